@@ -191,6 +191,7 @@ public:
     bool&
     data()
     {
+        invalidate_information();
         return mbBool;
     }
 
@@ -211,6 +212,7 @@ public:
     set_data(bool data)
     {
         mbBool = data;
+        invalidate_information();
         InformationData::set_timestamp();
     }
 
@@ -0,0 +1,161 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+/**
+ * @file CVFrame.hpp
+ * @brief Immutable, reference-counted image frame with copy-on-write.
+ *
+ * CVFrame is the unit that CVImageData and async workers share. Copying a
+ * CVFrame copies a cv::Mat header and bumps the buffer reference count; the
+ * pixels are never duplicated on handoff. Readers use mat(), which is const.
+ * A stage that has to write in place calls writable(), which clones only if
+ * another holder still references the buffer.
+ *
+ * **Why not clone on dispatch:**
+ * A 4K BGR frame is ~25 MB. Cloning it at every async stage costs a full
+ * memory pass per stage before any useful work is done, and most stages
+ * (blur, threshold, colour conversion, Hough, ...) only read their input.
+ *
+ * **Typical Usage:**
+ * @code
+ * // Producer side: hand the frame to a worker without copying
+ * CVFrame frame = mpCVImageInData->frame();
+ * QMetaObject::invokeMethod(worker, "process", Qt::QueuedConnection,
+ *                           Q_ARG(cv::Mat, frame.mat()));
+ *
+ * // Worker side: read-only kernels use the input directly
+ * cv::GaussianBlur(input, output, ksize, sigma);
+ *
+ * // In-place kernels detach first (clones only when shared)
+ * CVFrame::detach(input);
+ * cv::floodFill(input, seed, color);
+ * @endcode
+ *
+ * @see CVImageData::frame()
+ * @see PBAsyncDataModel::workerInput()
+ */
+
+#pragma once
+
+#include <utility>
+
+#include <opencv2/core/core.hpp>
+
+#include <QtCore/QMetaType>
+
+#include "CVImagePool.hpp"
+
+namespace CVDevLibrary
+{
+
+/**
+ * @class CVFrame
+ * @brief Shared, read-only view of a cv::Mat plus its FrameMetadata.
+ *
+ * Thread-safe to copy and read from any thread. The buffer lifetime is
+ * governed by OpenCV's atomic reference count, so a frame handed to a worker
+ * stays valid after the producing CVImageData moves on to the next frame.
+ */
+class CVFrame
+{
+public:
+    CVFrame() = default;
+
+    CVFrame(cv::Mat mat, FrameMetadata metadata = {})
+        : mMat(std::move(mat))
+        , mMetadata(std::move(metadata))
+    {}
+
+    /**
+     * @brief Read-only access to the pixels.
+     */
+    const cv::Mat &
+    mat() const
+    {
+        return mMat;
+    }
+
+    /**
+     * @brief Metadata of the frame (timestamp, frame id, producer).
+     */
+    const FrameMetadata &
+    metadata() const
+    {
+        return mMetadata;
+    }
+
+    bool
+    empty() const
+    {
+        return mMat.empty();
+    }
+
+    /**
+     * @brief True if another cv::Mat header references the same buffer.
+     */
+    bool
+    isShared() const
+    {
+        return isShared(mMat);
+    }
+
+    /**
+     * @brief Returns a matrix that is safe to modify in place.
+     *
+     * Detaches this frame from every other holder (cloning only if the buffer
+     * is shared) and returns the now-exclusive matrix.
+     */
+    cv::Mat &
+    writable()
+    {
+        detach(mMat);
+        return mMat;
+    }
+
+    /**
+     * @brief True if @p mat's buffer is referenced by more than one header.
+     *
+     * Headers over user-owned data (no UMatData) are treated as shared since
+     * their lifetime is not tracked.
+     */
+    static bool
+    isShared(const cv::Mat &mat)
+    {
+        if (mat.empty())
+            return false;
+        if (!mat.u)
+            return true;
+        return CV_XADD(&mat.u->refcount, 0) > 1;
+    }
+
+    /**
+     * @brief Makes @p mat exclusively owned, cloning only when shared.
+     *
+     * Call this before writing into a matrix received from another stage.
+     */
+    static void
+    detach(cv::Mat &mat)
+    {
+        if (isShared(mat))
+            mat = mat.clone();
+    }
+
+private:
+    cv::Mat mMat;
+    FrameMetadata mMetadata;
+};
+
+} // namespace CVDevLibrary
+
+Q_DECLARE_METATYPE(CVDevLibrary::CVFrame)
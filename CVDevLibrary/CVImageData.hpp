@@ -74,11 +74,13 @@
 #include <QtCore/QDateTime>
 #include <QtNodes/NodeData>
 
+#include "CVFrame.hpp"
 #include "CVImagePool.hpp"
 #include "InformationData.hpp"
 
 using QtNodes::NodeData;
 using QtNodes::NodeDataType;
+using CVDevLibrary::CVFrame;
 using CVDevLibrary::CVImagePool;
 using CVDevLibrary::FrameMetadata;
 
@@ -229,16 +231,19 @@ public:
      * // Update with new frame
      * cv::Mat frame = camera.read();
      * imageData->updateClone(frame, {});
-     * 
-     * // Update information display
-     * imageData->set_information();
+     *
+     * // Information text is rebuilt on demand
+     * QString text = imageData->info();
      * @endcode
      *
-     * @note Does not automatically call set_information()
+     * @note If the current buffer is still shared with a worker or downstream
+     *       frame, it is dropped rather than overwritten in place.
      */
     void
     updateClone(const cv::Mat &image, FrameMetadata metadata)
     {
+        if (CVFrame::isShared(mCVImage))
+            mCVImage.release();
         image.copyTo(mCVImage);
         mPoolHandle = {};
         assignMetadata(metadata);
@@ -274,11 +279,14 @@ public:
      * }
      * @endcode
      *
-     * @note Returns reference - modifications affect stored image
+     * @note Returns reference - modifications affect stored image. A frame that
+     *       was already emitted may be shared with a worker, a display or a
+     *       queued frame, so producers write through writable() or overwrite().
      */
     cv::Mat &
     data()
     {
+        invalidate_information();
         if (mPoolHandle)
             return mPoolHandle.matrix();
         return mCVImage;
@@ -292,6 +300,67 @@ public:
         return mCVImage;
     }
 
+    /**
+     * @brief Returns the image for modifying its pixels in place.
+     *
+     * Copy-on-write: if another holder (async worker, display, queued frame)
+     * still references the buffer, the image is cloned first and that holder
+     * keeps the frame it was given.
+     *
+     * **Example:**
+     * @code
+     * cv::Mat &image = mpCVImageData->writable();
+     * cv::circle(image, center, radius, color);
+     * @endcode
+     */
+    cv::Mat &
+    writable()
+    {
+        invalidate_information();
+        if (mPoolHandle)
+        {
+            mCVImage = mPoolHandle.matrix();
+            mPoolHandle = {};
+        }
+        CVFrame::detach(mCVImage);
+        return mCVImage;
+    }
+
+    /**
+     * @brief Returns the image for a write that replaces every pixel.
+     *
+     * Like writable(), but a shared buffer is released instead of cloned since
+     * the old pixels are not needed: the OpenCV output argument then allocates
+     * a fresh buffer. Use it for `cv::threshold(in, out->overwrite(), ...)`,
+     * `src.copyTo(out->overwrite())` and similar.
+     */
+    cv::Mat &
+    overwrite()
+    {
+        invalidate_information();
+        if (mPoolHandle || CVFrame::isShared(mCVImage))
+        {
+            mPoolHandle = {};
+            mCVImage.release();
+        }
+        return mCVImage;
+    }
+
+    /**
+     * @brief Returns a shared, read-only frame over the current image.
+     *
+     * No pixels are copied; the frame keeps the buffer alive after this
+     * CVImageData is updated or destroyed. Use it to hand the image to an
+     * async worker.
+     *
+     * @see CVFrame
+     */
+    CVFrame
+    frame() const
+    {
+        return CVFrame(data(), mMetadata);
+    }
+
     /**
      * @brief Legacy API: Updates the wrapped image (clone).
      *
@@ -349,6 +418,18 @@ public:
         return mMetadata;
     }
 
+    /**
+     * @brief Replaces the metadata without touching the image.
+     *
+     * Used by NodeDataSerializer to restore the producer's metadata of a
+     * frame received over a remote transport.
+     */
+    void
+    setMetadata(FrameMetadata metadata)
+    {
+        assignMetadata(std::move(metadata));
+    }
+
     /**
      * @brief Adopts a pooled frame handle (pool-aware producer path).
      *
@@ -431,7 +512,9 @@ public:
      * @brief Formats image information with channels, depth, and size.
      *
      * Overrides base class to provide Mat-specific formatting with
-     * channel count, depth type detection, and dimensions.
+     * channel count, depth type detection, and dimensions. Runs from info()
+     * the first time the text is requested after the image or metadata changed;
+     * frames that are never displayed are never formatted.
      *
      * **Output Format Examples:**
      * @code
@@ -473,7 +556,7 @@ public:
      */
     void set_information() override
     {
-        const cv::Mat &frame = data();
+        const cv::Mat &frame = static_cast<const CVImageData &>(*this).data();
         mQSData  = QString("Data Type\t : cv::Mat \n");
         if( !frame.empty() )
         {
@@ -500,6 +583,8 @@ public:
         {
             mQSData += "Producer\t : " + mMetadata.producerId + "\n";
             mQSData += "Frame ID\t : " + QString::number(mMetadata.frameId) + "\n";
+            if (!mMetadata.hops.empty())
+                mQSData += "Hops\t : " + QString::number(mMetadata.hops.size()) + "\n";
         }
     }
 
@@ -512,7 +597,7 @@ private:
             metadata.frameId = sFrameCounter.fetch_add(1, std::memory_order_relaxed);
         mMetadata = std::move(metadata);
         set_timestamp(mMetadata.timestamp);
-        set_information();
+        invalidate_information();
     }
 
     static std::atomic<long> sFrameCounter;
@@ -21,12 +21,13 @@
  * (e.g., display nodes, processing nodes) to reference those buffers without copying.
  *
  * **Key Features:**
- * - Lock-free ring buffer with atomic head/tail pointers
+ * - Lock-free bounded MPMC free list (sequence-numbered ring of slot pointers)
  * - Reference counting per slot for multi-consumer scenarios
  * - RAII handle (FrameHandle) for automatic slot release
  * - Frame metadata (timestamp, frameId, producerId) attached to each acquisition
  * - Switchable modes: PoolMode (zero-copy) vs BroadcastMode (legacy clone)
- * - Automatic fallback logging when pool is exhausted
+ * - Exhaustion policies: Block (park with deadline), DropNewest, OverwriteOldest
+ * - Per-pool counters (exhaustion, waits, timeouts, drops) via stats()
  *
  * **Typical Usage (Producer):**
  * @code
@@ -61,15 +62,17 @@
  * @endcode
  *
  * **Thread Safety:**
- * - Multiple producers can acquire slots concurrently (lock-free ring buffer)
+ * - Multiple producers can acquire slots concurrently (lock-free free list)
  * - Multiple consumers can hold references to different slots
  * - Reference counting ensures slots are released only when all consumers finish
  * - Mode switching (PoolMode ↔ BroadcastMode) is thread-safe via atomic
  *
  * **Performance Characteristics:**
- * - Acquisition: O(1) when pool not exhausted, O(pool_size) worst-case with yielding
- * - Release: O(1) atomic decrement
- * - Zero memory allocation after pool creation
+ * - Acquisition: O(1) lock-free when a slot is free
+ * - Exhausted pool: producer parks on a wait condition (no spinning) until a
+ *   slot is released, the deadline expires, or the pool shuts down
+ * - Release: O(1) CAS; takes the wait mutex only when a producer is parked
+ * - Zero memory allocation after pool creation (except OverwriteOldest evictions)
  * - Cache-friendly: pre-allocated cv::Mat buffers reused across frames
  *
  * @see CVImageData for the wrapper that holds FrameHandle
@@ -79,15 +82,20 @@
 
 #pragma once
 
+#include "CVMatArena.hpp"
 #include "DebugLogging.hpp"
 
 #include <opencv2/core/core.hpp>
 
+#include <QtCore/QDeadlineTimer>
 #include <QtCore/QThread>
 #include <QtCore/QString>
 #include <QtCore/QMutex>
+#include <QtCore/QWaitCondition>
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -106,33 +114,128 @@ namespace CVDevLibrary
  */
 enum class FrameSharingMode { PoolMode, BroadcastMode };
 
+/**
+ * @enum PoolExhaustionPolicy
+ * @brief What `CVImagePool::acquire()` does when every slot is held downstream.
+ *
+ * - **Block**: Park the producer (no spinning) until a slot is released or the
+ *   acquire timeout expires. On timeout an empty handle is returned and the
+ *   producer falls back to an owned allocation.
+ * - **DropNewest**: Return an empty handle immediately. The newest frame does not
+ *   get a pool slot; the producer decides whether to drop it or fall back.
+ * - **OverwriteOldest**: Evict the slot that was acquired longest ago. Its current
+ *   holders keep their buffer (detached from the pool) and the slot is re-armed
+ *   with a fresh buffer for the new frame, so the producer never waits.
+ */
+enum class PoolExhaustionPolicy { Block, DropNewest, OverwriteOldest };
+
+/**
+ * @struct FrameHop
+ * @brief One remote transport link a frame crossed.
+ *
+ * Times are wall-clock microseconds of the publishing and the receiving host
+ * respectively, so their difference includes the clock offset between hosts.
+ * @see PBLinkStats, which estimates that offset
+ */
+struct FrameHop
+{
+    static constexpr int MaxHops = 16;   ///< Older hops are dropped when a frame is republished
+
+    QString hostId;          ///< Computer ID of the publishing bridge
+    uint64_t sequence{0};    ///< Per-link publish counter, used to detect loss
+    int64_t publishUs{0};    ///< Publisher wall clock when the payload was handed to the transport
+    int64_t receiveUs{0};    ///< Receiver wall clock when the payload arrived; 0 while in flight
+
+    /**
+     * @brief Wall-clock microseconds since epoch.
+     */
+    static int64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+};
+
 /**
  * @struct FrameMetadata
  * @brief Metadata attached to each acquired frame for tracing and debugging.
  *
  * Automatically populated by producer nodes and propagated through the dataflow graph.
- * Used in property browser display and log correlation.
+ * Used in property browser display and log correlation. Zenoh and CycloneDDS
+ * carry it across hosts (see NodeDataSerializer, frame trace extension), adding
+ * one FrameHop per link.
  */
 struct FrameMetadata
 {
     long timestamp{0};      ///< Milliseconds since epoch (QDateTime::currentMSecsSinceEpoch)
     long frameId{0};        ///< Monotonically increasing frame counter per producer
     QString producerId;     ///< Node ID (getNodeId()) of the producer that emitted this frame
+    std::vector<FrameHop> hops;  ///< Remote links crossed so far, oldest first
+};
+
+/**
+ * @struct PoolStats
+ * @brief Snapshot of a pool's acquisition counters.
+ *
+ * Distinguishes starvation (high `exhausted`/`waitTimeouts`, producer outruns the
+ * pool size) from slow consumers (high `waits` with large `waitMicros` but few
+ * timeouts, slots do come back but late).
+ */
+struct PoolStats
+{
+    uint64_t acquired{0};           ///< Slots handed out (free list, wait or eviction)
+    uint64_t exhausted{0};          ///< acquire() calls that found the free list empty
+    uint64_t waits{0};              ///< acquire() calls that parked under the Block policy
+    uint64_t waitTimeouts{0};       ///< Parked acquires that hit the deadline
+    uint64_t waitMicros{0};         ///< Total time spent parked, in microseconds
+    uint64_t droppedNewest{0};      ///< Empty handles returned under DropNewest
+    uint64_t overwritten{0};        ///< Slots evicted under OverwriteOldest
+    uint64_t broadcastFallbacks{0}; ///< Empty handles returned because of BroadcastMode
+
+    PoolStats &operator+=(PoolStats const &other)
+    {
+        acquired += other.acquired;
+        exhausted += other.exhausted;
+        waits += other.waits;
+        waitTimeouts += other.waitTimeouts;
+        waitMicros += other.waitMicros;
+        droppedNewest += other.droppedNewest;
+        overwritten += other.overwritten;
+        broadcastFallbacks += other.broadcastFallbacks;
+        return *this;
+    }
 };
 
 /**
  * @class CVImagePool
- * @brief Lock-free ring buffer pool for sharing cv::Mat frames between nodes.
+ * @brief Lock-free pool for sharing cv::Mat frames between nodes.
  *
  * Maintains a fixed-size pool of pre-allocated cv::Mat buffers. Producers acquire
  * slots via `acquire()`, write frame data into the buffer, and pass ownership via
  * a `FrameHandle`. Consumers reference the buffer through `CVImageData::data()` and
  * the slot is automatically released when all references are dropped.
  *
+ * Free slots live in a bounded multi-producer/multi-consumer ring (one sequence
+ * number per cell), so acquire and release never take a lock on the fast path.
+ * A mutex/wait-condition pair is used only to park producers when the pool is
+ * exhausted under the Block policy.
+ *
+ * **Shape Polymorphism:**
+ * Slot buffers come from CVMatArena. The width/height/type given at construction
+ * only pre-warm the slots; a producer may write any shape or type into
+ * `handle.matrix()`. OpenCV then reallocates that slot through the arena, which
+ * hands back a recycled buffer of the same size class, and the slot keeps the new
+ * buffer when it is released. The pool therefore does not need to be rebuilt
+ * when frame geometry changes.
+ *
+ * Pools must be owned by a std::shared_ptr (std::make_shared); each FrameHandle
+ * keeps its pool alive so a node can drop or replace its pool while frames are
+ * still in flight downstream.
+ *
  * **Design Rationale:**
  * - Eliminates frame cloning overhead in high-throughput pipelines (e.g., 30+ FPS video)
  * - Supports multi-consumer scenarios (e.g., one video source feeding display + recorder)
- * - Provides graceful degradation when pool is exhausted (automatic fallback + logging)
+ * - Provides graceful degradation when pool is exhausted (policy + fallback + counters)
  * - Integrates with existing CVImageData API via optional FrameHandle member
  *
  * **Lifecycle:**
@@ -165,23 +268,28 @@ struct FrameMetadata
  *
  * @see FrameHandle for RAII slot management
  * @see FrameMetadata for per-frame tracking data
+ * @see PoolExhaustionPolicy for behaviour when every slot is in use
  */
-class CVImagePool
+class CVImagePool : public std::enable_shared_from_this<CVImagePool>
 {
 public:
     static constexpr size_t DefaultPoolSize = 10;
+    static constexpr int DefaultAcquireTimeoutMs = 200;
 
     /**
      * @struct PooledFrame
-     * @brief Single slot in the ring buffer holding a cv::Mat and its reference count.
+     * @brief Single pool slot holding a cv::Mat and its packed ownership state.
      *
      * Each slot is pre-allocated during pool construction and reused across frames.
-     * The refCount tracks how many consumers currently hold references to this slot.
+     * `state` packs a 32-bit generation (high word) with the reference count (low
+     * word) so that a release and an OverwriteOldest eviction can never both win
+     * the same slot: whichever CAS lands first owns it.
      */
     struct PooledFrame
     {
-        cv::Mat mat;                 ///< Pre-allocated OpenCV matrix buffer
-        std::atomic<int> refCount{0}; ///< Number of active FrameHandle references
+        cv::Mat mat;                        ///< Pre-allocated OpenCV matrix buffer
+        std::atomic<uint64_t> state{0};     ///< (generation << 32) | refCount
+        std::atomic<uint64_t> acquireSeq{0};///< Pool-wide acquisition order, used to find the oldest slot
     };
 
     /**
@@ -191,6 +299,13 @@ public:
      * Automatically releases the slot back to the pool when the handle destructs.
      * Move-only type to enforce single ownership semantics.
      *
+     * The handle holds a reference on its pool, so the slot can always be
+     * returned even if the owning node has already replaced the pool.
+     *
+     * The handle keeps its own cv::Mat header onto the slot buffer. If the slot is
+     * evicted under OverwriteOldest, this header keeps the old buffer alive and the
+     * release becomes a no-op for the pool.
+     *
      * **Lifetime:**
      * - Created by `CVImagePool::acquire()`
      * - Moved into `CVImageData::adoptPoolFrame()`
@@ -216,18 +331,20 @@ public:
         ~FrameHandle();
 
         explicit operator bool() const { return mSlot != nullptr; }
-        cv::Mat &matrix() { return mSlot->mat; }
-        const cv::Mat &matrix() const { return mSlot->mat; }
+        cv::Mat &matrix() { return mMat; }
+        const cv::Mat &matrix() const { return mMat; }
         FrameMetadata const &metadata() const { return mMetadata; }
 
     private:
         friend class CVImagePool;
 
-        FrameHandle(CVImagePool *pool, PooledFrame *slot, FrameMetadata metadata);
+        FrameHandle(std::shared_ptr<CVImagePool> pool, PooledFrame *slot, uint32_t generation, cv::Mat mat, FrameMetadata metadata);
         void release();
 
-        CVImagePool *mPool{nullptr};
+        std::shared_ptr<CVImagePool> mPool;
         PooledFrame *mSlot{nullptr};
+        uint32_t muGeneration{0};
+        cv::Mat mMat;
         FrameMetadata mMetadata;
     };
 
@@ -240,7 +357,9 @@ public:
      * @param type OpenCV matrix type (e.g., CV_8UC3 for BGR)
      * @param poolSize Number of slots to allocate (default: 10)
      *
-     * All slots are allocated immediately to avoid runtime allocation overhead.
+     * All slots are allocated immediately (from CVMatArena) to avoid runtime
+     * allocation overhead. width/height/type are a warm-up hint only; a
+     * non-positive size leaves the slots empty until the first write.
      */
     CVImagePool(QString ownerId,
                 int width,
@@ -248,6 +367,9 @@ public:
                 int type,
                 size_t poolSize = DefaultPoolSize);
 
+    CVImagePool(CVImagePool const &) = delete;
+    CVImagePool &operator=(CVImagePool const &) = delete;
+
     /**
      * @brief Returns the current sharing mode.
      * @return PoolMode or BroadcastMode
@@ -258,11 +380,33 @@ public:
      * @brief Switches between pool and broadcast modes.
      * @param mode New mode to activate
      *
-     * Thread-safe; can be called while acquire() is in progress.
+     * Thread-safe; can be called while acquire() is in progress. Producers parked
+     * in acquire() are woken so a switch to BroadcastMode takes effect immediately.
      * Typically triggered by user changing "Sharing Mode" property in UI.
      */
     void setMode(FrameSharingMode mode);
 
+    /**
+     * @brief Returns the policy applied when the pool is exhausted.
+     */
+    PoolExhaustionPolicy exhaustionPolicy() const { return mPolicy.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Sets the policy applied when the pool is exhausted.
+     */
+    void setExhaustionPolicy(PoolExhaustionPolicy policy) { mPolicy.store(policy, std::memory_order_release); }
+
+    /**
+     * @brief Returns the maximum time (ms) a Block-policy acquire stays parked.
+     */
+    int acquireTimeoutMs() const { return miAcquireTimeoutMs.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Sets the maximum time (ms) a Block-policy acquire stays parked.
+     * @param timeoutMs Deadline in milliseconds; 0 makes Block behave like DropNewest
+     */
+    void setAcquireTimeoutMs(int timeoutMs) { miAcquireTimeoutMs.store(timeoutMs < 0 ? 0 : timeoutMs, std::memory_order_release); }
+
     /**
      * @brief Acquires a slot from the pool for a new frame.
      *
@@ -271,34 +415,83 @@ public:
      * @return FrameHandle (empty if pool exhausted or in BroadcastMode)
      *
      * **Behavior:**
-     * - PoolMode: Attempts to acquire next available slot from ring buffer
+     * - PoolMode: Pops the next free slot from the lock-free free list
      *   - Success: Returns handle with refCount set to consumerCount
-     *   - Failure: Yields and retries until mode changes or slot available
-     *   - Logs warning if forced to broadcast due to exhaustion
+     *   - Free list empty: applies the exhaustion policy (see PoolExhaustionPolicy)
      * - BroadcastMode: Immediately returns empty handle and logs fallback
      *
      * **Thread Safety:**
-     * Lock-free atomic operations on head/tail pointers ensure multiple
-     * producers can acquire concurrently without contention.
+     * Lock-free on the fast path; multiple producers can acquire concurrently.
      *
-     * @note Blocks with yielding if pool is full; ensure poolSize ≥ pipeline depth
+     * @note consumerCount is the number of FrameHandle releases required before the
+     *       slot returns to the pool. Since FrameHandle is move-only, pass 1 unless
+     *       the slot is released through another path.
      */
     FrameHandle acquire(size_t consumerCount, FrameMetadata metadata);
 
+    /**
+     * @brief Returns a snapshot of this pool's acquisition counters.
+     */
+    PoolStats stats() const;
+
+    /**
+     * @brief Returns the owner node ID passed at construction.
+     */
+    QString const &ownerId() const { return mOwnerId; }
+
     /**
      * @brief Mark the pool as shutting down to abort any pending acquire blocks.
      */
-    void shutdown() { mShuttingDown.store(true, std::memory_order_release); }
+    void shutdown();
 
 private:
+    /**
+     * @struct FreeCell
+     * @brief One cell of the bounded MPMC free list.
+     *
+     * `sequence` tells producers and consumers of the free list whether the cell
+     * is ready to be written or read, which avoids ABA without a lock.
+     */
+    struct FreeCell
+    {
+        std::atomic<size_t> sequence{0};
+        PooledFrame *slot{nullptr};
+    };
+
+    static constexpr uint64_t RefCountMask = 0xffffffffull;
+
+    static uint32_t generationOf(uint64_t state) { return static_cast<uint32_t>(state >> 32); }
+    static uint32_t refCountOf(uint64_t state) { return static_cast<uint32_t>(state & RefCountMask); }
+    static uint64_t packState(uint32_t generation, uint32_t refCount)
+    {
+        return (static_cast<uint64_t>(generation) << 32) | refCount;
+    }
+
+    /// Pushes a slot onto the free list. Never fails: capacity >= pool size.
+    void pushFree(PooledFrame *slot);
+
+    /// Pops a slot from the free list, or nullptr if the list is empty.
+    PooledFrame *popFree();
+
+    /// Arms a slot popped from the free list and wraps it in a handle.
+    FrameHandle armSlot(PooledFrame *slot, size_t consumerCount, FrameMetadata metadata);
+
+    /// Parks until a slot is released, the deadline expires or the pool shuts down.
+    PooledFrame *waitForFreeSlot();
+
+    /// Evicts the oldest in-flight slot (OverwriteOldest); nullptr if none could be taken.
+    FrameHandle reclaimOldest(size_t consumerCount, FrameMetadata &metadata);
+
     /**
      * @brief Internal helper: releases a slot back to the pool.
      * @param slot Pointer to the slot being released
+     * @param generation Generation the handle was armed with
+     * @param mat The handle's header onto the slot buffer
      *
      * Decrements refCount; when it reaches zero, pushes the slot onto
-     * the free list to make it available for reuse.
+     * the free list and wakes one parked producer, if any.
      */
-    void releaseSlot(PooledFrame *slot);
+    void releaseSlot(PooledFrame *slot, uint32_t generation, cv::Mat &mat);
 
     /**
      * @brief Logs a warning when pool exhaustion forces broadcast mode.
@@ -311,32 +504,56 @@ private:
     const QString mOwnerId;              ///< Node ID for logging
     const size_t mPoolSize;              ///< Fixed number of slots
     std::vector<PooledFrame> mSlots;     ///< Pre-allocated frame buffers
-    mutable QMutex mMutex;               ///< Mutex for thread-safe access to the free list
-    std::vector<PooledFrame*> mFreeSlots;///< List of available slots
+    std::vector<FreeCell> mFreeCells;    ///< Bounded MPMC ring of free slot pointers
+    size_t mFreeMask{0};                 ///< mFreeCells.size() - 1 (power of two)
+    std::atomic<size_t> mFreeHead{0};    ///< Next cell to pop
+    std::atomic<size_t> mFreeTail{0};    ///< Next cell to push
+    std::atomic<uint64_t> mAcquireSeq{0};///< Source of PooledFrame::acquireSeq
+
+    mutable QMutex mWaitMutex;           ///< Guards parking and OverwriteOldest evictions
+    QWaitCondition mSlotReleased;        ///< Signalled when a slot returns and a producer is parked
+    std::atomic<int> miWaiters{0};       ///< Number of producers parked in waitForFreeSlot()
+
     std::atomic<FrameSharingMode> mMode{FrameSharingMode::PoolMode}; ///< Current mode
+    std::atomic<PoolExhaustionPolicy> mPolicy{PoolExhaustionPolicy::Block}; ///< Exhaustion policy
+    std::atomic<int> miAcquireTimeoutMs{DefaultAcquireTimeoutMs}; ///< Block-policy deadline
     std::atomic<bool> mShuttingDown{false}; ///< True if the pool is shutting down
+
+    std::atomic<uint64_t> muAcquired{0};
+    std::atomic<uint64_t> muExhausted{0};
+    std::atomic<uint64_t> muWaits{0};
+    std::atomic<uint64_t> muWaitTimeouts{0};
+    std::atomic<uint64_t> muWaitMicros{0};
+    std::atomic<uint64_t> muDroppedNewest{0};
+    std::atomic<uint64_t> muOverwritten{0};
+    std::atomic<uint64_t> muBroadcastFallbacks{0};
 };
 
 // ========================================================================
 // FrameHandle Implementation (inline for header-only convenience)
 // ========================================================================
 
-inline CVImagePool::FrameHandle::FrameHandle(CVImagePool *pool,
+inline CVImagePool::FrameHandle::FrameHandle(std::shared_ptr<CVImagePool> pool,
                                              PooledFrame *slot,
+                                             uint32_t generation,
+                                             cv::Mat mat,
                                              FrameMetadata metadata)
-    : mPool(pool)
+    : mPool(std::move(pool))
     , mSlot(slot)
+    , muGeneration(generation)
+    , mMat(std::move(mat))
     , mMetadata(std::move(metadata))
 {
 }
 
 inline CVImagePool::FrameHandle::FrameHandle(FrameHandle &&other) noexcept
-    : mPool(other.mPool)
+    : mPool(std::move(other.mPool))
     , mSlot(other.mSlot)
+    , muGeneration(other.muGeneration)
+    , mMat(std::move(other.mMat))
     , mMetadata(std::move(other.mMetadata))
 {
     other.mSlot = nullptr;
-    other.mPool = nullptr;
 }
 
 inline CVImagePool::FrameHandle &CVImagePool::FrameHandle::operator=(FrameHandle &&other) noexcept
@@ -344,11 +561,12 @@ inline CVImagePool::FrameHandle &CVImagePool::FrameHandle::operator=(FrameHandle
     if (this != &other)
     {
         release();
-        mPool = other.mPool;
+        mPool = std::move(other.mPool);
         mSlot = other.mSlot;
+        muGeneration = other.muGeneration;
+        mMat = std::move(other.mMat);
         mMetadata = std::move(other.mMetadata);
         other.mSlot = nullptr;
-        other.mPool = nullptr;
     }
     return *this;
 }
@@ -362,10 +580,11 @@ inline void CVImagePool::FrameHandle::release()
 {
     if (mSlot && mPool)
     {
-        mPool->releaseSlot(mSlot);
-        mSlot = nullptr;
-        mPool = nullptr;
+        mPool->releaseSlot(mSlot, muGeneration, mMat);
     }
+    mMat.release();
+    mSlot = nullptr;
+    mPool.reset();
 }
 
 // ========================================================================
@@ -381,14 +600,19 @@ inline CVImagePool::CVImagePool(QString ownerId,
     , mPoolSize(poolSize == 0 ? 1 : poolSize)
     , mSlots(mPoolSize)
 {
-    if (width > 0 && height > 0)
+    size_t capacity = 2;
+    while (capacity < mPoolSize)
+        capacity <<= 1;
+    mFreeCells = std::vector<FreeCell>(capacity);
+    mFreeMask = capacity - 1;
+    for (size_t i = 0; i < capacity; ++i)
+        mFreeCells[i].sequence.store(i, std::memory_order_relaxed);
+
+    CVMatArena &arena = CVMatArena::instance();
+    for (auto &slot : mSlots)
     {
-        mFreeSlots.reserve(mPoolSize);
-        for (auto &slot : mSlots)
-        {
-            slot.mat = cv::Mat(height, width, type);
-            mFreeSlots.push_back(&slot);
-        }
+        slot.mat = arena.create(height, width, type);
+        pushFree(&slot);
     }
 }
 
@@ -400,6 +624,88 @@ inline FrameSharingMode CVImagePool::mode() const
 inline void CVImagePool::setMode(FrameSharingMode mode)
 {
     mMode.store(mode, std::memory_order_release);
+    if (miWaiters.load(std::memory_order_acquire) > 0)
+    {
+        QMutexLocker locker(&mWaitMutex);
+        mSlotReleased.wakeAll();
+    }
+}
+
+inline void CVImagePool::shutdown()
+{
+    mShuttingDown.store(true, std::memory_order_release);
+    QMutexLocker locker(&mWaitMutex);
+    mSlotReleased.wakeAll();
+}
+
+inline void CVImagePool::pushFree(PooledFrame *slot)
+{
+    size_t pos = mFreeTail.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        FreeCell &cell = mFreeCells[pos & mFreeMask];
+        const size_t seq = cell.sequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0)
+        {
+            if (mFreeTail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.slot = slot;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return;
+            }
+        }
+        else
+        {
+            // Cell not yet consumed by a concurrent pop (diff < 0 cannot persist
+            // because capacity >= pool size) or another pusher moved the tail.
+            pos = mFreeTail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+inline CVImagePool::PooledFrame *CVImagePool::popFree()
+{
+    size_t pos = mFreeHead.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        FreeCell &cell = mFreeCells[pos & mFreeMask];
+        const size_t seq = cell.sequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0)
+        {
+            if (mFreeHead.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                PooledFrame *slot = cell.slot;
+                cell.sequence.store(pos + mFreeMask + 1, std::memory_order_release);
+                return slot;
+            }
+        }
+        else if (diff < 0)
+        {
+            return nullptr;
+        }
+        else
+        {
+            pos = mFreeHead.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+inline CVImagePool::FrameHandle CVImagePool::armSlot(PooledFrame *slot,
+                                                     size_t consumerCount,
+                                                     FrameMetadata metadata)
+{
+    // The slot came off the free list, so this thread owns it exclusively until
+    // the armed state is published; take the buffer header before that point
+    // because an OverwriteOldest eviction may swap slot->mat afterwards.
+    cv::Mat mat = slot->mat;
+    const uint32_t generation = generationOf(slot->state.load(std::memory_order_relaxed)) + 1;
+    slot->acquireSeq.store(mAcquireSeq.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+    slot->state.store(packState(generation, static_cast<uint32_t>(consumerCount == 0 ? 1 : consumerCount)),
+                      std::memory_order_release);
+    muAcquired.fetch_add(1, std::memory_order_relaxed);
+    return FrameHandle(shared_from_this(), slot, generation, std::move(mat), std::move(metadata));
 }
 
 inline CVImagePool::FrameHandle CVImagePool::acquire(size_t consumerCount,
@@ -410,57 +716,198 @@ inline CVImagePool::FrameHandle CVImagePool::acquire(size_t consumerCount,
         return FrameHandle();
     }
 
-    FrameSharingMode currentMode = mode();
-    if (currentMode == FrameSharingMode::BroadcastMode)
+    if (mode() == FrameSharingMode::BroadcastMode)
     {
+        muBroadcastFallbacks.fetch_add(1, std::memory_order_relaxed);
         logBroadcastFallback();
         return FrameHandle();
     }
 
-    PooledFrame* slot = nullptr;
-    while (true)
+    if (PooledFrame *slot = popFree())
     {
-        if (mShuttingDown.load(std::memory_order_acquire))
-        {
-            return FrameHandle();
-        }
+        return armSlot(slot, consumerCount, std::move(metadata));
+    }
+
+    muExhausted.fetch_add(1, std::memory_order_relaxed);
+
+    switch (exhaustionPolicy())
+    {
+    case PoolExhaustionPolicy::DropNewest:
+        muDroppedNewest.fetch_add(1, std::memory_order_relaxed);
+        return FrameHandle();
+
+    case PoolExhaustionPolicy::OverwriteOldest:
+    {
+        FrameHandle handle = reclaimOldest(consumerCount, metadata);
+        if (handle)
+            return handle;
+        // Every slot was released or evicted under us; the free list is the
+        // place to look again.
+        if (PooledFrame *slot = popFree())
+            return armSlot(slot, consumerCount, std::move(metadata));
+        muDroppedNewest.fetch_add(1, std::memory_order_relaxed);
+        return FrameHandle();
+    }
 
-        if (currentMode != FrameSharingMode::PoolMode)
+    case PoolExhaustionPolicy::Block:
+    default:
+        break;
+    }
+
+    if (PooledFrame *slot = waitForFreeSlot())
+    {
+        return armSlot(slot, consumerCount, std::move(metadata));
+    }
+
+    if (!mShuttingDown.load(std::memory_order_acquire) && mode() == FrameSharingMode::PoolMode)
+    {
+        logBroadcastFallback();
+    }
+    return FrameHandle();
+}
+
+inline CVImagePool::PooledFrame *CVImagePool::waitForFreeSlot()
+{
+    const int timeoutMs = acquireTimeoutMs();
+    if (timeoutMs <= 0)
+    {
+        muWaitTimeouts.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    muWaits.fetch_add(1, std::memory_order_relaxed);
+    const auto started = std::chrono::steady_clock::now();
+    QDeadlineTimer deadline(timeoutMs);
+
+    // Announce the waiter before re-checking the free list so that a release
+    // racing with us either sees miWaiters > 0 or its push is visible to popFree().
+    miWaiters.fetch_add(1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    PooledFrame *slot = nullptr;
+    bool timedOut = false;
+    {
+        QMutexLocker locker(&mWaitMutex);
+        for (;;)
         {
-            logBroadcastFallback();
-            return FrameHandle();
+            if (mShuttingDown.load(std::memory_order_acquire) ||
+                mode() != FrameSharingMode::PoolMode)
+                break;
+            slot = popFree();
+            if (slot)
+                break;
+            if (!mSlotReleased.wait(&mWaitMutex, deadline))
+            {
+                slot = popFree();
+                timedOut = (slot == nullptr);
+                break;
+            }
         }
+    }
+
+    miWaiters.fetch_sub(1, std::memory_order_release);
+
+    const auto waited = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - started).count();
+    muWaitMicros.fetch_add(static_cast<uint64_t>(waited), std::memory_order_relaxed);
+    if (timedOut)
+        muWaitTimeouts.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
 
+inline CVImagePool::FrameHandle CVImagePool::reclaimOldest(size_t consumerCount,
+                                                           FrameMetadata &metadata)
+{
+    // Evictions are rare and must not race each other while the evicted slot's
+    // buffer is swapped, so they are serialized on the wait mutex.
+    QMutexLocker locker(&mWaitMutex);
+    for (size_t attempt = 0; attempt < mPoolSize; ++attempt)
+    {
+        PooledFrame *oldest = nullptr;
+        uint64_t oldestState = 0;
+        uint64_t oldestSeq = 0;
+        for (auto &slot : mSlots)
         {
-            QMutexLocker locker(&mMutex);
-            if (!mFreeSlots.empty())
+            const uint64_t state = slot.state.load(std::memory_order_acquire);
+            if (refCountOf(state) == 0)
+                continue;
+            const uint64_t seq = slot.acquireSeq.load(std::memory_order_relaxed);
+            if (!oldest || seq < oldestSeq)
             {
-                slot = mFreeSlots.back();
-                mFreeSlots.pop_back();
+                oldest = &slot;
+                oldestState = state;
+                oldestSeq = seq;
             }
         }
+        if (!oldest)
+            return FrameHandle();
 
-        if (slot)
+        const uint32_t generation = generationOf(oldestState) + 1;
+        const uint64_t armed = packState(generation, static_cast<uint32_t>(consumerCount == 0 ? 1 : consumerCount));
+        if (oldest->state.compare_exchange_strong(oldestState, armed, std::memory_order_acq_rel))
         {
-            slot->refCount.store(static_cast<int>(consumerCount), std::memory_order_release);
-            return FrameHandle(this, slot, std::move(metadata));
+            // Current holders keep the old buffer alive through their own header.
+            oldest->mat = CVMatArena::instance().create(oldest->mat.rows, oldest->mat.cols, oldest->mat.type());
+            oldest->acquireSeq.store(mAcquireSeq.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+            muOverwritten.fetch_add(1, std::memory_order_relaxed);
+            muAcquired.fetch_add(1, std::memory_order_relaxed);
+            return FrameHandle(shared_from_this(), oldest, generation, oldest->mat, std::move(metadata));
         }
-
-        QThread::yieldCurrentThread();
-        currentMode = mode();
     }
+    return FrameHandle();
 }
 
-inline void CVImagePool::releaseSlot(PooledFrame *slot)
+inline void CVImagePool::releaseSlot(PooledFrame *slot, uint32_t generation, cv::Mat &mat)
 {
     if (!slot)
         return;
 
-    if (slot->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    uint64_t state = slot->state.load(std::memory_order_acquire);
+    for (;;)
     {
-        QMutexLocker locker(&mMutex);
-        mFreeSlots.push_back(slot);
+        // Slot was evicted (OverwriteOldest) and re-armed for someone else.
+        if (generationOf(state) != generation || refCountOf(state) == 0)
+            return;
+        const uint64_t next = state - 1;
+        if (slot->state.compare_exchange_weak(state, next, std::memory_order_acq_rel))
+        {
+            if (refCountOf(next) != 0)
+                return;
+            break;
+        }
     }
+
+    // Last reference: this thread owns the slot until it is back on the free list.
+    // Keep any reallocation the producer did (e.g. cv::resize into a new size).
+    if (!mat.empty() && mat.data != slot->mat.data)
+        slot->mat = mat;
+    // Frames are handed to workers without cloning, so a downstream stage may
+    // still hold the buffer (refs beyond the slot and this handle). Leave that
+    // buffer to its readers and recycle the slot with fresh arena storage.
+    if (slot->mat.u && CV_XADD(&slot->mat.u->refcount, 0) > 2)
+        slot->mat = CVMatArena::instance().create(slot->mat.rows, slot->mat.cols, slot->mat.type());
+    pushFree(slot);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (miWaiters.load(std::memory_order_relaxed) > 0)
+    {
+        QMutexLocker locker(&mWaitMutex);
+        mSlotReleased.wakeOne();
+    }
+}
+
+inline PoolStats CVImagePool::stats() const
+{
+    PoolStats s;
+    s.acquired = muAcquired.load(std::memory_order_relaxed);
+    s.exhausted = muExhausted.load(std::memory_order_relaxed);
+    s.waits = muWaits.load(std::memory_order_relaxed);
+    s.waitTimeouts = muWaitTimeouts.load(std::memory_order_relaxed);
+    s.waitMicros = muWaitMicros.load(std::memory_order_relaxed);
+    s.droppedNewest = muDroppedNewest.load(std::memory_order_relaxed);
+    s.overwritten = muOverwritten.load(std::memory_order_relaxed);
+    s.broadcastFallbacks = muBroadcastFallbacks.load(std::memory_order_relaxed);
+    return s;
 }
 
 inline void CVImagePool::logBroadcastFallback() const
@@ -0,0 +1,234 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+/**
+ * @file CVMatArena.cpp
+ * @brief Implementation of the size-class cv::Mat buffer arena.
+ */
+
+#include "CVMatArena.hpp"
+
+#include <algorithm>
+
+namespace CVDevLibrary
+{
+
+/**
+ * @brief cv::MatAllocator that routes large buffers through CVMatArena.
+ *
+ * Mirrors OpenCV's StdMatAllocator except for where the bytes come from.
+ */
+class CVMatArena::Allocator : public cv::MatAllocator
+{
+public:
+    explicit Allocator(CVMatArena *arena) : mpArena(arena) {}
+
+    cv::UMatData *allocate(int dims, const int *sizes, int type,
+                           void *data0, size_t *step,
+                           cv::AccessFlag, cv::UMatUsageFlags) const override
+    {
+        size_t total = CV_ELEM_SIZE(type);
+        for (int i = dims - 1; i >= 0; i--)
+        {
+            if (step)
+            {
+                if (data0 && step[i] != CV_AUTOSTEP)
+                {
+                    CV_Assert(total <= step[i]);
+                    total = step[i];
+                }
+                else
+                {
+                    step[i] = total;
+                }
+            }
+            total *= sizes[i];
+        }
+
+        uchar *data = data0 ? static_cast<uchar *>(data0) : mpArena->take(total);
+        cv::UMatData *u = new cv::UMatData(this);
+        u->data = u->origdata = data;
+        u->size = total;
+        if (data0)
+            u->flags |= cv::UMatData::USER_ALLOCATED;
+        return u;
+    }
+
+    bool allocate(cv::UMatData *u, cv::AccessFlag, cv::UMatUsageFlags) const override
+    {
+        return u != nullptr;
+    }
+
+    void deallocate(cv::UMatData *u) const override
+    {
+        if (!u)
+            return;
+
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        if (!(u->flags & cv::UMatData::USER_ALLOCATED))
+        {
+            mpArena->give(u->origdata, u->size);
+            u->origdata = nullptr;
+        }
+        delete u;
+    }
+
+private:
+    CVMatArena *mpArena;
+};
+
+CVMatArena &CVMatArena::instance()
+{
+    static CVMatArena *sInstance = new CVMatArena();
+    return *sInstance;
+}
+
+CVMatArena::CVMatArena()
+    : mpAllocator(new Allocator(this))
+{
+    mStats.capacityBytes = DefaultCapacityBytes;
+}
+
+cv::MatAllocator *CVMatArena::allocator() const
+{
+    return mpAllocator;
+}
+
+cv::Mat CVMatArena::create(int rows, int cols, int type) const
+{
+    cv::Mat mat;
+    mat.allocator = mpAllocator;
+    if (rows > 0 && cols > 0)
+        mat.create(rows, cols, type);
+    return mat;
+}
+
+size_t CVMatArena::sizeClassFor(size_t bytes)
+{
+    if (bytes < MinPooledBytes)
+        return bytes;
+
+    // Four classes per power of two: 2^k * {4, 5, 6, 7} / 4.
+    size_t power = 1;
+    while ((power << 1) <= bytes)
+        power <<= 1;
+    const size_t quarter = power / 4;
+    for (size_t step = 4; step <= 8; ++step)
+    {
+        const size_t candidate = quarter * step;
+        if (candidate >= bytes)
+            return candidate;
+    }
+    return power << 1;
+}
+
+uchar *CVMatArena::take(size_t bytes)
+{
+    const size_t sizeClass = sizeClassFor(bytes);
+    if (bytes < MinPooledBytes)
+    {
+        miBypassed.fetch_add(1, std::memory_order_relaxed);
+        return static_cast<uchar *>(cv::fastMalloc(bytes));
+    }
+
+    {
+        QMutexLocker locker(&mMutex);
+        auto it = mFreeBySize.find(sizeClass);
+        if (it != mFreeBySize.end() && !it->second.empty())
+        {
+            // Most recently returned buffer is the most likely to still be cache-warm.
+            auto lruIt = it->second.back();
+            it->second.pop_back();
+            uchar *data = lruIt->data;
+            mLru.erase(lruIt);
+            mStats.bytesCached -= sizeClass;
+            mStats.bytesInUse += sizeClass;
+            mStats.peakBytesInUse = std::max(mStats.peakBytesInUse, mStats.bytesInUse);
+            ++mStats.hits;
+            return data;
+        }
+        ++mStats.misses;
+        mStats.bytesInUse += sizeClass;
+        mStats.peakBytesInUse = std::max(mStats.peakBytesInUse, mStats.bytesInUse);
+    }
+    return static_cast<uchar *>(cv::fastMalloc(sizeClass));
+}
+
+void CVMatArena::give(uchar *data, size_t bytes)
+{
+    if (!data)
+        return;
+
+    if (bytes < MinPooledBytes)
+    {
+        cv::fastFree(data);
+        return;
+    }
+
+    const size_t sizeClass = sizeClassFor(bytes);
+    QMutexLocker locker(&mMutex);
+    mStats.bytesInUse -= sizeClass;
+    if (sizeClass > mStats.capacityBytes)
+    {
+        ++mStats.evictions;
+        locker.unlock();
+        cv::fastFree(data);
+        return;
+    }
+
+    evictTo(mStats.capacityBytes - sizeClass);
+    mLru.push_back(CachedBuffer{data, sizeClass});
+    mFreeBySize[sizeClass].push_back(std::prev(mLru.end()));
+    mStats.bytesCached += sizeClass;
+}
+
+void CVMatArena::evictTo(size_t limit)
+{
+    while (mStats.bytesCached > limit && !mLru.empty())
+    {
+        CachedBuffer oldest = mLru.front();
+        // The oldest buffer overall is also the oldest of its class.
+        mFreeBySize[oldest.sizeClass].pop_front();
+        mLru.pop_front();
+        mStats.bytesCached -= oldest.sizeClass;
+        ++mStats.evictions;
+        cv::fastFree(oldest.data);
+    }
+}
+
+void CVMatArena::setCapacityBytes(size_t bytes)
+{
+    QMutexLocker locker(&mMutex);
+    mStats.capacityBytes = bytes;
+    evictTo(bytes);
+}
+
+void CVMatArena::trim()
+{
+    QMutexLocker locker(&mMutex);
+    const uint64_t evictions = mStats.evictions;
+    evictTo(0);
+    mStats.evictions = evictions;
+}
+
+MatArenaStats CVMatArena::stats() const
+{
+    QMutexLocker locker(&mMutex);
+    MatArenaStats stats = mStats;
+    stats.bypassed = miBypassed.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace CVDevLibrary
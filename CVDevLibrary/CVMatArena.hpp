@@ -0,0 +1,169 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+/**
+ * @file CVMatArena.hpp
+ * @brief Process-wide size-class arena for cv::Mat pixel buffers.
+ *
+ * CVMatArena recycles large cv::Mat buffers across frames and across nodes.
+ * It plugs into OpenCV as a `cv::MatAllocator`: any cv::Mat whose `allocator`
+ * points at the arena gets its storage from a per-size-class free list, and
+ * returns it there when the last reference is dropped. Because `cv::Mat::create()`
+ * keeps the matrix allocator, a pooled matrix that changes shape (ROI, resize,
+ * type switch) reallocates from the arena instead of the heap.
+ *
+ * **Size classes:**
+ * Requests are rounded up to one of four steps per power of two
+ * (1, 1.25, 1.5, 1.75 × 2^k), so a buffer wastes at most 25% and any shape
+ * or type with the same rounded byte count reuses the same storage. Buffers
+ * below MinPooledBytes bypass the arena.
+ *
+ * **Memory cap:**
+ * Only idle (cached) bytes count against the capacity. When a returned buffer
+ * would push the cache over the cap, least-recently-returned buffers are
+ * released to the heap and counted as evictions.
+ *
+ * **Typical Usage:**
+ * @code
+ * cv::Mat dst;
+ * dst.allocator = CVMatArena::instance().allocator();
+ * cv::resize(src, dst, cv::Size(), 0.5, 0.5);   // storage comes from the arena
+ *
+ * // Or allocate directly
+ * cv::Mat frame = CVMatArena::instance().create(1080, 1920, CV_8UC3);
+ *
+ * auto stats = CVMatArena::instance().stats();
+ * DEBUG_LOG_INFO() << "arena hit" << stats.hits << "miss" << stats.misses;
+ * @endcode
+ *
+ * @see CVImagePool, which allocates its slots from the arena
+ */
+
+#pragma once
+
+#include "CVDevLibrary.hpp"
+
+#include <opencv2/core/core.hpp>
+
+#include <QtCore/QMutex>
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <map>
+
+namespace CVDevLibrary
+{
+
+/**
+ * @struct MatArenaStats
+ * @brief Snapshot of the arena counters.
+ */
+struct MatArenaStats
+{
+    uint64_t hits{0};          ///< Allocations served from a cached buffer
+    uint64_t misses{0};        ///< Allocations that went to the heap
+    uint64_t evictions{0};     ///< Cached buffers freed to honour the capacity
+    uint64_t bypassed{0};      ///< Allocations below MinPooledBytes
+    size_t bytesInUse{0};      ///< Size-class bytes currently referenced by cv::Mat objects
+    size_t peakBytesInUse{0};  ///< Highest bytesInUse so far
+    size_t bytesCached{0};     ///< Size-class bytes idle in the free lists
+    size_t capacityBytes{0};   ///< Cap on bytesCached
+};
+
+/**
+ * @class CVMatArena
+ * @brief Singleton size-class buffer arena exposed as a cv::MatAllocator.
+ *
+ * Thread-safe. One mutex guards the free lists; it is taken once per pooled
+ * allocation and once per final release, never per pixel. Allocations below
+ * MinPooledBytes only bump an atomic counter.
+ */
+class CVDEVSHAREDLIB_EXPORT CVMatArena
+{
+public:
+    static constexpr size_t MinPooledBytes = 64 * 1024;
+    static constexpr size_t DefaultCapacityBytes = size_t(1024) * 1024 * 1024;
+
+    /**
+     * @brief Returns the process-wide arena.
+     *
+     * The instance is intentionally never destroyed so that cv::Mat objects
+     * released during static destruction still find their allocator.
+     */
+    static CVMatArena &instance();
+
+    /**
+     * @brief Returns the OpenCV allocator backed by this arena.
+     */
+    cv::MatAllocator *allocator() const;
+
+    /**
+     * @brief Allocates a matrix whose storage comes from the arena.
+     */
+    cv::Mat create(int rows, int cols, int type) const;
+
+    /**
+     * @brief Sets the cap on idle cached bytes and trims the cache to it.
+     */
+    void setCapacityBytes(size_t bytes);
+
+    /**
+     * @brief Frees every idle cached buffer.
+     */
+    void trim();
+
+    /**
+     * @brief Returns a snapshot of the arena counters.
+     */
+    MatArenaStats stats() const;
+
+    /**
+     * @brief Rounds a byte count up to its size class.
+     */
+    static size_t sizeClassFor(size_t bytes);
+
+private:
+    class Allocator;
+    friend class Allocator;
+
+    CVMatArena();
+    CVMatArena(const CVMatArena &) = delete;
+    CVMatArena &operator=(const CVMatArena &) = delete;
+
+    /// Returns a buffer of at least sizeClassFor(bytes) bytes.
+    uchar *take(size_t bytes);
+
+    /// Hands a buffer obtained from take() back to the arena.
+    void give(uchar *data, size_t bytes);
+
+    /// Frees least-recently-returned buffers until bytesCached <= limit. Caller holds mMutex.
+    void evictTo(size_t limit);
+
+    struct CachedBuffer
+    {
+        uchar *data;
+        size_t sizeClass;
+    };
+    using LruList = std::list<CachedBuffer>;
+
+    mutable QMutex mMutex;
+    std::map<size_t, std::list<LruList::iterator>> mFreeBySize; ///< Size class -> cached buffers, oldest at front
+    LruList mLru;                                              ///< Every cached buffer, oldest at front
+    MatArenaStats mStats;                                      ///< All but bypassed, under mMutex
+    std::atomic<uint64_t> miBypassed{0};                       ///< Small allocations never take mMutex
+    Allocator *mpAllocator{nullptr};
+};
+
+} // namespace CVDevLibrary
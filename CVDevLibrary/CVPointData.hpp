@@ -178,6 +178,7 @@ public:
     cv::Point &
     data()
     {
+        invalidate_information();
         return mCVPoint;
     }
 
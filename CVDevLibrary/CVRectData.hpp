@@ -177,6 +177,7 @@ public:
     cv::Rect &
     data()
     {
+        invalidate_information();
         return mCVRect;
     }
 
@@ -260,6 +260,7 @@ public:
     cv::Scalar &
     scalar()
     {
+        invalidate_information();
         return mCVScalar;
     }
 
@@ -179,6 +179,7 @@ public:
     cv::Size &
     data()
     {
+        invalidate_information();
         return mCVSize;
     }
 
@@ -124,6 +124,7 @@ public:
     std::vector< std::vector<cv::Point> > &
     data()
     {
+        invalidate_information();
         return mvvPoints;
     }
 
@@ -18,37 +18,52 @@
  *
  * Implements DDS entity lifecycle (participant creation/destruction), topic-scoped
  * reader/writer pools (lazy creation), callback dispatch mechanism with subscriber ID
- * tracking, and Qt-integrated polling loop for data delivery. Includes conditional
+ * tracking, and the waitset thread that delivers reader data. Includes conditional
  * compilation support for CYCLONEDDS_ENABLED builds.
  *
  * **Key Implementation Details:**
  * - Pimpl (Private Implementation) pattern isolates DDS types
  * - Mutex-protected callback dispatch table (topic -> subscriber ID -> callback)
- * - Qt polling timer (10ms interval) drains all active readers
  * - Lazy reader/writer creation per topic
  * - Safe unsubscribe with partial callback removal
  * - Graceful degradation when CycloneDDS is disabled
  *
- * **DDS Polling Architecture:**
- * - Timer fires every 10ms
- * - Collects active reader IDs (thread-safe snapshot)
- * - Calls handleReaderData() for each reader
- * - Callbacks dispatch on Qt event loop via QMetaObject::invokeMethod
+ * **Reader Thread:**
+ * - Every reader has a read condition attached to one waitset; a guard
+ *   condition wakes the thread for shutdown
+ * - On wake-up, handleReaderData() takes the triggered readers' samples as
+ *   loans (no copy) in batches of up to kMaxSamples
+ * - One queued call per batch and subscriber context carries the batch; the
+ *   loan is returned once every context has run its callbacks
+ * - Chunks are reassembled after the lock is released; completed frames are
+ *   owned by the batch and dispatched in sample order
+ * - The waitset wait times out every kExpireInterval so that incomplete
+ *   frames on a quiet link still reach their deadline and send NACKs
+ * - Each batch holds a lease on its reader, and every reader one on the
+ *   participant: unsubscribeRaw() and shutdown() only detach a reader from
+ *   the waitset, and the reader (or participant) is deleted once the last
+ *   batch reading its loans is released
  */
 
-#include "CycloneDDSBridge.hpp"
-
 #include "CycloneDDSBridge.hpp"
 #include "DebugLogging.hpp"
+#include "NodeDataSerializer.hpp"
+#include "PBFrameTransfer.hpp"
+#include "PBLinkStats.hpp"
 
 #include <QSysInfo>
 #include <QMetaObject>
-#include <QCoreApplication>
 #include <QDebug>
 #include <QHash>
 #include <QList>
 #include <QMutex>
 #include <QMutexLocker>
+#include <QPointer>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #ifdef CYCLONEDDS_ENABLED
 #include <dds/dds.h>
@@ -58,32 +73,133 @@
 
 struct CycloneDDSBridge::Impl
 {
+    /// One registered callback and the thread it runs on.
+    struct Subscriber
+    {
+        RawDataCallback callback;
+        QPointer<QObject> context;  ///< Callback runs on this object's thread
+        bool direct{false};         ///< No context: run on the reader thread
+    };
+
+    /// One payload of a batch and the time its sample was received.
+    struct Received
+    {
+        QByteArray payload;
+        int64_t receiveUs{0};
+    };
+
+    /// Hands one batch of payloads to every subscriber; @p batch keeps their bytes alive.
+    static void dispatchBatch(const QList<Subscriber>& subscribers,
+                              const std::shared_ptr<void>& batch,
+                              std::vector<Received>&& payloads);
+
     ///< Synchronizes concurrent publish/subscribe and entity updates.
     QMutex mutex;
     ///< Topic -> subscriber id -> callback dispatch table.
-    QHash<QString, QHash<QString, RawDataCallback>> callbacksByTopic;
+    QHash<QString, QHash<QString, Subscriber>> callbacksByTopic;
+
+    FrameChunkingConfig frameChunking;
+    QHash<QString, std::shared_ptr<PBFrameChunker>> chunkersByTopic;
+    QHash<QString, std::shared_ptr<PBFrameReassembler>> reassemblersByTopic;
 
 #ifdef CYCLONEDDS_ENABLED
+    /// Deletes the participant, and everything left under it, with the last reference.
+    struct ParticipantLease;
+    /// Deletes a reader with the last reference; held by the bridge and by every batch of its loans.
+    struct ReaderLease;
+    /// Samples loaned by one dds_take(); the loan is returned with the last reference.
+    struct LoanedBatch;
+
     dds_entity_t participant{0};
+    std::shared_ptr<ParticipantLease> participantLease;
     dds_entity_t publisher{0};
     dds_entity_t subscriber{0};
+    dds_entity_t waitset{0};
+    dds_entity_t wakeCondition{0};      ///< Guard condition that interrupts the waitset
 
     QHash<QString, dds_entity_t> topicsByName;
     QHash<QString, dds_entity_t> writersByTopic;
-    QHash<QString, dds_entity_t> readersByTopic;
+    QHash<QString, std::shared_ptr<ReaderLease>> readersByTopic;
     QHash<dds_entity_t, QString> topicByReader;
+
+    std::thread readerThread;
+    std::atomic<bool> stopReader{false};
 #endif
 };
 
+namespace {
+
+/// Topic on which receivers of @p topicName ask its publisher for lost chunks.
+QString nackTopic(const QString& topicName)
+{
+    return topicName + QStringLiteral("_nack");
+}
+
+}
+
 #ifdef CYCLONEDDS_ENABLED
 namespace {
 
+constexpr size_t kMaxSamples = 64;
+/// Longest wait without data before incomplete frames are checked for their deadline.
+constexpr dds_duration_t kExpireInterval = DDS_MSECS(20);
+
 constexpr bool isValidEntity(dds_entity_t entity)
 {
     return entity > 0;
 }
 
 }
+
+struct CycloneDDSBridge::Impl::ParticipantLease
+{
+    dds_entity_t participant{0};
+
+    ~ParticipantLease()
+    {
+        if (isValidEntity(participant)) {
+            dds_delete(participant);
+        }
+    }
+};
+
+struct CycloneDDSBridge::Impl::ReaderLease
+{
+    dds_entity_t reader{0};
+    dds_entity_t condition{0};                      ///< Read condition attached to the waitset; 0 once detached
+    std::shared_ptr<ParticipantLease> participant;  ///< Released after the reader is deleted
+
+    ~ReaderLease()
+    {
+        if (isValidEntity(reader)) {
+            dds_delete(reader);
+        }
+    }
+
+    /// Stops the waitset from reporting the reader; loans taken from it stay valid.
+    void detach()
+    {
+        if (isValidEntity(condition)) {
+            dds_delete(condition);
+            condition = 0;
+        }
+    }
+};
+
+struct CycloneDDSBridge::Impl::LoanedBatch
+{
+    std::shared_ptr<ReaderLease> reader;            ///< Keeps the reader, and so the loans, alive
+    std::array<void*, kMaxSamples> samples{};
+    dds_return_t count{0};
+    std::vector<std::vector<uint8_t>> assembled;    ///< Frames completed by chunks of this batch
+
+    ~LoanedBatch()
+    {
+        if (count > 0) {
+            dds_return_loan(reader->reader, samples.data(), count);
+        }
+    }
+};
 #endif
 
 CycloneDDSBridge& CycloneDDSBridge::instance()
@@ -96,24 +212,6 @@ CycloneDDSBridge::CycloneDDSBridge()
     : msComputerId(QSysInfo::machineHostName())
     , mpImpl(std::make_unique<Impl>())
 {
-    mpPollTimer = new QTimer(this);
-    mpPollTimer->setInterval(10);
-    connect(mpPollTimer, &QTimer::timeout, this, [this]() {
-#ifdef CYCLONEDDS_ENABLED
-        QList<int> readerIds;
-        {
-            QMutexLocker locker(&mpImpl->mutex);
-            for (auto it = mpImpl->topicByReader.constBegin(); it != mpImpl->topicByReader.constEnd(); ++it) {
-                readerIds.append(static_cast<int>(it.key()));
-            }
-        }
-
-        for (int readerId : readerIds) {
-            handleReaderData(readerId);
-        }
-#endif
-    });
-
 #ifndef CYCLONEDDS_ENABLED
     DEBUG_LOG_INFO() << "[CycloneDDSBridge] CycloneDDS not available - in-process bus only (Qt-local fallback)";
 #endif
@@ -145,6 +243,8 @@ bool CycloneDDSBridge::initialize(const QString& computerId, int domainId, const
         mbInitialized = false;
         return false;
     }
+    mpImpl->participantLease = std::make_shared<Impl::ParticipantLease>();
+    mpImpl->participantLease->participant = mpImpl->participant;
 
     dds_qos_t *pubSubQos = dds_create_qos();
     QByteArray partitionUtf8 = msPartition.toUtf8();
@@ -158,28 +258,32 @@ bool CycloneDDSBridge::initialize(const QString& computerId, int domainId, const
     mpImpl->subscriber = dds_create_subscriber(mpImpl->participant, pubSubQos, nullptr);
     dds_delete_qos(pubSubQos);
 
-    if (!isValidEntity(mpImpl->publisher) || !isValidEntity(mpImpl->subscriber)) {
+    mpImpl->waitset = dds_create_waitset(mpImpl->participant);
+    mpImpl->wakeCondition = dds_create_guardcondition(mpImpl->participant);
+    if (isValidEntity(mpImpl->waitset) && isValidEntity(mpImpl->wakeCondition)) {
+        dds_waitset_attach(mpImpl->waitset, mpImpl->wakeCondition, 0);
+    }
+
+    if (!isValidEntity(mpImpl->publisher) || !isValidEntity(mpImpl->subscriber) ||
+        !isValidEntity(mpImpl->waitset) || !isValidEntity(mpImpl->wakeCondition)) {
         DEBUG_LOG_WARNING() << "[CycloneDDSBridge] Failed to create pub/sub entities"
                             << "publisher rc:" << mpImpl->publisher
-                            << "subscriber rc:" << mpImpl->subscriber;
-        if (isValidEntity(mpImpl->publisher)) {
-            dds_delete(mpImpl->publisher);
-        }
-        if (isValidEntity(mpImpl->subscriber)) {
-            dds_delete(mpImpl->subscriber);
-        }
-        dds_delete(mpImpl->participant);
+                            << "subscriber rc:" << mpImpl->subscriber
+                            << "waitset rc:" << mpImpl->waitset;
+        // Deleting the participant deletes every entity created under it
+        mpImpl->participantLease.reset();
         mpImpl->participant = 0;
         mpImpl->publisher = 0;
         mpImpl->subscriber = 0;
+        mpImpl->waitset = 0;
+        mpImpl->wakeCondition = 0;
         mbInitialized = false;
         return false;
     }
 
     mbInitialized = true;
-    if (mpPollTimer && !mpPollTimer->isActive()) {
-        mpPollTimer->start();
-    }
+    mpImpl->stopReader.store(false);
+    mpImpl->readerThread = std::thread([this]() { readerLoop(); });
     DEBUG_LOG_INFO() << "[CycloneDDSBridge] Initialized with computer ID:" << msComputerId
                      << "domain:" << miDomainId
                      << "partition:" << (msPartition.isEmpty() ? QStringLiteral("(default)") : msPartition);
@@ -196,19 +300,26 @@ bool CycloneDDSBridge::initialize(const QString& computerId, int domainId, const
 
 void CycloneDDSBridge::shutdown()
 {
-    QMutexLocker locker(&mpImpl->mutex);
-
-    if (mpPollTimer && mpPollTimer->isActive()) {
-        mpPollTimer->stop();
+#ifdef CYCLONEDDS_ENABLED
+    // Join before taking the mutex: the reader thread takes it per batch
+    if (mpImpl->readerThread.joinable()) {
+        mpImpl->stopReader.store(true);
+        dds_set_guardcondition(mpImpl->wakeCondition, true);
+        mpImpl->readerThread.join();
     }
+#endif
+
+    QMutexLocker locker(&mpImpl->mutex);
 
     mpImpl->callbacksByTopic.clear();
+    mpImpl->chunkersByTopic.clear();
+    mpImpl->reassemblersByTopic.clear();
 
 #ifdef CYCLONEDDS_ENABLED
+    // Batches still queued to subscriber contexts hold their reader; it is
+    // deleted when they are released, and the participant after the last one
     for (auto it = mpImpl->readersByTopic.begin(); it != mpImpl->readersByTopic.end(); ++it) {
-        if (isValidEntity(it.value())) {
-            dds_delete(it.value());
-        }
+        it.value()->detach();
     }
     mpImpl->readersByTopic.clear();
     mpImpl->topicByReader.clear();
@@ -220,25 +331,24 @@ void CycloneDDSBridge::shutdown()
     }
     mpImpl->writersByTopic.clear();
 
-    for (auto it = mpImpl->topicsByName.begin(); it != mpImpl->topicsByName.end(); ++it) {
-        if (isValidEntity(it.value())) {
-            dds_delete(it.value());
-        }
-    }
+    // Topics and the subscriber may still have leased readers; they go with the participant
     mpImpl->topicsByName.clear();
+    mpImpl->subscriber = 0;
 
     if (isValidEntity(mpImpl->publisher)) {
         dds_delete(mpImpl->publisher);
         mpImpl->publisher = 0;
     }
-    if (isValidEntity(mpImpl->subscriber)) {
-        dds_delete(mpImpl->subscriber);
-        mpImpl->subscriber = 0;
+    if (isValidEntity(mpImpl->waitset)) {
+        dds_delete(mpImpl->waitset);
+        mpImpl->waitset = 0;
     }
-    if (isValidEntity(mpImpl->participant)) {
-        dds_delete(mpImpl->participant);
-        mpImpl->participant = 0;
+    if (isValidEntity(mpImpl->wakeCondition)) {
+        dds_delete(mpImpl->wakeCondition);
+        mpImpl->wakeCondition = 0;
     }
+    mpImpl->participantLease.reset();
+    mpImpl->participant = 0;
 #endif
 
     if (mbInitialized) {
@@ -249,6 +359,98 @@ void CycloneDDSBridge::shutdown()
 }
 
 bool CycloneDDSBridge::publishRaw(const QString& topicName, const QByteArray& payload)
+{
+    return publishRaw(topicName,
+                      reinterpret_cast<const uint8_t*>(payload.constData()),
+                      static_cast<size_t>(payload.size()));
+}
+
+bool CycloneDDSBridge::publishSerialized(const QString& topicName, SerializedPayload&& payload)
+{
+    if (payload.empty()) {
+        DEBUG_LOG_WARNING() << "[CycloneDDSBridge] Empty payload - cannot publish";
+        return false;
+    }
+
+    NodeDataSerializer::appendFrameTrace(payload, getComputerId(),
+                                         PBLinkStats::instance().nextSequence(topicName));
+
+    std::shared_ptr<PBFrameChunker> chunker;
+    bool listenForNacks = false;
+    {
+        QMutexLocker locker(&mpImpl->mutex);
+        if (mpImpl->frameChunking.enabled()) {
+            auto& entry = mpImpl->chunkersByTopic[topicName];
+            if (!entry) {
+                entry = std::make_shared<PBFrameChunker>(mpImpl->frameChunking);
+                listenForNacks = mpImpl->frameChunking.retransmit;
+            }
+            chunker = entry;
+        }
+    }
+
+    if (listenForNacks) {
+        // Answered on the reader thread
+        std::weak_ptr<PBFrameChunker> weakChunker = chunker;
+        subscribeRaw(nackTopic(topicName), QStringLiteral("__frame_chunker__"),
+                     [this, topicName, weakChunker](const QByteArray& nack, int64_t) {
+            const std::shared_ptr<PBFrameChunker> owner = weakChunker.lock();
+            if (!owner) {
+                return;
+            }
+            std::vector<uint8_t> buffer;
+            owner->handleNack(reinterpret_cast<const uint8_t*>(nack.constData()), static_cast<size_t>(nack.size()),
+                              [this, &topicName, &buffer](const FrameChunk& chunk) {
+                buffer.resize(chunk.size());
+                chunk.copyTo(buffer.data());
+                return publishRaw(topicName, buffer.data(), buffer.size());
+            });
+        });
+    }
+
+    if (chunker && chunker->shouldChunk(payload)) {
+        // One sample per chunk, copied through one reused buffer
+        std::vector<uint8_t> buffer;
+        return chunker->send(std::move(payload), [this, &topicName, &buffer](const FrameChunk& chunk) {
+            buffer.resize(chunk.size());
+            chunk.copyTo(buffer.data());
+            return publishRaw(topicName, buffer.data(), buffer.size());
+        });
+    }
+
+    const std::vector<uint8_t> bytes = payload.flatten();
+    return publishRaw(topicName, bytes.data(), bytes.size());
+}
+
+void CycloneDDSBridge::setFrameChunking(const FrameChunkingConfig& config)
+{
+    QMutexLocker locker(&mpImpl->mutex);
+    mpImpl->frameChunking = config;
+}
+
+QList<FrameTransferStats> CycloneDDSBridge::frameTransferStats() const
+{
+    QMap<QString, FrameTransferStats> byTopic;
+    QMutexLocker locker(&mpImpl->mutex);
+    for (auto it = mpImpl->chunkersByTopic.cbegin(); it != mpImpl->chunkersByTopic.cend(); ++it) {
+        it.value()->addStats(byTopic[it.key()]);
+    }
+    for (auto it = mpImpl->reassemblersByTopic.cbegin(); it != mpImpl->reassemblersByTopic.cend(); ++it) {
+        it.value()->addStats(byTopic[it.key()]);
+    }
+
+    QList<FrameTransferStats> result;
+    for (auto it = byTopic.begin(); it != byTopic.end(); ++it) {
+        if (it.value().framesSent == 0 && it.value().chunksReceived == 0) {
+            continue;
+        }
+        it.value().key = it.key();
+        result.append(it.value());
+    }
+    return result;
+}
+
+bool CycloneDDSBridge::publishRaw(const QString& topicName, const uint8_t* data, size_t size)
 {
     QMutexLocker locker(&mpImpl->mutex);
 
@@ -292,9 +494,9 @@ bool CycloneDDSBridge::publishRaw(const QString& topicName, const QByteArray& pa
     }
 
     cvdev_RawPayload sample{};
-    sample.payload._length = static_cast<uint32_t>(payload.size());
-    sample.payload._maximum = static_cast<uint32_t>(payload.size());
-    sample.payload._buffer = reinterpret_cast<uint8_t*>(const_cast<char*>(payload.constData()));
+    sample.payload._length = static_cast<uint32_t>(size);
+    sample.payload._maximum = static_cast<uint32_t>(size);
+    sample.payload._buffer = const_cast<uint8_t*>(data);
     sample.payload._release = false;
 
     const dds_return_t rc = dds_write(writer, &sample);
@@ -303,20 +505,21 @@ bool CycloneDDSBridge::publishRaw(const QString& topicName, const QByteArray& pa
         return false;
     }
 
-    DEBUG_LOG_INFO() << "[CycloneDDSBridge] Published to topic:" << topicName << "bytes:" << payload.size();
+    DEBUG_LOG_INFO() << "[CycloneDDSBridge] Published to topic:" << topicName << "bytes:" << static_cast<qulonglong>(size);
     return true;
 #else
-    Q_UNUSED(payload);
+    Q_UNUSED(data);
+    Q_UNUSED(size);
     return false;
 #endif
 }
 
-bool CycloneDDSBridge::subscribeRaw(const QString& topicName, RawDataCallback callback)
+bool CycloneDDSBridge::subscribeRaw(const QString& topicName, RawDataCallback callback, QObject* context)
 {
-    return subscribeRaw(topicName, QStringLiteral("__default__"), callback);
+    return subscribeRaw(topicName, QStringLiteral("__default__"), callback, context);
 }
 
-bool CycloneDDSBridge::subscribeRaw(const QString& topicName, const QString& subscriberId, RawDataCallback callback)
+bool CycloneDDSBridge::subscribeRaw(const QString& topicName, const QString& subscriberId, RawDataCallback callback, QObject* context)
 {
     QMutexLocker locker(&mpImpl->mutex);
 
@@ -330,6 +533,11 @@ bool CycloneDDSBridge::subscribeRaw(const QString& topicName, const QString& sub
         return false;
     }
 
+    Impl::Subscriber entry;
+    entry.callback = callback;
+    entry.context = context;
+    entry.direct = (context == nullptr);
+
     auto existing = mpImpl->callbacksByTopic.find(topicName);
     if (existing != mpImpl->callbacksByTopic.end()) {
         if (existing->contains(subscriberId)) {
@@ -337,7 +545,7 @@ bool CycloneDDSBridge::subscribeRaw(const QString& topicName, const QString& sub
             return false;
         }
 
-        existing->insert(subscriberId, callback);
+        existing->insert(subscriberId, entry);
         DEBUG_LOG_INFO() << "[CycloneDDSBridge] Added shared raw subscriber for topic:" << topicName << subscriberId;
         return true;
     }
@@ -368,11 +576,23 @@ bool CycloneDDSBridge::subscribeRaw(const QString& topicName, const QString& sub
         return false;
     }
 
-    mpImpl->readersByTopic.insert(topicName, reader);
+    // The condition is a child of the reader and goes away with it
+    const dds_entity_t condition = dds_create_readcondition(reader, DDS_ANY_STATE);
+    if (!isValidEntity(condition) || dds_waitset_attach(mpImpl->waitset, condition, reader) < 0) {
+        DEBUG_LOG_WARNING() << "[CycloneDDSBridge] Failed to attach reader for topic:" << topicName << "rc:" << condition;
+        dds_delete(reader);
+        return false;
+    }
+
+    auto lease = std::make_shared<Impl::ReaderLease>();
+    lease->reader = reader;
+    lease->condition = condition;
+    lease->participant = mpImpl->participantLease;
+    mpImpl->readersByTopic.insert(topicName, lease);
     mpImpl->topicByReader.insert(reader, topicName);
 #endif
 
-    mpImpl->callbacksByTopic[topicName].insert(subscriberId, callback);
+    mpImpl->callbacksByTopic[topicName].insert(subscriberId, entry);
     DEBUG_LOG_INFO() << "[CycloneDDSBridge] Subscribed to topic:" << topicName;
     return true;
 }
@@ -397,12 +617,14 @@ void CycloneDDSBridge::unsubscribeRaw(const QString& topicName, const QString& s
     }
 
 #ifdef CYCLONEDDS_ENABLED
+    if (removeReader) {
+        mpImpl->reassemblersByTopic.remove(topicName);
+    }
     if (removeReader && mpImpl->readersByTopic.contains(topicName)) {
-        const dds_entity_t reader = mpImpl->readersByTopic.take(topicName);
-        mpImpl->topicByReader.remove(reader);
-        if (isValidEntity(reader)) {
-            dds_delete(reader);
-        }
+        // Deleted here, or by the last batch still reading its loans
+        const std::shared_ptr<Impl::ReaderLease> lease = mpImpl->readersByTopic.take(topicName);
+        mpImpl->topicByReader.remove(lease->reader);
+        lease->detach();
     }
 #endif
 
@@ -414,73 +636,166 @@ void CycloneDDSBridge::unsubscribeRaw(const QString& topicName, const QString& s
 void CycloneDDSBridge::handleReaderData(int readerEntity)
 {
 #ifdef CYCLONEDDS_ENABLED
-    QMutexLocker locker(&mpImpl->mutex);
-
     const dds_entity_t reader = static_cast<dds_entity_t>(readerEntity);
-    const QString topicName = mpImpl->topicByReader.value(reader);
-    if (topicName.isEmpty()) {
-        return;
-    }
 
-    const auto callbackIt = mpImpl->callbacksByTopic.constFind(topicName);
-    if (callbackIt == mpImpl->callbacksByTopic.constEnd()) {
-        return;
-    }
-
-    const QList<RawDataCallback> callbacks = callbackIt.value().values();
-    if (callbacks.isEmpty()) {
-        return;
-    }
+    for (;;) {
+        auto batch = std::make_shared<Impl::LoanedBatch>();
+        QList<Impl::Subscriber> subscribers;
+        {
+            // The lease taken under this lock keeps the reader alive while its loans are read
+            QMutexLocker locker(&mpImpl->mutex);
+            const QString topicName = mpImpl->topicByReader.value(reader);
+            if (topicName.isEmpty()) {
+                return;
+            }
+            batch->reader = mpImpl->readersByTopic.value(topicName);
+            if (!batch->reader) {
+                return;
+            }
+            subscribers = mpImpl->callbacksByTopic.value(topicName).values();
+            auto& reassemblerEntry = mpImpl->reassemblersByTopic[topicName];
+            if (!reassemblerEntry) {
+                reassemblerEntry = std::make_shared<PBFrameReassembler>();
+            }
+            const std::shared_ptr<PBFrameReassembler> reassembler = reassemblerEntry;
+
+            // samples[0] == nullptr asks CycloneDDS to loan its own buffers
+            dds_sample_info_t sampleInfos[kMaxSamples];
+            const dds_return_t taken = dds_take(reader, batch->samples.data(), sampleInfos,
+                                                kMaxSamples, static_cast<uint32_t>(kMaxSamples));
+            if (taken <= 0) {
+                return;
+            }
+            batch->count = taken;
+            locker.unlock();
+
+            // Views into the loaned samples and the frames they complete, valid while the batch lives
+            std::vector<Impl::Received> payloads;
+            std::vector<std::vector<uint8_t>> nacks;
+            PBFrameReassembler::PushResult result;
+            payloads.reserve(static_cast<size_t>(taken));
+            for (dds_return_t i = 0; i < taken; ++i) {
+                const auto *sample = static_cast<const cvdev_RawPayload*>(batch->samples[i]);
+                if (!sampleInfos[i].valid_data || !sample || !sample->payload._buffer ||
+                    sample->payload._length == 0) {
+                    continue;
+                }
+                // Stamped here, not where the subscriber's thread decodes it (reception_timestamp is ns since epoch)
+                const int64_t receiveUs = sampleInfos[i].reception_timestamp > 0
+                                              ? sampleInfos[i].reception_timestamp / 1000
+                                              : FrameHop::now();
+                if (!PBFrameReassembler::isChunk(sample->payload._buffer, sample->payload._length)) {
+                    payloads.push_back({QByteArray::fromRawData(reinterpret_cast<const char*>(sample->payload._buffer),
+                                                                static_cast<int>(sample->payload._length)),
+                                        receiveUs});
+                    continue;
+                }
 
-    constexpr size_t kMaxSamples = 16;
-    cvdev_RawPayload samples[kMaxSamples]{};
-    void *samplePtrs[kMaxSamples];
-    dds_sample_info_t sampleInfos[kMaxSamples]{};
+                reassembler->push(sample->payload._buffer, sample->payload._length, receiveUs, result);
+                for (auto& nack : result.nacks) {
+                    nacks.push_back(std::move(nack));
+                }
+                if (result.complete) {
+                    // Moving the vectors of assembled keeps their buffers in place
+                    batch->assembled.push_back(std::move(result.frame));
+                    const std::vector<uint8_t>& frame = batch->assembled.back();
+                    payloads.push_back({QByteArray::fromRawData(reinterpret_cast<const char*>(frame.data()),
+                                                                static_cast<int>(frame.size())),
+                                        receiveUs});
+                }
+            }
 
-    for (size_t i = 0; i < kMaxSamples; ++i) {
-        samplePtrs[i] = &samples[i];
+            for (const auto& nack : nacks) {
+                publishRaw(nackTopic(topicName), nack.data(), nack.size());
+            }
+            Impl::dispatchBatch(subscribers, batch, std::move(payloads));
+            if (taken < static_cast<dds_return_t>(kMaxSamples)) {
+                return;
+            }
+        }
     }
+#else
+    Q_UNUSED(readerEntity);
+#endif
+}
 
-    const dds_return_t taken = dds_take(reader, samplePtrs, sampleInfos, kMaxSamples, static_cast<uint32_t>(kMaxSamples));
-    if (taken <= 0) {
+void CycloneDDSBridge::Impl::dispatchBatch(const QList<Subscriber>& subscribers,
+                                           const std::shared_ptr<void>& batch,
+                                           std::vector<Received>&& payloads)
+{
+    if (payloads.empty()) {
         return;
     }
 
-    for (dds_return_t i = 0; i < taken; ++i) {
-        if (!sampleInfos[i].valid_data || !samplePtrs[i]) {
+    auto shared = std::make_shared<const std::vector<Received>>(std::move(payloads));
+    for (const Subscriber& subscriber : subscribers) {
+        if (!subscriber.callback) {
             continue;
         }
-
-        auto *sample = static_cast<cvdev_RawPayload*>(samplePtrs[i]);
-        const char *bytes = reinterpret_cast<const char*>(sample->payload._buffer);
-        QByteArray payload = (bytes && sample->payload._length > 0)
-            ? QByteArray(bytes, static_cast<int>(sample->payload._length))
-            : QByteArray();
-
-        QObject *dispatchTarget = QCoreApplication::instance();
-        if (dispatchTarget) {
-            QMetaObject::invokeMethod(dispatchTarget, [callbacks, payload]() {
-                for (const RawDataCallback& callback : callbacks) {
-                    if (callback) {
-                        callback(payload);
-                    }
+        const RawDataCallback callback = subscriber.callback;
+        if (subscriber.direct) {
+            for (const Received& received : *shared) {
+                callback(received.payload, received.receiveUs);
+            }
+            continue;
+        }
+        // A destroyed context drops the call and with it the loan and reader reference
+        QObject* context = subscriber.context.data();
+        if (context) {
+            QMetaObject::invokeMethod(context, [callback, batch, shared]() {
+                for (const Received& received : *shared) {
+                    callback(received.payload, received.receiveUs);
                 }
             }, Qt::QueuedConnection);
-        } else {
-            for (const RawDataCallback& callback : callbacks) {
-                if (callback) {
-                    callback(payload);
-                }
-            }
         }
+    }
+}
 
-        dds_sample_free(sample, &cvdev_RawPayload_desc, DDS_FREE_CONTENTS);
+void CycloneDDSBridge::readerLoop()
+{
+#ifdef CYCLONEDDS_ENABLED
+    dds_attach_t triggered[16];
+    while (!mpImpl->stopReader.load()) {
+        const dds_return_t count = dds_waitset_wait(mpImpl->waitset, triggered, 16, kExpireInterval);
+        if (count < 0) {
+            DEBUG_LOG_WARNING() << "[CycloneDDSBridge] dds_waitset_wait failed, rc:" << count;
+            break;
+        }
+        if (count == 0) {
+            // Quiet link: frames whose chunks stopped arriving still expire and NACK
+            expireReassemblers();
+            continue;
+        }
+        for (dds_return_t i = 0; i < qMin<dds_return_t>(count, 16); ++i) {
+            if (triggered[i] == 0) {
+                bool woken = false;
+                dds_take_guardcondition(mpImpl->wakeCondition, &woken);
+                continue;
+            }
+            handleReaderData(static_cast<int>(triggered[i]));
+        }
     }
-#else
-    Q_UNUSED(readerEntity);
 #endif
 }
 
+void CycloneDDSBridge::expireReassemblers()
+{
+    QHash<QString, std::shared_ptr<PBFrameReassembler>> reassemblers;
+    {
+        QMutexLocker locker(&mpImpl->mutex);
+        reassemblers = mpImpl->reassemblersByTopic;
+    }
+
+    PBFrameReassembler::PushResult result;
+    const int64_t nowUs = FrameHop::now();
+    for (auto it = reassemblers.cbegin(); it != reassemblers.cend(); ++it) {
+        it.value()->expire(nowUs, result);
+        for (const auto& nack : result.nacks) {
+            publishRaw(nackTopic(it.key()), nack.data(), nack.size());
+        }
+    }
+}
+
 bool CycloneDDSBridge::isInitialized() const
 {
     return mbInitialized;
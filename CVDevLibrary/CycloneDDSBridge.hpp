@@ -21,14 +21,14 @@
  * Provides a transport bridge to OMG DDS (implemented via Eclipse CycloneDDS)
  * for pub/sub operations on arbitrary byte-payload topics. Encapsulates all DDS
  * entity lifecycle management (participant, publisher, subscriber, reader/writer creation),
- * topic-scoped reader/writer pools, and callback dispatch via Qt polling.
+ * topic-scoped reader/writer pools, and callback dispatch from a waitset thread.
  *
  * **Key Features:**
  * - Singleton instance per application
  * - Topic-based API (create readers/writers on-demand)
  * - Multi-subscriber support per topic (subscriber ID tracking)
  * - Thread-safe pub/sub operations (mutex-protected)
- * - Qt timer-driven polling for DDS reader data
+ * - Event-driven reader thread (DDS waitset); samples are loaned, not copied
  * - Graceful shutdown with entity cleanup
  * - Conditional compilation (CYCLONEDDS_ENABLED) for optional CycloneDDS support
  *
@@ -45,7 +45,19 @@
  *
  * **Thread Safety:**
  * - All public methods are thread-safe (use internal QMutex)
- * - Callbacks are dispatched from Qt event loop (safe for widget updates)
+ * - Callbacks run on the thread of the context object given to subscribeRaw(),
+ *   one queued call per batch of samples, or directly on the reader thread
+ *   without a context
+ * - The payload passed to a callback references DDS-owned memory and is only
+ *   valid during the call; copy it to keep it
+ *
+ * **Large Frames:**
+ * With setFrameChunking(), publishSerialized() writes payloads above the
+ * threshold as one sample per chunk (PBFrameTransfer.hpp) instead of one
+ * `sequence<octet>` of the whole frame. The reader thread reassembles chunks
+ * before dispatch, so subscribers still receive whole payloads; frames that
+ * miss the sender's deadline are dropped. With retransmit, receivers ask for
+ * lost chunks on `{topic}_nack`.
  */
 
 #pragma once
@@ -54,9 +66,15 @@
 #include <QString>
 #include <QMap>
 #include <QByteArray>
-#include <QTimer>
+#include <QList>
 #include <functional>
 #include <memory>
+#include <cstddef>
+#include <cstdint>
+
+struct SerializedPayload;
+struct FrameChunkingConfig;
+struct FrameTransferStats;
 
 /**
  * @class CycloneDDSBridge
@@ -70,7 +88,7 @@
  * CycloneDDSBridge& bridge = CycloneDDSBridge::instance();
  * if (bridge.initialize("my_computer", 0)) {
  *     bridge.publishRaw("my/topic", data);
- *     bridge.subscribeRaw("my/topic", [](const QByteArray& payload) {
+ *     bridge.subscribeRaw("my/topic", [](const QByteArray& payload, int64_t receiveUs) {
  *         // handle data
  *     });
  * }
@@ -80,7 +98,7 @@
  * - Pimpl (Private Implementation) pattern hides DDS entities in Impl struct
  * - All DDS entity handles stored/managed in Impl
  * - Callback dispatch table organized by topic and subscriber ID
- * - Qt polling loop drains reader queues every 10ms
+ * - A reader thread waits on a waitset and drains triggered readers
  *
  * **Build Requirement:**
  * - Requires CycloneDDS library and CMake with CYCLONEDDS_ENABLED flag
@@ -91,8 +109,12 @@ class CycloneDDSBridge : public QObject
     Q_OBJECT
 
 public:
-    /// Callback signature for raw data delivery (QByteArray payload).
-    using RawDataCallback = std::function<void(const QByteArray&)>;
+    /**
+     * Callback signature for raw data delivery: the payload and when it reached
+     * this host (FrameHop::now() clock, stamped on the reader thread), so that
+     * queueing to the callback's thread is not counted as transport latency.
+     */
+    using RawDataCallback = std::function<void(const QByteArray& payload, int64_t receiveUs)>;
 
     /// @name Singleton Access
     /// @{
@@ -124,8 +146,10 @@ public:
     /**
      * @brief Shuts down all DDS entities and clears subscriptions.
      *
-     * Stops the polling timer, closes all active readers/writers, and destroys
-     * the DDS participant. After shutdown, reinitialize() must be called before
+     * Joins the reader thread, closes all active readers/writers, and destroys
+     * the DDS participant. A reader whose loaned samples are still queued to a
+     * subscriber context, and the participant above it, are deleted once those
+     * callbacks have run. After shutdown, reinitialize() must be called before
      * pub/sub operations can resume.
      *
      * Safe to call even if not initialized.
@@ -175,6 +199,34 @@ public:
      */
     bool publishRaw(const QString& topicName, const QByteArray& payload);
 
+    /**
+     * @brief Publishes @p size bytes at @p data without copying them into a QByteArray first.
+     *
+     * The bytes only need to stay valid for the duration of the call.
+     */
+    bool publishRaw(const QString& topicName, const uint8_t* data, size_t size);
+
+    /**
+     * @brief Publishes a NodeDataSerializer payload, adding its frame trace extension.
+     *
+     * The segments are copied once into the DDS sample, or into one sample
+     * per chunk above the frame chunking threshold. Thread-safe.
+     */
+    bool publishSerialized(const QString& topicName, SerializedPayload&& payload);
+
+    /**
+     * @brief Chunked transfer of serialized payloads above @p config.thresholdBytes; off by default.
+     *
+     * Applies to topics first published afterwards. Read from `[FrameChunking]`
+     * in cvdev.ini. Receiving chunks needs no setting.
+     */
+    void setFrameChunking(const FrameChunkingConfig& config);
+
+    /**
+     * @brief Chunk counters of every topic that sent or received chunks.
+     */
+    QList<FrameTransferStats> frameTransferStats() const;
+
     /// @}
 
     /// @name Subscribe Operations
@@ -183,14 +235,16 @@ public:
     /**
      * @brief Subscribes to a DDS topic without subscriber ID.
      *
-     * Creates a DDS reader for the topic if not already created. Callback
-     * is invoked from the Qt polling loop (safe for widget updates).
+     * Creates a DDS reader for the topic if not already created.
      *
      * @param topicName DDS topic name.
-     * @param callback Invoked when data arrives (from Qt event loop).
+     * @param callback Invoked when data arrives. The payload is only valid during the call.
+     * @param context Object whose thread runs the callback (e.g. the owning node);
+     *        nullptr runs it on the DDS reader thread. Calls for a destroyed
+     *        context are dropped.
      * @return true if subscription succeeded, false on error.
      */
-    bool subscribeRaw(const QString& topicName, RawDataCallback callback);
+    bool subscribeRaw(const QString& topicName, RawDataCallback callback, QObject* context = nullptr);
 
     /**
      * @brief Subscribes to a DDS topic with a unique subscriber ID.
@@ -201,10 +255,12 @@ public:
      *
      * @param topicName DDS topic name.
      * @param subscriberId Unique subscriber identifier (for this topic).
-     * @param callback Invoked when data arrives.
+     * @param callback Invoked when data arrives. The payload is only valid during the call.
+     * @param context Object whose thread runs the callback; nullptr runs it on the reader thread.
      * @return true if subscription succeeded, false on error.
      */
-    bool subscribeRaw(const QString& topicName, const QString& subscriberId, RawDataCallback callback);
+    bool subscribeRaw(const QString& topicName, const QString& subscriberId, RawDataCallback callback,
+                      QObject* context = nullptr);
 
     /// @}
 
@@ -234,17 +290,15 @@ public:
 
     /// @}
 
-    /// @name Internal Data Delivery (Qt Polling)
+    /// @name Internal Data Delivery
     /// @{
 
     /**
      * @brief Drains one DDS reader and dispatches available messages.
      *
-     * Called from Qt polling loop (10ms interval). Retrieves all samples from
-     * the reader's queue and invokes registered callbacks on the Qt event loop.
-     *
-     * **Note**: This is called automatically by the polling timer. Manual calls
-     * are only needed for custom polling strategies.
+     * Called from the reader thread when the reader's read condition triggers.
+     * Takes samples as loans in batches and hands each batch to the
+     * subscribers' context threads in one queued call.
      *
      * @param readerEntity DDS reader handle (opaque integer).
      */
@@ -259,7 +313,7 @@ private:
     /**
      * @brief Constructs the bridge (private for singleton pattern).
      *
-     * Initializes Qt polling timer and default computerId. Does NOT initialize
+     * Initializes the default computerId. Does NOT initialize
      * DDS entities (call initialize() after construction).
      */
     CycloneDDSBridge();
@@ -272,6 +326,12 @@ private:
      */
     ~CycloneDDSBridge() override;
 
+    /** Reader thread body: waits on the waitset and drains triggered readers. */
+    void readerLoop();
+
+    /** Expires incomplete frames of every topic and sends their due NACKs; reader thread. */
+    void expireReassemblers();
+
     /// @name Private Member Variables
     /// @{
 
@@ -287,9 +347,6 @@ private:
     /** Optional DDS partition for topic filtering. */
     QString msPartition;
 
-    /** Qt timer that drives the 10ms polling loop for reader data. */
-    QTimer *mpPollTimer{nullptr};
-
     /** Pimpl holding DDS entity handles and callback dispatch table. */
     std::unique_ptr<Impl> mpImpl;
 
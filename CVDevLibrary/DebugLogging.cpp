@@ -13,9 +13,153 @@
 //limitations under the License.
 
 #include "DebugLogging.hpp"
+#include "PBLockFreeQueue.hpp"
+
+#include <QFile>
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <iterator>
+#include <thread>
+#include <vector>
 
 // Define the debug logging category
 // By default, it's enabled. To disable at runtime:
 // - Environment: export QT_LOGGING_RULES="DebugLogging.info=false" or "DebugLogging.warning=false"
 // - Code: QLoggingCategory::setFilterRules("DebugLogging.info=false");
 Q_LOGGING_CATEGORY(DebugLogging, "DebugLogging")
+
+namespace DebugLog
+{
+
+QDebug operator<<(QDebug debug, const Prefix &prefix)
+{
+    const auto now = std::chrono::system_clock::now();
+    const std::time_t seconds = std::chrono::system_clock::to_time_t(now);
+    const int millis = static_cast<int>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000);
+    std::tm local{};
+#if defined(_WIN32)
+    localtime_s(&local, &seconds);
+#else
+    localtime_r(&seconds, &local);
+#endif
+
+    char buffer[160];
+    std::snprintf(buffer, sizeof(buffer), "[[%s] %04d-%02d-%02d %02d:%02d:%02d.%03d | %s:%d]",
+                  prefix.level, local.tm_year + 1900, local.tm_mon + 1, local.tm_mday,
+                  local.tm_hour, local.tm_min, local.tm_sec, millis, prefix.file, prefix.line);
+    debug << buffer;
+    return debug;
+}
+
+} // namespace DebugLog
+
+struct DebugLogSink::State
+{
+    explicit State(size_t capacity)
+        : queue(capacity, PBQueueWaitStrategy{0, 0})
+    {}
+
+    PBMpscQueue<QString> queue;
+    std::thread writer;
+    QFile file;
+};
+
+DebugLogSink::DebugLogSink() = default;
+
+DebugLogSink::~DebugLogSink()
+{
+    stop();
+}
+
+DebugLogSink &DebugLogSink::instance()
+{
+    static DebugLogSink sink;
+    return sink;
+}
+
+bool DebugLogSink::start(const QString &filePath, size_t capacity)
+{
+    if (mbRunning.load(std::memory_order_acquire))
+        return false;
+
+    auto state = std::make_unique<State>(capacity > 0 ? capacity : DefaultCapacity);
+    if (filePath.isEmpty())
+    {
+        if (!state->file.open(stderr, QIODevice::WriteOnly | QIODevice::Text))
+            return false;
+    }
+    else
+    {
+        state->file.setFileName(filePath);
+        if (!state->file.open(QIODevice::Append | QIODevice::Text))
+            return false;
+    }
+
+    mpState = std::move(state);
+    muDropped.store(0, std::memory_order_relaxed);
+    mpState->writer = std::thread(&DebugLogSink::writerLoop, this);
+    mbRunning.store(true, std::memory_order_release);
+    mPreviousHandler = qInstallMessageHandler(&DebugLogSink::messageHandler);
+    return true;
+}
+
+void DebugLogSink::stop()
+{
+    if (!mbRunning.exchange(false, std::memory_order_acq_rel))
+        return;
+
+    qInstallMessageHandler(mPreviousHandler);
+    mPreviousHandler = nullptr;
+    // The writer drains what is queued before it sees the finished flag.
+    mpState->queue.set_finished();
+    if (mpState->writer.joinable())
+        mpState->writer.join();
+    mpState->file.close();
+}
+
+void DebugLogSink::messageHandler(QtMsgType type, const QMessageLogContext &context, const QString &message)
+{
+    DebugLogSink &sink = instance();
+    if (type == QtFatalMsg || !sink.mbRunning.load(std::memory_order_acquire))
+    {
+        if (sink.mPreviousHandler)
+            sink.mPreviousHandler(type, context, message);
+        else
+            std::fprintf(stderr, "%s\n", message.toLocal8Bit().constData());
+        return;
+    }
+
+    QString line = message;
+    if (!sink.mpState->queue.try_enqueue(line))
+        sink.muDropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+void DebugLogSink::writerLoop()
+{
+    State &state = *mpState;
+    std::vector<QString> batch;
+    batch.reserve(256);
+    uint64_t reportedDropped = 0;
+
+    while (state.queue.dequeue_bulk(std::back_inserter(batch), 256) > 0)
+    {
+        const uint64_t dropped = muDropped.load(std::memory_order_relaxed);
+        if (dropped != reportedDropped)
+        {
+            state.file.write(QByteArray("[[Warning] log sink dropped ")
+                             + QByteArray::number(static_cast<qulonglong>(dropped - reportedDropped))
+                             + " messages]\n");
+            reportedDropped = dropped;
+        }
+        for (const QString &line : batch)
+        {
+            state.file.write(line.toUtf8());
+            state.file.write("\n", 1);
+        }
+        state.file.flush();
+        batch.clear();
+    }
+}
@@ -14,11 +14,17 @@
 
 #pragma once
 
-#include <QDateTime>
+#include <QDateTime>        // Kept for files that relied on this header for them
 #include <QFileInfo>
+#include <QDebug>
 #include <QLoggingCategory>
+#include <QString>
 #include "CVDevLibrary.hpp"
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
 // Qt Logging Category for debug messages
 // Can be controlled at runtime via:
 // - Environment variable: QT_LOGGING_RULES="DebugLogging.info=false" or "DebugLogging.warning=false"
@@ -26,7 +32,146 @@
 // Export the logging category symbol from CVDevLibrary on Windows
 CVDEVSHAREDLIB_EXPORT Q_DECLARE_LOGGING_CATEGORY(DebugLogging)
 
-// Logging macros with datetime and line number using Qt Logging Category
-#define DEBUG_LOG_INFO() qCInfo(DebugLogging) << "[[Info] " << QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm:ss.zzz") << "|" << QFileInfo(__FILE__).fileName() << ":" << __LINE__ << "]"
-#define DEBUG_LOG_WARNING() qCWarning(DebugLogging) << "[[Warning] " << QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm:ss.zzz") << "|" << QFileInfo(__FILE__).fileName() << ":" << __LINE__ << "]"
-#define DEBUG_LOG_CRITICAL() qCritical(DebugLogging) << "[[Critical] " << QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm:ss.zzz") << "|" << QFileInfo(__FILE__).fileName() << ":" << __LINE__ << "]"
+// Compile-time level floor. Macros below the floor expand to dead code, so
+// neither the prefix nor the streamed operands are compiled into the binary.
+// Set with -DCVDEV_LOG_MIN_LEVEL=<n> (CMake cache variable of the same name).
+#define CVDEV_LOG_LEVEL_INFO     0
+#define CVDEV_LOG_LEVEL_WARNING  1
+#define CVDEV_LOG_LEVEL_CRITICAL 2
+#define CVDEV_LOG_LEVEL_OFF      3
+
+#ifndef CVDEV_LOG_MIN_LEVEL
+#define CVDEV_LOG_MIN_LEVEL CVDEV_LOG_LEVEL_INFO
+#endif
+
+namespace DebugLog
+{
+
+/**
+ * @brief File name part of a path, evaluated at compile time for __FILE__.
+ */
+constexpr const char *
+baseName(const char *path)
+{
+    const char *name = path;
+    for (const char *p = path; *p; ++p)
+    {
+        if (*p == '/' || *p == '\\')
+            name = p + 1;
+    }
+    return name;
+}
+
+/**
+ * @brief Line prefix "[[Level] yyyy-MM-dd hh:mm:ss.zzz | file:line]".
+ *
+ * Streamed as the first operand of every DEBUG_LOG_* statement. Like the
+ * other operands it is only evaluated once the category check has passed,
+ * and it formats the timestamp into a stack buffer.
+ */
+struct Prefix
+{
+    const char *level;
+    const char *file;
+    int line;
+};
+
+CVDEVSHAREDLIB_EXPORT QDebug operator<<(QDebug debug, const Prefix &prefix);
+
+} // namespace DebugLog
+
+// Forces compile-time evaluation of the file name.
+#define CVDEV_LOG_FILE_NAME \
+    ([]() { constexpr const char *name = DebugLog::baseName(__FILE__); return name; }())
+
+// Statement that accepts operator<< and is never executed.
+#define CVDEV_LOG_DISABLED() while (false) QMessageLogger().noDebug()
+
+// Logging macros with datetime and line number using Qt Logging Category.
+// qCInfo/qCWarning/qCCritical test the category before evaluating anything
+// that is streamed, so a runtime-disabled statement costs one flag test.
+#if CVDEV_LOG_MIN_LEVEL <= CVDEV_LOG_LEVEL_INFO
+#define DEBUG_LOG_INFO() qCInfo(DebugLogging) << DebugLog::Prefix{"Info", CVDEV_LOG_FILE_NAME, __LINE__}
+#else
+#define DEBUG_LOG_INFO() CVDEV_LOG_DISABLED()
+#endif
+
+#if CVDEV_LOG_MIN_LEVEL <= CVDEV_LOG_LEVEL_WARNING
+#define DEBUG_LOG_WARNING() qCWarning(DebugLogging) << DebugLog::Prefix{"Warning", CVDEV_LOG_FILE_NAME, __LINE__}
+#else
+#define DEBUG_LOG_WARNING() CVDEV_LOG_DISABLED()
+#endif
+
+#if CVDEV_LOG_MIN_LEVEL <= CVDEV_LOG_LEVEL_CRITICAL
+#define DEBUG_LOG_CRITICAL() qCCritical(DebugLogging) << DebugLog::Prefix{"Critical", CVDEV_LOG_FILE_NAME, __LINE__}
+#else
+#define DEBUG_LOG_CRITICAL() CVDEV_LOG_DISABLED()
+#endif
+
+/**
+ * @class DebugLogSink
+ * @brief Asynchronous Qt message handler writing to a file or stderr.
+ *
+ * Once started, every Qt message (DEBUG_LOG_* included) is pushed into a
+ * lock-free ring buffer and written by a background thread, so processing
+ * threads never wait on disk or console I/O. When the buffer is full the
+ * message is dropped and counted rather than blocking the caller; the writer
+ * reports the number of dropped messages in the log. Fatal messages bypass
+ * the buffer and go to the previous handler.
+ *
+ * **Typical Usage:**
+ * @code
+ * DebugLogSink::instance().start(logDir.filePath("log.txt"));
+ * ...
+ * DebugLogSink::instance().stop();   // flushes what is queued
+ * @endcode
+ */
+class CVDEVSHAREDLIB_EXPORT DebugLogSink
+{
+public:
+    static constexpr size_t DefaultCapacity = 8192;
+
+    /**
+     * @brief Returns the process-wide sink.
+     */
+    static DebugLogSink &instance();
+
+    /**
+     * @brief Installs the message handler and starts the writer thread.
+     *
+     * @param filePath File to append to; empty writes to stderr
+     * @param capacity Messages the ring buffer holds before dropping
+     * @return false if the file could not be opened or the sink already runs
+     */
+    bool start(const QString &filePath = QString(), size_t capacity = DefaultCapacity);
+
+    /**
+     * @brief Restores the previous handler, writes what is queued and joins the writer.
+     */
+    void stop();
+
+    bool isRunning() const { return mbRunning.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Messages dropped because the ring buffer was full, since start().
+     */
+    uint64_t dropped() const { return muDropped.load(std::memory_order_relaxed); }
+
+    ~DebugLogSink();
+
+private:
+    struct State;
+
+    DebugLogSink();
+    DebugLogSink(const DebugLogSink &) = delete;
+    DebugLogSink &operator=(const DebugLogSink &) = delete;
+
+    static void messageHandler(QtMsgType type, const QMessageLogContext &context, const QString &message);
+
+    void writerLoop();
+
+    std::unique_ptr<State> mpState;                ///< Ring buffer, writer thread and output; kept until the next start()
+    QtMessageHandler mPreviousHandler{nullptr};
+    std::atomic<bool> mbRunning{false};
+    std::atomic<uint64_t> muDropped{0};
+};
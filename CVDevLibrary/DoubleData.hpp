@@ -203,6 +203,7 @@ public:
     double &
     data()
     {
+        invalidate_information();
         return mdData;
     }
 
@@ -207,6 +207,7 @@ public:
     float &
     data()
     {
+        invalidate_information();
         return mfData;
     }
 
@@ -21,10 +21,26 @@ InformationData::InformationData()
 }
 
 InformationData::InformationData(QString const &text)
-    : mQSData(text), mlTimeStamp(0)
+    : mQSData(text), mlTimeStamp(0), mbInformationStale(false)
 {
 }
 
+InformationData::InformationData(InformationData const &other)
+    : NodeData(other), mQSData(other.info()), mlTimeStamp(other.mlTimeStamp), mbInformationStale(false)
+{
+}
+
+InformationData & InformationData::operator=(InformationData const &other)
+{
+    if (this != &other)
+    {
+        mQSData = other.info();
+        mlTimeStamp = other.mlTimeStamp;
+        mbInformationStale.store(false, std::memory_order_relaxed);
+    }
+    return *this;
+}
+
 NodeDataType InformationData::type() const
 {
     return NodeDataType{"Information", "Inf"};
@@ -38,6 +54,7 @@ void InformationData::set_information()
 void InformationData::set_information(QString const &text)
 {
     mQSData = text;
+    mbInformationStale.store(false, std::memory_order_relaxed);
 }
 
 void InformationData::set_timestamp(long int const &time)
@@ -54,6 +71,17 @@ void InformationData::set_timestamp()
 
 QString const & InformationData::info() const
 {
+    if (mbInformationStale.load(std::memory_order_acquire))
+    {
+        // Readers of one stale object: the first formats, the others wait and reuse its text
+        QMutexLocker locker(&mInformationMutex);
+        if (mbInformationStale.load(std::memory_order_relaxed))
+        {
+            // set_information() only rewrites the cached text
+            const_cast<InformationData *>(this)->set_information();
+            mbInformationStale.store(false, std::memory_order_release);
+        }
+    }
     return mQSData;
 }
 
@@ -17,6 +17,8 @@
 #include "CVDevLibrary.hpp"
 #include <QtNodes/NodeData>
 #include <QDateTime>
+#include <QMutex>
+#include <atomic>
 
 using QtNodes::NodeData;
 using QtNodes::NodeDataType;
@@ -28,6 +30,14 @@ using QtNodes::NodeDataType;
  * Stores a QString for human-readable information and an optional timestamp.
  * Derived classes override set_information() to format specific data types.
  *
+ * **Lazy Formatting:**
+ * Most frames are never shown in an information display, so the text is not
+ * built when the data changes. Derived classes call invalidate_information()
+ * from their mutators (including the non-const data() accessors); info()
+ * runs set_information() on first access after that and caches the result.
+ * Concurrent info() calls on one object are safe: the first formats the text
+ * under a mutex and the others wait for it.
+ *
  * **Core Functionality:**
  * - **Information Storage:** QString for formatted display
  * - **Timestamp Tracking:** Optional long int timestamp (milliseconds since epoch)
@@ -55,9 +65,13 @@ using QtNodes::NodeDataType;
  *     void set_information() override {
  *         // Format member data into mQSData
  *         mQSData = QString("Value: %1").arg(mValue);
- *         set_timestamp();  // Optional
  *     }
- *     
+ *
+ *     void set_value(double value) {
+ *         mValue = value;
+ *         invalidate_information();  // Reformatted on the next info()
+ *     }
+ *
  * private:
  *     double mValue{0.0};
  * };
@@ -82,6 +96,14 @@ public:
      */
     InformationData();
 
+    /**
+     * @brief Copies the formatted text and timestamp of @p other.
+     *
+     * Defined because the formatting lock cannot be copied; each object gets its own.
+     */
+    InformationData(InformationData const &other);
+    InformationData &operator=(InformationData const &other);
+
     /**
      * @brief Virtual destructor for proper polymorphic deletion.
      */
@@ -122,7 +144,8 @@ public:
     /**
      * @brief Virtual method to update information from derived class data.
      *
-     * Called by derived classes to format their specific data into mQSData.
+     * Formats the derived class data into mQSData. info() calls it lazily,
+     * so there is normally no need to call it directly.
      * Base implementation does nothing; derived classes override.
      *
      * **Derivation Example:**
@@ -190,7 +213,11 @@ public:
     void set_timestamp();
 
     /**
-     * @brief Returns the stored information text.
+     * @brief Returns the information text, formatting it first if stale.
+     *
+     * Runs set_information() only if the data changed since the last call.
+     * Any number of threads may call it at once; none of them may run while
+     * another thread modifies the object.
      *
      * @return const QString& Reference to information string
      *
@@ -222,6 +249,17 @@ public:
     long int const & timestamp() const;
 
 protected:
+    /**
+     * @brief Marks the information text as out of date.
+     *
+     * Derived classes call this whenever their data may have changed; the
+     * text is rebuilt on the next info(). Costs a single store.
+     */
+    void invalidate_information()
+    {
+        mbInformationStale.store(true, std::memory_order_relaxed);
+    }
+
     /**
      * @brief Information text storage.
      *
@@ -235,4 +273,13 @@ protected:
      * Zero if not set. Use set_timestamp() to populate.
      */
     long int mlTimeStamp{0};
+
+    /**
+     * @brief True while mQSData does not reflect the current data.
+     */
+    mutable std::atomic<bool> mbInformationStale{true};
+
+private:
+    /// Serializes the set_information() run by concurrent info() calls.
+    mutable QMutex mInformationMutex;
 };
\ No newline at end of file
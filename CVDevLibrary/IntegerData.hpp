@@ -179,6 +179,7 @@ public:
     int &
     data()
     {
+        invalidate_information();
         return miData;
     }
 
@@ -198,6 +199,7 @@ public:
     set_data( int data )
     {
         miData = data;
+        invalidate_information();
         InformationData::set_timestamp();
     }
 
@@ -47,7 +47,6 @@
 #include <QSettings>
 #include <QDate>
 #include <QStandardPaths>
-#include <QPointer>
 #include <QProcess>
 #include <QUndoStack>
 #include <QLabel>
@@ -60,14 +59,17 @@
 #include "PluginInterface.hpp"
 #include "PBDataFlowGraphicsScene.hpp"
 #include "PBFlowGraphicsView.hpp"
+#include "PBNodePainter.hpp"
 #include "ViewTransformCommand.hpp"
 #include "PropertyChangeCommand.hpp"
 #include "GroupCommands.hpp"
 #include "CycloneDDSBridge.hpp"
+#include "SharedMemoryBridge.hpp"
 #include "CycloneDDSSettingsDialog.hpp"
 #include "TransportModeManager.hpp"
+#include "PBTransportRouter.hpp"
+#include "PBWorkerExecutor.hpp"
 #include "ZenohBridge.hpp"
-#include "NodeDataSerializer.hpp"
 #include "ZenohSettingsDialog.hpp"
 #include "PBNodeGroup.hpp"
 #include "PBNodeGroupGraphicsItem.hpp"
@@ -110,6 +112,23 @@ MainWindow::MainWindow( QWidget *parent )
     ui->menuSettings->addAction(mpActionReadOnly);
     connect(mpActionReadOnly, &QAction::triggered, this, &MainWindow::toggleReadOnlyMode);
 
+    // Node metrics: overlay in the View menu, export in the File menu
+    mpActionMetricsOverlay = new QAction(tr("Node Metrics Overlay"), this);
+    mpActionMetricsOverlay->setCheckable(true);
+    ui->mpMenuView->addSeparator();
+    ui->mpMenuView->addAction(mpActionMetricsOverlay);
+    connect(mpActionMetricsOverlay, &QAction::triggered, this, &MainWindow::toggleMetricsOverlay);
+    mpMetricsOverlayTimer = new QTimer(this);
+    mpMetricsOverlayTimer->setInterval(500);
+    connect(mpMetricsOverlayTimer, &QTimer::timeout, this, [this]() {
+        if (auto *scene = getCurrentScene())
+            scene->update();
+    });
+    auto *actionExportMetrics = new QAction(tr("Export Node Metrics..."), this);
+    ui->mpMenuFile->insertAction(ui->mpActionQuit, actionExportMetrics);
+    ui->mpMenuFile->insertSeparator(ui->mpActionQuit);
+    connect(actionExportMetrics, &QAction::triggered, this, &MainWindow::exportNodeMetrics);
+
     // Initialize Preset Status Badge
     mpPresetStatusLabel = new QLabel(this);
     mpPresetStatusLabel->setObjectName("presetStatusBadge");
@@ -220,6 +239,9 @@ MainWindow::MainWindow( QWidget *parent )
         QMessageBox::warning(this, msProgramName, "<p>This version is too old. There might be a newer version with some bugs fixed and improvements. "
                                                  "Please contact <a href=mailto:pished.bunnun@nectec.or.th>pished.bunnun@nectec.or.th</a> to get a new version.</p>");
 
+    // Follows the connections of every scene model in Zenoh/CycloneDDS modes
+    mpTransportRouter = new PBTransportRouter( this );
+
     // Create shared registry for all node types (plugins + built-in nodes)
     mpDelegateModelRegistry = std::make_shared<NodeDelegateModelRegistry>();
     // NOTE: Plugin loading deferred below to speed up initial GUI appearance.
@@ -321,6 +343,7 @@ MainWindow::MainWindow( QWidget *parent )
     mpOperationModeActionGroup->addAction(ui->mpActionModeQt);
     mpOperationModeActionGroup->addAction(ui->mpActionModeZenoh);
     mpOperationModeActionGroup->addAction(ui->mpActionModeCycloneDDS);
+    mpOperationModeActionGroup->addAction(ui->mpActionModeSharedMemory);
 
 #ifndef ZENOH_ENABLED
     ui->mpActionModeZenoh->setEnabled(false);
@@ -332,6 +355,11 @@ MainWindow::MainWindow( QWidget *parent )
     ui->mpActionModeCycloneDDS->setToolTip(tr("CycloneDDS support was disabled at compile time because its library was missing."));
 #endif
 
+#ifndef __linux__
+    ui->mpActionModeSharedMemory->setEnabled(false);
+    ui->mpActionModeSharedMemory->setToolTip(tr("Shared memory transport is only available on Linux."));
+#endif
+
     connect(mpOperationModeActionGroup,
         &QActionGroup::triggered,
         this,
@@ -360,111 +388,39 @@ MainWindow::MainWindow( QWidget *parent )
     updateTransportModeStatusBadge();
     nodeChanged();
 
-    QString computerId = settings.value("computer_id", "").toString().trimmed();
-    if (computerId.isEmpty()) {
-        computerId = QSysInfo::machineHostName();
-    }
-    
-    settings.beginGroup("Zenoh");
-    QString mode = settings.value("mode", "").toString();
-    QString connect = settings.value("connect", "").toString();
-    QString listen = settings.value("listen", "").toString();
-    bool multicast = settings.value("multicast", true).toBool();
-    bool sharedMemory = settings.value("sharedMemory", true).toBool();
+    // Shared executor for async nodes set to "Shared Executor"; threads start on first use
+    settings.beginGroup("Executor");
+    ExecutorConfig executorConfig;
+    executorConfig.workerCount = settings.value("worker_threads", 0).toInt();
+    executorConfig.pinThreads = settings.value("pin_threads", false).toBool();
+    executorConfig.numaAware = settings.value("numa_aware", true).toBool();
     settings.endGroup();
-    
-    // Build configuration string if custom settings exist
-    QString zenohConfig;
-    if (!mode.isEmpty() && mode != "peer") {
-        // Only build config if non-default settings exist
-        QStringList configLines;
-        configLines << "{";
-        configLines << QString("  mode: \"%1\",").arg(mode);
-        
-        if (!connect.isEmpty()) {
-            QStringList endpoints = connect.split(',', Qt::SkipEmptyParts);
-            configLines << "  connect: {";
-            configLines << "    endpoints: [";
-            for (int i = 0; i < endpoints.size(); ++i) {
-                QString ep = endpoints[i].trimmed();
-                configLines << QString("      \"%1\"%2").arg(ep).arg(i < endpoints.size() - 1 ? "," : "");
-            }
-            configLines << "    ]";
-            configLines << "  },";
-        }
-        
-        if (!listen.isEmpty()) {
-            QStringList endpoints = listen.split(',', Qt::SkipEmptyParts);
-            configLines << "  listen: {";
-            configLines << "    endpoints: [";
-            for (int i = 0; i < endpoints.size(); ++i) {
-                QString ep = endpoints[i].trimmed();
-                configLines << QString("      \"%1\"%2").arg(ep).arg(i < endpoints.size() - 1 ? "," : "");
-            }
-            configLines << "    ]";
-            configLines << "  },";
-        }
-        
-        configLines << "  scouting: {";
-        configLines << "    multicast: {";
-        configLines << QString("      enabled: %1").arg(multicast ? "true" : "false");
-        configLines << "    }";
-        configLines << "  },";
-        
-        configLines << "  transport: {";
-        configLines << "    shared_memory: {";
-        configLines << QString("      enabled: %1").arg(sharedMemory ? "true" : "false");
-        configLines << "    }";
-        configLines << "  }";
-        
-        configLines << "}";
-        zenohConfig = configLines.join("\n");
-    }
-    
-    if (ZenohBridge::instance().initialize(computerId, zenohConfig)) {
-        qInfo() << "[MainWindow] Zenoh initialized successfully with computer ID:" << computerId;
-        if (!zenohConfig.isEmpty()) {
-            qInfo() << "[MainWindow] Using custom Zenoh configuration";
-        }
-    } else {
-        if (requiresZenoh(TransportModeManager::instance().getTransportMode())) {
-            qInfo() << "[MainWindow] Zenoh not available - running in Qt-only mode";
-            TransportModeManager::instance().setTransportMode(TransportMode::QtOnly);
-            syncOperationModeMenu(TransportMode::QtOnly);
-            updateTransportModeStatusBadge();
+    PBWorkerExecutor::instance().configure(executorConfig);
+
+    // Zenoh and CycloneDDS sessions; the mode falls back to Qt if its bridge is unavailable.
+    const TransportMode activeMode = PBTransportRouter::initializeBridges(settings);
+    if (activeMode != startupMode) {
+        syncOperationModeMenu(activeMode);
+        updateTransportModeStatusBadge();
 
-            QSettings saveSettings(msSettingFilename, QSettings::IniFormat);
-            saveSettings.setValue("transport_mode", TransportModeManager::settingFromTransportMode(TransportMode::QtOnly));
+        QSettings saveSettings(msSettingFilename, QSettings::IniFormat);
+        saveSettings.setValue("transport_mode", TransportModeManager::settingFromTransportMode(activeMode));
 
+        if (requiresZenoh(startupMode)) {
             QMessageBox::warning(this,
                                  "Zenoh Transport Unavailable",
                                  "Transport mode was set to Zenoh, but Zenoh failed to initialize.\n"
                                  "The application has fallen back to Qt for this session.");
-        }
-    }
-
-    QSettings cycloneddsSettings(msSettingFilename, QSettings::IniFormat);
-    cycloneddsSettings.beginGroup("CycloneDDS");
-    const int domainId = cycloneddsSettings.value("domain_id", 0).toInt();
-    const QString partition = cycloneddsSettings.value("partition", "").toString();
-    cycloneddsSettings.endGroup();
-
-    if (CycloneDDSBridge::instance().initialize(computerId, domainId, partition)) {
-        qInfo() << "[MainWindow] CycloneDDS initialized successfully";
-    } else {
-        if (requiresDDS(TransportModeManager::instance().getTransportMode())) {
-            qInfo() << "[MainWindow] CycloneDDS not available - running in Qt-only mode";
-            TransportModeManager::instance().setTransportMode(TransportMode::QtOnly);
-            syncOperationModeMenu(TransportMode::QtOnly);
-            updateTransportModeStatusBadge();
-
-            QSettings saveSettings(msSettingFilename, QSettings::IniFormat);
-            saveSettings.setValue("transport_mode", TransportModeManager::settingFromTransportMode(TransportMode::QtOnly));
-
+        } else if (requiresDDS(startupMode)) {
             QMessageBox::warning(this,
                                  "CycloneDDS Transport Unavailable",
                                  "Transport mode was set to CycloneDDS, but CycloneDDS failed to initialize.\n"
                                  "The application has fallen back to Qt for this session.");
+        } else if (requiresSharedMemory(startupMode)) {
+            QMessageBox::warning(this,
+                                 "Shared Memory Transport Unavailable",
+                                 "Transport mode was set to Shared Memory, but it is not supported on this platform.\n"
+                                 "The application has fallen back to Qt for this session.");
         }
     }
     updateTransportModeStatusBadge();
@@ -493,8 +449,7 @@ MainWindow::
 {
     // Shutdown Zenoh session before cleaning up scenes
     qInfo() << "[MainWindow] Shutting down Zenoh...";
-    ZenohBridge::instance().shutdown();
-    CycloneDDSBridge::instance().shutdown();
+    PBTransportRouter::shutdownBridges();
 
     // Proper cleanup order is critical
     // Delete in reverse order of creation: view -> scene -> model
@@ -502,7 +457,7 @@ MainWindow::
     {
         struct SceneProperty sceneProperty = mlSceneProperty.back();
 
-        removeZenohRoutesForModel(sceneProperty.pDataFlowGraphModel);
+        mpTransportRouter->detachModel(sceneProperty.pDataFlowGraphModel);
 
         // Delete view first (it references the scene)
         delete sceneProperty.pFlowGraphicsView;
@@ -512,6 +467,8 @@ MainWindow::
         delete sceneProperty.pDataFlowGraphModel;
         mlSceneProperty.pop_back();
     }
+    // Every async node has closed its strand by now
+    PBWorkerExecutor::instance().shutdown();
 
     delete mpVariantManager;
     delete mpPropertyEditor;
@@ -1520,275 +1477,6 @@ groupDissolved( GroupId groupId )
     removeFromGroupTree(groupId);
 }
 
-QString
-MainWindow::
-makeTransportSourceKey(const QString& sourceNodeId, PortIndex outPortIndex) const
-{
-    return QString("%1:%2").arg(sourceNodeId).arg(outPortIndex);
-}
-
-void
-MainWindow::
-removeZenohRoutesForModel(PBDataFlowGraphModel* model)
-{
-    if (!model) {
-        return;
-    }
-
-    QMap<QString, QVector<TransportRouteTarget>> cleaned;
-
-    for (auto it = mTransportRoutesBySource.begin(); it != mTransportRoutesBySource.end(); ++it) {
-        QVector<TransportRouteTarget> keptTargets;
-        for (const auto& target : it.value()) {
-            if (target.model != model) {
-                keptTargets.push_back(target);
-            }
-        }
-
-        if (!keptTargets.isEmpty()) {
-            cleaned[it.key()] = keptTargets;
-            continue;
-        }
-
-        const QStringList parts = it.key().split(':');
-        if (parts.size() == 2) {
-            bool ok = false;
-            int outPort = parts[1].toInt(&ok);
-            if (ok) {
-                ZenohBridge::instance().unsubscribe(parts[0], outPort, model->transportFlowFilename());
-            }
-        }
-    }
-
-    mTransportRoutesBySource.swap(cleaned);
-}
-
-void
-MainWindow::
-onConnectionCreated( QtNodes::ConnectionId connectionId )
-{
-    const auto mode = TransportModeManager::instance().getTransportMode();
-    const bool useZenohTransport = (mode == TransportMode::ZenohOnly);
-    const bool useCycloneDDSTransport = (mode == TransportMode::CycloneDDSOnly);
-
-    if (!useZenohTransport && !useCycloneDDSTransport) {
-        return;
-    }
-
-    // Get model from sender if called via signal, fallback to current active model
-    auto* model = qobject_cast<PBDataFlowGraphModel*>(sender());
-    if (!model) {
-        model = getCurrentModel();
-    }
-    if (!model) {
-        return;
-    }
-
-    // Get source and target nodes
-    NodeId outNodeId = connectionId.outNodeId;
-    NodeId inNodeId = connectionId.inNodeId;
-    PortIndex outPortIndex = connectionId.outPortIndex;
-    PortIndex inPortIndex = connectionId.inPortIndex;
-
-    // Get node delegate models
-    auto outNode = dynamic_cast<PBNodeDelegateModel*>(model->delegateModel<PBNodeDelegateModel>(outNodeId));
-    auto inNode = dynamic_cast<PBNodeDelegateModel*>(model->delegateModel<PBNodeDelegateModel>(inNodeId));
-
-    if (!outNode || !inNode) {
-        return;
-    }
-
-    const QString sourceNodeId = outNode->getNodeId();
-    const QString sourceKey = makeTransportSourceKey(sourceNodeId, outPortIndex);
-
-    auto& routeTargets = mTransportRoutesBySource[sourceKey];
-    bool alreadyRouted = false;
-    for (const auto& target : routeTargets) {
-        if (target.model == model &&
-            target.inNodeId == inNodeId &&
-            target.inPortIndex == inPortIndex) {
-            alreadyRouted = true;
-            break;
-        }
-    }
-
-    if (!alreadyRouted) {
-        TransportRouteTarget target;
-        target.model = model;
-        target.inNodeId = inNodeId;
-        target.inPortIndex = inPortIndex;
-        routeTargets.push_back(target);
-    }
-
-    // Subscribe once per source key and fan out in-process to all targets.
-    if (routeTargets.size() == 1) {
-        QPointer<MainWindow> weakThis(this);
-        auto callback = [weakThis, sourceKey](std::shared_ptr<QtNodes::NodeData> data) {
-            QObject* target = qApp ? static_cast<QObject*>(qApp) : static_cast<QObject*>(weakThis.data());
-            if (!target) {
-                return;
-            }
-
-            QMetaObject::invokeMethod(target, [weakThis, sourceKey, data]() {
-                if (!weakThis) {
-                    return;
-                }
-
-                auto it = weakThis->mTransportRoutesBySource.find(sourceKey);
-                if (it == weakThis->mTransportRoutesBySource.end() || !data) {
-                    return;
-                }
-
-                const auto targets = it.value();
-                for (const auto& target : targets) {
-                    if (!target.model) {
-                        continue;
-                    }
-
-                    auto targetNode = dynamic_cast<PBNodeDelegateModel*>(
-                        target.model->delegateModel<PBNodeDelegateModel>(target.inNodeId));
-                    if (targetNode) {
-                        targetNode->setInData(data, target.inPortIndex);
-                    }
-                }
-            }, Qt::QueuedConnection);
-        };
-
-        if (useZenohTransport) {
-            if (ZenohBridge::instance().subscribe(sourceNodeId,
-                                 static_cast<int>(outPortIndex),
-                                 callback,
-                                 model->transportFlowFilename())) {
-                qInfo() << "[MainWindow] Zenoh subscription created:"
-                        << sourceNodeId << "port" << outPortIndex;
-            } else {
-                mTransportRoutesBySource.remove(sourceKey);
-            }
-            return;
-        }
-
-        const QString topicName = TransportModeManager::makeTransportOutputTopicKey(
-            CycloneDDSBridge::instance().getComputerId(),
-            model->transportFlowFilename(),
-            sourceNodeId,
-            outPortIndex);
-
-        QPointer<MainWindow> weakThisRaw(this);
-        auto rawCallback = [weakThisRaw, sourceKey](const QByteArray& payload) {
-            QObject* target = qApp ? static_cast<QObject*>(qApp) : static_cast<QObject*>(weakThisRaw.data());
-            if (!target) {
-                return;
-            }
-
-            QMetaObject::invokeMethod(target, [weakThisRaw, sourceKey, payload]() {
-                if (!weakThisRaw) {
-                    return;
-                }
-
-                auto it = weakThisRaw->mTransportRoutesBySource.find(sourceKey);
-                if (it == weakThisRaw->mTransportRoutesBySource.end() || payload.isEmpty()) {
-                    return;
-                }
-
-                const auto data = NodeDataSerializer::deserialize(payload);
-                if (!data) {
-                    return;
-                }
-
-                const auto targets = it.value();
-                for (const auto& targetRoute : targets) {
-                    if (!targetRoute.model) {
-                        continue;
-                    }
-
-                    auto targetNode = dynamic_cast<PBNodeDelegateModel*>(
-                        targetRoute.model->delegateModel<PBNodeDelegateModel>(targetRoute.inNodeId));
-                    if (targetNode) {
-                        targetNode->setInData(data, targetRoute.inPortIndex);
-                    }
-                }
-            }, Qt::QueuedConnection);
-        };
-
-        if (CycloneDDSBridge::instance().subscribeRaw(topicName, rawCallback)) {
-            qInfo() << "[MainWindow] CycloneDDS subscription created:"
-                    << sourceNodeId << "port" << outPortIndex;
-        } else {
-            mTransportRoutesBySource.remove(sourceKey);
-        }
-    }
-}
-
-void
-MainWindow::
-onConnectionDeleted( QtNodes::ConnectionId connectionId )
-{
-    const auto mode = TransportModeManager::instance().getTransportMode();
-    const bool useZenohTransport = (mode == TransportMode::ZenohOnly);
-    const bool useCycloneDDSTransport = (mode == TransportMode::CycloneDDSOnly);
-
-    if (!useZenohTransport && !useCycloneDDSTransport) {
-        return;
-    }
-
-    // Get model from sender if called via signal, fallback to current active model
-    auto* model = qobject_cast<PBDataFlowGraphModel*>(sender());
-    if (!model) {
-        model = getCurrentModel();
-    }
-    if (!model) {
-        return;
-    }
-
-    // Get source node
-    NodeId outNodeId = connectionId.outNodeId;
-    PortIndex outPortIndex = connectionId.outPortIndex;
-
-    auto outNode = dynamic_cast<PBNodeDelegateModel*>(model->delegateModel<PBNodeDelegateModel>(outNodeId));
-    if (!outNode) {
-        return;
-    }
-
-    NodeId inNodeId = connectionId.inNodeId;
-    PortIndex inPortIndex = connectionId.inPortIndex;
-    QString sourceNodeId = outNode->getNodeId();
-    QString sourceKey = makeTransportSourceKey(sourceNodeId, outPortIndex);
-
-    auto it = mTransportRoutesBySource.find(sourceKey);
-    if (it == mTransportRoutesBySource.end()) {
-        return;
-    }
-
-    auto& routeTargets = it.value();
-    for (int i = routeTargets.size() - 1; i >= 0; --i) {
-        const auto& target = routeTargets[i];
-        if (target.model == model &&
-            target.inNodeId == inNodeId &&
-            target.inPortIndex == inPortIndex) {
-            routeTargets.remove(i);
-        }
-    }
-
-    if (routeTargets.isEmpty()) {
-        if (useZenohTransport) {
-            ZenohBridge::instance().unsubscribe(sourceNodeId,
-                               static_cast<int>(outPortIndex),
-                               model->transportFlowFilename());
-        } else {
-            const QString topicName = TransportModeManager::makeTransportOutputTopicKey(
-                CycloneDDSBridge::instance().getComputerId(),
-                model->transportFlowFilename(),
-                sourceNodeId,
-                outPortIndex);
-            CycloneDDSBridge::instance().unsubscribeRaw(topicName);
-        }
-        mTransportRoutesBySource.remove(sourceKey);
-
-        qInfo() << "[MainWindow] Transport subscription removed:"
-                << sourceNodeId << "port" << outPortIndex;
-    }
-}
-
 void
 MainWindow::
 openZenohSettings()
@@ -1910,6 +1598,8 @@ onOperationModeTriggered(QAction *action)
         newMode = TransportMode::ZenohOnly;
     } else if (action == ui->mpActionModeCycloneDDS) {
         newMode = TransportMode::CycloneDDSOnly;
+    } else if (action == ui->mpActionModeSharedMemory) {
+        newMode = TransportMode::SharedMemoryOnly;
     }
 
     QSettings settings(msSettingFilename, QSettings::IniFormat);
@@ -1963,6 +1653,9 @@ syncOperationModeMenu(TransportMode mode)
     case TransportMode::CycloneDDSOnly:
         actionToCheck = ui->mpActionModeCycloneDDS;
         break;
+    case TransportMode::SharedMemoryOnly:
+        actionToCheck = ui->mpActionModeSharedMemory;
+        break;
 
     case TransportMode::QtOnly:
     default:
@@ -1983,16 +1676,21 @@ updateTransportModeStatusBadge()
     const auto mode = TransportModeManager::instance().getTransportMode();
     const bool isZenohOnly = (mode == TransportMode::ZenohOnly);
     const bool isCycloneDDSOnly = (mode == TransportMode::CycloneDDSOnly);
+    const bool isSharedMemoryOnly = (mode == TransportMode::SharedMemoryOnly);
     const bool zenohReady = ZenohBridge::instance().isInitialized();
     const bool ddsReady = CycloneDDSBridge::instance().isInitialized();
+    const bool shmReady = SharedMemoryBridge::instance().isInitialized();
 
     const QString modeText = isZenohOnly ? "Zenoh"
-                         : (isCycloneDDSOnly ? "CycloneDDS" : "Qt");
+                         : (isCycloneDDSOnly ? "CycloneDDS"
+                         : (isSharedMemoryOnly ? "Shared Memory" : "Qt"));
 
     const QString borderColor = isZenohOnly ? "#2a5f3a"
-                           : (isCycloneDDSOnly ? "#1f6f78" : "#2f4f7f");
+                           : (isCycloneDDSOnly ? "#1f6f78"
+                           : (isSharedMemoryOnly ? "#6f4f1f" : "#2f4f7f"));
     const QString backgroundColor = isZenohOnly ? "#13301d"
-                               : (isCycloneDDSOnly ? "#0e3136" : "#182a44");
+                               : (isCycloneDDSOnly ? "#0e3136"
+                               : (isSharedMemoryOnly ? "#33250e" : "#182a44"));
     const QString textColor = "#f0f0f0";
     mpTransportModeStatusLabel->setStyleSheet(
         QString("QLabel#transportModeStatusBadge {"
@@ -2009,10 +1707,12 @@ updateTransportModeStatusBadge()
     mpTransportModeStatusLabel->setToolTip(QString("Current node data transport mode for this session.\n"
                                                    "Zenoh initialized: %1\n"
                                                    "CycloneDDS initialized: %2\n"
+                                                   "Shared memory initialized: %3\n"
                                                    "Transport mode changes restart CVDevPro automatically.\n"
                                                    "Connection/application settings may require restart.")
                                                .arg(zenohReady ? "Yes" : "No")
-                                               .arg(ddsReady ? "Yes" : "No"));
+                                               .arg(ddsReady ? "Yes" : "No")
+                                               .arg(shmReady ? "Yes" : "No"));
 }
 
 void
@@ -2085,6 +1785,48 @@ toggleReadOnlyMode(bool checked)
     }
 }
 
+void
+MainWindow::
+toggleMetricsOverlay(bool checked)
+{
+    PBNodePainter::setMetricsOverlayVisible(checked);
+    if (checked)
+        mpMetricsOverlayTimer->start();
+    else
+        mpMetricsOverlayTimer->stop();
+    if (auto *scene = getCurrentScene())
+        scene->update();
+}
+
+void
+MainWindow::
+exportNodeMetrics()
+{
+    PBDataFlowGraphModel* model = getCurrentModel();
+    if (!model)
+        return;
+
+    QString directory = QDir::homePath();
+    if (QFileInfo::exists(msSettingFilename))
+    {
+        QSettings settings(msSettingFilename, QSettings::IniFormat);
+        directory = settings.value("Flow Directory", QDir::homePath()).toString();
+    }
+    QString selectedFilter;
+    QString filename = QFileDialog::getSaveFileName(this,
+                               tr( "Export Node Metrics to" ),
+                               directory + "/node_metrics.json",
+                               tr( "JSON Files (*.json);;CSV Files (*.csv)" ),
+                               &selectedFilter);
+    if (filename.isEmpty())
+        return;
+    if (QFileInfo(filename).suffix().isEmpty())
+        filename += selectedFilter.contains("csv") ? ".csv" : ".json";
+
+    if (!model->export_node_metrics(filename))
+        QMessageBox::warning(this, tr("Export Node Metrics"), tr("Could not write %1.").arg(filename));
+}
+
 void
 MainWindow::
 refreshCurrentTabTitle(bool dirty)
@@ -2156,6 +1898,14 @@ createScene(QString const & _filename, std::shared_ptr<NodeDelegateModelRegistry
     }
     sceneProperty.bReadOnly = false;
     sceneProperty.pDataFlowGraphModel->setTransportFlowFilename(filename);
+    {
+        QSettings settings(CVDev::cvdevIniPath(), QSettings::IniFormat);
+        sceneProperty.pDataFlowGraphModel->setEvaluationMode(PBDataFlowGraphModel::evaluationModeFromSetting(
+            settings.value("Graph/evaluation_mode", QStringLiteral("push")).toString()));
+        sceneProperty.pDataFlowGraphModel->setScheduling(PBDataFlowGraphModel::schedulingFromSetting(
+            settings.value("Graph/scheduling", QStringLiteral("immediate")).toString()));
+        sceneProperty.pDataFlowGraphModel->setBufferReuseEnabled(settings.value("Graph/buffer_reuse", false).toBool());
+    }
 
     // Step 2: Create graphics scene
     // The scene takes a REFERENCE to the model (model must outlive scene)
@@ -2185,9 +1935,8 @@ createScene(QString const & _filename, std::shared_ptr<NodeDelegateModelRegistry
     connect( model, &PBDataFlowGraphModel::groupCreated, this, &MainWindow::groupCreated );
     connect( model, &PBDataFlowGraphModel::groupDissolved, this, &MainWindow::groupDissolved );
 
-    // Connect Zenoh subscription handling for hybrid mode
-    connect( model, &PBDataFlowGraphModel::connectionCreated, this, &MainWindow::onConnectionCreated );
-    connect( model, &PBDataFlowGraphModel::connectionDeleted, this, &MainWindow::onConnectionDeleted );
+    // Route connections over Zenoh/CycloneDDS when one of those modes is active
+    mpTransportRouter->attachModel( model );
 
     // Connect preset mode signals
     connect( model, &PBDataFlowGraphModel::presetModeChanged, this, [this, model](bool enabled) {
@@ -2312,7 +2061,7 @@ closeScene( int index )
             createScene( "", mpDelegateModelRegistry );
             ui->mpTabWidget->removeTab( 0 );
         }
-        removeZenohRoutesForModel(mlSceneProperty.front().pDataFlowGraphModel);
+        mpTransportRouter->detachModel(mlSceneProperty.front().pDataFlowGraphModel);
         // Delete in proper order: view -> scene -> model
         delete mlSceneProperty.front().pFlowGraphicsView;
         delete mlSceneProperty.front().pDataFlowGraphicsScene;
@@ -2327,7 +2076,7 @@ closeScene( int index )
         {
             if( it->pFlowGraphicsView == pPage2bClosed )
             {
-                removeZenohRoutesForModel(it->pDataFlowGraphModel);
+                mpTransportRouter->detachModel(it->pDataFlowGraphModel);
                 // Delete in proper order: view -> scene -> model
                 delete it->pFlowGraphicsView;
                 delete it->pDataFlowGraphicsScene;
@@ -64,6 +64,7 @@ class QPushButton;
 class QCheckBox;
 class QSpinBox;
 class QSettings;
+class PBTransportRouter;
 
 using QtNodes::NodeId;
 using QtNodes::PortIndex;
@@ -233,24 +234,6 @@ private Q_SLOTS:
      */
     void nodeDeleted( NodeId nodeId );
     
-    /**
-     * @brief Called when a connection is created between nodes
-     * @param connectionId Connection identifier (source/target node and port)
-     * 
-     * Sets up Zenoh subscription if target node has Zenoh enabled:
-     * - Subscribes to source node's Zenoh topic
-     * - Routes received data to target node's input port
-     */
-    void onConnectionCreated( QtNodes::ConnectionId connectionId );
-    
-    /**
-     * @brief Called when a connection is deleted
-     * @param connectionId Connection identifier to remove
-     * 
-     * Cleans up Zenoh subscription if it exists.
-     */
-    void onConnectionDeleted( QtNodes::ConnectionId connectionId );
-
     /**
      * @brief Opens the Zenoh configuration settings dialog
      * 
@@ -632,6 +615,9 @@ private:
     void updateReadOnlyStatusBadge();
     void toggleReadOnlyMode(bool checked);
 
+    void toggleMetricsOverlay(bool checked);
+    void exportNodeMetrics();
+
     // Preset Parameters
     void togglePresetMode(bool checked);
     void onPresetComboChanged(int index);
@@ -646,16 +632,6 @@ private:
     void applyViewSetting(ViewSettingType type, bool value);
     void onDockVisibilityChanged(ViewSettingType type, bool visible);
 
-    QString makeTransportSourceKey(const QString& sourceNodeId, PortIndex outPortIndex) const;
-    void removeZenohRoutesForModel(PBDataFlowGraphModel* model);
-
-    struct TransportRouteTarget
-    {
-        PBDataFlowGraphModel* model{nullptr};
-        NodeId inNodeId{0};
-        PortIndex inPortIndex{0};
-    };
-
     // Member variables
     
     Ui::MainWindow *ui;  ///< Auto-generated UI components
@@ -670,6 +646,8 @@ private:
     QAction *mpActionPresetDelete{nullptr};       ///< Action to delete current preset
     QLabel *mpPresetStatusLabel{nullptr};         ///< Status badge for preset mode
     QActionGroup *mpOperationModeActionGroup{nullptr};
+    QAction *mpActionMetricsOverlay{nullptr};     ///< View menu action toggling the node metrics overlay
+    QTimer *mpMetricsOverlayTimer{nullptr};       ///< Repaints the current scene while the overlay is on
     
     /// Shared registry of all available node types (from plugins and built-ins)
     std::shared_ptr<NodeDelegateModelRegistry> mpDelegateModelRegistry;
@@ -745,8 +723,8 @@ private:
     /// Kept alive to prevent unloading plugin code while in use
     QList< QPluginLoader * > mPluginsList;
 
-    /// Source-keyed route fan-out used in ZenohOnly mode.
-    QMap< QString, QVector<TransportRouteTarget> > mTransportRoutesBySource;
+    /// Subscriptions that carry connections in ZenohOnly/CycloneDDSOnly mode.
+    PBTransportRouter * mpTransportRouter{ nullptr };
 
     QString msSettingFilename;  ///< Path to the settings INI file
     const QString msProgramName{ "CVDev" };  ///< Application name
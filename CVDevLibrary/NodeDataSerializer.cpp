@@ -16,77 +16,271 @@
 #include "SyncData.hpp"
 #include "DebugLogging.hpp"
 #include <QDebug>
+#include <QJsonValue>
+
+#include <QReadWriteLock>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <typeindex>
+#include <unordered_map>
+
+namespace
+{
+// Rows per LOSSLESS band; small enough to spread a VGA frame over several cores
+constexpr int kLosslessBandRows = 64;
+constexpr int kLosslessMaxBands = 64;
+constexpr int kLosslessDeflateLevel = 1;
+// Largest image a LOSSLESS header may ask for; same bound as a reassembled frame
+constexpr size_t kLosslessMaxImageBytes = size_t(1) << 30;
+
+constexpr uint8_t kFrameTraceMagic[4] = {'C', 'V', 'T', 'R'};
+// Magic + version + extension size
+constexpr size_t kFrameTraceHeaderSize = 9;
+
+ImageCodecSettings codecFor(NodeDataSerializer::ImageEncoding imageEncoding)
+{
+    ImageCodecSettings codec;
+    codec.encoding = imageEncoding;
+    return codec;
+}
+}
 
 // ============================================================================
-// Main Serialization Entry Point
+// Type Registry
 // ============================================================================
 
-std::vector<uint8_t> NodeDataSerializer::serialize(std::shared_ptr<QtNodes::NodeData> data,
-                                                   ImageEncoding imageEncoding)
+struct NodeDataSerializer::TypeSerializer
 {
-    if (!data) {
-        return std::vector<uint8_t>();
+    uint8_t typeId;
+    std::type_index type;
+    BodyWriter write;
+    BodyReader read;
+};
+
+/**
+ * @brief Serializers indexed by dynamic type and by wire ID.
+ *
+ * Written while types register, read for every message.
+ */
+class NodeDataSerializer::Registry
+{
+public:
+    Registry()
+    {
+        registerBuiltinTypes(*this);
     }
 
-    // Determine data type and call appropriate serializer
-    if (auto cvImage = std::dynamic_pointer_cast<CVImageData>(data)) {
-        return serializeCVImage(cvImage.get(), imageEncoding);
+    bool add(std::shared_ptr<const TypeSerializer> serializer)
+    {
+        QWriteLocker locker(&mLock);
+        const auto& byId = mById[serializer->typeId];
+        const auto byType = mByType.find(serializer->type);
+        if ((byId && byId->type != serializer->type) ||
+            (byType != mByType.end() && byType->second->typeId != serializer->typeId)) {
+            return false;
+        }
+        mByType[serializer->type] = serializer;
+        mById[serializer->typeId] = std::move(serializer);
+        return true;
     }
-    else if (auto cvPoint = std::dynamic_pointer_cast<CVPointData>(data)) {
-        return serializeCVPoint(cvPoint.get());
+
+    std::shared_ptr<const TypeSerializer> find(const std::type_index& type) const
+    {
+        QReadLocker locker(&mLock);
+        const auto it = mByType.find(type);
+        return it == mByType.end() ? nullptr : it->second;
     }
-    else if (auto cvRect = std::dynamic_pointer_cast<CVRectData>(data)) {
-        return serializeCVRect(cvRect.get());
+
+    std::shared_ptr<const TypeSerializer> find(uint8_t typeId) const
+    {
+        QReadLocker locker(&mLock);
+        return mById[typeId];
+    }
+
+private:
+    mutable QReadWriteLock mLock;
+    std::unordered_map<std::type_index, std::shared_ptr<const TypeSerializer>> mByType;
+    std::array<std::shared_ptr<const TypeSerializer>, 256> mById;
+};
+
+NodeDataSerializer::Registry& NodeDataSerializer::registry()
+{
+    static Registry registry;
+    return registry;
+}
+
+bool NodeDataSerializer::registerType(uint8_t typeId, const std::type_info& type, BodyWriter writer, BodyReader reader)
+{
+    return addType(registry(), typeId, type, std::move(writer), std::move(reader));
+}
+
+bool NodeDataSerializer::addType(Registry& registry, uint8_t typeId, const std::type_info& type,
+                                 BodyWriter writer, BodyReader reader)
+{
+    if (typeId == TYPE_UNKNOWN || !reader) {
+        return false;
     }
-    else if (auto cvScalar = std::dynamic_pointer_cast<CVScalarData>(data)) {
-        return serializeCVScalar(cvScalar.get());
+
+    auto serializer = std::make_shared<TypeSerializer>(
+        TypeSerializer{typeId, std::type_index(type), std::move(writer), std::move(reader)});
+    if (!registry.add(std::move(serializer))) {
+        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Type ID" << static_cast<int>(typeId) << "or type" << type.name()
+                            << "is already registered to another type";
+        return false;
     }
-    else if (auto cvSize = std::dynamic_pointer_cast<CVSizeData>(data)) {
-        return serializeCVSize(cvSize.get());
+    return true;
+}
+
+uint8_t NodeDataSerializer::typeIdOf(const QtNodes::NodeData& data)
+{
+    const auto serializer = registry().find(std::type_index(typeid(data)));
+    return serializer ? serializer->typeId : static_cast<uint8_t>(TYPE_UNKNOWN);
+}
+
+void NodeDataSerializer::registerBuiltinTypes(Registry& registry)
+{
+    // Images have their own segmented path; the writer is never called
+    addType(registry, TYPE_CVIMAGE, typeid(CVImageData), nullptr, &NodeDataSerializer::deserializeCVImage);
+    addType(registry, TYPE_INFORMATION, typeid(InformationData),
+            &NodeDataSerializer::writeInformation, &NodeDataSerializer::deserializeInformation);
+
+    BodyWriter writer;
+    BodyReader reader;
+    makeValueSerializer<CVScalarData>(
+        [](CVScalarData& data) -> cv::Scalar& { return data.scalar(); },
+        [](cv::Scalar&& value) { return std::make_shared<CVScalarData>(value); },
+        writer, reader);
+    addType(registry, TYPE_CVSCALAR, typeid(CVScalarData), std::move(writer), std::move(reader));
+
+    addValueType<CVPointData>(registry, TYPE_CVPOINT);
+    addValueType<CVRectData>(registry, TYPE_CVRECT);
+    addValueType<CVSizeData>(registry, TYPE_CVSIZE);
+    addValueType<BoolData>(registry, TYPE_BOOL);
+    addValueType<IntegerData>(registry, TYPE_INTEGER);
+    addValueType<DoubleData>(registry, TYPE_DOUBLE);
+    addValueType<FloatData>(registry, TYPE_FLOAT);
+    addValueType<StdStringData>(registry, TYPE_STDSTRING);
+    addValueType<StdVectorIntData>(registry, TYPE_STDVECTOR_INT);
+    addValueType<StdVectorFloatData>(registry, TYPE_STDVECTOR_FLT);
+    addValueType<StdVectorDoubleData>(registry, TYPE_STDVECTOR_DBL);
+    addValueType<SyncData>(registry, TYPE_SYNCDATA);
+    addValueType<ContourPointsData>(registry, TYPE_CONTOURS);
+}
+
+// ============================================================================
+// Main Serialization Entry Point
+// ============================================================================
+
+std::vector<uint8_t> NodeDataSerializer::serialize(std::shared_ptr<QtNodes::NodeData> data,
+                                                   ImageEncoding imageEncoding)
+{
+    if (!data) {
+        return std::vector<uint8_t>();
     }
-    else if (auto boolData = std::dynamic_pointer_cast<BoolData>(data)) {
-        return serializeBool(boolData.get());
+
+    auto serializer = registry().find(std::type_index(typeid(*data)));
+    if (!serializer && dynamic_cast<InformationData*>(data.get())) {
+        serializer = registry().find(static_cast<uint8_t>(TYPE_INFORMATION));
     }
-    else if (auto intData = std::dynamic_pointer_cast<IntegerData>(data)) {
-        return serializeInteger(intData.get());
+
+    if (!serializer) {
+        const NodeDataType nodeType = data->type();
+        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Unsupported data type for serialization"
+                            << "id:" << nodeType.id
+                            << "name:" << nodeType.name;
+        return std::vector<uint8_t>();
     }
-    else if (auto dblData = std::dynamic_pointer_cast<DoubleData>(data)) {
-        return serializeDouble(dblData.get());
+
+    if (serializer->typeId == TYPE_CVIMAGE) {
+        return serializeCVImage(static_cast<const CVImageData*>(data.get()), codecFor(imageEncoding)).flatten();
     }
-    else if (auto fltData = std::dynamic_pointer_cast<FloatData>(data)) {
-        return serializeFloat(fltData.get());
+    return serializeBody(*serializer, *data);
+}
+
+SerializedPayload NodeDataSerializer::serializeSegments(std::shared_ptr<QtNodes::NodeData> data,
+                                                        ImageEncoding imageEncoding)
+{
+    return serializeSegments(std::move(data), codecFor(imageEncoding));
+}
+
+SerializedPayload NodeDataSerializer::serializeSegments(std::shared_ptr<QtNodes::NodeData> data,
+                                                        const ImageCodecSettings& codec)
+{
+    if (data && typeid(*data) == typeid(CVImageData)) {
+        return serializeCVImage(static_cast<const CVImageData*>(data.get()), codec);
     }
-    else if (auto strData = std::dynamic_pointer_cast<StdStringData>(data)) {
-        return serializeStdString(strData.get());
+
+    // Everything else is a few bytes: a single owned segment
+    SerializedPayload payload;
+    payload.header = serialize(data);
+    return payload;
+}
+
+std::vector<uint8_t> NodeDataSerializer::serializeBody(const TypeSerializer& serializer, QtNodes::NodeData& data)
+{
+    std::vector<uint8_t> result;
+    result.push_back(PROTOCOL_VERSION);
+    result.push_back(serializer.typeId);
+    writeUInt32(result, 0);  // Data size, patched below
+
+    if (!serializer.write || !serializer.write(data, result)) {
+        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Serialization failed for type ID:" << static_cast<int>(serializer.typeId);
+        return std::vector<uint8_t>();
     }
-    else if (auto syncData = std::dynamic_pointer_cast<SyncData>(data)) {
-        return serializeSyncData(syncData.get());
+
+    const uint32_t dataSize = static_cast<uint32_t>(result.size() - 6);
+    for (int i = 0; i < 4; ++i) {
+        result[2 + i] = static_cast<uint8_t>((dataSize >> (i * 8)) & 0xFF);
     }
-    else if (auto infoData = std::dynamic_pointer_cast<InformationData>(data)) {
-        return serializeInformation(infoData.get());
+    return result;
+}
+
+// ============================================================================
+// SerializedPayload
+// ============================================================================
+
+std::vector<SerializedPayload::Segment> SerializedPayload::segments() const
+{
+    std::vector<Segment> result;
+    if (!header.empty()) {
+        result.push_back({header.data(), header.size()});
     }
-    else if (auto vecIntData = std::dynamic_pointer_cast<StdVectorIntData>(data)) {
-        return serializeStdVector(vecIntData.get(), TYPE_STDVECTOR_INT);
+    if (pixelBytes() > 0) {
+        result.push_back({pixels.data, pixelBytes()});
     }
-    else if (auto vecFltData = std::dynamic_pointer_cast<StdVectorFloatData>(data)) {
-        return serializeStdVector(vecFltData.get(), TYPE_STDVECTOR_FLT);
+    if (!trailer.empty()) {
+        result.push_back({trailer.data(), trailer.size()});
     }
-    else if (auto vecDblData = std::dynamic_pointer_cast<StdVectorDoubleData>(data)) {
-        return serializeStdVector(vecDblData.get(), TYPE_STDVECTOR_DBL);
+    return result;
+}
+
+void SerializedPayload::copyTo(uint8_t* destination) const
+{
+    for (const auto& segment : segments()) {
+        std::memcpy(destination, segment.data, segment.size);
+        destination += segment.size;
     }
+}
 
-    const NodeDataType nodeType = data->type();
-    DEBUG_LOG_WARNING() << "[NodeDataSerializer] Unsupported data type for serialization"
-                        << "id:" << nodeType.id
-                        << "name:" << nodeType.name;
-    return std::vector<uint8_t>();
+std::vector<uint8_t> SerializedPayload::flatten() const
+{
+    if (pixelBytes() == 0 && trailer.empty()) {
+        return header;
+    }
+    std::vector<uint8_t> result(size());
+    copyTo(result.data());
+    return result;
 }
 
 // ============================================================================
 // Main Deserialization Entry Point
 // ============================================================================
 
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserialize(const std::vector<uint8_t>& payload)
+std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserialize(const std::vector<uint8_t>& payload,
+                                                                   int64_t receiveUs)
 {
     // Minimum payload: version(1) + type(1) + size(4) = 6 bytes
     if (payload.size() < 6) {
@@ -113,99 +307,227 @@ std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserialize(const std::ve
 
     const uint8_t* dataPtr = &payload[6];
 
-    // Dispatch to type-specific deserializer
-    switch (typeId) {
-        case TYPE_CVIMAGE:       return deserializeCVImage(dataPtr, dataSize);
-        case TYPE_CVPOINT:       return deserializeCVPoint(dataPtr, dataSize);
-        case TYPE_CVRECT:        return deserializeCVRect(dataPtr, dataSize);
-        case TYPE_CVSCALAR:      return deserializeCVScalar(dataPtr, dataSize);
-        case TYPE_CVSIZE:        return deserializeCVSize(dataPtr, dataSize);
-        case TYPE_BOOL:          return deserializeBool(dataPtr, dataSize);
-        case TYPE_INTEGER:       return deserializeInteger(dataPtr, dataSize);
-        case TYPE_DOUBLE:        return deserializeDouble(dataPtr, dataSize);
-        case TYPE_FLOAT:         return deserializeFloat(dataPtr, dataSize);
-        case TYPE_STDSTRING:     return deserializeStdString(dataPtr, dataSize);
-        case TYPE_STDVECTOR_INT: return deserializeStdVector<int>(dataPtr, dataSize);
-        case TYPE_STDVECTOR_FLT: return deserializeStdVector<float>(dataPtr, dataSize);
-        case TYPE_STDVECTOR_DBL: return deserializeStdVector<double>(dataPtr, dataSize);
-        case TYPE_SYNCDATA:      return deserializeSyncData(dataPtr, dataSize);
-        case TYPE_INFORMATION:   return deserializeInformation(dataPtr, dataSize);
-        default:
-            DEBUG_LOG_WARNING() << "[NodeDataSerializer] Unknown type ID:" << typeId;
-            return nullptr;
+    const auto serializer = registry().find(static_cast<uint8_t>(typeId));
+    if (!serializer) {
+        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Unknown type ID:" << typeId;
+        return nullptr;
+    }
+
+    auto data = serializer->read(dataPtr, dataSize);
+    if (!data) {
+        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid data section for type ID:" << typeId;
+        return nullptr;
     }
+
+    if (typeId == TYPE_CVIMAGE) {
+        FrameMetadata metadata;
+        if (readFrameTrace(dataPtr + dataSize, payload.size() - 6 - dataSize, metadata)) {
+            if (!metadata.hops.empty()) {
+                metadata.hops.back().receiveUs = receiveUs != 0 ? receiveUs : FrameHop::now();
+            }
+            std::static_pointer_cast<CVImageData>(data)->setMetadata(std::move(metadata));
+        }
+    }
+    return data;
 }
 
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserialize(const QByteArray& payload)
+std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserialize(const QByteArray& payload,
+                                                                   int64_t receiveUs)
 {
     // Convert QByteArray to std::vector and call main deserialize
     std::vector<uint8_t> vec(reinterpret_cast<const uint8_t*>(payload.data()),
                              reinterpret_cast<const uint8_t*>(payload.data()) + payload.size());
-    return deserialize(vec);
+    return deserialize(vec, receiveUs);
+}
+
+size_t NodeDataSerializer::dataSectionEnd(const uint8_t* header, size_t size)
+{
+    if (size < 6 || header[0] != PROTOCOL_VERSION) {
+        return 0;
+    }
+    return 6 + static_cast<size_t>(readUInt32(&header[2]));
+}
+
+// ============================================================================
+// Frame trace extension
+// ============================================================================
+
+void NodeDataSerializer::appendFrameTrace(SerializedPayload& payload, const QString& hostId, uint64_t sequence)
+{
+    if (!payload.hasMetadata) {
+        return;
+    }
+
+    const FrameMetadata& metadata = payload.metadata;
+    const size_t firstHop = metadata.hops.size() >= static_cast<size_t>(FrameHop::MaxHops)
+        ? metadata.hops.size() - FrameHop::MaxHops + 1
+        : 0;
+    FrameHop hop;
+    hop.hostId = hostId;
+    hop.sequence = sequence;
+
+    std::vector<uint8_t>& out = payload.trailer;
+    out.clear();
+    out.insert(out.end(), std::begin(kFrameTraceMagic), std::end(kFrameTraceMagic));
+    out.push_back(FRAME_TRACE_VERSION);
+    writeUInt32(out, 0);  // Extension size, patched below
+
+    const QByteArray producer = metadata.producerId.toUtf8().left(0xFFFF);
+    writeInt64(out, static_cast<int64_t>(metadata.frameId));
+    writeInt64(out, static_cast<int64_t>(metadata.timestamp));
+    out.push_back(static_cast<uint8_t>(producer.size() & 0xFF));
+    out.push_back(static_cast<uint8_t>((producer.size() >> 8) & 0xFF));
+    out.insert(out.end(), producer.constBegin(), producer.constEnd());
+
+    out.push_back(static_cast<uint8_t>(metadata.hops.size() - firstHop + 1));
+    auto writeHop = [&out](const FrameHop& entry) {
+        const QByteArray host = entry.hostId.toUtf8().left(0xFF);
+        out.push_back(static_cast<uint8_t>(host.size()));
+        out.insert(out.end(), host.constBegin(), host.constEnd());
+        writeInt64(out, static_cast<int64_t>(entry.sequence));
+        writeInt64(out, entry.publishUs);
+        writeInt64(out, entry.receiveUs);
+    };
+    for (size_t i = firstHop; i < metadata.hops.size(); ++i) {
+        writeHop(metadata.hops[i]);
+    }
+    // Stamped last so that encoding time is not counted as link latency
+    hop.publishUs = FrameHop::now();
+    writeHop(hop);
+
+    const uint32_t extensionSize = static_cast<uint32_t>(out.size() - kFrameTraceHeaderSize);
+    for (int i = 0; i < 4; ++i) {
+        out[5 + i] = static_cast<uint8_t>((extensionSize >> (i * 8)) & 0xFF);
+    }
+}
+
+bool NodeDataSerializer::readFrameTrace(const uint8_t* data, size_t size, FrameMetadata& metadata)
+{
+    if (size < kFrameTraceHeaderSize || std::memcmp(data, kFrameTraceMagic, 4) != 0) {
+        return false;
+    }
+    const uint8_t version = data[4];
+    const uint32_t extensionSize = readUInt32(&data[5]);
+    if (version != FRAME_TRACE_VERSION || extensionSize > size - kFrameTraceHeaderSize) {
+        return false;
+    }
+
+    const uint8_t* ptr = data + kFrameTraceHeaderSize;
+    const uint8_t* end = ptr + extensionSize;
+    auto remaining = [&]() { return static_cast<size_t>(end - ptr); };
+
+    if (remaining() < 18) {
+        return false;
+    }
+    FrameMetadata result;
+    result.frameId = static_cast<long>(readInt64(ptr));
+    result.timestamp = static_cast<long>(readInt64(ptr + 8));
+    const size_t producerLength = static_cast<size_t>(ptr[16]) | (static_cast<size_t>(ptr[17]) << 8);
+    ptr += 18;
+    if (remaining() < producerLength + 1) {
+        return false;
+    }
+    result.producerId = QString::fromUtf8(reinterpret_cast<const char*>(ptr), static_cast<qsizetype>(producerLength));
+    ptr += producerLength;
+
+    const uint8_t hopCount = *ptr++;
+    result.hops.reserve(hopCount);
+    for (uint8_t i = 0; i < hopCount; ++i) {
+        if (remaining() < 1) {
+            return false;
+        }
+        const size_t hostLength = *ptr++;
+        if (remaining() < hostLength + 24) {
+            return false;
+        }
+        FrameHop hop;
+        hop.hostId = QString::fromUtf8(reinterpret_cast<const char*>(ptr), static_cast<qsizetype>(hostLength));
+        ptr += hostLength;
+        hop.sequence = static_cast<uint64_t>(readInt64(ptr));
+        hop.publishUs = readInt64(ptr + 8);
+        hop.receiveUs = readInt64(ptr + 16);
+        ptr += 24;
+        result.hops.push_back(std::move(hop));
+    }
+
+    metadata = std::move(result);
+    return true;
 }
 
 // ============================================================================
 // CVImageData Serialization (with JPEG compression for efficiency)
 // ============================================================================
 
-std::vector<uint8_t> NodeDataSerializer::serializeCVImage(const CVImageData* data,
-                                                          ImageEncoding imageEncoding)
+SerializedPayload NodeDataSerializer::serializeCVImage(const CVImageData* data,
+                                                       const ImageCodecSettings& codec)
 {
-    std::vector<uint8_t> result;
-    
+    const ImageEncoding imageEncoding = codec.encoding;
+    SerializedPayload payload;
+    std::vector<uint8_t>& result = payload.header;
+
     // Write header
     result.push_back(PROTOCOL_VERSION);
     result.push_back(TYPE_CVIMAGE);
     
+    // Carried to the receiver once a bridge calls appendFrameTrace()
+    payload.hasMetadata = true;
+    payload.metadata = data->metadata();
+
     // Get cv::Mat
     cv::Mat mat = const_cast<CVImageData*>(data)->data();
     
     if (mat.empty()) {
         writeUInt32(result, 0);  // Empty image
-        return result;
+        return payload;
     }
 
-    std::vector<uint8_t> encodedBody;
-    encodedBody.push_back(static_cast<uint8_t>(imageEncoding));
-
-    if (imageEncoding == ImageEncoding::JPEG) {
-        std::vector<uint8_t> compressed;
-        std::vector<int> params = {cv::IMWRITE_JPEG_QUALITY, 95};
-        if (!cv::imencode(".jpg", mat, compressed, params)) {
-            DEBUG_LOG_WARNING() << "[NodeDataSerializer] Failed to JPEG-encode image";
-            return std::vector<uint8_t>();
-        }
-        encodedBody.insert(encodedBody.end(), compressed.begin(), compressed.end());
-    }
-    else if (imageEncoding == ImageEncoding::PNG) {
+    if (imageEncoding == ImageEncoding::JPEG || imageEncoding == ImageEncoding::PNG) {
         std::vector<uint8_t> compressed;
-        if (!cv::imencode(".png", mat, compressed)) {
-            DEBUG_LOG_WARNING() << "[NodeDataSerializer] Failed to PNG-encode image";
-            return std::vector<uint8_t>();
+        const bool isJpeg = (imageEncoding == ImageEncoding::JPEG);
+        const std::vector<int> params = isJpeg
+            ? std::vector<int>{cv::IMWRITE_JPEG_QUALITY, std::clamp(codec.jpegQuality, 1, 100)}
+            : std::vector<int>{cv::IMWRITE_PNG_COMPRESSION, std::clamp(codec.pngLevel, 0, 9)};
+        if (!cv::imencode(isJpeg ? ".jpg" : ".png", mat, compressed, params)) {
+            DEBUG_LOG_WARNING() << "[NodeDataSerializer] Failed to" << (isJpeg ? "JPEG" : "PNG")
+                                << "-encode image";
+            return SerializedPayload();
         }
-        encodedBody.insert(encodedBody.end(), compressed.begin(), compressed.end());
+        result.reserve(result.size() + 5 + compressed.size());
+        writeUInt32(result, static_cast<uint32_t>(1 + compressed.size()));
+        result.push_back(static_cast<uint8_t>(imageEncoding));
+        result.insert(result.end(), compressed.begin(), compressed.end());
     }
     else if (imageEncoding == ImageEncoding::RAW) {
-        writeUInt32(encodedBody, static_cast<uint32_t>(mat.cols));
-        writeUInt32(encodedBody, static_cast<uint32_t>(mat.rows));
-        writeInt32(encodedBody, mat.type());
-        writeUInt32(encodedBody, static_cast<uint32_t>(mat.step));
-
-        const size_t rawSize = mat.step * static_cast<size_t>(mat.rows);
-        encodedBody.insert(encodedBody.end(), mat.data, mat.data + rawSize);
+        // The pixel segment must be one run of bytes; an ROI is compacted once.
+        // Sharing the buffer keeps a pooled frame's slot held until the
+        // transport releases the payload.
+        payload.pixels = mat.isContinuous() ? mat : mat.clone();
+        const cv::Mat& pixels = payload.pixels;
+
+        writeUInt32(result, static_cast<uint32_t>(1 + 16 + payload.pixelBytes()));
+        result.push_back(static_cast<uint8_t>(imageEncoding));
+        writeUInt32(result, static_cast<uint32_t>(pixels.cols));
+        writeUInt32(result, static_cast<uint32_t>(pixels.rows));
+        writeInt32(result, pixels.type());
+        writeUInt32(result, static_cast<uint32_t>(pixels.step));
+    }
+    else if (imageEncoding == ImageEncoding::LOSSLESS) {
+        std::vector<uint8_t> encoded;
+        if (!encodeLossless(mat, encoded)) {
+            DEBUG_LOG_WARNING() << "[NodeDataSerializer] Failed to LOSSLESS-encode image";
+            return SerializedPayload();
+        }
+        result.reserve(result.size() + 5 + encoded.size());
+        writeUInt32(result, static_cast<uint32_t>(1 + encoded.size()));
+        result.push_back(static_cast<uint8_t>(imageEncoding));
+        result.insert(result.end(), encoded.begin(), encoded.end());
     }
     else {
         DEBUG_LOG_WARNING() << "[NodeDataSerializer] Unknown image encoding";
-        return std::vector<uint8_t>();
+        return SerializedPayload();
     }
 
-    // Write data size
-    writeUInt32(result, static_cast<uint32_t>(encodedBody.size()));
-
-    // Append encoded image body
-    result.insert(result.end(), encodedBody.begin(), encodedBody.end());
-    
-    return result;
+    return payload;
 }
 
 std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeCVImage(const uint8_t* data, uint32_t size)
@@ -282,6 +604,9 @@ std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeCVImage(const
                         static_cast<size_t>(step));
         mat = wrapped.clone();
     }
+    else if (encodingPrefix == static_cast<uint8_t>(ImageEncoding::LOSSLESS)) {
+        mat = decodeLossless(encodedData, encodedSize);
+    }
     else {
         DEBUG_LOG_WARNING() << "[NodeDataSerializer] Unknown image encoding prefix:" << encodingPrefix;
         return nullptr;
@@ -297,337 +622,217 @@ std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeCVImage(const
 }
 
 // ============================================================================
-// CVPointData Serialization (2 x int32)
-// ============================================================================
-
-std::vector<uint8_t> NodeDataSerializer::serializeCVPoint(const CVPointData* data)
-{
-    std::vector<uint8_t> result;
-    result.push_back(PROTOCOL_VERSION);
-    result.push_back(TYPE_CVPOINT);
-    writeUInt32(result, 8);  // 2 x int32 = 8 bytes
-
-    cv::Point pt = const_cast<CVPointData*>(data)->data();
-    writeInt32(result, pt.x);
-    writeInt32(result, pt.y);
-
-    return result;
-}
+// LOSSLESS image codec (banded delta filter + deflate)
+// ============================================================================
+
+bool NodeDataSerializer::encodeLossless(const cv::Mat& mat, std::vector<uint8_t>& result)
+{
+    const int rows = mat.rows;
+    const size_t elemSize = mat.elemSize();
+    const size_t rowBytes = static_cast<size_t>(mat.cols) * elemSize;
+    const int bands = std::clamp((rows + kLosslessBandRows - 1) / kLosslessBandRows, 1, kLosslessMaxBands);
+    const int bandRows = (rows + bands - 1) / bands;
+
+    // Each band is filtered (byte minus the same byte of the previous pixel,
+    // as PNG's Sub filter) and deflated on its own, so bands run in parallel.
+    std::vector<QByteArray> compressed(bands);
+    cv::parallel_for_(cv::Range(0, bands), [&](const cv::Range& range) {
+        std::vector<uint8_t> filtered;
+        for (int band = range.start; band < range.end; ++band) {
+            const int firstRow = band * bandRows;
+            const int lastRow = std::min(rows, firstRow + bandRows);
+            filtered.resize(rowBytes * static_cast<size_t>(lastRow - firstRow));
+            uint8_t* out = filtered.data();
+            for (int row = firstRow; row < lastRow; ++row, out += rowBytes) {
+                const uint8_t* in = mat.ptr<uint8_t>(row);
+                std::memcpy(out, in, std::min(elemSize, rowBytes));
+                for (size_t i = elemSize; i < rowBytes; ++i) {
+                    out[i] = static_cast<uint8_t>(in[i] - in[i - elemSize]);
+                }
+            }
+            compressed[band] = qCompress(filtered.data(), static_cast<qsizetype>(filtered.size()),
+                                         kLosslessDeflateLevel);
+        }
+    });
 
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeCVPoint(const uint8_t* data, uint32_t size)
-{
-    if (size != 8) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid CVPoint size";
-        return nullptr;
+    size_t total = 16;
+    for (const QByteArray& band : compressed) {
+        if (band.isEmpty()) {
+            return false;
+        }
+        total += 4 + static_cast<size_t>(band.size());
     }
 
-    int32_t x = readInt32(&data[0]);
-    int32_t y = readInt32(&data[4]);
-
-    return std::make_shared<CVPointData>(cv::Point(x, y));
-}
-
-// ============================================================================
-// CVRectData Serialization (4 x int32)
-// ============================================================================
-
-std::vector<uint8_t> NodeDataSerializer::serializeCVRect(const CVRectData* data)
-{
-    std::vector<uint8_t> result;
-    result.push_back(PROTOCOL_VERSION);
-    result.push_back(TYPE_CVRECT);
-    writeUInt32(result, 16);  // 4 x int32 = 16 bytes
-
-    cv::Rect rect = const_cast<CVRectData*>(data)->data();
-    writeInt32(result, rect.x);
-    writeInt32(result, rect.y);
-    writeInt32(result, rect.width);
-    writeInt32(result, rect.height);
-
-    return result;
-}
-
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeCVRect(const uint8_t* data, uint32_t size)
-{
-    if (size != 16) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid CVRect size";
-        return nullptr;
+    result.reserve(result.size() + total);
+    writeUInt32(result, static_cast<uint32_t>(mat.cols));
+    writeUInt32(result, static_cast<uint32_t>(rows));
+    writeInt32(result, mat.type());
+    writeUInt32(result, static_cast<uint32_t>(bands));
+    for (const QByteArray& band : compressed) {
+        writeUInt32(result, static_cast<uint32_t>(band.size()));
+        result.insert(result.end(), band.constBegin(), band.constEnd());
     }
-
-    int32_t x = readInt32(&data[0]);
-    int32_t y = readInt32(&data[4]);
-    int32_t width = readInt32(&data[8]);
-    int32_t height = readInt32(&data[12]);
-
-    return std::make_shared<CVRectData>(cv::Rect(x, y, width, height));
+    return true;
 }
 
-// ============================================================================
-// CVScalarData Serialization (4 x double)
-// ============================================================================
-
-std::vector<uint8_t> NodeDataSerializer::serializeCVScalar(const CVScalarData* data)
+cv::Mat NodeDataSerializer::decodeLossless(const uint8_t* data, uint32_t size)
 {
-    std::vector<uint8_t> result;
-    result.push_back(PROTOCOL_VERSION);
-    result.push_back(TYPE_CVSCALAR);
-    writeUInt32(result, 32);  // 4 x double = 32 bytes
-
-    cv::Scalar scalar = const_cast<CVScalarData*>(data)->scalar();
-    writeDouble(result, scalar[0]);
-    writeDouble(result, scalar[1]);
-    writeDouble(result, scalar[2]);
-    writeDouble(result, scalar[3]);
-
-    return result;
-}
-
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeCVScalar(const uint8_t* data, uint32_t size)
-{
-    if (size != 32) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid CVScalar size";
-        return nullptr;
+    if (size < 16) {
+        DEBUG_LOG_WARNING() << "[NodeDataSerializer] LOSSLESS image payload too small";
+        return cv::Mat();
     }
 
-    double v0 = readDouble(&data[0]);
-    double v1 = readDouble(&data[8]);
-    double v2 = readDouble(&data[16]);
-    double v3 = readDouble(&data[24]);
-
-    return std::make_shared<CVScalarData>(cv::Scalar(v0, v1, v2, v3));
-}
-
-// ============================================================================
-// CVSizeData Serialization (2 x int32)
-// ============================================================================
-
-std::vector<uint8_t> NodeDataSerializer::serializeCVSize(const CVSizeData* data)
-{
-    std::vector<uint8_t> result;
-    result.push_back(PROTOCOL_VERSION);
-    result.push_back(TYPE_CVSIZE);
-    writeUInt32(result, 8);  // 2 x int32 = 8 bytes
-
-    cv::Size size = const_cast<CVSizeData*>(data)->data();
-    writeInt32(result, size.width);
-    writeInt32(result, size.height);
-
-    return result;
-}
+    const uint32_t cols = readUInt32(&data[0]);
+    const uint32_t rows = readUInt32(&data[4]);
+    const int32_t cvType = readInt32(&data[8]);
+    const uint32_t bands = readUInt32(&data[12]);
+    const int depth = CV_MAT_DEPTH(cvType);
+    const int channels = CV_MAT_CN(cvType);
 
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeCVSize(const uint8_t* data, uint32_t size)
-{
-    if (size != 8) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid CVSize size";
-        return nullptr;
+    if (depth < CV_8U || depth > CV_16F || channels <= 0 || channels > CV_CN_MAX ||
+        cols == 0 || rows == 0 || bands == 0 || bands > kLosslessMaxBands || bands > rows ||
+        cols > static_cast<uint32_t>(std::numeric_limits<int>::max()) ||
+        rows > static_cast<uint32_t>(std::numeric_limits<int>::max())) {
+        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid LOSSLESS image metadata";
+        return cv::Mat();
     }
 
-    int32_t width = readInt32(&data[0]);
-    int32_t height = readInt32(&data[4]);
-
-    return std::make_shared<CVSizeData>(cv::Size(width, height));
-}
-
-// ============================================================================
-// BoolData Serialization (1 byte)
-// ============================================================================
-
-std::vector<uint8_t> NodeDataSerializer::serializeBool(const BoolData* data)
-{
-    std::vector<uint8_t> result;
-    result.push_back(PROTOCOL_VERSION);
-    result.push_back(TYPE_BOOL);
-    writeUInt32(result, 1);  // 1 byte
-
-    bool value = const_cast<BoolData*>(data)->data();
-    result.push_back(value ? 0x01 : 0x00);
-
-    return result;
-}
-
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeBool(const uint8_t* data, uint32_t size)
-{
-    if (size != 1) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid Bool size";
-        return nullptr;
+    // The header is untrusted: bound the allocation before cv::Mat makes it
+    const size_t headerRowBytes = static_cast<size_t>(cols) * CV_ELEM_SIZE(cvType);
+    if (headerRowBytes > kLosslessMaxImageBytes || rows > kLosslessMaxImageBytes / headerRowBytes) {
+        DEBUG_LOG_WARNING() << "[NodeDataSerializer] LOSSLESS image too large:" << cols << "x" << rows;
+        return cv::Mat();
     }
 
-    bool value = (data[0] != 0x00);
-    return std::make_shared<BoolData>(value);
-}
-
-// ============================================================================
-// IntegerData Serialization (int32)
-// ============================================================================
-
-std::vector<uint8_t> NodeDataSerializer::serializeInteger(const IntegerData* data)
-{
-    std::vector<uint8_t> result;
-    result.push_back(PROTOCOL_VERSION);
-    result.push_back(TYPE_INTEGER);
-    writeUInt32(result, 4);  // int32 = 4 bytes
-
-    int value = const_cast<IntegerData*>(data)->data();
-    writeInt32(result, value);
-
-    return result;
-}
+    // Locate every band before decoding so that they can be inflated in parallel
+    std::vector<std::pair<const uint8_t*, uint32_t>> bandData;
+    bandData.reserve(bands);
+    uint32_t offset = 16;
+    for (uint32_t band = 0; band < bands; ++band) {
+        if (size - offset < 4) {
+            DEBUG_LOG_WARNING() << "[NodeDataSerializer] Truncated LOSSLESS image payload";
+            return cv::Mat();
+        }
+        const uint32_t bandSize = readUInt32(&data[offset]);
+        offset += 4;
+        if (size - offset < bandSize) {
+            DEBUG_LOG_WARNING() << "[NodeDataSerializer] Truncated LOSSLESS image payload";
+            return cv::Mat();
+        }
+        bandData.emplace_back(&data[offset], bandSize);
+        offset += bandSize;
+    }
+
+    cv::Mat mat(static_cast<int>(rows), static_cast<int>(cols), cvType);
+    const size_t elemSize = mat.elemSize();
+    const size_t rowBytes = static_cast<size_t>(cols) * elemSize;
+    const int bandRows = (static_cast<int>(rows) + static_cast<int>(bands) - 1) / static_cast<int>(bands);
+    std::atomic<bool> ok{true};
+
+    cv::parallel_for_(cv::Range(0, static_cast<int>(bands)), [&](const cv::Range& range) {
+        for (int band = range.start; band < range.end; ++band) {
+            const int firstRow = band * bandRows;
+            const int lastRow = std::min(static_cast<int>(rows), firstRow + bandRows);
+            const QByteArray filtered = qUncompress(bandData[band].first,
+                                                    static_cast<qsizetype>(bandData[band].second));
+            if (firstRow >= lastRow ||
+                static_cast<size_t>(filtered.size()) != rowBytes * static_cast<size_t>(lastRow - firstRow)) {
+                ok = false;
+                return;
+            }
+            const uint8_t* in = reinterpret_cast<const uint8_t*>(filtered.constData());
+            for (int row = firstRow; row < lastRow; ++row, in += rowBytes) {
+                uint8_t* out = mat.ptr<uint8_t>(row);
+                std::memcpy(out, in, std::min(elemSize, rowBytes));
+                for (size_t i = elemSize; i < rowBytes; ++i) {
+                    out[i] = static_cast<uint8_t>(in[i] + out[i - elemSize]);
+                }
+            }
+        }
+    });
 
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeInteger(const uint8_t* data, uint32_t size)
-{
-    if (size != 4) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid Integer size";
-        return nullptr;
+    if (!ok) {
+        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Corrupt LOSSLESS image band";
+        return cv::Mat();
     }
-
-    int32_t value = readInt32(&data[0]);
-    return std::make_shared<IntegerData>(value);
+    return mat;
 }
 
 // ============================================================================
-// DoubleData Serialization (double)
+// ImageCodecSettings
 // ============================================================================
 
-std::vector<uint8_t> NodeDataSerializer::serializeDouble(const DoubleData* data)
+bool ImageCodecSettings::isDefault() const
 {
-    std::vector<uint8_t> result;
-    result.push_back(PROTOCOL_VERSION);
-    result.push_back(TYPE_DOUBLE);
-    writeUInt32(result, 8);  // double = 8 bytes
-
-    double value = const_cast<DoubleData*>(data)->data();
-    writeDouble(result, value);
-
-    return result;
+    return *this == ImageCodecSettings();
 }
 
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeDouble(const uint8_t* data, uint32_t size)
+QJsonObject ImageCodecSettings::toJson() const
 {
-    if (size != 8) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid Double size";
-        return nullptr;
-    }
-
-    double value = readDouble(&data[0]);
-    return std::make_shared<DoubleData>(value);
+    QJsonObject json;
+    json["encoding"] = encodingName(encoding);
+    json["jpeg_quality"] = jpegQuality;
+    json["png_level"] = pngLevel;
+    json["threads"] = threads;
+    return json;
 }
 
-// ============================================================================
-// FloatData Serialization (float)
-// ============================================================================
-
-std::vector<uint8_t> NodeDataSerializer::serializeFloat(const FloatData* data)
+ImageCodecSettings ImageCodecSettings::fromJson(const QJsonObject& json)
 {
-    std::vector<uint8_t> result;
-    result.push_back(PROTOCOL_VERSION);
-    result.push_back(TYPE_FLOAT);
-    writeUInt32(result, 4);  // float = 4 bytes
-
-    float value = const_cast<FloatData*>(data)->data();
-    writeFloat(result, value);
-
-    return result;
-}
-
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeFloat(const uint8_t* data, uint32_t size)
-{
-    if (size != 4) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid Float size";
-        return nullptr;
+    ImageCodecSettings codec;
+    NodeDataSerializer::ImageEncoding encoding;
+    if (encodingFromName(json["encoding"].toString(), encoding)) {
+        codec.encoding = encoding;
     }
-
-    float value = readFloat(&data[0]);
-    return std::make_shared<FloatData>(value);
+    codec.jpegQuality = std::clamp(json["jpeg_quality"].toInt(codec.jpegQuality), 1, 100);
+    codec.pngLevel = std::clamp(json["png_level"].toInt(codec.pngLevel), 0, 9);
+    codec.threads = std::clamp(json["threads"].toInt(codec.threads), 1, MaxThreads);
+    return codec;
 }
 
-// ============================================================================
-// StdStringData Serialization (length + UTF-8 bytes)
-// ============================================================================
-
-std::vector<uint8_t> NodeDataSerializer::serializeStdString(const StdStringData* data)
+QString ImageCodecSettings::encodingName(NodeDataSerializer::ImageEncoding encoding)
 {
-    std::vector<uint8_t> result;
-    result.push_back(PROTOCOL_VERSION);
-    result.push_back(TYPE_STDSTRING);
-
-    std::string str = const_cast<StdStringData*>(data)->data();
-    uint32_t length = static_cast<uint32_t>(str.size());
-
-    writeUInt32(result, 4 + length);  // size = length(4) + string bytes
-    writeUInt32(result, length);
-    result.insert(result.end(), str.begin(), str.end());
-
-    return result;
-}
-
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeStdString(const uint8_t* data, uint32_t size)
-{
-    if (size < 4) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid StdString size";
-        return nullptr;
-    }
-
-    uint32_t length = readUInt32(&data[0]);
-    if (size != 4 + length) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] StdString size mismatch";
-        return nullptr;
+    switch (encoding) {
+        case NodeDataSerializer::ImageEncoding::JPEG:     return QStringLiteral("jpeg");
+        case NodeDataSerializer::ImageEncoding::PNG:      return QStringLiteral("png");
+        case NodeDataSerializer::ImageEncoding::LOSSLESS: return QStringLiteral("lossless");
+        case NodeDataSerializer::ImageEncoding::RAW:
+        default:                                          return QStringLiteral("raw");
     }
-
-    std::string str(reinterpret_cast<const char*>(&data[4]), length);
-    return std::make_shared<StdStringData>(str);
-}
-
-// ============================================================================
-// SyncData Serialization (1 byte: bool state)
-// ============================================================================
-
-std::vector<uint8_t> NodeDataSerializer::serializeSyncData(const SyncData* data)
-{
-    std::vector<uint8_t> result;
-    result.push_back(PROTOCOL_VERSION);
-    result.push_back(TYPE_SYNCDATA);
-    writeUInt32(result, 1);  // 1 byte
-
-    bool value = const_cast<SyncData*>(data)->data();
-    result.push_back(value ? 0x01 : 0x00);
-
-    return result;
 }
 
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeSyncData(const uint8_t* data, uint32_t size)
+bool ImageCodecSettings::encodingFromName(const QString& name, NodeDataSerializer::ImageEncoding& encoding)
 {
-    if (size != 1) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid SyncData size";
-        return nullptr;
+    const QString normalized = name.trimmed().toLower();
+    if (normalized == "raw") {
+        encoding = NodeDataSerializer::ImageEncoding::RAW;
+    } else if (normalized == "jpeg" || normalized == "jpg") {
+        encoding = NodeDataSerializer::ImageEncoding::JPEG;
+    } else if (normalized == "png") {
+        encoding = NodeDataSerializer::ImageEncoding::PNG;
+    } else if (normalized == "lossless") {
+        encoding = NodeDataSerializer::ImageEncoding::LOSSLESS;
+    } else {
+        return false;
     }
-
-    auto syncData = std::make_shared<SyncData>();
-    syncData->set_data(data[0] != 0x00);
-    return syncData;
+    return true;
 }
 
 // ============================================================================
 // InformationData Serialization (timestamp + UTF-8 text)
 // ============================================================================
 
-std::vector<uint8_t> NodeDataSerializer::serializeInformation(const InformationData* data)
+bool NodeDataSerializer::writeInformation(QtNodes::NodeData& data, std::vector<uint8_t>& body)
 {
-    std::vector<uint8_t> result;
-    result.push_back(PROTOCOL_VERSION);
-    result.push_back(TYPE_INFORMATION);
-
-    const QString infoText = const_cast<InformationData*>(data)->info();
-    const QByteArray utf8 = infoText.toUtf8();
+    // Also used for unregistered subclasses, which travel as their info() text
+    auto& information = static_cast<InformationData&>(data);
+    const QByteArray utf8 = information.info().toUtf8();
     const uint32_t length = static_cast<uint32_t>(utf8.size());
-    const int64_t timestamp = static_cast<int64_t>(const_cast<InformationData*>(data)->timestamp());
-
-    // size = timestamp(8) + string length(4) + UTF-8 bytes
-    writeUInt32(result, 12 + length);
-    writeInt64(result, timestamp);
-    writeUInt32(result, length);
-    result.insert(result.end(), utf8.begin(), utf8.end());
 
-    return result;
+    writeInt64(body, static_cast<int64_t>(information.timestamp()));
+    writeUInt32(body, length);
+    body.insert(body.end(), utf8.begin(), utf8.end());
+    return true;
 }
 
 std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeInformation(const uint8_t* data, uint32_t size)
@@ -652,74 +857,6 @@ std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeInformation(co
     return infoData;
 }
 
-// ============================================================================
-// StdVectorNumberData Serialization (count + elements)
-// ============================================================================
-
-template<typename T>
-std::vector<uint8_t> NodeDataSerializer::serializeStdVector(const StdVectorNumberData<T>* data, DataTypeID typeId)
-{
-    std::vector<uint8_t> result;
-    result.push_back(PROTOCOL_VERSION);
-    result.push_back(typeId);
-
-    std::vector<T> vec = const_cast<StdVectorNumberData<T>*>(data)->data();
-    uint32_t count = static_cast<uint32_t>(vec.size());
-    uint32_t dataSize = 4 + count * sizeof(T);  // count(4) + elements
-
-    writeUInt32(result, dataSize);
-    writeUInt32(result, count);
-
-    // Serialize each element
-    for (const T& value : vec) {
-        if constexpr (std::is_same_v<T, int>) {
-            writeInt32(result, value);
-        } else if constexpr (std::is_same_v<T, float>) {
-            writeFloat(result, value);
-        } else if constexpr (std::is_same_v<T, double>) {
-            writeDouble(result, value);
-        }
-    }
-
-    return result;
-}
-
-template<typename T>
-std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeStdVector(const uint8_t* data, uint32_t size)
-{
-    if (size < 4) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] Invalid StdVector size";
-        return nullptr;
-    }
-
-    uint32_t count = readUInt32(&data[0]);
-    uint32_t expectedSize = 4 + count * sizeof(T);
-
-    if (size != expectedSize) {
-        DEBUG_LOG_WARNING() << "[NodeDataSerializer] StdVector size mismatch";
-        return nullptr;
-    }
-
-    std::vector<T> vec;
-    vec.reserve(count);
-
-    const uint8_t* ptr = &data[4];
-    for (uint32_t i = 0; i < count; ++i) {
-        if constexpr (std::is_same_v<T, int>) {
-            vec.push_back(readInt32(ptr));
-            ptr += 4;
-        } else if constexpr (std::is_same_v<T, float>) {
-            vec.push_back(readFloat(ptr));
-            ptr += 4;
-        } else if constexpr (std::is_same_v<T, double>) {
-            vec.push_back(readDouble(ptr));
-            ptr += 8;
-        }
-    }
-
-    return std::make_shared<StdVectorNumberData<T>>(vec);
-}
-
 // ============================================================================
 // Helper Functions (Little-Endian Binary I/O)
 // ============================================================================
@@ -750,43 +887,6 @@ int32_t NodeDataSerializer::readInt32(const uint8_t* data)
     return static_cast<int32_t>(readUInt32(data));
 }
 
-void NodeDataSerializer::writeDouble(std::vector<uint8_t>& buffer, double value)
-{
-    uint64_t bits;
-    std::memcpy(&bits, &value, sizeof(double));
-    
-    for (int i = 0; i < 8; ++i) {
-        buffer.push_back(static_cast<uint8_t>((bits >> (i * 8)) & 0xFF));
-    }
-}
-
-double NodeDataSerializer::readDouble(const uint8_t* data)
-{
-    uint64_t bits = 0;
-    for (int i = 0; i < 8; ++i) {
-        bits |= (static_cast<uint64_t>(data[i]) << (i * 8));
-    }
-    
-    double value;
-    std::memcpy(&value, &bits, sizeof(double));
-    return value;
-}
-
-void NodeDataSerializer::writeFloat(std::vector<uint8_t>& buffer, float value)
-{
-    uint32_t bits;
-    std::memcpy(&bits, &value, sizeof(float));
-    writeUInt32(buffer, bits);
-}
-
-float NodeDataSerializer::readFloat(const uint8_t* data)
-{
-    uint32_t bits = readUInt32(data);
-    float value;
-    std::memcpy(&value, &bits, sizeof(float));
-    return value;
-}
-
 void NodeDataSerializer::writeInt64(std::vector<uint8_t>& buffer, int64_t value)
 {
     const uint64_t bits = static_cast<uint64_t>(value);
@@ -803,12 +903,3 @@ int64_t NodeDataSerializer::readInt64(const uint8_t* data)
     }
     return static_cast<int64_t>(bits);
 }
-
-// Explicit template instantiations
-template std::vector<uint8_t> NodeDataSerializer::serializeStdVector<int>(const StdVectorNumberData<int>*, DataTypeID);
-template std::vector<uint8_t> NodeDataSerializer::serializeStdVector<float>(const StdVectorNumberData<float>*, DataTypeID);
-template std::vector<uint8_t> NodeDataSerializer::serializeStdVector<double>(const StdVectorNumberData<double>*, DataTypeID);
-
-template std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeStdVector<int>(const uint8_t*, uint32_t);
-template std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeStdVector<float>(const uint8_t*, uint32_t);
-template std::shared_ptr<QtNodes::NodeData> NodeDataSerializer::deserializeStdVector<double>(const uint8_t*, uint32_t);
@@ -40,13 +40,29 @@
  * - StdStringData (length + UTF-8 bytes)
  * - StdVectorNumberData (count + elements)
  * - SyncData (single byte boolean)
+ * - InformationData (timestamp + UTF-8 text)
+ * - ContourPointsData (count + contours of count + points)
+ *
+ * **Type Registry:**
+ * serialize() looks the exact dynamic type of the data up in a table filled
+ * at registration time (one typeid() and one hash lookup per message), and
+ * deserialize() indexes the table by the payload's type byte. Every type
+ * above is registered by the library; registerValueType() builds the
+ * serializer of a NodeData class from the WireFormat of its value
+ * (NodeDataWireFormat.hpp), bulk-copying numeric and point vectors. Plugins
+ * register their own types the same way, with IDs from TYPE_PLUGIN_FIRST:
+ * @code
+ * // In the plugin's registerDataModel()
+ * NodeDataSerializer::registerValueType<KeypointsData>(NodeDataSerializer::TYPE_PLUGIN_FIRST + 0);
+ * @endcode
+ * Unregistered types derived from InformationData travel as InformationData.
  *
  * **Payload Format:**
  * @code
  * [Version:1] [Type:1] [DataSize:4] [Data:N]
  * 
  * Version: Protocol version (0x01)
- * Type: Data type identifier (0x01-0x0F)
+ * Type: Data type identifier (DataTypeID)
  * DataSize: Size of data section in bytes
  * Data: Type-specific binary data
  * @endcode
@@ -70,6 +86,31 @@
  * - Small data types (<100 bytes) serialize in microseconds
  * - Large images (1920x1080) serialize in 5-20ms with compression
  * - Binary format is more efficient than JSON/XML
+ * - serializeSegments() leaves RAW pixels in the frame buffer: Zenoh publishes
+ *   them by reference, DDS copies them once into the sample
+ *
+ * **Image Codecs:**
+ * @code
+ * RAW:      [Enc:1=0x02] [Cols:4] [Rows:4] [Type:4] [Step:4] [Pixels]
+ * JPEG/PNG: [Enc:1=0x00|0x01] [imencode() output]
+ * LOSSLESS: [Enc:1=0x03] [Cols:4] [Rows:4] [Type:4] [Bands:4]
+ *           Bands x ([Size:4] [qCompress(delta-filtered rows)])
+ * @endcode
+ * LOSSLESS cuts the image into horizontal bands that are filtered and
+ * deflated in parallel; it is bit-exact like RAW and PNG but several times
+ * faster than PNG. Which codec a port uses is an ImageCodecSettings.
+ *
+ * **Frame Trace Extension:**
+ * Bridges append the image's FrameMetadata after the data section
+ * (appendFrameTrace()). Readers that predate it ignore the trailing bytes.
+ * @code
+ * [Magic:4 "CVTR"] [ExtVersion:1] [ExtSize:4]
+ * [FrameId:8] [Timestamp:8] [ProducerLen:2] [Producer:N] [HopCount:1]
+ * HopCount x ([HostLen:1] [Host:N] [Sequence:8] [PublishUs:8] [ReceiveUs:8])
+ * @endcode
+ * The last hop is the link the payload is travelling on; its ReceiveUs is 0
+ * on the wire and filled in by deserialize(). Unknown ExtVersions are skipped
+ * using ExtSize.
  *
  * @see ZenohBridge, CycloneDDSBridge for pub/sub integration
  * @see PBNodeDelegateModel for node-level usage
@@ -79,10 +120,17 @@
 #include <memory>
 #include <cstdint>
 #include <cstring>
+#include <functional>
+#include <typeinfo>
 #include <QtNodes/NodeData>
+#include <QJsonObject>
+#include <QString>
 #include <opencv2/opencv.hpp>
 
+#include "CVDevLibrary.hpp"
+#include "NodeDataWireFormat.hpp"
 #include "CVImageData.hpp"
+#include "ContourPointsData.hpp"
 #include "CVPointData.hpp"
 #include "CVRectData.hpp"
 #include "CVScalarData.hpp"
@@ -96,20 +144,84 @@
 #include "StdVectorNumberData.hpp"
 #include "SyncData.hpp"
 
+/**
+ * @struct SerializedPayload
+ * @brief A serialized payload held as up to two segments instead of one buffer.
+ *
+ * The header segment owns the protocol header and any metadata; the pixel
+ * segment points into a cv::Mat that shares the source frame's buffer, so a
+ * RAW image is not copied until a transport actually needs contiguous bytes.
+ * Concatenating the segments gives exactly the bytes of
+ * NodeDataSerializer::serialize().
+ *
+ * @code
+ * SerializedPayload payload = NodeDataSerializer::serializeSegments(data);
+ * for (const auto& segment : payload.segments())
+ *     writev_like(segment.data, segment.size);
+ * @endcode
+ */
+struct SerializedPayload
+{
+    /**
+     * @brief One contiguous byte range of the payload (iovec-style).
+     */
+    struct Segment
+    {
+        const uint8_t* data;
+        size_t size;
+    };
+
+    std::vector<uint8_t> header;   ///< Owned leading bytes; the whole payload for non-image types
+    cv::Mat pixels;                ///< Continuous matrix holding the pixel bytes, or empty
+    std::vector<uint8_t> trailer;  ///< Frame trace extension after the data section, or empty
+
+    bool hasMetadata{false};       ///< True for images: metadata is what appendFrameTrace() writes
+    FrameMetadata metadata;
+
+    bool empty() const { return header.empty(); }
+
+    /**
+     * @brief Total payload size in bytes.
+     */
+    size_t size() const { return header.size() + pixelBytes() + trailer.size(); }
+
+    size_t pixelBytes() const { return pixels.empty() ? 0 : pixels.total() * pixels.elemSize(); }
+
+    /**
+     * @brief Non-empty segments in payload order. Valid while this object is alive.
+     */
+    std::vector<Segment> segments() const;
+
+    /**
+     * @brief Writes the payload into @p destination, which must hold size() bytes.
+     */
+    void copyTo(uint8_t* destination) const;
+
+    /**
+     * @brief The payload as one buffer (one copy of the pixel data).
+     */
+    std::vector<uint8_t> flatten() const;
+};
+
+struct ImageCodecSettings;
+
 /**
  * @class NodeDataSerializer
  * @brief Static utility class for serializing/deserializing CVDev data types.
  *
  * Provides binary serialization for all CVDev NodeData types, enabling
  * transmission over Zenoh pub/sub channels with type safety and versioning.
+ * The type registry is thread-safe; registration normally happens while
+ * plugins load, before any transport runs.
  */
-class NodeDataSerializer
+class CVDEVSHAREDLIB_EXPORT NodeDataSerializer
 {
 public:
     enum class ImageEncoding : uint8_t {
-        JPEG = 0x00,
-        PNG  = 0x01,
-        RAW  = 0x02
+        JPEG     = 0x00,
+        PNG      = 0x01,
+        RAW      = 0x02,
+        LOSSLESS = 0x03   ///< Banded delta filter + deflate, decoded in parallel
     };
 
     /**
@@ -135,9 +247,62 @@ public:
         TYPE_STDVECTOR_FLT = 0x0C,  ///< StdVectorFloatData
         TYPE_STDVECTOR_DBL = 0x0D,  ///< StdVectorDoubleData
         TYPE_SYNCDATA      = 0x0E,  ///< SyncData
-        TYPE_INFORMATION   = 0x0F   ///< InformationData
+        TYPE_INFORMATION   = 0x0F,  ///< InformationData
+        TYPE_CONTOURS      = 0x10,  ///< ContourPointsData
+        TYPE_PLUGIN_FIRST  = 0x80   ///< First ID available to plugin types; lower IDs belong to the library
     };
 
+    /// Appends the data section of @p data to @p body; false if it cannot be serialized.
+    using BodyWriter = std::function<bool(QtNodes::NodeData& data, std::vector<uint8_t>& body)>;
+    /// Builds a NodeData from a data section of @p size bytes; nullptr if invalid.
+    using BodyReader = std::function<std::shared_ptr<QtNodes::NodeData>(const uint8_t* data, uint32_t size)>;
+
+    /**
+     * @brief Registers the serializer of the NodeData class @p type under @p typeId.
+     *
+     * The writer receives objects whose dynamic type is exactly @p type.
+     *
+     * @return false if @p typeId or @p type is already registered to something else
+     */
+    static bool registerType(uint8_t typeId, const std::type_info& type, BodyWriter writer, BodyReader reader);
+
+    /**
+     * @brief Registers DataT with a serializer generated from the WireFormat of its value.
+     *
+     * DataT must have `data()` returning its value and a constructor taking
+     * that value, like the library's data types. The data section is the
+     * value's WireFormat encoding; fixed-size values are checked for their
+     * exact size.
+     */
+    template<typename DataT>
+    static bool registerValueType(uint8_t typeId)
+    {
+        BodyWriter writer;
+        BodyReader reader;
+        makeValueSerializer<DataT>(writer, reader);
+        return registerType(typeId, typeid(DataT), std::move(writer), std::move(reader));
+    }
+
+    /**
+     * @brief registerValueType() with explicit accessors.
+     *
+     * @param get `Value get(DataT&)`, returning the value or a reference to it
+     * @param make `std::shared_ptr<DataT> make(Value&&)`
+     */
+    template<typename DataT, typename Get, typename Make>
+    static bool registerValueType(uint8_t typeId, Get get, Make make)
+    {
+        BodyWriter writer;
+        BodyReader reader;
+        makeValueSerializer<DataT>(get, make, writer, reader);
+        return registerType(typeId, typeid(DataT), std::move(writer), std::move(reader));
+    }
+
+    /**
+     * @brief Wire ID of the serializer registered for the dynamic type of @p data, or TYPE_UNKNOWN.
+     */
+    static uint8_t typeIdOf(const QtNodes::NodeData& data);
+
     /**
      * @brief Serializes a NodeData object to binary payload.
      *
@@ -168,6 +333,27 @@ public:
     static std::vector<uint8_t> serialize(std::shared_ptr<QtNodes::NodeData> data,
                                           ImageEncoding imageEncoding = ImageEncoding::RAW);
 
+    /**
+     * @brief Serializes without copying pixel data.
+     *
+     * Same wire format as serialize(). For a RAW CVImageData the pixel bytes
+     * stay in the frame's buffer (a non-continuous ROI is compacted once);
+     * transports publish the segments directly or copy them once into their
+     * own buffer with SerializedPayload::copyTo().
+     *
+     * @return Payload segments; empty() if the type is unsupported
+     */
+    static SerializedPayload serializeSegments(std::shared_ptr<QtNodes::NodeData> data,
+                                               ImageEncoding imageEncoding = ImageEncoding::RAW);
+
+    /**
+     * @brief serializeSegments() with the codec, quality and level of @p codec.
+     *
+     * Non-image types ignore @p codec.
+     */
+    static SerializedPayload serializeSegments(std::shared_ptr<QtNodes::NodeData> data,
+                                               const ImageCodecSettings& codec);
+
     /**
      * @brief Deserializes a binary payload to NodeData object.
      *
@@ -198,7 +384,8 @@ public:
      * }
      * @endcode
      */
-    static std::shared_ptr<QtNodes::NodeData> deserialize(const std::vector<uint8_t>& payload);
+    static std::shared_ptr<QtNodes::NodeData> deserialize(const std::vector<uint8_t>& payload,
+                                                          int64_t receiveUs = 0);
 
     /**
      * @brief Deserializes a QByteArray payload to NodeData object.
@@ -206,56 +393,162 @@ public:
      * Convenience overload for Qt-based code.
      *
      * @param payload Binary data from Zenoh
+     * @param receiveUs Arrival time (FrameHop::now()) recorded in the last hop; 0 for now
      * @return Reconstructed NodeData object, or nullptr if deserialization fails
      */
-    static std::shared_ptr<QtNodes::NodeData> deserialize(const QByteArray& payload);
+    static std::shared_ptr<QtNodes::NodeData> deserialize(const QByteArray& payload,
+                                                          int64_t receiveUs = 0);
+
+    /**
+     * @brief Appends the frame trace extension of an image payload.
+     *
+     * Writes payload.metadata plus a new hop for @p hostId with sequence
+     * @p sequence and the current time as publish time. Called by the bridges
+     * just before handing the payload to the transport. No-op for non-image
+     * payloads.
+     */
+    static void appendFrameTrace(SerializedPayload& payload, const QString& hostId, uint64_t sequence);
+
+    /**
+     * @brief Parses a frame trace extension.
+     *
+     * @param data First byte after the data section
+     * @param size Bytes from @p data to the end of the payload
+     * @return false if there is no trace extension of a known version
+     */
+    static bool readFrameTrace(const uint8_t* data, size_t size, FrameMetadata& metadata);
+
+    /**
+     * @brief Offset of the first byte after the data section, or 0 if @p header is not a valid header.
+     *
+     * @p header holds at least the first 6 bytes of a payload.
+     */
+    static size_t dataSectionEnd(const uint8_t* header, size_t size);
 
 private:
     static constexpr uint8_t PROTOCOL_VERSION = 0x01;
+    static constexpr uint8_t FRAME_TRACE_VERSION = 0x01;
+
+    struct TypeSerializer;
+    class Registry;
+
+    /// Registry with the library's types registered.
+    static Registry& registry();
+    static void registerBuiltinTypes(Registry& registry);
+    static bool addType(Registry& registry, uint8_t typeId, const std::type_info& type,
+                        BodyWriter writer, BodyReader reader);
+
+    /// Writer and reader of DataT's value, encoded with its WireFormat.
+    template<typename DataT, typename Get, typename Make>
+    static void makeValueSerializer(Get get, Make make, BodyWriter& writer, BodyReader& reader)
+    {
+        using Value = typename std::decay<decltype(get(std::declval<DataT&>()))>::type;
+        writer = [get](QtNodes::NodeData& data, std::vector<uint8_t>& body) {
+            WireFormat<Value>::write(body, get(static_cast<DataT&>(data)));
+            return true;
+        };
+        reader = [make](const uint8_t* data, uint32_t size) -> std::shared_ptr<QtNodes::NodeData> {
+            const uint8_t* end = data + size;
+            Value value;
+            if (!WireFormat<Value>::read(data, end, value) || data != end) {
+                return nullptr;
+            }
+            return make(std::move(value));
+        };
+    }
+
+    /// makeValueSerializer() through DataT::data() and DataT's value constructor.
+    template<typename DataT>
+    static void makeValueSerializer(BodyWriter& writer, BodyReader& reader)
+    {
+        makeValueSerializer<DataT>(
+            [](DataT& data) -> decltype(data.data()) { return data.data(); },
+            [](auto&& value) { return std::make_shared<DataT>(std::forward<decltype(value)>(value)); },
+            writer, reader);
+    }
+
+    /// registerValueType() for the built-ins, which register while the registry is constructed.
+    template<typename DataT>
+    static void addValueType(Registry& registry, uint8_t typeId)
+    {
+        BodyWriter writer;
+        BodyReader reader;
+        makeValueSerializer<DataT>(writer, reader);
+        addType(registry, typeId, typeid(DataT), std::move(writer), std::move(reader));
+    }
+
+    /// Header plus the data section written by @p serializer.
+    static std::vector<uint8_t> serializeBody(const TypeSerializer& serializer, QtNodes::NodeData& data);
+
+    // Types with hand-written serializers
+    static SerializedPayload serializeCVImage(const CVImageData* data, const ImageCodecSettings& codec);
+    static bool writeInformation(QtNodes::NodeData& data, std::vector<uint8_t>& body);
 
-    // Serialize individual types
-    static std::vector<uint8_t> serializeCVImage(const CVImageData* data, ImageEncoding imageEncoding);
-    static std::vector<uint8_t> serializeCVPoint(const CVPointData* data);
-    static std::vector<uint8_t> serializeCVRect(const CVRectData* data);
-    static std::vector<uint8_t> serializeCVScalar(const CVScalarData* data);
-    static std::vector<uint8_t> serializeCVSize(const CVSizeData* data);
-    static std::vector<uint8_t> serializeBool(const BoolData* data);
-    static std::vector<uint8_t> serializeInteger(const IntegerData* data);
-    static std::vector<uint8_t> serializeDouble(const DoubleData* data);
-    static std::vector<uint8_t> serializeFloat(const FloatData* data);
-    static std::vector<uint8_t> serializeStdString(const StdStringData* data);
-    static std::vector<uint8_t> serializeSyncData(const SyncData* data);
-    static std::vector<uint8_t> serializeInformation(const InformationData* data);
-    
-    template<typename T>
-    static std::vector<uint8_t> serializeStdVector(const StdVectorNumberData<T>* data, DataTypeID typeId);
-
-    // Deserialize individual types
     static std::shared_ptr<QtNodes::NodeData> deserializeCVImage(const uint8_t* data, uint32_t size);
-    static std::shared_ptr<QtNodes::NodeData> deserializeCVPoint(const uint8_t* data, uint32_t size);
-    static std::shared_ptr<QtNodes::NodeData> deserializeCVRect(const uint8_t* data, uint32_t size);
-    static std::shared_ptr<QtNodes::NodeData> deserializeCVScalar(const uint8_t* data, uint32_t size);
-    static std::shared_ptr<QtNodes::NodeData> deserializeCVSize(const uint8_t* data, uint32_t size);
-    static std::shared_ptr<QtNodes::NodeData> deserializeBool(const uint8_t* data, uint32_t size);
-    static std::shared_ptr<QtNodes::NodeData> deserializeInteger(const uint8_t* data, uint32_t size);
-    static std::shared_ptr<QtNodes::NodeData> deserializeDouble(const uint8_t* data, uint32_t size);
-    static std::shared_ptr<QtNodes::NodeData> deserializeFloat(const uint8_t* data, uint32_t size);
-    static std::shared_ptr<QtNodes::NodeData> deserializeStdString(const uint8_t* data, uint32_t size);
-    static std::shared_ptr<QtNodes::NodeData> deserializeSyncData(const uint8_t* data, uint32_t size);
+    static bool encodeLossless(const cv::Mat& mat, std::vector<uint8_t>& result);
+    static cv::Mat decodeLossless(const uint8_t* data, uint32_t size);
     static std::shared_ptr<QtNodes::NodeData> deserializeInformation(const uint8_t* data, uint32_t size);
-    
-    template<typename T>
-    static std::shared_ptr<QtNodes::NodeData> deserializeStdVector(const uint8_t* data, uint32_t size);
 
     // Helper functions
     static void writeUInt32(std::vector<uint8_t>& buffer, uint32_t value);
     static uint32_t readUInt32(const uint8_t* data);
     static void writeInt32(std::vector<uint8_t>& buffer, int32_t value);
     static int32_t readInt32(const uint8_t* data);
-    static void writeDouble(std::vector<uint8_t>& buffer, double value);
-    static double readDouble(const uint8_t* data);
-    static void writeFloat(std::vector<uint8_t>& buffer, float value);
-    static float readFloat(const uint8_t* data);
     static void writeInt64(std::vector<uint8_t>& buffer, int64_t value);
     static int64_t readInt64(const uint8_t* data);
 };
+
+/**
+ * @struct ImageCodecSettings
+ * @brief How images are encoded on one output port of a remote transport.
+ *
+ * Stored per output port by PBNodeDelegateModel and saved in the flow file
+ * under "params" / "transport_codecs":
+ * @code
+ * { "encoding": "jpeg", "jpeg_quality": 80, "png_level": 1, "threads": 2 }
+ * @endcode
+ * The receiver needs no settings; the encoding travels in the payload.
+ */
+struct ImageCodecSettings
+{
+    NodeDataSerializer::ImageEncoding encoding{NodeDataSerializer::ImageEncoding::RAW};
+    int jpegQuality{95};   ///< cv::IMWRITE_JPEG_QUALITY, 1..100
+    int pngLevel{1};       ///< cv::IMWRITE_PNG_COMPRESSION, 0..9
+    int threads{1};        ///< Frames of the port encoded concurrently, 1..MaxThreads
+
+    static constexpr int MaxThreads = 8;
+
+    /**
+     * @brief True for RAW with default values, which is not written to the flow file.
+     */
+    bool isDefault() const;
+
+    /**
+     * @brief True if encoding is expensive enough to move off the node's thread.
+     */
+    bool isCompressed() const { return encoding != NodeDataSerializer::ImageEncoding::RAW; }
+
+    QJsonObject toJson() const;
+
+    /**
+     * @brief Parses toJson() output; unknown or missing keys keep their defaults.
+     */
+    static ImageCodecSettings fromJson(const QJsonObject& json);
+
+    /**
+     * @brief "raw", "jpeg", "png" or "lossless".
+     */
+    static QString encodingName(NodeDataSerializer::ImageEncoding encoding);
+
+    /**
+     * @brief Inverse of encodingName(); returns false for an unknown name.
+     */
+    static bool encodingFromName(const QString& name, NodeDataSerializer::ImageEncoding& encoding);
+
+    bool operator==(const ImageCodecSettings& other) const
+    {
+        return encoding == other.encoding && jpegQuality == other.jpegQuality &&
+               pngLevel == other.pngLevel && threads == other.threads;
+    }
+    bool operator!=(const ImageCodecSettings& other) const { return !(*this == other); }
+};
@@ -0,0 +1,287 @@
+//Copyright © 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#pragma once
+
+/**
+ * @file NodeDataWireFormat.hpp
+ * @brief Compile-time little-endian encoding of the values carried by node data.
+ *
+ * WireFormat<T> describes how one value of type T is laid out in a
+ * NodeDataSerializer data section. NodeDataSerializer::registerValueType()
+ * composes them into the serializer of a whole NodeData class, so a type
+ * whose value is made of supported pieces needs no hand-written code.
+ *
+ * **Supported values:**
+ * - Arithmetic types: sizeof(T) bytes, little-endian (bool: 1 byte)
+ * - cv::Point_, cv::Size_, cv::Rect_, cv::Scalar_: their members in declaration order
+ * - std::string: [Length:4] [Bytes]
+ * - std::vector<E>: [Count:4] [E...]
+ *
+ * **Bulk copy:**
+ * When the wire bytes of E are exactly its in-memory bytes (BulkCopy: numbers
+ * and the OpenCV point/size/rect/scalar types on a little-endian host), a
+ * std::vector<E> is written and read with one memcpy instead of per element.
+ *
+ * A specialization provides:
+ * @code
+ * static constexpr size_t FixedSize;   // bytes of every value, 0 if it varies
+ * static constexpr bool BulkCopy;      // wire bytes == memory bytes
+ * static void write(std::vector<uint8_t>& buffer, const T& value);
+ * static bool read(const uint8_t*& data, const uint8_t* end, T& value);  // advances data
+ * @endcode
+ */
+
+#include <QtGlobal>
+
+#include <opencv2/core/types.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+template<typename T, typename Enable = void>
+struct WireFormat;
+
+/**
+ * @brief Numbers other than bool: sizeof(T) little-endian bytes.
+ */
+template<typename T>
+struct WireFormat<T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>::type>
+{
+    static constexpr size_t FixedSize = sizeof(T);
+    static constexpr bool BulkCopy = (Q_BYTE_ORDER == Q_LITTLE_ENDIAN);
+
+    static void write(std::vector<uint8_t>& buffer, const T& value)
+    {
+        uint8_t bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+        std::reverse(bytes, bytes + sizeof(T));
+#endif
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    static bool read(const uint8_t*& data, const uint8_t* end, T& value)
+    {
+        if (static_cast<size_t>(end - data) < sizeof(T)) {
+            return false;
+        }
+        uint8_t bytes[sizeof(T)];
+        std::memcpy(bytes, data, sizeof(T));
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+        std::reverse(bytes, bytes + sizeof(T));
+#endif
+        std::memcpy(&value, bytes, sizeof(T));
+        data += sizeof(T);
+        return true;
+    }
+};
+
+/**
+ * @brief One byte, 0x00 or 0x01; any non-zero byte reads as true.
+ */
+template<>
+struct WireFormat<bool>
+{
+    static constexpr size_t FixedSize = 1;
+    static constexpr bool BulkCopy = false;
+
+    static void write(std::vector<uint8_t>& buffer, const bool& value)
+    {
+        buffer.push_back(value ? 0x01 : 0x00);
+    }
+
+    static bool read(const uint8_t*& data, const uint8_t* end, bool& value)
+    {
+        if (data == end) {
+            return false;
+        }
+        value = (*data++ != 0x00);
+        return true;
+    }
+};
+
+/**
+ * @brief Fixed sequence of N members of type E.
+ *
+ * CRTP base of the OpenCV geometry types: Derived provides
+ * `static void members(T& value, E* (&fields)[N])` listing them in wire order.
+ */
+template<typename Derived, typename T, typename E, size_t N>
+struct WireFormatFields
+{
+    static constexpr size_t FixedSize = N * WireFormat<E>::FixedSize;
+    static constexpr bool BulkCopy = WireFormat<E>::BulkCopy && sizeof(T) == N * sizeof(E);
+
+    static void write(std::vector<uint8_t>& buffer, const T& value)
+    {
+        E* fields[N];
+        Derived::members(const_cast<T&>(value), fields);
+        for (size_t i = 0; i < N; ++i) {
+            WireFormat<E>::write(buffer, *fields[i]);
+        }
+    }
+
+    static bool read(const uint8_t*& data, const uint8_t* end, T& value)
+    {
+        E* fields[N];
+        Derived::members(value, fields);
+        for (size_t i = 0; i < N; ++i) {
+            if (!WireFormat<E>::read(data, end, *fields[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+template<typename E>
+struct WireFormat<cv::Point_<E>> : WireFormatFields<WireFormat<cv::Point_<E>>, cv::Point_<E>, E, 2>
+{
+    static void members(cv::Point_<E>& value, E* (&fields)[2])
+    {
+        fields[0] = &value.x;
+        fields[1] = &value.y;
+    }
+};
+
+template<typename E>
+struct WireFormat<cv::Size_<E>> : WireFormatFields<WireFormat<cv::Size_<E>>, cv::Size_<E>, E, 2>
+{
+    static void members(cv::Size_<E>& value, E* (&fields)[2])
+    {
+        fields[0] = &value.width;
+        fields[1] = &value.height;
+    }
+};
+
+template<typename E>
+struct WireFormat<cv::Rect_<E>> : WireFormatFields<WireFormat<cv::Rect_<E>>, cv::Rect_<E>, E, 4>
+{
+    static void members(cv::Rect_<E>& value, E* (&fields)[4])
+    {
+        fields[0] = &value.x;
+        fields[1] = &value.y;
+        fields[2] = &value.width;
+        fields[3] = &value.height;
+    }
+};
+
+template<typename E>
+struct WireFormat<cv::Scalar_<E>> : WireFormatFields<WireFormat<cv::Scalar_<E>>, cv::Scalar_<E>, E, 4>
+{
+    static void members(cv::Scalar_<E>& value, E* (&fields)[4])
+    {
+        for (int i = 0; i < 4; ++i) {
+            fields[i] = &value[i];
+        }
+    }
+};
+
+/**
+ * @brief [Length:4] [Bytes]
+ */
+template<>
+struct WireFormat<std::string>
+{
+    static constexpr size_t FixedSize = 0;
+    static constexpr bool BulkCopy = false;
+
+    static void write(std::vector<uint8_t>& buffer, const std::string& value)
+    {
+        WireFormat<uint32_t>::write(buffer, static_cast<uint32_t>(value.size()));
+        buffer.insert(buffer.end(), value.begin(), value.end());
+    }
+
+    static bool read(const uint8_t*& data, const uint8_t* end, std::string& value)
+    {
+        uint32_t length = 0;
+        if (!WireFormat<uint32_t>::read(data, end, length) || static_cast<size_t>(end - data) < length) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(data), length);
+        data += length;
+        return true;
+    }
+};
+
+/**
+ * @brief [Count:4] followed by the elements, bulk-copied when E allows it.
+ */
+template<typename E>
+struct WireFormat<std::vector<E>>
+{
+    static constexpr size_t FixedSize = 0;
+    static constexpr bool BulkCopy = false;
+
+    static void write(std::vector<uint8_t>& buffer, const std::vector<E>& value)
+    {
+        WireFormat<uint32_t>::write(buffer, static_cast<uint32_t>(value.size()));
+        writeElements(buffer, value, std::integral_constant<bool, WireFormat<E>::BulkCopy>());
+    }
+
+    static bool read(const uint8_t*& data, const uint8_t* end, std::vector<E>& value)
+    {
+        uint32_t count = 0;
+        if (!WireFormat<uint32_t>::read(data, end, count)) {
+            return false;
+        }
+        // Reject a count the remaining bytes cannot hold before allocating for it
+        const size_t elementSize = WireFormat<E>::FixedSize > 0 ? WireFormat<E>::FixedSize : 4;
+        if (static_cast<size_t>(end - data) / elementSize < count) {
+            return false;
+        }
+        return readElements(data, end, count, value, std::integral_constant<bool, WireFormat<E>::BulkCopy>());
+    }
+
+private:
+    static void writeElements(std::vector<uint8_t>& buffer, const std::vector<E>& value, std::true_type)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(value.data());
+        buffer.insert(buffer.end(), bytes, bytes + value.size() * sizeof(E));
+    }
+
+    static void writeElements(std::vector<uint8_t>& buffer, const std::vector<E>& value, std::false_type)
+    {
+        for (const E& element : value) {
+            WireFormat<E>::write(buffer, element);
+        }
+    }
+
+    static bool readElements(const uint8_t*& data, const uint8_t*, uint32_t count, std::vector<E>& value, std::true_type)
+    {
+        value.resize(count);
+        std::memcpy(value.data(), data, count * sizeof(E));
+        data += count * sizeof(E);
+        return true;
+    }
+
+    static bool readElements(const uint8_t*& data, const uint8_t* end, uint32_t count, std::vector<E>& value, std::false_type)
+    {
+        value.clear();
+        value.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            E element;
+            if (!WireFormat<E>::read(data, end, element)) {
+                return false;
+            }
+            value.push_back(std::move(element));
+        }
+        return true;
+    }
+};
@@ -17,6 +17,7 @@
 #include "qtvariantproperty_p.h"
 #include <QtNodes/internal/ConnectionIdUtils.hpp>
 #include <QTimer>
+#include <limits>
 
 PBAsyncDataModel::PBAsyncDataModel(const QString& modelName, bool bSource, bool bEnable)
     : PBNodeDelegateModel(modelName, bSource, bEnable)
@@ -24,7 +25,10 @@ PBAsyncDataModel::PBAsyncDataModel(const QString& modelName, bool bSource, bool
     qRegisterMetaType<std::shared_ptr<CVImageData>>("std::shared_ptr<CVImageData>");
     qRegisterMetaType<std::shared_ptr<CVImagePool>>("std::shared_ptr<CVImagePool>");
     qRegisterMetaType<cv::Mat>("cv::Mat");
+    qRegisterMetaType<CVFrame>("CVFrame");
     qRegisterMetaType<FrameSharingMode>("FrameSharingMode");
+    // Processing is timed from dispatch to completion, not inside setInData()
+    metrics().setSelfTimed(true);
     // Sharing mode property
     EnumPropertyType sharingModeProperty;
     sharingModeProperty.mslEnumNames = { "Pool Mode", "Broadcast Mode" };
@@ -45,6 +49,82 @@ PBAsyncDataModel::PBAsyncDataModel(const QString& modelName, bool bSource, bool
         "Pool Size", propId, QMetaType::Int, poolSizeProperty, "Image Memory" );
     mvProperty.push_back( propPoolSize );
     mMapIdToProperty[ propId ] = propPoolSize;
+
+    // Pool exhaustion policy property
+    EnumPropertyType exhaustionPolicyProperty;
+    exhaustionPolicyProperty.mslEnumNames = { "Block", "Drop Newest", "Overwrite Oldest" };
+    exhaustionPolicyProperty.miCurrentIndex = static_cast<int>( mePoolExhaustionPolicy );
+    propId = "pool_exhaustion_policy";
+    auto propExhaustionPolicy = std::make_shared< TypedProperty< EnumPropertyType > >(
+        "Exhaustion Policy", propId, QtVariantPropertyManager::enumTypeId(), exhaustionPolicyProperty, "Image Memory" );
+    mvProperty.push_back( propExhaustionPolicy );
+    mMapIdToProperty[ propId ] = propExhaustionPolicy;
+
+    // Pool wait timeout property (Block policy only)
+    IntPropertyType poolTimeoutProperty;
+    poolTimeoutProperty.miMin = 0;
+    poolTimeoutProperty.miMax = 10000;
+    poolTimeoutProperty.miValue = miPoolAcquireTimeoutMs;
+    propId = "pool_wait_timeout";
+    auto propPoolTimeout = std::make_shared< TypedProperty< IntPropertyType > >(
+        "Wait Timeout (ms)", propId, QMetaType::Int, poolTimeoutProperty, "Image Memory" );
+    mvProperty.push_back( propPoolTimeout );
+    mMapIdToProperty[ propId ] = propPoolTimeout;
+
+    // Execution mode property (own thread or shared executor)
+    EnumPropertyType executionModeProperty;
+    executionModeProperty.mslEnumNames = { "Dedicated Thread", "Shared Executor" };
+    executionModeProperty.miCurrentIndex = static_cast<int>( meExecutionMode );
+    propId = "execution_mode";
+    auto propExecutionMode = std::make_shared< TypedProperty< EnumPropertyType > >(
+        "Execution Mode", propId, QtVariantPropertyManager::enumTypeId(), executionModeProperty, "Execution" );
+    mvProperty.push_back( propExecutionMode );
+    mMapIdToProperty[ propId ] = propExecutionMode;
+
+    // Back-pressure policy for frames arriving while the worker is busy
+    EnumPropertyType backPressureProperty;
+    backPressureProperty.mslEnumNames = { "Latest Only", "Bounded Queue", "Every Nth" };
+    backPressureProperty.miCurrentIndex = static_cast<int>( meBackPressurePolicy );
+    propId = "backpressure_policy";
+    auto propBackPressure = std::make_shared< TypedProperty< EnumPropertyType > >(
+        "Back-Pressure", propId, QtVariantPropertyManager::enumTypeId(), backPressureProperty, "Input Queue" );
+    mvProperty.push_back( propBackPressure );
+    mMapIdToProperty[ propId ] = propBackPressure;
+
+    IntPropertyType queueDepthProperty;
+    queueDepthProperty.miMin = 1;
+    queueDepthProperty.miMax = 256;
+    queueDepthProperty.miValue = miQueueDepth;
+    propId = "queue_depth";
+    auto propQueueDepth = std::make_shared< TypedProperty< IntPropertyType > >(
+        "Queue Depth", propId, QMetaType::Int, queueDepthProperty, "Input Queue" );
+    mvProperty.push_back( propQueueDepth );
+    mMapIdToProperty[ propId ] = propQueueDepth;
+
+    IntPropertyType frameStrideProperty;
+    frameStrideProperty.miMin = 1;
+    frameStrideProperty.miMax = 1000;
+    frameStrideProperty.miValue = miFrameStride;
+    propId = "frame_stride";
+    auto propFrameStride = std::make_shared< TypedProperty< IntPropertyType > >(
+        "Every Nth (N)", propId, QMetaType::Int, frameStrideProperty, "Input Queue" );
+    mvProperty.push_back( propFrameStride );
+    mMapIdToProperty[ propId ] = propFrameStride;
+
+    // Read-only frame counters
+    const QStringList counterNames = { "Received", "Processed", "Dropped", "Queued" };
+    const QStringList counterIds = { "frames_received", "frames_processed", "frames_dropped", "frames_queued" };
+    for( int i = 0; i < counterIds.size(); ++i )
+    {
+        IntPropertyType counterProperty;
+        counterProperty.miMin = 0;
+        counterProperty.miMax = std::numeric_limits<int>::max();
+        counterProperty.miValue = 0;
+        auto propCounter = std::make_shared< TypedProperty< IntPropertyType > >(
+            counterNames[i], counterIds[i], QMetaType::Int, counterProperty, "Input Queue", true );
+        mvProperty.push_back( propCounter );
+        mMapIdToProperty[ counterIds[i] ] = propCounter;
+    }
 }
 
 PBAsyncDataModel::~PBAsyncDataModel()
@@ -66,6 +146,16 @@ PBAsyncDataModel::~PBAsyncDataModel()
         // Disconnect all signals from worker to prevent callbacks during destruction
         disconnect(mpWorker, nullptr, this, nullptr);
     }
+
+    mInputQueue.clear();
+    mInputArrivalNs.clear();
+
+    // Drop queued executor jobs and wait for a running one
+    if (mpStrand)
+    {
+        mpStrand->close();
+        mpStrand.reset();
+    }
     
     // Request thread termination
     mWorkerThread.quit();
@@ -97,14 +187,52 @@ void PBAsyncDataModel::late_constructor()
     if (!mpWorker)
         return;
     
-    // Move to thread
-    mpWorker->moveToThread(&mWorkerThread);
-    
     // Connect signals via derived class
     connectWorker(mpWorker);
-    
-    // Start thread
-    mWorkerThread.start();
+
+    // Own thread or shared executor, per execution_mode
+    apply_execution_mode();
+}
+
+void PBAsyncDataModel::bindWorker(QObject* worker)
+{
+    mpWorker = worker;
+    apply_execution_mode();
+}
+
+void PBAsyncDataModel::apply_execution_mode()
+{
+    if (!mpWorker || isShuttingDown())
+        return;
+    // Never switch under an in-flight job; onWorkCompleted() retries.
+    if (mWorkerBusy)
+        return;
+
+    if (meExecutionMode == WorkerExecutionMode::SharedExecutor)
+    {
+        if (mpStrand)
+            return;
+        if (mWorkerThread.isRunning())
+        {
+            mWorkerThread.quit();
+            mWorkerThread.wait();
+        }
+        // Slots are called directly on executor threads; the worker keeps its
+        // current thread affinity, which only matters for queued calls.
+        mpStrand = PBWorkerExecutor::instance().createStrand();
+    }
+    else
+    {
+        if (mpStrand)
+        {
+            mpStrand->close();
+            mpStrand.reset();
+        }
+        if (mpWorker->thread() != &mWorkerThread)
+            mpWorker->moveToThread(&mWorkerThread);
+        if (!mWorkerThread.isRunning())
+            mWorkerThread.start();
+    }
 }
 
 void PBAsyncDataModel::setModelProperty(QString& id, const QVariant& value)
@@ -145,6 +273,83 @@ void PBAsyncDataModel::setModelProperty(QString& id, const QVariant& value)
         if (meSharingMode != FrameSharingMode::PoolMode)
             reset_frame_pool();
     }
+    else if (id == "pool_exhaustion_policy")
+    {
+        auto prop = mMapIdToProperty[id];
+        auto typedProp = std::static_pointer_cast< TypedProperty< EnumPropertyType > >(prop);
+        int newIndex = qBound(0, value.toInt(), 2);
+        typedProp->getData().miCurrentIndex = newIndex;
+        mePoolExhaustionPolicy = static_cast<PoolExhaustionPolicy>(newIndex);
+
+        QMutexLocker locker(&mFramePoolMutex);
+        if (mpFramePool)
+            mpFramePool->setExhaustionPolicy(mePoolExhaustionPolicy);
+    }
+    else if (id == "pool_wait_timeout")
+    {
+        auto prop = mMapIdToProperty[id];
+        auto typedProp = std::static_pointer_cast< TypedProperty< IntPropertyType > >(prop);
+        int newTimeout = qBound(0, value.toInt(), 10000);
+        typedProp->getData().miValue = newTimeout;
+        miPoolAcquireTimeoutMs = newTimeout;
+
+        QMutexLocker locker(&mFramePoolMutex);
+        if (mpFramePool)
+            mpFramePool->setAcquireTimeoutMs(miPoolAcquireTimeoutMs);
+    }
+    else if (id == "execution_mode")
+    {
+        auto prop = mMapIdToProperty[id];
+        auto typedProp = std::static_pointer_cast< TypedProperty< EnumPropertyType > >(prop);
+        int newIndex = qBound(0, value.toInt(), 1);
+        typedProp->getData().miCurrentIndex = newIndex;
+        meExecutionMode = static_cast<WorkerExecutionMode>(newIndex);
+        apply_execution_mode();
+    }
+    else if (id == "backpressure_policy")
+    {
+        auto prop = mMapIdToProperty[id];
+        auto typedProp = std::static_pointer_cast< TypedProperty< EnumPropertyType > >(prop);
+        int newIndex = qBound(0, value.toInt(), 2);
+        typedProp->getData().miCurrentIndex = newIndex;
+        meBackPressurePolicy = static_cast<BackPressurePolicy>(newIndex);
+        // Latest Only keeps a single waiting frame
+        if (meBackPressurePolicy == BackPressurePolicy::LatestOnly && mInputQueue.size() > 1)
+        {
+            mBackPressureStats.dropped += mInputQueue.size() - 1;
+            metrics().recordDrop(mInputQueue.size() - 1);
+            mInputQueue.erase(mInputQueue.begin(), mInputQueue.end() - 1);
+            mInputArrivalNs.erase(mInputArrivalNs.begin(), mInputArrivalNs.end() - 1);
+            mBackPressureStats.queued = mInputQueue.size();
+            schedule_stats_publish();
+        }
+    }
+    else if (id == "queue_depth")
+    {
+        auto prop = mMapIdToProperty[id];
+        auto typedProp = std::static_pointer_cast< TypedProperty< IntPropertyType > >(prop);
+        miQueueDepth = qBound(1, value.toInt(), 256);
+        typedProp->getData().miValue = miQueueDepth;
+        // A lower depth sheds the newest queued frames, as admit_input() would have
+        if (mInputQueue.size() > static_cast<size_t>(miQueueDepth))
+        {
+            const size_t excess = mInputQueue.size() - static_cast<size_t>(miQueueDepth);
+            mBackPressureStats.dropped += excess;
+            mBackPressureStats.overflows += excess;
+            metrics().recordDrop(excess);
+            mInputQueue.erase(mInputQueue.end() - excess, mInputQueue.end());
+            mInputArrivalNs.erase(mInputArrivalNs.end() - excess, mInputArrivalNs.end());
+            mBackPressureStats.queued = mInputQueue.size();
+            schedule_stats_publish();
+        }
+    }
+    else if (id == "frame_stride")
+    {
+        auto prop = mMapIdToProperty[id];
+        auto typedProp = std::static_pointer_cast< TypedProperty< IntPropertyType > >(prop);
+        miFrameStride = qBound(1, value.toInt(), 1000);
+        typedProp->getData().miValue = miFrameStride;
+    }
 }
 
 void PBAsyncDataModel::ensure_frame_pool(int width, int height, int type)
@@ -154,30 +359,40 @@ void PBAsyncDataModel::ensure_frame_pool(int width, int height, int type)
 
     const int desiredSize = qMax(1, miPoolSize);
     QMutexLocker locker(&mFramePoolMutex);
+    // Pool slots are shape-polymorphic (backed by CVMatArena), so a change of
+    // width/height/type does not require a new pool; only the slot count does.
     const bool shouldRecreate = !mpFramePool ||
-        miPoolFrameWidth != width ||
-        miPoolFrameHeight != height ||
         miActivePoolSize != desiredSize;
 
     if (shouldRecreate)
     {
+        if (mpFramePool)
+            mRetiredPoolStats += mpFramePool->stats();
         mpFramePool = std::make_shared<CVImagePool>(
             getNodeId(), width, height, type, static_cast<size_t>(desiredSize));
-        miPoolFrameWidth = width;
-        miPoolFrameHeight = height;
         miActivePoolSize = desiredSize;
     }
+    miPoolFrameWidth = width;
+    miPoolFrameHeight = height;
+    miPoolFrameType = type;
 
     if (mpFramePool)
+    {
         mpFramePool->setMode(meSharingMode);
+        mpFramePool->setExhaustionPolicy(mePoolExhaustionPolicy);
+        mpFramePool->setAcquireTimeoutMs(miPoolAcquireTimeoutMs);
+    }
 }
 
 void PBAsyncDataModel::reset_frame_pool()
 {
     QMutexLocker locker(&mFramePoolMutex);
+    if (mpFramePool)
+        mRetiredPoolStats += mpFramePool->stats();
     mpFramePool.reset();
     miPoolFrameWidth = 0;
     miPoolFrameHeight = 0;
+    miPoolFrameType = -1;
     miActivePoolSize = 0;
 }
 
@@ -187,11 +402,152 @@ std::shared_ptr<CVImagePool> PBAsyncDataModel::getFramePool()
     return mpFramePool;
 }
 
+PoolStats PBAsyncDataModel::framePoolStats()
+{
+    QMutexLocker locker(&mFramePoolMutex);
+    PoolStats stats = mRetiredPoolStats;
+    if (mpFramePool)
+        stats += mpFramePool->stats();
+    return stats;
+}
+
 void PBAsyncDataModel::onWorkCompleted()
 {
     mWorkerBusy = false;
+    if (miDispatchNs != 0)
+    {
+        metrics().recordProcessing(PBNodeMetrics::now() - miDispatchNs);
+        miDispatchNs = 0;
+    }
+    apply_execution_mode();
+    if (!mInputQueue.empty() && !isShuttingDown())
+    {
+        // Replay the oldest queued input as if it had just arrived
+        mpCVImageInData = std::move(mInputQueue.front());
+        mInputQueue.pop_front();
+        miArrivalNs = mInputArrivalNs.front();
+        mInputArrivalNs.pop_front();
+        mBackPressureStats.queued = mInputQueue.size();
+        if (mInputQueue.size() < static_cast<size_t>(miQueueDepth))
+            mbQueueOverflowLogged = false;
+        schedule_stats_publish();
+        process_cached_input();
+        return;
+    }
     if (mHasPending)
+    {
+        miArrivalNs = miPendingArrivalNs;
         dispatchPendingWork();
+    }
+}
+
+void PBAsyncDataModel::admit_input()
+{
+    if (isShuttingDown() || !mpCVImageInData)
+        return;
+
+    const int64_t arrivalNs = PBNodeMetrics::now();
+    ++mBackPressureStats.received;
+    schedule_stats_publish();
+
+    if (meBackPressurePolicy == BackPressurePolicy::EveryNth &&
+        (mBackPressureStats.received - 1) % static_cast<uint64_t>(miFrameStride) != 0)
+    {
+        ++mBackPressureStats.dropped;
+        metrics().recordDrop();
+        return;
+    }
+
+    if (!mWorkerBusy)
+    {
+        miArrivalNs = arrivalNs;
+        process_cached_input();
+        return;
+    }
+
+    if (meBackPressurePolicy == BackPressurePolicy::LatestOnly)
+    {
+        // The derived class overwrites its single pending slot
+        if (mHasPending)
+        {
+            ++mBackPressureStats.dropped;
+            metrics().recordDrop();
+        }
+        miPendingArrivalNs = arrivalNs;
+        process_cached_input();
+        return;
+    }
+
+    // Each entry holds a full frame and the GUI thread cannot wait for the worker,
+    // so a full queue sheds the newest frame
+    if (mInputQueue.size() >= static_cast<size_t>(miQueueDepth))
+    {
+        ++mBackPressureStats.dropped;
+        ++mBackPressureStats.overflows;
+        metrics().recordDrop();
+        if (!mbQueueOverflowLogged)
+        {
+            DEBUG_LOG_WARNING() << "Node" << getNodeId() << "input queue full at depth" << miQueueDepth
+                                << "- dropping frames; upstream producer is not pool-bounded";
+            mbQueueOverflowLogged = true;
+        }
+        return;
+    }
+
+    // Producers may reuse their output CVImageData for the next frame, so queue
+    // a snapshot of the header. Pooled frames arrive in a fresh CVImageData per
+    // frame; keep that object so its pool slot stays held while queued.
+    std::shared_ptr<CVImageData> entry = mpCVImageInData;
+    if (!entry->hasPoolFrame())
+    {
+        const CVFrame frame = mpCVImageInData->frame();
+        entry = std::make_shared<CVImageData>();
+        entry->updateMove(cv::Mat(frame.mat()), frame.metadata());
+    }
+    mInputQueue.push_back(std::move(entry));
+    mInputArrivalNs.push_back(arrivalNs);
+    mBackPressureStats.queued = mInputQueue.size();
+    mBackPressureStats.maxQueued = qMax(mBackPressureStats.maxQueued, mBackPressureStats.queued);
+}
+
+void PBAsyncDataModel::note_dispatch()
+{
+    const int64_t dispatchNs = PBNodeMetrics::now();
+    if (miArrivalNs != 0)
+    {
+        metrics().recordQueueWait(dispatchNs - miArrivalNs);
+        metrics().markInput(miArrivalNs);
+        miArrivalNs = 0;
+    }
+    miDispatchNs = dispatchNs;
+}
+
+BackPressureStats PBAsyncDataModel::backPressureStats() const
+{
+    return mBackPressureStats;
+}
+
+void PBAsyncDataModel::schedule_stats_publish()
+{
+    if (mbStatsPublishPending || isShuttingDown())
+        return;
+    mbStatsPublishPending = true;
+    QTimer::singleShot(250, this, [this]() {
+        mbStatsPublishPending = false;
+        const uint64_t counters[] = { mBackPressureStats.received, mBackPressureStats.processed,
+                                      mBackPressureStats.dropped, mBackPressureStats.queued };
+        const char* ids[] = { "frames_received", "frames_processed", "frames_dropped", "frames_queued" };
+        for (int i = 0; i < 4; ++i)
+        {
+            auto prop = mMapIdToProperty[ids[i]];
+            auto typedProp = std::static_pointer_cast< TypedProperty< IntPropertyType > >(prop);
+            const int value = static_cast<int>(qMin<uint64_t>(counters[i], std::numeric_limits<int>::max()));
+            if (typedProp->getData().miValue == value)
+                continue;
+            typedProp->getData().miValue = value;
+            Q_EMIT property_changed_signal(prop);
+        }
+    });
 }
 
 void PBAsyncDataModel::handleFrameReady(std::shared_ptr<CVImageData> img)
@@ -217,6 +573,12 @@ QJsonObject PBAsyncDataModel::save() const
     QJsonObject cParams;
     cParams["pool_size"] = miPoolSize;
     cParams["sharing_mode"] = (meSharingMode == FrameSharingMode::PoolMode) ? "pool" : "broadcast";
+    cParams["pool_exhaustion_policy"] = static_cast<int>(mePoolExhaustionPolicy);
+    cParams["pool_wait_timeout"] = miPoolAcquireTimeoutMs;
+    cParams["execution_mode"] = static_cast<int>(meExecutionMode);
+    cParams["backpressure_policy"] = static_cast<int>(meBackPressurePolicy);
+    cParams["queue_depth"] = miQueueDepth;
+    cParams["frame_stride"] = miFrameStride;
     modelJson["cParams"] = cParams;
     return modelJson;
 }
@@ -246,6 +608,64 @@ void PBAsyncDataModel::load(const QJsonObject &p)
             auto typedProp = std::static_pointer_cast<TypedProperty<EnumPropertyType>>(prop);
             typedProp->getData().miCurrentIndex = (meSharingMode == FrameSharingMode::PoolMode) ? 0 : 1;
         }
+
+        v = paramsObj["pool_exhaustion_policy"];
+        if (!v.isUndefined())
+        {
+            int index = qBound(0, v.toInt(), 2);
+            mePoolExhaustionPolicy = static_cast<PoolExhaustionPolicy>(index);
+            auto prop = mMapIdToProperty["pool_exhaustion_policy"];
+            auto typedProp = std::static_pointer_cast<TypedProperty<EnumPropertyType>>(prop);
+            typedProp->getData().miCurrentIndex = index;
+        }
+
+        v = paramsObj["pool_wait_timeout"];
+        if (!v.isUndefined())
+        {
+            miPoolAcquireTimeoutMs = qBound(0, v.toInt(), 10000);
+            auto prop = mMapIdToProperty["pool_wait_timeout"];
+            auto typedProp = std::static_pointer_cast<TypedProperty<IntPropertyType>>(prop);
+            typedProp->getData().miValue = miPoolAcquireTimeoutMs;
+        }
+
+        v = paramsObj["execution_mode"];
+        if (!v.isUndefined())
+        {
+            int index = qBound(0, v.toInt(), 1);
+            meExecutionMode = static_cast<WorkerExecutionMode>(index);
+            auto prop = mMapIdToProperty["execution_mode"];
+            auto typedProp = std::static_pointer_cast<TypedProperty<EnumPropertyType>>(prop);
+            typedProp->getData().miCurrentIndex = index;
+            apply_execution_mode();
+        }
+
+        v = paramsObj["backpressure_policy"];
+        if (!v.isUndefined())
+        {
+            int index = qBound(0, v.toInt(), 2);
+            meBackPressurePolicy = static_cast<BackPressurePolicy>(index);
+            auto prop = mMapIdToProperty["backpressure_policy"];
+            auto typedProp = std::static_pointer_cast<TypedProperty<EnumPropertyType>>(prop);
+            typedProp->getData().miCurrentIndex = index;
+        }
+
+        v = paramsObj["queue_depth"];
+        if (!v.isUndefined())
+        {
+            miQueueDepth = qBound(1, v.toInt(), 256);
+            auto prop = mMapIdToProperty["queue_depth"];
+            auto typedProp = std::static_pointer_cast<TypedProperty<IntPropertyType>>(prop);
+            typedProp->getData().miValue = miQueueDepth;
+        }
+
+        v = paramsObj["frame_stride"];
+        if (!v.isUndefined())
+        {
+            miFrameStride = qBound(1, v.toInt(), 1000);
+            auto prop = mMapIdToProperty["frame_stride"];
+            auto typedProp = std::static_pointer_cast<TypedProperty<IntPropertyType>>(prop);
+            typedProp->getData().miValue = miFrameStride;
+        }
     }
 }
 
@@ -260,7 +680,7 @@ void PBAsyncDataModel::setInData(std::shared_ptr<NodeData> nodeData, PortIndex p
         if (d) {
             mpCVImageInData = d;
             if (!mbUseSyncSignal) {
-                process_cached_input();
+                admit_input();
             }
         }
     } else if (portIndex == 1) {
@@ -271,12 +691,32 @@ void PBAsyncDataModel::setInData(std::shared_ptr<NodeData> nodeData, PortIndex p
         auto d = std::dynamic_pointer_cast<SyncData>(nodeData);
         if (d && d->data()) {
             if ( mpCVImageInData && !mpCVImageInData->data().empty() ) {
-                process_cached_input();
+                admit_input();
             }
         }
     }
 }
 
+bool PBAsyncDataModel::releaseOutput(PortIndex portIndex)
+{
+    if (portIndex != 0 || !mpCVImageData || mpCVImageData->data().empty())
+        return false;
+    // Replace rather than clear: consumers may still hold the current CVImageData
+    mpCVImageData = std::make_shared<CVImageData>(cv::Mat());
+    return true;
+}
+
+bool PBAsyncDataModel::canReleaseOutput(PortIndex portIndex) const
+{
+    return portIndex == 0;
+}
+
+void PBAsyncDataModel::releaseInputs()
+{
+    if (!mbUseSyncSignal)
+        mpCVImageInData.reset();
+}
+
 std::shared_ptr<NodeData> PBAsyncDataModel::outData(PortIndex port)
 {
     if (port == 0 && mpCVImageData) {
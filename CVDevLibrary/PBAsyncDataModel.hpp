@@ -19,9 +19,12 @@
  * This class provides common infrastructure for node models that use:
  * - QObject worker + moveToThread() pattern for async processing
  * - CVImagePool for zero-copy memory management
+ * - Zero-copy input handoff to the worker (see workerInput())
  * - Backpressure handling with pending frame queue
  * - Sync signal support for synchronized processing
- * - Configurable pool size and sharing mode
+ * - Configurable pool size, sharing mode and exhaustion policy
+ * - Dedicated worker thread or the shared PBWorkerExecutor (execution_mode)
+ * - Per-node back-pressure policy with frame counters (backpressure_policy)
  * 
  * Derived classes must implement:
  * - createWorker() - Create worker instance
@@ -32,17 +35,108 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <deque>
 #include <QThread>
 #include <QMutex>
+#include <QJsonObject>
 #include "PBNodeDelegateModel.hpp"
 #include "CVImageData.hpp"
 #include "CVImagePool.hpp"
 #include "SyncData.hpp"
+#include "PBWorkerExecutor.hpp"
 
 using QtNodes::PortType;
 using CVDevLibrary::FrameSharingMode;
+using CVDevLibrary::PoolExhaustionPolicy;
+using CVDevLibrary::PoolStats;
 using CVDevLibrary::CVImagePool;
 
+/**
+ * @enum WorkerExecutionMode
+ * @brief Where a PBAsyncDataModel runs its worker.
+ *
+ * - **DedicatedThread**: The worker lives in the node's own QThread (default).
+ *   Use it for workers that block for long periods.
+ * - **SharedExecutor**: Jobs run on PBWorkerExecutor through a per-node strand,
+ *   so the node costs no thread of its own and frame order is kept.
+ */
+enum class WorkerExecutionMode { DedicatedThread, SharedExecutor };
+
+/**
+ * @enum BackPressurePolicy
+ * @brief What an async node does with frames that arrive while its worker is busy.
+ *
+ * - **LatestOnly**: Keep one pending frame and replace it with each newer one
+ *   (live display). Replaced frames count as dropped.
+ * - **BoundedQueue**: Queue frames in arrival order, at most queue_depth of
+ *   them (recorders). The GUI thread that delivers inputs cannot block, so a
+ *   frame arriving at a full queue is dropped and counted as an overflow.
+ *   Nothing is lost only when the upstream stalls first: queued frames keep
+ *   their upstream pool slots, so a pooled producer with the Block exhaustion
+ *   policy and a pool no larger than queue_depth waits in its own thread
+ *   instead of outrunning the node. Loaders and sync producers are not
+ *   pool-bounded and lose frames once the worker falls queue_depth behind.
+ * - **EveryNth**: Admit one frame out of every N and queue the admitted ones
+ *   like BoundedQueue (analytics at a fixed decimation).
+ *
+ * Saved flows store the index, so BoundedQueue reads back what older
+ * versions called "Never Drop".
+ */
+enum class BackPressurePolicy { LatestOnly, BoundedQueue, EveryNth };
+
+/**
+ * @struct BackPressureStats
+ * @brief Input frame counters of one async node.
+ */
+struct BackPressureStats
+{
+    uint64_t received{0};   ///< Frames that reached the node
+    uint64_t processed{0};  ///< Frames handed to the worker
+    uint64_t dropped{0};    ///< Frames skipped by the policy or replaced while pending
+    uint64_t queued{0};     ///< Frames waiting now
+    uint64_t maxQueued{0};  ///< Highest queue length seen
+    uint64_t overflows{0};  ///< Frames dropped at a full queue (also counted in dropped)
+
+    QJsonObject toJson() const
+    {
+        QJsonObject json;
+        json["received"] = static_cast<qint64>(received);
+        json["processed"] = static_cast<qint64>(processed);
+        json["dropped"] = static_cast<qint64>(dropped);
+        json["queued"] = static_cast<qint64>(queued);
+        json["max_queued"] = static_cast<qint64>(maxQueued);
+        json["overflows"] = static_cast<qint64>(overflows);
+        return json;
+    }
+};
+
+/**
+ * @class PBWorkerArgument
+ * @brief Owning counterpart of Q_ARG for invokeWorker().
+ *
+ * Q_ARG only points at its value, which is fine for an immediate queued call
+ * (Qt copies the arguments) but not for a job that runs later on the shared
+ * executor. PBWorkerArgument keeps a copy together with the type name.
+ */
+template <typename T>
+class PBWorkerArgument
+{
+public:
+    PBWorkerArgument(const char* name, const T& value) : mpName(name), mValue(value) {}
+
+    QArgument<T> argument() const { return QArgument<T>(mpName, mValue); }
+
+private:
+    const char* mpName;
+    T mValue;
+};
+
+/**
+ * @brief Q_ARG replacement for PBAsyncDataModel::invokeWorker()
+ */
+#define WORKER_ARG(type, data) PBWorkerArgument<type>(#type, data)
+
 /**
  * @class PBAsyncDataModel
  * @brief Base class for async worker + pool pattern
@@ -74,7 +168,7 @@ public:
     void late_constructor() override;
 
     /**
-     * @brief Set model property (handles pool_size and sharing_mode)
+     * @brief Set model property (handles pool_size, sharing_mode and pool exhaustion settings)
      */
     void setModelProperty(QString& id, const QVariant& value) override;
 
@@ -131,6 +225,44 @@ public:
     // a derived model explicitly returns false.
     bool resizable() const override { return false; }
 
+    /**
+     * @brief True while the worker computes a frame or one waits for it
+     */
+    bool hasWorkInFlight() const override { return mWorkerBusy || mHasPending; }
+
+    /**
+     * @brief Replaces the image output with an empty one once its last consumer has it
+     *
+     * The frame itself stays alive for as long as a consumer or a pool holds it.
+     */
+    bool releaseOutput(PortIndex portIndex) override;
+
+    /**
+     * @brief True for the image output, the one releaseOutput() drops
+     */
+    bool canReleaseOutput(PortIndex portIndex) const override;
+
+    /**
+     * @brief Drops the image input kept for process_cached_input()
+     *
+     * A parameter change then waits for the next frame instead of recomputing the
+     * last one. Kept in sync mode, where the input waits for its trigger.
+     */
+    void releaseInputs() override;
+
+    /**
+     * @brief Pool acquisition counters for this node
+     *
+     * Sums the current pool with every pool this node retired on resize or
+     * reset, so exhaustion/wait counts survive geometry changes.
+     */
+    PoolStats framePoolStats();
+
+    /**
+     * @brief Input frame counters (received/processed/dropped/queued)
+     */
+    BackPressureStats backPressureStats() const;
+
 protected:
     /**
      * @brief Create worker instance - MUST BE IMPLEMENTED BY DERIVED CLASS
@@ -157,6 +289,16 @@ protected:
      */
     virtual void dispatchPendingWork();
 
+    /**
+     * @brief Admit newly arrived input according to the back-pressure policy
+     *
+     * Called instead of process_cached_input() when a new frame arrives on the
+     * image port (or a sync trigger fires). Counts the frame, applies the
+     * decimation of EveryNth, and either runs process_cached_input() or queues
+     * a snapshot of the input while the worker is busy.
+     */
+    void admit_input();
+
     /**
      * @brief Process cached input if available
      * 
@@ -166,7 +308,12 @@ protected:
     virtual void process_cached_input();
 
     /**
-     * @brief Ensure frame pool exists with correct dimensions
+     * @brief Ensure frame pool exists
+     *
+     * The pool is only rebuilt when the configured pool size changes. Slots are
+     * shape-polymorphic, so width/height/type just pre-warm a newly created pool
+     * and record the last frame geometry.
+     *
      * @param width Frame width in pixels
      * @param height Frame height in pixels
      * @param type OpenCV type (CV_8UC1, CV_8UC3, etc.)
@@ -218,6 +365,76 @@ protected:
      */
     FrameSharingMode getSharingMode() const { return meSharingMode; }
 
+    /**
+     * @brief Invoke a worker slot on the node's execution context
+     *
+     * Drop-in replacement for QMetaObject::invokeMethod(mpWorker, method,
+     * Qt::QueuedConnection, Q_ARG(...)...). In DedicatedThread mode it is
+     * exactly that call; in SharedExecutor mode the arguments are copied into
+     * a job posted to the node's strand, which calls the slot directly on an
+     * executor thread.
+     *
+     * @code
+     * invokeWorker("processFrame",
+     *              WORKER_ARG(cv::Mat, workerInput(input)),
+     *              WORKER_ARG(long, frameId));
+     * @endcode
+     */
+    template <typename... Args>
+    void invokeWorker(const char* method, Args... args)
+    {
+        if (!mpWorker)
+            return;
+        note_dispatch();
+        if (!mpStrand)
+        {
+            ++mBackPressureStats.processed;
+            schedule_stats_publish();
+            QMetaObject::invokeMethod(mpWorker, method, Qt::QueuedConnection, args.argument()...);
+            return;
+        }
+        QObject* worker = mpWorker;
+        ++mBackPressureStats.processed;
+        schedule_stats_publish();
+        mpStrand->post([worker, method, args...]() {
+            QMetaObject::invokeMethod(worker, method, Qt::DirectConnection, args.argument()...);
+        });
+    }
+
+    /**
+     * @brief Attach a worker created outside late_constructor() to the node's execution context
+     */
+    void bindWorker(QObject* worker);
+
+    /**
+     * @brief Get execution mode
+     */
+    WorkerExecutionMode getExecutionMode() const { return meExecutionMode; }
+
+    /**
+     * @brief Prepare an input matrix for handoff to the worker thread
+     *
+     * Returns a header sharing @p input's buffer (no pixel copy) so read-only
+     * kernels run directly on the upstream frame. Nodes whose worker writes
+     * into its input call setCopyInputOnDispatch(true) and get a private clone.
+     * Workers that only occasionally write in place can instead call
+     * CVFrame::detach() on the received matrix.
+     */
+    cv::Mat workerInput(const cv::Mat& input) const
+    {
+        return mbCopyInputOnDispatch ? input.clone() : input;
+    }
+
+    /**
+     * @brief Opt out of zero-copy dispatch for in-place kernels
+     */
+    void setCopyInputOnDispatch(bool copy) { mbCopyInputOnDispatch = copy; }
+
+    /**
+     * @brief Check if inputs are cloned before dispatch
+     */
+    bool copyInputOnDispatch() const { return mbCopyInputOnDispatch; }
+
     /**
      * @brief Handle work completion from worker
      * 
@@ -226,6 +443,23 @@ protected:
      */
     void onWorkCompleted();
 
+    /**
+     * @brief Move the worker between its thread and the shared executor
+     *
+     * Deferred while a job is in flight; onWorkCompleted() applies it.
+     */
+    void apply_execution_mode();
+
+    /**
+     * @brief Refresh the read-only counter properties, at most a few times per second
+     */
+    void schedule_stats_publish();
+
+    /**
+     * @brief Record queue wait and start the processing timer of the job being dispatched
+     */
+    void note_dispatch();
+
     // Protected members accessible to derived classes
     QThread mWorkerThread;
     QObject* mpWorker { nullptr };
@@ -233,13 +467,35 @@ protected:
     bool mHasPending { false };
     long mFrameCounter { 0 };
     std::atomic<bool> mShuttingDown { false };
+    bool mbCopyInputOnDispatch { false };
+
+    // Execution context
+    WorkerExecutionMode meExecutionMode { WorkerExecutionMode::DedicatedThread };
+    std::shared_ptr<PBWorkerExecutor::Strand> mpStrand;
+
+    // Back-pressure
+    BackPressurePolicy meBackPressurePolicy { BackPressurePolicy::LatestOnly };
+    int miQueueDepth { 4 };
+    int miFrameStride { 2 };
+    std::deque<std::shared_ptr<CVImageData>> mInputQueue;
+    std::deque<int64_t> mInputArrivalNs;          ///< Arrival time of each mInputQueue entry
+    int64_t miArrivalNs { 0 };                    ///< Arrival time of the input being dispatched
+    int64_t miPendingArrivalNs { 0 };             ///< Arrival time of the LatestOnly pending input
+    int64_t miDispatchNs { 0 };                   ///< Dispatch time of the in-flight job; 0 if idle
+    BackPressureStats mBackPressureStats;
+    bool mbStatsPublishPending { false };
+    bool mbQueueOverflowLogged { false };
 
     // Pool management
     int miPoolSize { 3 };
     FrameSharingMode meSharingMode { FrameSharingMode::PoolMode };
+    PoolExhaustionPolicy mePoolExhaustionPolicy { PoolExhaustionPolicy::Block };
+    int miPoolAcquireTimeoutMs { CVImagePool::DefaultAcquireTimeoutMs };
+    PoolStats mRetiredPoolStats;
     std::shared_ptr<CVImagePool> mpFramePool;
     int miPoolFrameWidth { 0 };
     int miPoolFrameHeight { 0 };
+    int miPoolFrameType { -1 };
     int miActivePoolSize { 0 };
     QMutex mFramePoolMutex;
 
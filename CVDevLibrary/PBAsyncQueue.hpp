@@ -42,6 +42,10 @@
  *   // Graceful shutdown
  *   queue.set_finished();  // Wakes all waiters
  * @endcode
+ *
+ * Nothing is logged on the enqueue/dequeue success path; only timeouts and
+ * failures are. For hot paths with a single consumer, PBSpscQueue and
+ * PBMpscQueue (PBLockFreeQueue.hpp) offer the same API without the mutex.
  */
 
 #include <queue>
@@ -124,7 +128,6 @@ public:
 
         try {
             q_.push(std::move(item));
-            DEBUG_LOG_INFO() << "Enqueued item, queue size:" << static_cast<qint64>(q_.size());
             cv_not_empty_.notify_one();
             return true;
         } catch (const std::exception& e) {
@@ -170,7 +173,6 @@ public:
         try {
             item = std::move(q_.front());
             q_.pop();
-            DEBUG_LOG_INFO() << "Dequeued item, queue size:" << static_cast<qint64>(q_.size());
             cv_not_full_.notify_one();
             return true;
         } catch (const std::exception& e) {
@@ -196,6 +198,89 @@ public:
         return std::nullopt;
     }
 
+    /**
+     * @brief Enqueue @p count items starting at @p first.
+     *
+     * Items are moved out of the source range. Blocks until all of them are
+     * in, the timeout expires or the queue is finished; each wait covers the
+     * whole @p timeout_ms.
+     *
+     * @return Number of items enqueued (a prefix of the range)
+     */
+    template<typename InputIt>
+    size_t enqueue_bulk(InputIt first, size_t count, int timeout_ms = 0)
+    {
+        size_t done = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (done < count) {
+            auto has_space = [this]() {
+                return !is_full_unsafe() || finished_.load(std::memory_order_acquire);
+            };
+            if (timeout_ms <= 0) {
+                cv_not_full_.wait(lock, has_space);
+            } else if (!cv_not_full_.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                                              has_space)) {
+                DEBUG_LOG_WARNING() << "Bulk enqueue timeout after" << timeout_ms << "ms,"
+                                    << static_cast<qint64>(done) << "of"
+                                    << static_cast<qint64>(count) << "items enqueued";
+                break;
+            }
+            if (finished_.load(std::memory_order_acquire)) {
+                break;
+            }
+            const size_t before = done;
+            while (done < count && !is_full_unsafe()) {
+                q_.push(std::move(*first));
+                ++first;
+                ++done;
+            }
+            if (done - before == 1) {
+                cv_not_empty_.notify_one();
+            } else {
+                cv_not_empty_.notify_all();
+            }
+        }
+        return done;
+    }
+
+    /**
+     * @brief Dequeue up to @p max_items items into @p out.
+     *
+     * Waits (subject to @p timeout_ms) until at least one item is available,
+     * then takes everything queued, up to @p max_items, under one lock.
+     *
+     * @return Number of items written to @p out; 0 on timeout or when finished and empty
+     */
+    template<typename OutputIt>
+    size_t dequeue_bulk(OutputIt out, size_t max_items, int timeout_ms = 0)
+    {
+        if (max_items == 0) {
+            return 0;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto has_item = [this]() {
+            return !q_.empty() || finished_.load(std::memory_order_acquire);
+        };
+        if (timeout_ms <= 0) {
+            cv_not_empty_.wait(lock, has_item);
+        } else {
+            cv_not_empty_.wait_for(lock, std::chrono::milliseconds(timeout_ms), has_item);
+        }
+        size_t taken = 0;
+        while (taken < max_items && !q_.empty()) {
+            *out = std::move(q_.front());
+            ++out;
+            q_.pop();
+            ++taken;
+        }
+        if (taken == 1) {
+            cv_not_full_.notify_one();
+        } else if (taken > 1) {
+            cv_not_full_.notify_all();
+        }
+        return taken;
+    }
+
     /**
      * @brief Mark the queue as finished (no more items will be enqueued).
      *
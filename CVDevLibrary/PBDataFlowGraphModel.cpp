@@ -13,18 +13,26 @@
 //limitations under the License.
 
 #include "PBDataFlowGraphModel.hpp"
+#include "PBExecutionPlan.hpp"
+#include "PBLinkStats.hpp"
 #include "PBNodeDelegateModel.hpp"
 #include "InformationData.hpp"
+#include "CVImageData.hpp"
+#include "CVMatArena.hpp"
 #include "PBNodeGroup.hpp"
 #include "TransportModeManager.hpp"
 #include "ZenohBridge.hpp"
 #include <QFile>
 #include <QFileInfo>
+#include <QDateTime>
 #include <QJsonDocument>
 #include <QJsonArray>
 #include <QMessageBox>
+#include <QSaveFile>
 #include <QSize>
 #include <QTimer>
+#include <algorithm>
+#include <deque>
 #include <set>
 #include <stack>
 
@@ -38,6 +46,65 @@ PBDataFlowGraphModel(std::shared_ptr<NodeDelegateModelRegistry> registry, QObjec
 {
     Q_UNUSED(parent);
     setTransportFlowFilename(QStringLiteral("Untitle"));
+
+    // Any topology edit invalidates the execution plan and can change which nodes an active sink depends on
+    connect(this, &QtNodes::AbstractGraphModel::connectionCreated, this, [this](QtNodes::ConnectionId) {
+        invalidateExecutionPlan();
+        invalidateDemand();
+    });
+    connect(this, &QtNodes::AbstractGraphModel::connectionDeleted, this, [this](QtNodes::ConnectionId) {
+        invalidateExecutionPlan();
+        invalidateDemand();
+    });
+    connect(this, &QtNodes::AbstractGraphModel::nodeCreated, this, [this](NodeId) {
+        invalidateExecutionPlan();
+        invalidateDemand();
+    });
+    connect(this, &QtNodes::AbstractGraphModel::portsInserted, this, [this]() {
+        invalidateExecutionPlan();
+    });
+    connect(this, &QtNodes::AbstractGraphModel::portsDeleted, this, [this]() {
+        invalidateExecutionPlan();
+    });
+    connect(this, &QtNodes::AbstractGraphModel::nodeDeleted, this, [this](NodeId nodeId) {
+        mDeferredInputs.erase(nodeId);
+        mWaveInputs.erase(nodeId);
+        mWaitingInputs.erase(nodeId);
+        invalidateExecutionPlan();
+        invalidateDemand();
+    });
+}
+
+PBDataFlowGraphModel::EvaluationMode
+PBDataFlowGraphModel::
+evaluationModeFromSetting(const QString& setting)
+{
+    if (setting.trimmed().compare(QLatin1String("pull"), Qt::CaseInsensitive) == 0)
+        return EvaluationMode::Pull;
+    return EvaluationMode::Push;
+}
+
+QString
+PBDataFlowGraphModel::
+settingFromEvaluationMode(EvaluationMode mode)
+{
+    return mode == EvaluationMode::Pull ? QStringLiteral("pull") : QStringLiteral("push");
+}
+
+PBDataFlowGraphModel::Scheduling
+PBDataFlowGraphModel::
+schedulingFromSetting(const QString& setting)
+{
+    if (setting.trimmed().compare(QLatin1String("wave"), Qt::CaseInsensitive) == 0)
+        return Scheduling::Wave;
+    return Scheduling::Immediate;
+}
+
+QString
+PBDataFlowGraphModel::
+settingFromScheduling(Scheduling scheduling)
+{
+    return scheduling == Scheduling::Wave ? QStringLiteral("wave") : QStringLiteral("immediate");
 }
 
 void
@@ -72,6 +139,7 @@ addNode(QString const nodeType)
                     [this, newId]() {
                         Q_EMIT nodeUpdated(newId);
                     });
+            connectDemandSignals(delegateModel);
             // Call late_constructor() here to perform any heavy initialization
             // (threads, hardware, etc.) only when the node is actually placed
             // into the scene. This centralizes the deferred initialization so
@@ -307,6 +375,10 @@ load_from_file(QString const & sFilename)
 
     // Show dialog if any nodes had errors during loading
     if (!mLoadErrors.isEmpty()) {
+        // Headless callers report loadErrors() themselves; there is no one to click the dialog.
+        if (PBNodeDelegateModel::isHeadlessMode())
+            return false;
+
         // Remove duplicates
         QStringList uniqueErrors = mLoadErrors;
         uniqueErrors.removeDuplicates();
@@ -329,6 +401,65 @@ load_from_file(QString const & sFilename)
     return true;
 }
 
+QList<NodeMetricsSnapshot>
+PBDataFlowGraphModel::
+nodeMetrics() const
+{
+    const auto allIds = allNodeIds();
+    std::vector<NodeId> nodeIds(allIds.begin(), allIds.end());
+    std::sort(nodeIds.begin(), nodeIds.end());
+
+    QList<NodeMetricsSnapshot> snapshots;
+    for (const auto nodeId : nodeIds) {
+        auto *delegateModel = const_cast<PBDataFlowGraphModel*>(this)->delegateModel<PBNodeDelegateModel>(nodeId);
+        if (!delegateModel) {
+            continue;
+        }
+        NodeMetricsSnapshot snapshot = delegateModel->metrics().snapshot();
+        snapshot.nodeId = delegateModel->getNodeId();
+        snapshot.caption = delegateModel->caption();
+        snapshots.append(snapshot);
+    }
+    return snapshots;
+}
+
+bool
+PBDataFlowGraphModel::
+export_node_metrics(QString const & sFilename) const
+{
+    const QList<NodeMetricsSnapshot> snapshots = nodeMetrics();
+
+    QByteArray content;
+    if (QFileInfo(sFilename).suffix().compare("csv", Qt::CaseInsensitive) == 0) {
+        content += NodeMetricsSnapshot::csvHeader().join(',').toUtf8() + '\n';
+        for (const auto &snapshot : snapshots) {
+            content += snapshot.csvRow().join(',').toUtf8() + '\n';
+        }
+    } else {
+        QJsonArray nodes;
+        for (const auto &snapshot : snapshots) {
+            nodes.append(snapshot.toJson());
+        }
+        QJsonArray links;
+        for (const auto &link : PBLinkStats::instance().snapshot()) {
+            links.append(link.toJson());
+        }
+        QJsonObject json;
+        json["flow"] = msFlowFilename;
+        json["timestamp"] = QDateTime::currentDateTime().toString(Qt::ISODateWithMs);
+        json["nodes"] = nodes;
+        json["links"] = links;
+        content = QJsonDocument(json).toJson(QJsonDocument::Indented);
+    }
+
+    QSaveFile file(sFilename);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(content);
+    return file.commit();
+}
+
 QJsonObject
 PBDataFlowGraphModel::
 saveNode(NodeId const nodeId) const
@@ -433,6 +564,7 @@ loadNode(QJsonObject const &nodeJson)
                 [this, restoredNodeId]() {
                     Q_EMIT nodeUpdated(restoredNodeId);
                 });
+        connectDemandSignals(delegateModel);
         // Perform deferred/late initialization for the delegate model here so
         // that any heavy work (threads, hardware, etc.) only runs when the
         // node is actually present in the scene during load. This mirrors the
@@ -508,6 +640,11 @@ QVariant
 PBDataFlowGraphModel::
 nodeData(NodeId nodeId, NodeRole role) const
 {
+    // Embedded widgets are never shown when running headless.
+    if (role == NodeRole::Widget && PBNodeDelegateModel::isHeadlessMode()) {
+        return QVariant();
+    }
+
     // For Style role, return the delegate model's style instead of global style
     if (role == NodeRole::Style) {
         auto *model = const_cast<PBDataFlowGraphModel*>(this)->delegateModel<PBNodeDelegateModel>(nodeId);
@@ -534,52 +671,82 @@ setPortData(NodeId nodeId,
         return true;
     }
 
-    if (role == QtNodes::PortRole::Data && portType == QtNodes::PortType::In) {
-        auto *delegateModel = this->delegateModel<PBNodeDelegateModel>(nodeId);
-        if (delegateModel && !delegateModel->isEnable()) {
+    if (role != QtNodes::PortRole::Data || portType != QtNodes::PortType::In) {
+        return DataFlowGraphModel::setPortData(nodeId, portType, portIndex, value, role);
+    }
+
+    if (meScheduling == Scheduling::Wave) {
+        enqueueWaveInput(nodeId, portIndex, value);
+        return true;
+    }
+    return deliverInput(nodeId, portIndex, value);
+}
+
+bool
+PBDataFlowGraphModel::
+deliverInput(NodeId nodeId, QtNodes::PortIndex portIndex, QVariant const &value)
+{
+    const auto portType = QtNodes::PortType::In;
+    const auto role = QtNodes::PortRole::Data;
+
+    // Times the node's setInData(); downstream nodes reached from it open their own scopes.
+    const PBExecutionPlan &plan = executionPlan();
+    PBNodeMetrics *metrics = nullptr;
+    auto *delegateModel = plan.delegate(nodeId);
+    if (delegateModel && !delegateModel->isEnable()) {
+        return true;
+    }
+    if (meEvaluationMode == EvaluationMode::Pull) {
+        // Nothing needs this node's result: keep the input and stay dirty
+        if (!isNodeDemanded(nodeId)) {
+            mDeferredInputs[nodeId][portIndex] = value;
             return true;
         }
+        auto deferred = mDeferredInputs.find(nodeId);
+        if (deferred != mDeferredInputs.end()) {
+            deferred->second.erase(portIndex);
+            if (deferred->second.empty()) {
+                mDeferredInputs.erase(deferred);
+            }
+        }
+    }
+    if (delegateModel) {
+        metrics = &delegateModel->metrics();
     }
+    PBNodeMetrics::ProcessScope processScope(metrics);
 
-    // For input ports with data role, check if type conversion is needed
-    if (role == QtNodes::PortRole::Data && portType == QtNodes::PortType::In) {
-        auto incomingData = value.value<std::shared_ptr<QtNodes::NodeData>>();
-        
-        if (incomingData) {
-            // Get the expected input type for this port
-            auto expectedType = portData(nodeId, portType, portIndex, QtNodes::PortRole::DataType)
-                                    .value<QtNodes::NodeDataType>();
-            
-            // Get the actual incoming type
-            auto incomingType = incomingData->type();
-            
-            // If types don't match, check if we need to convert
-            if (expectedType.id != incomingType.id) {
-                // Check if target expects InformationData
-                if (expectedType.id == "Information") {
-                    // Try to cast incoming data to InformationData
-                    // Since CVImageData and other types inherit from InformationData,
-                    // we can use dynamic_pointer_cast
-                    auto convertedData = std::dynamic_pointer_cast<InformationData>(incomingData);
-                    
-                    if (convertedData) {
-                        // Successfully converted - we need to pass it as std::shared_ptr<NodeData>
-                        // Cast it back to NodeData to maintain the proper type for setInData
-                        std::shared_ptr<QtNodes::NodeData> nodeDataPtr = 
-                            std::static_pointer_cast<QtNodes::NodeData>(convertedData);
-                        
-                        QVariant convertedValue;
-                        convertedValue.setValue(nodeDataPtr);
-                        return DataFlowGraphModel::setPortData(nodeId, portType, portIndex, 
-                                                               convertedValue, role);
-                    }
-                }
-            }
+    auto incomingData = value.value<std::shared_ptr<QtNodes::NodeData>>();
+
+    // Frame size of the image output feeding this port, for bufferReport()
+    PBExecutionPlan::PortKey source;
+    if (incomingData && plan.imageSource(nodeId, portIndex, source)) {
+        if (auto image = std::dynamic_pointer_cast<CVImageData>(incomingData)) {
+            mImageOutputBytes[source] = static_cast<qint64>(image->data().total() * image->data().elemSize());
         }
     }
-    
-    // For all other cases, use the parent implementation
-    return DataFlowGraphModel::setPortData(nodeId, portType, portIndex, value, role);
+
+    // The plan lists the ports that need a type conversion; the others take the value as is
+    QVariant deliveredValue = value;
+    if (incomingData && plan.inputConversion(nodeId, portIndex) == PBExecutionPlan::InputConversion::Information) {
+        // Target expects InformationData.
+        // Since CVImageData and other types inherit from InformationData,
+        // we can use dynamic_pointer_cast
+        auto convertedData = std::dynamic_pointer_cast<InformationData>(incomingData);
+
+        if (convertedData) {
+            // Successfully converted - we need to pass it as std::shared_ptr<NodeData>
+            // Cast it back to NodeData to maintain the proper type for setInData
+            std::shared_ptr<QtNodes::NodeData> nodeDataPtr =
+                std::static_pointer_cast<QtNodes::NodeData>(convertedData);
+            deliveredValue.setValue(nodeDataPtr);
+        }
+    }
+
+    const bool delivered = DataFlowGraphModel::setPortData(nodeId, portType, portIndex, deliveredValue, role);
+    if (mbBufferReuse) {
+        releaseDeadBuffers(nodeId);
+    }
+    return delivered;
 }
 
 bool
@@ -967,40 +1134,380 @@ void
 PBDataFlowGraphModel::
 triggerInitialPropagation()
 {
-    // Find all source-like nodes: nodes that have no incoming connection links
-    std::vector<NodeId> sourceNodes;
-    auto allIds = allNodeIds();
-    for (NodeId nodeId : allIds) {
+    // Source-like nodes, with no incoming connection links, come from the execution plan
+    const PBExecutionPlan &plan = executionPlan();
+    const auto sourceNodes = plan.sources();
+
+    // Propagate output data for each source-like node
+    for (NodeId nodeId : sourceNodes) {
+        auto *delegateModel = plan.delegate(nodeId);
+        if (!delegateModel || !delegateModel->isEnable()) {
+            continue;
+        }
+
+        unsigned int nOutputPorts = delegateModel->nPorts(QtNodes::PortType::Out);
+        for (QtNodes::PortIndex port = 0; port < nOutputPorts; ++port) {
+            Q_EMIT delegateModel->dataUpdated(port);
+        }
+    }
+}
+
+void
+PBDataFlowGraphModel::
+setEvaluationMode(EvaluationMode mode)
+{
+    if (meEvaluationMode == mode)
+        return;
+
+    meEvaluationMode = mode;
+    mbDemandDirty = true;
+    if (mode == EvaluationMode::Push)
+        flushDeferredInputs();
+}
+
+bool
+PBDataFlowGraphModel::
+isNodeDemanded(NodeId nodeId)
+{
+    if (meEvaluationMode == EvaluationMode::Push)
+        return true;
+    if (mbDemandDirty || TransportModeManager::instance().getTransportMode() != meDemandTransport)
+        updateDemand();
+    return mDemandedNodes.count(nodeId) > 0;
+}
+
+void
+PBDataFlowGraphModel::
+connectDemandSignals(PBNodeDelegateModel *delegateModel)
+{
+    connect(delegateModel, &PBNodeDelegateModel::enable_changed_signal, this, [this](bool) {
+        invalidateDemand();
+    });
+    connect(delegateModel, &PBNodeDelegateModel::minimize_changed_signal, this, [this](bool) {
+        invalidateDemand();
+    });
+    connect(delegateModel, &PBNodeDelegateModel::sink_state_changed_signal, this, [this]() {
+        invalidateDemand();
+    });
+}
+
+void
+PBDataFlowGraphModel::
+invalidateDemand()
+{
+    mbDemandDirty = true;
+    if (meEvaluationMode != EvaluationMode::Pull || mbRestoringGraph || mbDemandRefreshQueued)
+        return;
+
+    // Batch the edits of one event loop turn (a paste, a group delete) into one refresh
+    mbDemandRefreshQueued = true;
+    QTimer::singleShot(0, this, [this]() {
+        mbDemandRefreshQueued = false;
+        refreshDemand();
+    });
+}
+
+void
+PBDataFlowGraphModel::
+refreshDemand()
+{
+    if (meEvaluationMode != EvaluationMode::Pull)
+        return;
+    updateDemand();
+    flushDeferredInputs();
+}
+
+void
+PBDataFlowGraphModel::
+updateDemand()
+{
+    mbDemandDirty = false;
+    mDemandedNodes.clear();
+
+    auto isEnabled = [this](NodeId nodeId) {
         auto *delegateModel = this->delegateModel<PBNodeDelegateModel>(nodeId);
-        if (!delegateModel) {
+        return !delegateModel || delegateModel->isEnable();
+    };
+
+    // Outputs published over Zenoh, CycloneDDS or shared memory may have readers in
+    // other processes, so every node that publishes one is a sink
+    meDemandTransport = TransportModeManager::instance().getTransportMode();
+    const bool remoteReaders = meDemandTransport != TransportMode::QtOnly;
+
+    // Sinks: enabled nodes that consume their inputs themselves
+    std::stack<NodeId> pending;
+    for (NodeId nodeId : allNodeIds()) {
+        if (!isEnabled(nodeId)) {
             continue;
         }
+        auto *delegateModel = this->delegateModel<PBNodeDelegateModel>(nodeId);
+        const auto sinkState = delegateModel ? delegateModel->sinkState() : PBNodeDelegateModel::SinkState::Auto;
+        bool sink = (sinkState == PBNodeDelegateModel::SinkState::Active) ||
+                    (remoteReaders && nodeData(nodeId, QtNodes::NodeRole::OutPortCount).toUInt() > 0);
+        if (!sink && sinkState == PBNodeDelegateModel::SinkState::Auto) {
+            const auto connectionIds = allConnectionIds(nodeId);
+            sink = std::none_of(connectionIds.begin(), connectionIds.end(),
+                                [nodeId](const QtNodes::ConnectionId &cn) { return cn.outNodeId == nodeId; });
+        }
+        if (sink) {
+            pending.push(nodeId);
+        }
+    }
 
-        bool hasIncomingConnections = false;
-        unsigned int nInputPorts = delegateModel->nPorts(QtNodes::PortType::In);
-        for (QtNodes::PortIndex port = 0; port < nInputPorts; ++port) {
-            if (!connections(nodeId, QtNodes::PortType::In, port).empty()) {
-                hasIncomingConnections = true;
-                break;
+    // Everything feeding a demanded, enabled node is demanded; a disabled node drops its inputs
+    while (!pending.empty()) {
+        const NodeId nodeId = pending.top();
+        pending.pop();
+        if (!mDemandedNodes.insert(nodeId).second || !isEnabled(nodeId)) {
+            continue;
+        }
+        for (const auto &cn : allConnectionIds(nodeId)) {
+            if (cn.inNodeId == nodeId && mDemandedNodes.count(cn.outNodeId) == 0) {
+                pending.push(cn.outNodeId);
             }
         }
-        if (!hasIncomingConnections) {
-            sourceNodes.push_back(nodeId);
+    }
+}
+
+void
+PBDataFlowGraphModel::
+flushDeferredInputs()
+{
+    if (mDeferredInputs.empty())
+        return;
+
+    // Upstream nodes first, so a node recomputed by the flush delivers fresh data
+    // downstream and the stale inputs kept there are replaced before their turn
+    const auto order = executionPlan().order();
+    for (NodeId nodeId : order) {
+        auto deferred = mDeferredInputs.find(nodeId);
+        if (deferred == mDeferredInputs.end() || !isNodeDemanded(nodeId)) {
+            continue;
+        }
+        const auto inputs = std::move(deferred->second);
+        mDeferredInputs.erase(deferred);
+        for (const auto &input : inputs) {
+            setPortData(nodeId, QtNodes::PortType::In, input.first, input.second);
         }
     }
+}
 
-    // Propagate output data for each source-like node
-    for (NodeId nodeId : sourceNodes) {
-        auto *delegateModel = this->delegateModel<PBNodeDelegateModel>(nodeId);
-        if (!delegateModel || !delegateModel->isEnable()) {
+void
+PBDataFlowGraphModel::
+invalidateExecutionPlan()
+{
+    mbPlanDirty = true;
+}
+
+const PBExecutionPlan &
+PBDataFlowGraphModel::
+executionPlan()
+{
+    if (mbPlanDirty) {
+        mbPlanDirty = false;
+        mExecutionPlan = PBExecutionPlan::build(*this);
+    }
+    return mExecutionPlan;
+}
+
+QJsonObject
+PBDataFlowGraphModel::
+bufferReport()
+{
+    const PBExecutionPlan &plan = executionPlan();
+    const std::set<PBExecutionPlan::PortKey> imageOutputs = plan.imageOutputs();
+
+    // Only outputs whose producer can drop its reference end early, and only with reuse on
+    std::set<PBExecutionPlan::PortKey> releasable;
+    for (const auto &output : imageOutputs) {
+        auto *producer = plan.delegate(output.first);
+        if (producer && producer->canReleaseOutput(output.second)) {
+            releasable.insert(output);
+        }
+    }
+    const std::set<PBExecutionPlan::PortKey> released = mbBufferReuse ? releasable : std::set<PBExecutionPlan::PortKey>();
+
+    QJsonObject report;
+    report["image_outputs"] = static_cast<qint64>(imageOutputs.size());
+    report["releasable_outputs"] = static_cast<qint64>(releasable.size());
+    report["peak_frames_before"] = plan.peakResidentFrames({});
+    report["peak_frames_after"] = plan.peakResidentFrames(released);
+    report["peak_bytes_before"] = plan.peakResidentBytes(mImageOutputBytes, {});
+    report["peak_bytes_after"] = plan.peakResidentBytes(mImageOutputBytes, released);
+    report["peak_frames_planned"] = plan.bufferSlotCount();
+    report["peak_bytes_planned"] = plan.peakResidentBytes(mImageOutputBytes, imageOutputs);
+    report["arena_peak_bytes_in_use"] = static_cast<qint64>(CVMatArena::instance().stats().peakBytesInUse);
+    report["reuse"] = mbBufferReuse;
+    report["released"] = static_cast<qint64>(miReleasedBuffers);
+    return report;
+}
+
+void
+PBDataFlowGraphModel::
+releaseDeadBuffers(NodeId nodeId)
+{
+    // Consumers and queued wave inputs hold their own references; only the producer's goes
+    const PBExecutionPlan &plan = executionPlan();
+    for (const auto &output : plan.releasedAfter(nodeId)) {
+        auto *producer = plan.delegate(output.first);
+        if (producer && producer->releaseOutput(output.second)) {
+            ++miReleasedBuffers;
+        }
+    }
+    if (auto *consumer = plan.delegate(nodeId)) {
+        consumer->releaseInputs();
+    }
+}
+
+void
+PBDataFlowGraphModel::
+setScheduling(Scheduling scheduling)
+{
+    if (meScheduling == scheduling)
+        return;
+
+    meScheduling = scheduling;
+    if (scheduling == Scheduling::Wave)
+        return;
+
+    // Nothing may stay queued once inputs are delivered immediately again
+    auto pending = std::move(mWaitingInputs);
+    mWaitingInputs.clear();
+    for (auto &node : mWaveInputs) {
+        for (auto &input : node.second) {
+            pending[node.first][input.first] = std::move(input.second);
+        }
+    }
+    mWaveInputs.clear();
+
+    const auto order = executionPlan().order();
+    for (NodeId nodeId : order) {
+        auto inputs = pending.find(nodeId);
+        if (inputs == pending.end()) {
             continue;
         }
+        for (const auto &input : inputs->second) {
+            deliverInput(nodeId, input.first, input.second);
+        }
+    }
+}
 
-        unsigned int nOutputPorts = delegateModel->nPorts(QtNodes::PortType::Out);
-        for (QtNodes::PortIndex port = 0; port < nOutputPorts; ++port) {
-            Q_EMIT delegateModel->dataUpdated(port);
+void
+PBDataFlowGraphModel::
+enqueueWaveInput(NodeId nodeId, QtNodes::PortIndex portIndex, QVariant const &value)
+{
+    // Latest per port: a source emitting twice before its wave runs sends its last frame
+    mWaveInputs[nodeId][portIndex] = value;
+    if (mbWaveRunning || mbWaveQueued)
+        return;
+
+    // Start on the next turn, once the emitting node has reached all its connections
+    mbWaveQueued = true;
+    QTimer::singleShot(0, this, [this]() {
+        runWave();
+    });
+}
+
+void
+PBDataFlowGraphModel::
+runWave()
+{
+    mbWaveQueued = false;
+    if (mbWaveRunning || mWaveInputs.empty())
+        return;
+
+    const PBExecutionPlan &plan = executionPlan();
+    mbWaveRunning = true;
+    ++miWaveCount;
+
+    while (!mWaveInputs.empty()) {
+        // Lowest rank first: every node feeding it has already run in this wave
+        auto next = std::min_element(mWaveInputs.begin(), mWaveInputs.end(),
+                                     [&plan](const auto &a, const auto &b) { return plan.rank(a.first) < plan.rank(b.first); });
+        const NodeId nodeId = next->first;
+        auto inputs = std::move(next->second);
+        mWaveInputs.erase(next);
+
+        // Inputs kept by a waiting join are completed by the ones of this wave
+        auto waiting = mWaitingInputs.find(nodeId);
+        if (waiting != mWaitingInputs.end()) {
+            for (auto &input : inputs) {
+                waiting->second[input.first] = std::move(input.second);
+            }
+            inputs = std::move(waiting->second);
+            mWaitingInputs.erase(waiting);
+        }
+
+        if (waitsForUpstream(nodeId, inputs)) {
+            mWaitingInputs[nodeId] = std::move(inputs);
+            continue;
+        }
+        deliverInputBatch(nodeId, inputs);
+    }
+
+    mbWaveRunning = false;
+}
+
+void
+PBDataFlowGraphModel::
+deliverInputBatch(NodeId nodeId, std::map<QtNodes::PortIndex, QVariant> const &inputs)
+{
+    auto *delegateModel = executionPlan().delegate(nodeId);
+    if (delegateModel) {
+        delegateModel->holdOutputs(true);
+    }
+
+    std::size_t remaining = inputs.size();
+    for (const auto &input : inputs) {
+        if (delegateModel) {
+            delegateModel->setInputBatchPending(--remaining > 0);
+        }
+        deliverInput(nodeId, input.first, input.second);
+    }
+
+    // Queues the outputs for the nodes below, which run later in this wave
+    if (delegateModel) {
+        delegateModel->setInputBatchPending(false);
+        delegateModel->holdOutputs(false);
+    }
+}
+
+bool
+PBDataFlowGraphModel::
+waitsForUpstream(NodeId nodeId, std::map<QtNodes::PortIndex, QVariant> const &inputs)
+{
+    const PBExecutionPlan &plan = executionPlan();
+    auto *delegateModel = plan.delegate(nodeId);
+    if (!delegateModel || !delegateModel->isEnable()) {
+        return false;
+    }
+
+    // Walk up from the connected inputs that have no data in this wave
+    std::set<NodeId> visited;
+    std::stack<NodeId> pending;
+    for (const auto &cn : allConnectionIds(nodeId)) {
+        if (cn.inNodeId == nodeId && inputs.count(cn.inPortIndex) == 0) {
+            pending.push(cn.outNodeId);
         }
     }
+
+    while (!pending.empty()) {
+        const NodeId upstreamId = pending.top();
+        pending.pop();
+        if (!visited.insert(upstreamId).second) {
+            continue;
+        }
+        auto *upstreamModel = plan.delegate(upstreamId);
+        if (upstreamModel && upstreamModel->isEnable() && upstreamModel->hasWorkInFlight()) {
+            return true;
+        }
+        for (const auto &cn : allConnectionIds(upstreamId)) {
+            if (cn.inNodeId == upstreamId) {
+                pending.push(cn.outNodeId);
+            }
+        }
+    }
+    return false;
 }
 
 void
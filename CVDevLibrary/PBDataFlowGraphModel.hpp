@@ -25,6 +25,10 @@
  * - **Type Conversion:** Support automatic type converters in connections
  * - **Node Styling:** Per-node style instead of global style
  * - **Port Data Management:** Custom port data handling
+ * - **Pull Evaluation:** Optionally computes only nodes an active sink depends on
+ * - **Wave Scheduling:** Optionally fires every node once per frame, in topological order
+ * - **Execution Plan:** Analyses the topology once per edit and caches the result beside the .flow
+ * - **Buffer Reuse:** Optionally drops each image output once its last consumer has it
  *
  * **Migration from v2 to v3:**
  * - Replaces v2's PBFlowScene (which inherited from QGraphicsScene)
@@ -98,7 +102,11 @@
 #include <QtNodes/DataFlowGraphModel>
 #include <QtNodes/NodeDelegateModelRegistry>
 #include "PBNodeGroup.hpp"
+#include "PBExecutionPlan.hpp"
+#include "PBNodeMetrics.hpp"
+#include "TransportMode.hpp"
 #include <map>
+#include <set>
 #include <QMap>
 #include <QStringList>
 #include <QJsonObject>
@@ -206,6 +214,59 @@ class CVDEVSHAREDLIB_EXPORT PBDataFlowGraphModel : public QtNodes::DataFlowGraph
 {
     Q_OBJECT
 public:
+    /**
+     * @brief How data reaching a node's input is scheduled.
+     *
+     * - Push: every input is delivered at once and the node computes (default).
+     * - Pull: a node computes only while it is demanded, i.e. it is an active
+     *   sink or an enabled node downstream of it is demanded (see
+     *   PBNodeDelegateModel::sinkState(), or a node with outputs while a remote
+     *   transport publishes them). Inputs of other nodes are kept, latest
+     *   per port, and the node is dirty; they are delivered in topological order
+     *   as soon as the node becomes demanded again, e.g. when a display is
+     *   restored or a sink is connected.
+     *
+     * Pull applies to Qt propagation; remote transports always deliver.
+     */
+    enum class EvaluationMode
+    {
+        Push = 0,
+        Pull
+    };
+
+    /// "push" or "pull", as in `[Graph] evaluation_mode` of cvdev.ini; anything else is Push.
+    static EvaluationMode evaluationModeFromSetting(const QString& setting);
+    static QString settingFromEvaluationMode(EvaluationMode mode);
+
+    /**
+     * @brief How an output reaches the inputs downstream of it.
+     *
+     * - Immediate: each output is delivered as it is emitted and the receiving
+     *   node computes at once, recursively (default). A join fed by two
+     *   branches of one source computes once per branch, the first time with
+     *   the other input still from the previous frame.
+     * - Wave: an output emitted outside a wave opens one on the next event loop
+     *   turn. Everything it triggers is queued and delivered node by node in
+     *   topological order, each node receiving all its inputs of the wave in one
+     *   batch (see PBNodeDelegateModel::holdOutputs()), so it fires once per
+     *   frame with inputs of the same frame. Asynchronous nodes of a wave are
+     *   all dispatched before any node below them runs, so independent branches
+     *   compute in parallel on PBWorkerExecutor; a join waiting for one of them
+     *   keeps its other inputs until the result arrives (see
+     *   PBNodeDelegateModel::hasWorkInFlight()).
+     *
+     * Remote transports always deliver immediately.
+     */
+    enum class Scheduling
+    {
+        Immediate = 0,
+        Wave
+    };
+
+    /// "immediate" or "wave", as in `[Graph] scheduling` of cvdev.ini; anything else is Immediate.
+    static Scheduling schedulingFromSetting(const QString& setting);
+    static QString settingFromScheduling(Scheduling scheduling);
+
     /**
      * @brief Constructs a custom dataflow graph model.
      *
@@ -377,10 +438,32 @@ public:
      *
      * @note Fails gracefully if file doesn't exist or is invalid JSON
      * @note Does not clear existing graph - call clearScene() first if needed
+     * @note In headless mode node errors are not shown in a dialog; read them with loadErrors()
      * @see save_to_file() for saving graphs
      */
     bool load_from_file(QString const & sFilename);
 
+    /**
+     * @brief Errors collected for nodes skipped by the last load_from_file().
+     */
+    QStringList loadErrors() const { return mLoadErrors; }
+
+    /**
+     * @brief Metrics snapshot of every node, ordered by node id.
+     */
+    QList<NodeMetricsSnapshot> nodeMetrics() const;
+
+    /**
+     * @brief Writes nodeMetrics() to a file.
+     *
+     * A ".csv" suffix writes one row per node with a header line; anything
+     * else writes a JSON document {"flow", "timestamp", "nodes": [...], "links": [...]}
+     * where "links" holds PBLinkStats of the remote transport links received.
+     *
+     * @return false if the file could not be written
+     */
+    bool export_node_metrics(QString const & sFilename) const;
+
     /**
      * @brief Serializes a node to JSON with custom size information.
      *
@@ -444,6 +527,9 @@ public:
      * @param role NodeRole indicating requested data type
      * @return QVariant Requested node data (style, position, etc.)
      *
+     * In headless mode NodeRole::Widget yields an empty QVariant, so no
+     * embedded widget is resized, enabled or placed into a scene.
+     *
      * **Per-Node Styling:**
      * @code
      * // Each node can have custom colors/fonts
@@ -489,6 +575,7 @@ public:
      * @endcode
      *
      * @note Typically called internally during node computation
+     * @note In Wave scheduling an input is queued for the wave and delivered later
      */
     bool setPortData(QtNodes::NodeId nodeId,
                      QtNodes::PortType portType,
@@ -533,6 +620,86 @@ public:
     bool connectionPossible(QtNodes::ConnectionId const connectionId) const override;
     bool deleteConnection(QtNodes::ConnectionId const connectionId) override;
 
+    // ========== Evaluation Mode ==========
+
+    /**
+     * @brief Switches between push and pull evaluation.
+     *
+     * Leaving Pull delivers every kept input, so no node stays dirty.
+     */
+    void setEvaluationMode(EvaluationMode mode);
+    EvaluationMode evaluationMode() const { return meEvaluationMode; }
+
+    /**
+     * @brief True if @p nodeId computes on new input; always true in Push mode.
+     */
+    bool isNodeDemanded(NodeId nodeId);
+
+    /**
+     * @brief Nodes holding inputs they have not computed yet (Pull mode).
+     */
+    std::size_t dirtyNodeCount() const { return mDeferredInputs.size(); }
+
+    // ========== Scheduling ==========
+
+    /**
+     * @brief Switches between immediate and wave scheduling.
+     *
+     * Leaving Wave delivers the inputs still queued or kept for a join.
+     */
+    void setScheduling(Scheduling scheduling);
+    Scheduling scheduling() const { return meScheduling; }
+
+    /**
+     * @brief Waves run since the model was created.
+     */
+    quint64 waveCount() const { return miWaveCount; }
+
+    // ========== Execution Plan ==========
+
+    /**
+     * @brief Order, sources, input conversions, delegates and buffer slots of the current graph.
+     *
+     * Rebuilt on first use after a topology edit (node or connection added or
+     * removed, ports inserted or deleted); parameter changes keep it. See
+     * PBExecutionPlan.
+     */
+    const PBExecutionPlan &executionPlan();
+
+    // ========== Buffer Reuse ==========
+
+    /**
+     * @brief Releases image outputs at the end of their liveness (default false).
+     *
+     * After each delivery, the producers of the image outputs whose last consumer
+     * in the execution plan is the receiving node drop their reference
+     * (PBNodeDelegateModel::releaseOutput()), and the receiving node drops the
+     * inputs it kept for a recompute (PBNodeDelegateModel::releaseInputs()). A
+     * frame is then freed, and its pool or arena block recycled for a later
+     * stage, as soon as the last stage reading it is done instead of when its
+     * producer computes the next one. The cost: a parameter change on a node
+     * waits for the next frame instead of recomputing the last one.
+     */
+    void setBufferReuseEnabled(bool enabled) { mbBufferReuse = enabled; }
+    bool isBufferReuseEnabled() const { return mbBufferReuse; }
+
+    /**
+     * @brief Peak resident image memory of the graph, without and with buffer reuse.
+     *
+     * "before" keeps every image output resident. "after" ends an output at its
+     * last consumer only if reuse is on and its producer can release it
+     * (PBNodeDelegateModel::canReleaseOutput()), so it equals "before" with
+     * reuse off. "planned" is the theoretical figure with every producer
+     * releasing. Frame sizes are the last ones delivered on each connection, so
+     * the bytes are 0 until frames have flowed; "arena_peak_bytes_in_use" is the
+     * measured CVMatArena peak.
+     *
+     * @return {"image_outputs", "releasable_outputs", "peak_frames_before", "peak_frames_after",
+     *          "peak_bytes_before", "peak_bytes_after", "peak_frames_planned", "peak_bytes_planned",
+     *          "arena_peak_bytes_in_use", "reuse", "released"}
+     */
+    QJsonObject bufferReport();
+
     // ========== Node Grouping API ==========
     
     /**
@@ -712,11 +879,72 @@ private:
     void updateAllNodeTransportContext();
     void triggerInitialPropagation();
 
+    /// Connects the delegate signals that change what a node demands.
+    void connectDemandSignals(PBNodeDelegateModel *delegateModel);
+
+    /// Marks the demanded set stale; in Pull mode queues refreshDemand().
+    void invalidateDemand();
+
+    /// Recomputes the demanded set and delivers the inputs of nodes demanded again.
+    void refreshDemand();
+
+    /// Walks upstream from every active sink to rebuild mDemandedNodes.
+    void updateDemand();
+
+    /// Delivers kept inputs of demanded nodes (all nodes in Push mode) in topological order.
+    void flushDeferredInputs();
+
+    /// Marks the execution plan stale; called on every topology edit.
+    void invalidateExecutionPlan();
+
+    /// Type conversion, metrics and setInData() of one input.
+    bool deliverInput(NodeId nodeId, QtNodes::PortIndex portIndex, QVariant const &value);
+
+    /// Queues an input for the running wave, or for one started on the next event loop turn.
+    void enqueueWaveInput(NodeId nodeId, QtNodes::PortIndex portIndex, QVariant const &value);
+
+    /// Delivers queued inputs, lowest topological rank first, until none is left.
+    void runWave();
+
+    /// Delivers @p inputs to @p nodeId with its outputs held, so it emits each port once.
+    void deliverInputBatch(NodeId nodeId, std::map<QtNodes::PortIndex, QVariant> const &inputs);
+
+    /// True if an input port of @p nodeId missing from @p inputs is fed by a node with work in flight.
+    bool waitsForUpstream(NodeId nodeId, std::map<QtNodes::PortIndex, QVariant> const &inputs);
+
+    /// Releases the image outputs @p nodeId was the last consumer of, and its kept inputs.
+    void releaseDeadBuffers(NodeId nodeId);
+
     // Track error messages for nodes that couldn't be loaded
     QStringList mLoadErrors;
     QString msFlowFilename{"Untitle"};
     bool mbReadOnly{false};
     bool mbRestoringGraph{false};
+
+    // Pull evaluation
+    EvaluationMode meEvaluationMode{EvaluationMode::Push};
+    bool mbDemandDirty{true};
+    bool mbDemandRefreshQueued{false};
+    TransportMode meDemandTransport{TransportMode::QtOnly};   ///< Transport mDemandedNodes was computed for
+    std::set<NodeId> mDemandedNodes;
+    std::map<NodeId, std::map<QtNodes::PortIndex, QVariant>> mDeferredInputs;  ///< Latest undelivered input per port
+
+    // Execution plan
+    PBExecutionPlan mExecutionPlan;
+    bool mbPlanDirty{true};
+
+    // Buffer reuse
+    bool mbBufferReuse{false};
+    quint64 miReleasedBuffers{0};
+    std::map<PBExecutionPlan::PortKey, qint64> mImageOutputBytes;    ///< Last frame size of each image output
+
+    // Wave scheduling
+    Scheduling meScheduling{Scheduling::Immediate};
+    bool mbWaveQueued{false};
+    bool mbWaveRunning{false};
+    quint64 miWaveCount{0};
+    std::map<NodeId, std::map<QtNodes::PortIndex, QVariant>> mWaveInputs;     ///< Inputs of the running wave
+    std::map<NodeId, std::map<QtNodes::PortIndex, QVariant>> mWaitingInputs;  ///< Joins waiting for an upstream result
     
     // Node grouping
     std::map<GroupId, PBNodeGroup> mGroups;  ///< All groups in the model
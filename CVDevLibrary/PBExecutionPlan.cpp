@@ -0,0 +1,281 @@
+//Copyright © 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#include "PBExecutionPlan.hpp"
+#include "PBNodeDelegateModel.hpp"
+
+#include <QElapsedTimer>
+#include <QtNodes/DataFlowGraphModel>
+
+#include <algorithm>
+#include <deque>
+#include <set>
+
+using QtNodes::NodeId;
+using QtNodes::PortIndex;
+
+namespace
+{
+const char *kImageTypeId = "image";
+const char *kInformationTypeId = "Information";
+
+unsigned int
+portCount(const QtNodes::DataFlowGraphModel &model, NodeId nodeId, QtNodes::PortType portType)
+{
+    const auto role = portType == QtNodes::PortType::In ? QtNodes::NodeRole::InPortCount
+                                                        : QtNodes::NodeRole::OutPortCount;
+    return model.nodeData(nodeId, role).toUInt();
+}
+
+QString
+portTypeId(const QtNodes::DataFlowGraphModel &model, NodeId nodeId, QtNodes::PortType portType, PortIndex portIndex)
+{
+    return model.portData(nodeId, portType, portIndex, QtNodes::PortRole::DataType)
+        .value<QtNodes::NodeDataType>().id;
+}
+}
+
+PBExecutionPlan
+PBExecutionPlan::
+build(QtNodes::DataFlowGraphModel &model)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    PBExecutionPlan plan;
+
+    // Kahn's algorithm; the graph is acyclic since connectionPossible() rejects loops
+    const auto allIds = model.allNodeIds();
+    std::map<NodeId, std::size_t> inDegree;
+    for (NodeId nodeId : allIds) {
+        inDegree[nodeId] = 0;
+    }
+    for (NodeId nodeId : allIds) {
+        for (const auto &cn : model.allConnectionIds(nodeId)) {
+            if (cn.outNodeId == nodeId) {
+                ++inDegree[cn.inNodeId];
+            }
+        }
+    }
+
+    std::deque<NodeId> ready;
+    for (const auto &entry : inDegree) {
+        if (entry.second == 0) {
+            ready.push_back(entry.first);
+            plan.mSources.push_back(entry.first);
+        }
+    }
+
+    plan.mOrder.reserve(allIds.size());
+    while (!ready.empty()) {
+        const NodeId nodeId = ready.front();
+        ready.pop_front();
+        plan.mRank[nodeId] = plan.mOrder.size();
+        plan.mOrder.push_back(nodeId);
+        for (const auto &cn : model.allConnectionIds(nodeId)) {
+            if (cn.outNodeId == nodeId && --inDegree[cn.inNodeId] == 0) {
+                ready.push_back(cn.inNodeId);
+            }
+        }
+    }
+
+    // Linear scan in order: an output takes the slot of one whose last use came before it
+    const std::size_t lastRank = plan.mOrder.empty() ? 0 : plan.mOrder.size() - 1;
+    std::multimap<std::size_t, int> liveSlots;  // last use -> slot
+    std::set<int> freeSlots;
+    for (NodeId nodeId : plan.mOrder) {
+        for (const auto &cn : model.allConnectionIds(nodeId)) {
+            if (cn.inNodeId == nodeId &&
+                portTypeId(model, nodeId, QtNodes::PortType::In, cn.inPortIndex) == QLatin1String(kInformationTypeId)) {
+                plan.mConversions[{nodeId, cn.inPortIndex}] = InputConversion::Information;
+            }
+        }
+
+        const std::size_t nodeRank = plan.mRank[nodeId];
+        while (!liveSlots.empty() && liveSlots.begin()->first < nodeRank) {
+            freeSlots.insert(liveSlots.begin()->second);
+            liveSlots.erase(liveSlots.begin());
+        }
+
+        const unsigned int nOutputPorts = portCount(model, nodeId, QtNodes::PortType::Out);
+        for (PortIndex port = 0; port < nOutputPorts; ++port) {
+            if (portTypeId(model, nodeId, QtNodes::PortType::Out, port) != QLatin1String(kImageTypeId)) {
+                continue;
+            }
+            const PortKey output{nodeId, port};
+
+            // Nobody reads it, or a sink keeps it: live to the end
+            std::size_t lastUse = lastRank;
+            const auto consumers = model.connections(nodeId, QtNodes::PortType::Out, port);
+            if (!consumers.empty()) {
+                NodeId lastConsumer = QtNodes::InvalidNodeId;
+                bool readBySink = false;
+                lastUse = nodeRank;
+                for (const auto &cn : consumers) {
+                    plan.mImageSources[{cn.inNodeId, cn.inPortIndex}] = output;
+                    const std::size_t consumerRank = plan.mRank[cn.inNodeId];
+                    if (consumerRank >= lastUse) {
+                        lastUse = consumerRank;
+                        lastConsumer = cn.inNodeId;
+                    }
+                    readBySink = readBySink || portCount(model, cn.inNodeId, QtNodes::PortType::Out) == 0;
+                }
+                plan.mReleases[lastConsumer].push_back(output);
+                if (readBySink) {
+                    lastUse = lastRank;
+                }
+            }
+            plan.mLiveRanges[output] = {nodeRank, lastUse};
+
+            int slot = plan.miSlotCount;
+            if (freeSlots.empty()) {
+                ++plan.miSlotCount;
+            } else {
+                slot = *freeSlots.begin();
+                freeSlots.erase(freeSlots.begin());
+            }
+            plan.mBufferSlots[output] = slot;
+            liveSlots.emplace(lastUse, slot);
+        }
+    }
+
+    plan.resolveDelegates(model);
+    plan.mbValid = true;
+    plan.mdPrepareMs = timer.nsecsElapsed() / 1e6;
+    return plan;
+}
+
+std::size_t
+PBExecutionPlan::
+rank(NodeId nodeId) const
+{
+    auto it = mRank.find(nodeId);
+    return it != mRank.end() ? it->second : mOrder.size();
+}
+
+PBNodeDelegateModel *
+PBExecutionPlan::
+delegate(NodeId nodeId) const
+{
+    auto it = mDelegates.find(nodeId);
+    return it != mDelegates.end() ? it->second : nullptr;
+}
+
+PBExecutionPlan::InputConversion
+PBExecutionPlan::
+inputConversion(NodeId nodeId, PortIndex portIndex) const
+{
+    auto it = mConversions.find({nodeId, portIndex});
+    return it != mConversions.end() ? it->second : InputConversion::None;
+}
+
+int
+PBExecutionPlan::
+bufferSlot(NodeId nodeId, PortIndex portIndex) const
+{
+    auto it = mBufferSlots.find({nodeId, portIndex});
+    return it != mBufferSlots.end() ? it->second : -1;
+}
+
+bool
+PBExecutionPlan::
+imageSource(NodeId nodeId, PortIndex portIndex, PortKey &source) const
+{
+    auto it = mImageSources.find({nodeId, portIndex});
+    if (it == mImageSources.end()) {
+        return false;
+    }
+    source = it->second;
+    return true;
+}
+
+const std::vector<PBExecutionPlan::PortKey> &
+PBExecutionPlan::
+releasedAfter(NodeId nodeId) const
+{
+    static const std::vector<PortKey> none;
+    auto it = mReleases.find(nodeId);
+    return it != mReleases.end() ? it->second : none;
+}
+
+qint64
+PBExecutionPlan::
+peakResidentBytes(const std::map<PortKey, qint64> &bytes, const std::set<PortKey> &released) const
+{
+    auto sizeOf = [&bytes](const PortKey &output) -> qint64 {
+        auto it = bytes.find(output);
+        return it != bytes.end() ? it->second : 0;
+    };
+
+    // An output nobody drops is live from its producer to the end of the order
+    const std::size_t lastRank = mOrder.empty() ? 0 : mOrder.size() - 1;
+    qint64 peak = 0;
+    for (std::size_t rank = 0; rank < mOrder.size(); ++rank) {
+        qint64 live = 0;
+        for (const auto &entry : mLiveRanges) {
+            const std::size_t lastUse = released.count(entry.first) ? entry.second.second : lastRank;
+            if (entry.second.first <= rank && rank <= lastUse) {
+                live += sizeOf(entry.first);
+            }
+        }
+        peak = std::max(peak, live);
+    }
+    return peak;
+}
+
+int
+PBExecutionPlan::
+peakResidentFrames(const std::set<PortKey> &released) const
+{
+    std::map<PortKey, qint64> frames;
+    for (const auto &entry : mLiveRanges) {
+        frames[entry.first] = 1;
+    }
+    return static_cast<int>(peakResidentBytes(frames, released));
+}
+
+std::set<PBExecutionPlan::PortKey>
+PBExecutionPlan::
+imageOutputs() const
+{
+    std::set<PortKey> outputs;
+    for (const auto &entry : mBufferSlots) {
+        outputs.insert(entry.first);
+    }
+    return outputs;
+}
+
+QJsonObject
+PBExecutionPlan::
+summary() const
+{
+    QJsonObject json;
+    json["nodes"] = static_cast<qint64>(mOrder.size());
+    json["sources"] = static_cast<qint64>(mSources.size());
+    json["conversions"] = static_cast<qint64>(mConversions.size());
+    json["image_outputs"] = static_cast<qint64>(mBufferSlots.size());
+    json["slots"] = miSlotCount;
+    json["prepare_ms"] = mdPrepareMs;
+    return json;
+}
+
+void
+PBExecutionPlan::
+resolveDelegates(QtNodes::DataFlowGraphModel &model)
+{
+    mDelegates.clear();
+    for (NodeId nodeId : mOrder) {
+        mDelegates[nodeId] = model.delegateModel<PBNodeDelegateModel>(nodeId);
+    }
+}
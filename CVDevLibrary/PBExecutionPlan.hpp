@@ -0,0 +1,155 @@
+//Copyright © 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#pragma once
+
+/**
+ * @file PBExecutionPlan.hpp
+ * @brief What PBDataFlowGraphModel needs to know about a graph to run it.
+ *
+ * The plan is the result of analysing the topology once:
+ * - the topological order and the rank of every node in it
+ * - the source nodes, which have no connected input
+ * - the conversion applied to each connected input before setInData()
+ * - the delegate of every node, resolved once instead of per delivery
+ * - the liveness of every image output and a buffer slot shared by outputs
+ *   that are never live at the same time
+ *
+ * It depends only on nodes, their types and connections, so the model
+ * rebuilds it after a topology edit and nothing else. The plan is not
+ * persisted: input conversions and image outputs follow from port types,
+ * which only exist once the nodes are created, and the analysis is linear in
+ * the graph, so after a load building it costs less than checking a cached
+ * copy would.
+ *
+ * **Buffer liveness:**
+ * An image output is live from its producer to its last consumer in the
+ * order. Without reuse every node keeps its last output until its next frame,
+ * so all of them are resident at once; with reuse (see
+ * PBDataFlowGraphModel::setBufferReuseEnabled()) the producer drops its
+ * reference once the last consumer has the frame, and only the outputs live at
+ * the same rank are. Slots are assigned by a linear scan over the order, so
+ * bufferSlotCount() is that peak in frames. Outputs read by a sink, which keeps
+ * what it shows or writes, and outputs nobody reads stay live to the end.
+ */
+
+#include "CVDevLibrary.hpp"
+
+#include <QJsonObject>
+#include <QString>
+#include <QtNodes/Definitions>
+
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace QtNodes {
+    class DataFlowGraphModel;
+}
+
+class PBNodeDelegateModel;
+
+/**
+ * @class PBExecutionPlan
+ * @brief Topological order, input conversions, delegates and buffer slots of one graph.
+ *
+ * Built and owned by PBDataFlowGraphModel; delegate pointers stay valid
+ * until the next topology edit, which invalidates the plan.
+ */
+class CVDEVSHAREDLIB_EXPORT PBExecutionPlan
+{
+public:
+    using PortKey = std::pair<QtNodes::NodeId, QtNodes::PortIndex>;
+
+    /// Applied by PBDataFlowGraphModel to an input before setInData().
+    enum class InputConversion
+    {
+        None = 0,
+        Information     ///< The port takes InformationData; the value is passed on as such
+    };
+
+    /**
+     * @brief Analyses @p model.
+     */
+    static PBExecutionPlan build(QtNodes::DataFlowGraphModel &model);
+
+    bool isValid() const { return mbValid; }
+
+    /// Every node, each after the nodes feeding it.
+    const std::vector<QtNodes::NodeId> &order() const { return mOrder; }
+
+    /// Position of @p nodeId in order(); order().size() if unknown.
+    std::size_t rank(QtNodes::NodeId nodeId) const;
+
+    /// Nodes without a connected input.
+    const std::vector<QtNodes::NodeId> &sources() const { return mSources; }
+
+    /// Delegate of @p nodeId, nullptr if it is not a PBNodeDelegateModel.
+    PBNodeDelegateModel *delegate(QtNodes::NodeId nodeId) const;
+
+    InputConversion inputConversion(QtNodes::NodeId nodeId, QtNodes::PortIndex portIndex) const;
+
+    /// Buffer slot of an image output port, -1 for other ports.
+    int bufferSlot(QtNodes::NodeId nodeId, QtNodes::PortIndex portIndex) const;
+
+    /// Image outputs resident at once with reuse; outputs sharing a slot are never live together.
+    int bufferSlotCount() const { return miSlotCount; }
+
+    /// Image output feeding input @p portIndex of @p nodeId; false if the port is not fed by one.
+    bool imageSource(QtNodes::NodeId nodeId, QtNodes::PortIndex portIndex, PortKey &source) const;
+
+    /// Image outputs whose last consumer is @p nodeId.
+    const std::vector<PortKey> &releasedAfter(QtNodes::NodeId nodeId) const;
+
+    /// All image output ports.
+    std::set<PortKey> imageOutputs() const;
+
+    /**
+     * @brief Peak bytes of image outputs resident at once.
+     *
+     * @param bytes Size of the frame of each image output; outputs not listed count 0
+     * @param released Outputs whose producer drops them after their last use; the others stay
+     *                 resident to the end, as when a node keeps its last frame. Empty: every
+     *                 output resident at once; imageOutputs(): the planned liveness
+     */
+    qint64 peakResidentBytes(const std::map<PortKey, qint64> &bytes, const std::set<PortKey> &released) const;
+
+    /// Peak number of image outputs resident at once; see peakResidentBytes().
+    int peakResidentFrames(const std::set<PortKey> &released) const;
+
+    /// Time taken to build the plan.
+    double prepareMs() const { return mdPrepareMs; }
+
+    /**
+     * @brief {"nodes", "sources", "conversions", "image_outputs", "slots", "prepare_ms"}
+     */
+    QJsonObject summary() const;
+
+private:
+    void resolveDelegates(QtNodes::DataFlowGraphModel &model);
+
+    bool mbValid{false};
+    double mdPrepareMs{0.0};
+    std::vector<QtNodes::NodeId> mOrder;
+    std::map<QtNodes::NodeId, std::size_t> mRank;
+    std::vector<QtNodes::NodeId> mSources;
+    std::map<QtNodes::NodeId, PBNodeDelegateModel *> mDelegates;
+    std::map<PortKey, InputConversion> mConversions;    ///< Ports not listed: None
+    std::map<PortKey, int> mBufferSlots;                ///< Image output ports
+    std::map<PortKey, std::pair<std::size_t, std::size_t>> mLiveRanges;  ///< Image output -> ranks of producer and last use
+    std::map<PortKey, PortKey> mImageSources;           ///< Input port -> image output feeding it
+    std::map<QtNodes::NodeId, std::vector<PortKey>> mReleases;  ///< Last consumer -> image outputs it ends
+    int miSlotCount{0};
+};
@@ -44,6 +44,7 @@
 #include "PBDataFlowGraphModel.hpp"
 #include "GroupPasteCommand.hpp"
 #include "PBDeleteCommand.hpp"
+#include "TransportCodecDialog.hpp"
 
 PBFlowGraphicsView::PBFlowGraphicsView(QtNodes::BasicGraphicsScene *scene, QWidget *parent)
     : QtNodes::GraphicsView(scene, parent),
@@ -274,10 +275,27 @@ contextMenuEvent(QContextMenuEvent *event)
         QAction* sendToBackAction   = new QAction("Send to Back", &nodeMenu);
         nodeMenu.addAction(bringToFrontAction);
         nodeMenu.addAction(sendToBackAction);
+
+        // Per-port image codec used by the Zenoh / CycloneDDS transports
+        QAction* transportCodecAction = nullptr;
+        auto* nodeDelegate = pbModel ? pbModel->delegateModel<PBNodeDelegateModel>(nodeItem->nodeId()) : nullptr;
+        if (!isPreset && nodeDelegate)
+        {
+            nodeMenu.addSeparator();
+            transportCodecAction = new QAction("Transport Codec...", &nodeMenu);
+            nodeMenu.addAction(transportCodecAction);
+        }
         
         QAction* selectedAction = nodeMenu.exec(event->globalPos());
         
-        if (selectedAction == copyAction)
+        if (transportCodecAction && selectedAction == transportCodecAction)
+        {
+            TransportCodecDialog dialog(nodeDelegate, this);
+            // Mark the undo stack as not clean to indicate unsaved changes
+            if (dialog.exec() == QDialog::Accepted && dialog.apply())
+                mpDataFlowGraphicsScene->undoStack().resetClean();
+        }
+        else if (selectedAction == copyAction)
         {
             // Use NodeEditor v3's built-in CopyCommand
             mpDataFlowGraphicsScene->undoStack().push(new QtNodes::CopyCommand(mpDataFlowGraphicsScene));
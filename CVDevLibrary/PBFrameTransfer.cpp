@@ -0,0 +1,712 @@
+//Copyright © 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#include "PBFrameTransfer.hpp"
+
+#include <QElapsedTimer>
+#include <QRandomGenerator>
+#include <QtEndian>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <random>
+
+namespace
+{
+
+constexpr uint8_t kMagic[4] = {0xCC, 'C', 'K', 0x01};
+constexpr uint8_t kKindData = 0x00;
+constexpr uint8_t kKindNack = 0x01;
+constexpr uint8_t kFlagRetransmit = 0x01;
+constexpr size_t kNackHeaderSize = 16;
+
+/// A stream without pending frames is forgotten after this long.
+constexpr int64_t kStreamIdleUs = 10 * 1000 * 1000;
+
+std::vector<uint8_t>
+makeNack(uint32_t streamId, uint32_t frameId, const std::vector<uint32_t> &chunks)
+{
+    std::vector<uint8_t> nack(kNackHeaderSize + 4 * chunks.size());
+    std::memcpy(nack.data(), kMagic, sizeof(kMagic));
+    nack[4] = kKindNack;
+    nack[5] = 0;
+    qToLittleEndian<quint16>(static_cast<quint16>(chunks.size()), nack.data() + 6);
+    qToLittleEndian<quint32>(streamId, nack.data() + 8);
+    qToLittleEndian<quint32>(frameId, nack.data() + 12);
+    for (size_t i = 0; i < chunks.size(); ++i)
+        qToLittleEndian<quint32>(chunks[i], nack.data() + kNackHeaderSize + 4 * i);
+    return nack;
+}
+
+} // namespace
+
+// ============================================================================
+// Wire format
+// ============================================================================
+
+size_t
+FrameChunkHeader::
+bodySize() const
+{
+    if (chunkIndex + 1 < chunkCount)
+        return chunkBytes;
+    return totalSize - offset();
+}
+
+void
+FrameChunkHeader::
+write(uint8_t *destination) const
+{
+    std::memcpy(destination, kMagic, sizeof(kMagic));
+    destination[4] = kKindData;
+    destination[5] = flags;
+    qToLittleEndian<quint16>(deadlineMs, destination + 6);
+    qToLittleEndian<quint32>(streamId, destination + 8);
+    qToLittleEndian<quint32>(frameId, destination + 12);
+    qToLittleEndian<quint32>(totalSize, destination + 16);
+    qToLittleEndian<quint32>(chunkIndex, destination + 20);
+    qToLittleEndian<quint32>(chunkCount, destination + 24);
+    qToLittleEndian<quint32>(chunkBytes, destination + 28);
+}
+
+bool
+FrameChunkHeader::
+read(const uint8_t *data, size_t size, FrameChunkHeader &header)
+{
+    if (!data || size < Size || std::memcmp(data, kMagic, sizeof(kMagic)) != 0 || data[4] != kKindData)
+        return false;
+
+    header.flags = data[5];
+    header.deadlineMs = qFromLittleEndian<quint16>(data + 6);
+    header.streamId = qFromLittleEndian<quint32>(data + 8);
+    header.frameId = qFromLittleEndian<quint32>(data + 12);
+    header.totalSize = qFromLittleEndian<quint32>(data + 16);
+    header.chunkIndex = qFromLittleEndian<quint32>(data + 20);
+    header.chunkCount = qFromLittleEndian<quint32>(data + 24);
+    header.chunkBytes = qFromLittleEndian<quint32>(data + 28);
+
+    if (header.chunkBytes == 0 || header.totalSize == 0)
+        return false;
+    const uint64_t expectedCount = (static_cast<uint64_t>(header.totalSize) + header.chunkBytes - 1) / header.chunkBytes;
+    return header.chunkCount == expectedCount && header.chunkIndex < header.chunkCount;
+}
+
+void
+FrameChunk::
+copyTo(uint8_t *destination) const
+{
+    std::memcpy(destination, header, FrameChunkHeader::Size);
+    destination += FrameChunkHeader::Size;
+    for (const auto &span : body)
+    {
+        std::memcpy(destination, span.data, span.size);
+        destination += span.size;
+    }
+}
+
+std::vector<uint8_t>
+FrameChunk::
+toBytes() const
+{
+    std::vector<uint8_t> bytes(size());
+    copyTo(bytes.data());
+    return bytes;
+}
+
+void
+FrameTransferStats::
+add(const FrameTransferStats &other)
+{
+    framesSent += other.framesSent;
+    chunksSent += other.chunksSent;
+    chunksResent += other.chunksResent;
+    nacksReceived += other.nacksReceived;
+    nacksUnserved += other.nacksUnserved;
+    chunksReceived += other.chunksReceived;
+    chunksDuplicate += other.chunksDuplicate;
+    chunksStale += other.chunksStale;
+    framesDelivered += other.framesDelivered;
+    framesExpired += other.framesExpired;
+    framesSuperseded += other.framesSuperseded;
+    nacksSent += other.nacksSent;
+}
+
+QJsonObject
+FrameTransferStats::
+toJson() const
+{
+    QJsonObject json;
+    json["key"] = key;
+    json["frames_sent"] = static_cast<qint64>(framesSent);
+    json["chunks_sent"] = static_cast<qint64>(chunksSent);
+    json["chunks_resent"] = static_cast<qint64>(chunksResent);
+    json["nacks_received"] = static_cast<qint64>(nacksReceived);
+    json["nacks_unserved"] = static_cast<qint64>(nacksUnserved);
+    json["chunks_received"] = static_cast<qint64>(chunksReceived);
+    json["chunks_duplicate"] = static_cast<qint64>(chunksDuplicate);
+    json["chunks_stale"] = static_cast<qint64>(chunksStale);
+    json["frames_delivered"] = static_cast<qint64>(framesDelivered);
+    json["frames_expired"] = static_cast<qint64>(framesExpired);
+    json["frames_superseded"] = static_cast<qint64>(framesSuperseded);
+    json["nacks_sent"] = static_cast<qint64>(nacksSent);
+    return json;
+}
+
+// ============================================================================
+// Sender
+// ============================================================================
+
+PBFrameChunker::
+PBFrameChunker(const FrameChunkingConfig &config)
+    : mConfig(config)
+    , muStreamId(QRandomGenerator::global()->generate() | 1u)
+{
+}
+
+bool
+PBFrameChunker::
+shouldChunk(const SerializedPayload &payload) const
+{
+    return mConfig.enabled() && payload.size() > mConfig.thresholdBytes;
+}
+
+bool
+PBFrameChunker::
+send(SerializedPayload &&payload, const ChunkSink &sink)
+{
+    const size_t totalSize = payload.size();
+    if (totalSize == 0 || totalSize > std::numeric_limits<uint32_t>::max() || !sink)
+        return false;
+
+    const uint32_t chunkBytes = static_cast<uint32_t>(std::max<size_t>(1, std::min<size_t>(mConfig.chunkBytes, totalSize)));
+    const uint32_t chunkCount = static_cast<uint32_t>((totalSize + chunkBytes - 1) / chunkBytes);
+    auto owner = std::make_shared<const SerializedPayload>(std::move(payload));
+
+    uint32_t frameId = 0;
+    {
+        QMutexLocker locker(&mMutex);
+        frameId = ++muNextFrameId;
+        ++mStats.framesSent;
+        if (mConfig.retransmit && mConfig.retransmitFrames > 0)
+        {
+            mSentFrames.push_back(SentFrame{frameId, owner});
+            while (mSentFrames.size() > static_cast<size_t>(mConfig.retransmitFrames))
+                mSentFrames.pop_front();
+        }
+    }
+
+    uint64_t sent = 0;
+    bool ok = true;
+    for (uint32_t index = 0; index < chunkCount; ++index)
+    {
+        if (!sink(makeChunk(owner, frameId, index, chunkCount)))
+        {
+            ok = false;
+            break;
+        }
+        ++sent;
+    }
+
+    QMutexLocker locker(&mMutex);
+    mStats.chunksSent += sent;
+    return ok;
+}
+
+size_t
+PBFrameChunker::
+handleNack(const uint8_t *data, size_t size, const ChunkSink &sink)
+{
+    if (!data || size < kNackHeaderSize || std::memcmp(data, kMagic, sizeof(kMagic)) != 0 ||
+        data[4] != kKindNack || !sink)
+        return 0;
+    const size_t count = qFromLittleEndian<quint16>(data + 6);
+    const uint32_t streamId = qFromLittleEndian<quint32>(data + 8);
+    const uint32_t frameId = qFromLittleEndian<quint32>(data + 12);
+    if (streamId != muStreamId || size < kNackHeaderSize + 4 * count)
+        return 0;
+
+    std::shared_ptr<const SerializedPayload> owner;
+    {
+        QMutexLocker locker(&mMutex);
+        ++mStats.nacksReceived;
+        for (const SentFrame &frame : mSentFrames)
+        {
+            if (frame.frameId == frameId)
+                owner = frame.payload;
+        }
+        if (!owner)
+        {
+            ++mStats.nacksUnserved;
+            return 0;
+        }
+    }
+
+    const size_t totalSize = owner->size();
+    const uint32_t chunkBytes = static_cast<uint32_t>(std::max<size_t>(1, std::min<size_t>(mConfig.chunkBytes, totalSize)));
+    const uint32_t chunkCount = static_cast<uint32_t>((totalSize + chunkBytes - 1) / chunkBytes);
+
+    size_t sent = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint32_t index = qFromLittleEndian<quint32>(data + kNackHeaderSize + 4 * i);
+        if (index >= chunkCount)
+            continue;
+        if (!sink(makeChunk(owner, frameId, index, chunkCount)))
+            break;
+        ++sent;
+    }
+
+    QMutexLocker locker(&mMutex);
+    mStats.chunksResent += sent;
+    return sent;
+}
+
+void
+PBFrameChunker::
+addStats(FrameTransferStats &stats) const
+{
+    QMutexLocker locker(&mMutex);
+    stats.add(mStats);
+}
+
+FrameChunk
+PBFrameChunker::
+makeChunk(const std::shared_ptr<const SerializedPayload> &payload,
+          uint32_t frameId, uint32_t index, uint32_t count) const
+{
+    FrameChunkHeader header;
+    header.flags = (mConfig.retransmit && mConfig.retransmitFrames > 0) ? kFlagRetransmit : 0;
+    header.deadlineMs = static_cast<uint16_t>(qBound(1, mConfig.deadlineMs, 65535));
+    header.streamId = muStreamId;
+    header.frameId = frameId;
+    header.totalSize = static_cast<uint32_t>(payload->size());
+    header.chunkIndex = index;
+    header.chunkCount = count;
+    header.chunkBytes = static_cast<uint32_t>(std::max<size_t>(1, std::min<size_t>(mConfig.chunkBytes, header.totalSize)));
+
+    FrameChunk chunk;
+    header.write(chunk.header);
+    chunk.owner = payload;
+    chunk.bodySize = header.bodySize();
+
+    // Views of [offset, offset + bodySize) across the payload's segments
+    size_t skip = header.offset();
+    size_t remaining = chunk.bodySize;
+    for (const auto &segment : payload->segments())
+    {
+        if (remaining == 0)
+            break;
+        if (skip >= segment.size)
+        {
+            skip -= segment.size;
+            continue;
+        }
+        const size_t take = std::min(segment.size - skip, remaining);
+        chunk.body.push_back(SerializedPayload::Segment{segment.data + skip, take});
+        remaining -= take;
+        skip = 0;
+    }
+    return chunk;
+}
+
+// ============================================================================
+// Receiver
+// ============================================================================
+
+bool
+PBFrameReassembler::
+isChunk(const uint8_t *data, size_t size)
+{
+    return data && size >= sizeof(kMagic) && std::memcmp(data, kMagic, sizeof(kMagic)) == 0;
+}
+
+void
+PBFrameReassembler::
+push(const uint8_t *data, size_t size, int64_t nowUs, PushResult &result)
+{
+    FrameChunkHeader header;
+    if (!FrameChunkHeader::read(data, size, header) || size - FrameChunkHeader::Size != header.bodySize())
+    {
+        result = PushResult();
+        return;
+    }
+    push(header, [data](uint8_t *destination, size_t bytes) {
+        std::memcpy(destination, data + FrameChunkHeader::Size, bytes);
+    }, nowUs, result);
+}
+
+void
+PBFrameReassembler::
+push(const FrameChunkHeader &header, const BodyReader &readBody, int64_t nowUs, PushResult &result)
+{
+    result.complete = false;
+    result.frameId = 0;
+    result.frame.clear();
+    result.nacks.clear();
+    if (header.totalSize > MaxFrameBytes || !readBody)
+        return;
+
+    QMutexLocker locker(&mMutex);
+    ++mStats.chunksReceived;
+    Stream &stream = streamFor(header.streamId, nowUs);
+
+    auto it = stream.pending.find(header.frameId);
+    if (it == stream.pending.end())
+    {
+        // Never go back in time: older than a frame delivered or discarded
+        if (stream.hasFloor && header.frameId <= stream.floorFrameId)
+        {
+            ++mStats.chunksStale;
+            expireStream(header.streamId, stream, nowUs, result);
+            return;
+        }
+        if (stream.pending.size() >= MaxPendingFrames)
+        {
+            if (header.frameId < stream.pending.begin()->first)
+            {
+                ++mStats.chunksStale;
+                return;
+            }
+            ++mStats.framesSuperseded;
+            erasePending(stream, stream.pending.begin());
+        }
+
+        // A newer frame has started: older frames are missing their tail
+        for (auto &entry : stream.pending)
+        {
+            if (entry.second.retransmit && !entry.second.nacked)
+                appendNack(header.streamId, entry.first, entry.second, result);
+        }
+
+        // The buffer is sized by the chunks that arrive, not by the header's claim
+        Pending pending;
+        pending.totalSize = header.totalSize;
+        pending.received.assign(header.chunkCount, false);
+        pending.chunkBytes = header.chunkBytes;
+        pending.firstUs = nowUs;
+        pending.deadlineUs = nowUs + static_cast<int64_t>(header.deadlineMs) * 1000;
+        pending.retransmit = (header.flags & kFlagRetransmit) != 0;
+        it = stream.pending.emplace(header.frameId, std::move(pending)).first;
+    }
+
+    Pending &pending = it->second;
+    if (pending.totalSize != header.totalSize || pending.chunkBytes != header.chunkBytes ||
+        pending.received.size() != header.chunkCount)
+    {
+        ++mStats.chunksStale;
+        return;
+    }
+    if (pending.received[header.chunkIndex])
+    {
+        ++mStats.chunksDuplicate;
+        expireStream(header.streamId, stream, nowUs, result);
+        return;
+    }
+
+    const size_t end = static_cast<size_t>(header.offset()) + header.bodySize();
+    if (end > pending.bytes.size())
+    {
+        if (!reserveBytes(end - pending.bytes.size(), &pending))
+        {
+            // Too much is buffered already: this frame cannot finish
+            ++mStats.framesExpired;
+            stream.hasFloor = true;
+            stream.floorFrameId = std::max(stream.floorFrameId, header.frameId);
+            erasePending(stream, it);
+            expireStream(header.streamId, stream, nowUs, result);
+            return;
+        }
+        mPendingBytes += end - pending.bytes.size();
+        pending.bytes.resize(end);
+    }
+
+    readBody(pending.bytes.data() + header.offset(), header.bodySize());
+    pending.received[header.chunkIndex] = true;
+    ++pending.receivedCount;
+
+    if (pending.receivedCount == header.chunkCount)
+    {
+        const bool late = nowUs > pending.deadlineUs;
+        mPendingBytes -= pending.bytes.size();
+        std::vector<uint8_t> bytes = std::move(pending.bytes);
+        bytes.resize(pending.totalSize);
+        stream.pending.erase(it);
+        stream.hasFloor = true;
+        stream.floorFrameId = std::max(stream.floorFrameId, header.frameId);
+
+        // Incomplete older frames can only be delivered stale now
+        while (!stream.pending.empty() && stream.pending.begin()->first < header.frameId)
+        {
+            ++mStats.framesSuperseded;
+            erasePending(stream, stream.pending.begin());
+        }
+
+        if (late)
+        {
+            ++mStats.framesExpired;
+        }
+        else
+        {
+            ++mStats.framesDelivered;
+            result.complete = true;
+            result.frameId = header.frameId;
+            result.frame = std::move(bytes);
+        }
+    }
+    else if (header.chunkIndex + 1 == header.chunkCount && pending.retransmit && !pending.nacked)
+    {
+        // The tail arrived, so every gap before it is a loss
+        appendNack(header.streamId, header.frameId, pending, result);
+    }
+
+    expireStream(header.streamId, stream, nowUs, result);
+}
+
+void
+PBFrameReassembler::
+expire(int64_t nowUs, PushResult &result)
+{
+    result.complete = false;
+    result.frameId = 0;
+    result.frame.clear();
+    result.nacks.clear();
+
+    QMutexLocker locker(&mMutex);
+    for (auto it = mStreams.begin(); it != mStreams.end();)
+    {
+        expireStream(it->first, it->second, nowUs, result);
+        if (it->second.pending.empty() && nowUs - it->second.lastActivityUs > kStreamIdleUs)
+            it = mStreams.erase(it);
+        else
+            ++it;
+    }
+}
+
+void
+PBFrameReassembler::
+addStats(FrameTransferStats &stats) const
+{
+    QMutexLocker locker(&mMutex);
+    stats.add(mStats);
+}
+
+void
+PBFrameReassembler::
+expireStream(uint32_t streamId, Stream &stream, int64_t nowUs, PushResult &result)
+{
+    for (auto it = stream.pending.begin(); it != stream.pending.end();)
+    {
+        Pending &pending = it->second;
+        if (nowUs > pending.deadlineUs)
+        {
+            // Later chunks of this frame count as stale
+            ++mStats.framesExpired;
+            stream.hasFloor = true;
+            stream.floorFrameId = std::max(stream.floorFrameId, it->first);
+            it = erasePending(stream, it);
+            continue;
+        }
+        if (pending.retransmit && !pending.nacked && nowUs - pending.firstUs >= (pending.deadlineUs - pending.firstUs) / 2)
+            appendNack(streamId, it->first, pending, result);
+        ++it;
+    }
+}
+
+void
+PBFrameReassembler::
+appendNack(uint32_t streamId, uint32_t frameId, Pending &pending, PushResult &result)
+{
+    pending.nacked = true;
+    std::vector<uint32_t> missing;
+    for (size_t i = 0; i < pending.received.size() && missing.size() < MaxNackChunks; ++i)
+    {
+        if (!pending.received[i])
+            missing.push_back(static_cast<uint32_t>(i));
+    }
+    if (missing.empty())
+        return;
+    result.nacks.push_back(makeNack(streamId, frameId, missing));
+    ++mStats.nacksSent;
+}
+
+PBFrameReassembler::Stream &
+PBFrameReassembler::
+streamFor(uint32_t streamId, int64_t nowUs)
+{
+    auto it = mStreams.find(streamId);
+    if (it == mStreams.end())
+    {
+        if (mStreams.size() >= MaxStreams)
+        {
+            auto oldest = std::min_element(mStreams.begin(), mStreams.end(), [](const auto &a, const auto &b) {
+                return a.second.lastActivityUs < b.second.lastActivityUs;
+            });
+            mStats.framesExpired += oldest->second.pending.size();
+            for (const auto &entry : oldest->second.pending)
+                mPendingBytes -= entry.second.bytes.size();
+            mStreams.erase(oldest);
+        }
+        it = mStreams.emplace(streamId, Stream()).first;
+    }
+    it->second.lastActivityUs = nowUs;
+    return it->second;
+}
+
+std::map<uint32_t, PBFrameReassembler::Pending>::iterator
+PBFrameReassembler::
+erasePending(Stream &stream, std::map<uint32_t, Pending>::iterator it)
+{
+    mPendingBytes -= it->second.bytes.size();
+    return stream.pending.erase(it);
+}
+
+bool
+PBFrameReassembler::
+reserveBytes(size_t extra, const Pending *keep)
+{
+    if (extra > MaxPendingBytes)
+        return false;
+    while (mPendingBytes + extra > MaxPendingBytes)
+    {
+        // Oldest first: the frame least likely to still make its deadline
+        Stream *victimStream = nullptr;
+        std::map<uint32_t, Pending>::iterator victim;
+        for (auto &entry : mStreams)
+        {
+            for (auto it = entry.second.pending.begin(); it != entry.second.pending.end(); ++it)
+            {
+                if (&it->second == keep || it->second.bytes.empty())
+                    continue;
+                if (!victimStream || it->second.firstUs < victim->second.firstUs)
+                {
+                    victimStream = &entry.second;
+                    victim = it;
+                }
+            }
+        }
+        if (!victimStream)
+            return false;
+        ++mStats.framesSuperseded;
+        victimStream->hasFloor = true;
+        victimStream->floorFrameId = std::max(victimStream->floorFrameId, victim->first);
+        erasePending(*victimStream, victim);
+    }
+    return true;
+}
+
+// ============================================================================
+// Loopback
+// ============================================================================
+
+PBFrameLoopback::
+PBFrameLoopback(const FrameLoopbackConfig &config)
+    : mConfig(config)
+{
+}
+
+FrameLoopbackResult
+PBFrameLoopback::
+run(int frames, size_t payloadBytes)
+{
+    FrameLoopbackResult result;
+    if (frames <= 0 || payloadBytes < 16 || mConfig.linkMBps <= 0.0)
+        return result;
+
+    PBFrameChunker chunker(mConfig.chunking);
+    PBFrameReassembler reassembler;
+    std::mt19937 random(mConfig.seed);
+    std::bernoulli_distribution drop(qBound(0.0, mConfig.dropRate, 1.0));
+
+    int64_t nowUs = 0;
+    std::map<uint32_t, std::vector<uint8_t>> expected;     ///< Frame ID -> bytes sent
+    std::vector<std::vector<uint8_t>> nacks;
+    PBFrameReassembler::PushResult pushed;
+
+    auto collect = [&]() {
+        for (auto &nack : pushed.nacks)
+        {
+            if (!drop(random))
+                nacks.push_back(std::move(nack));
+        }
+        if (!pushed.complete)
+            return;
+        ++result.framesDelivered;
+        const auto sent = expected.find(pushed.frameId);
+        if (sent != expected.end() && sent->second == pushed.frame)
+            ++result.framesIntact;
+    };
+
+    // The receiver sees each chunk's body through its segments, as from a transport reader
+    auto link = [&](const FrameChunk &chunk) {
+        nowUs += static_cast<int64_t>(static_cast<double>(chunk.size()) / mConfig.linkMBps);
+        if (drop(random))
+            return true;
+        FrameChunkHeader header;
+        FrameChunkHeader::read(chunk.header, FrameChunkHeader::Size, header);
+        reassembler.push(header, [&chunk](uint8_t *destination, size_t size) {
+            for (const auto &span : chunk.body)
+            {
+                const size_t take = std::min(span.size, size);
+                std::memcpy(destination, span.data, take);
+                destination += take;
+                size -= take;
+            }
+        }, nowUs, pushed);
+        collect();
+        return true;
+    };
+
+    QElapsedTimer timer;
+    timer.start();
+    const int64_t frameIntervalUs = static_cast<int64_t>(mConfig.frameIntervalMs * 1000.0);
+    for (int frame = 0; frame < frames; ++frame)
+    {
+        // The link idles until the next frame is produced, or is still busy with the last one
+        nowUs = std::max<int64_t>(nowUs, frame * frameIntervalUs);
+
+        SerializedPayload payload;
+        payload.header.assign(16, static_cast<uint8_t>(frame));
+        payload.pixels.create(1, static_cast<int>(payloadBytes - 16), CV_8UC1);
+        cv::RNG pixels(mConfig.seed + static_cast<uint64_t>(frame));
+        pixels.fill(payload.pixels, cv::RNG::UNIFORM, 0, 256);
+
+        const uint32_t frameId = static_cast<uint32_t>(frame + 1);
+        expected[frameId] = payload.flatten();
+        while (expected.size() > PBFrameReassembler::MaxPendingFrames + 1)
+            expected.erase(expected.begin());
+
+        chunker.send(std::move(payload), link);
+        ++result.framesSent;
+
+        // The backward path answers after this frame; retransmits may trigger further NACKs
+        while (!nacks.empty())
+        {
+            std::vector<std::vector<uint8_t>> due;
+            due.swap(nacks);
+            for (const auto &nack : due)
+                chunker.handleNack(nack.data(), nack.size(), link);
+        }
+        reassembler.expire(nowUs, pushed);
+        collect();
+    }
+
+    // Let every frame still incomplete reach its deadline
+    reassembler.expire(nowUs + static_cast<int64_t>(mConfig.chunking.deadlineMs + 1) * 1000, pushed);
+    result.wallMs = timer.nsecsElapsed() / 1e6;
+
+    chunker.addStats(result.stats);
+    reassembler.addStats(result.stats);
+    return result;
+}
@@ -0,0 +1,415 @@
+//Copyright © 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#pragma once
+
+/**
+ * @file PBFrameTransfer.hpp
+ * @brief Chunked, loss-tolerant transfer of large payloads over Zenoh and DDS.
+ *
+ * A raw 4K frame is tens of megabytes. Sent as one Zenoh put or one DDS
+ * sample it is fragmented by the transport, blocks the publisher until the
+ * last fragment is out, and one lost fragment loses the whole frame after the
+ * transport has spent its time retrying. Above a size threshold the bridges
+ * instead split the payload into chunks that carry their own header, and the
+ * receiver reassembles them.
+ *
+ * **Chunk:**
+ * @code
+ * [Magic:4] [Kind:1] [Flags:1] [DeadlineMs:2] [StreamId:4] [FrameId:4]
+ * [TotalSize:4] [ChunkIndex:4] [ChunkCount:4] [ChunkBytes:4] [Body]
+ * @endcode
+ * All fields are little-endian. The body holds bytes
+ * [ChunkIndex * ChunkBytes, + ChunkBytes) of the payload, the last chunk the
+ * rest. The magic starts with 0xCC, which is never a NodeDataSerializer
+ * protocol version, so a receiver tells chunks from whole payloads by their
+ * first byte. StreamId is chosen at random by each sender, so frame IDs of
+ * several publishers on one key do not mix.
+ *
+ * **Deadline:**
+ * A frame must be complete within DeadlineMs of the arrival of its first
+ * chunk; the receiver's clock only, so no clock synchronization is needed.
+ * A frame that misses its deadline is discarded, never delivered late. So is
+ * an incomplete frame once a newer frame of its stream has been delivered,
+ * and a frame completing after a newer one: the receiver never goes back in
+ * time.
+ *
+ * **Retransmit (optional):**
+ * A sender with FrameChunkingConfig::retransmit keeps its last few frames and
+ * marks their chunks. A receiver that sees a gap in such a frame (the last
+ * chunk arrived, a newer frame started, or half the deadline has passed)
+ * sends one NACK listing the missing chunks, and the sender sends them again:
+ * @code
+ * [Magic:4] [Kind:1] [Reserved:1] [Count:2] [StreamId:4] [FrameId:4] [ChunkIndex:4 x Count]
+ * @endcode
+ *
+ * @code
+ * // Sender
+ * chunker.send(std::move(payload), [&](const FrameChunk& chunk) {
+ *     return transport.write(chunk.toBytes());
+ * });
+ * // Receiver
+ * PBFrameReassembler::PushResult result;
+ * reassembler.push(data, size, FrameHop::now(), result);
+ * if (result.complete)
+ *     NodeDataSerializer::deserialize(result.frame);
+ * for (const auto& nack : result.nacks)
+ *     transport.writeNack(nack);
+ * @endcode
+ *
+ * PBFrameLoopback runs a sender and a receiver in-process over a link that
+ * drops chunks, to measure what the settings deliver (`cvdev-run --chunk-loopback`).
+ */
+
+#include "CVDevLibrary.hpp"
+#include "NodeDataSerializer.hpp"
+
+#include <QJsonObject>
+#include <QMutex>
+#include <QString>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+/**
+ * @struct FrameChunkingConfig
+ * @brief Chunking settings of one transport, read from `[FrameChunking]` in cvdev.ini.
+ */
+struct CVDEVSHAREDLIB_EXPORT FrameChunkingConfig
+{
+    size_t thresholdBytes{0};       ///< Payloads larger than this are chunked; 0 (default) sends every payload whole
+    size_t chunkBytes{60000};       ///< Payload bytes per chunk
+    int deadlineMs{100};            ///< Time a frame has to complete after its first chunk
+    bool retransmit{false};         ///< Answer NACKs with the missing chunks
+    int retransmitFrames{2};        ///< Recent frames kept for retransmission
+
+    bool enabled() const { return thresholdBytes > 0 && chunkBytes > 0; }
+};
+
+/**
+ * @struct FrameChunkHeader
+ * @brief Decoded header of one data chunk.
+ */
+struct CVDEVSHAREDLIB_EXPORT FrameChunkHeader
+{
+    static constexpr size_t Size = 32;
+
+    uint8_t flags{0};
+    uint16_t deadlineMs{0};
+    uint32_t streamId{0};
+    uint32_t frameId{0};
+    uint32_t totalSize{0};
+    uint32_t chunkIndex{0};
+    uint32_t chunkCount{0};
+    uint32_t chunkBytes{0};
+
+    /// Byte offset of the body in the payload.
+    size_t offset() const { return static_cast<size_t>(chunkIndex) * chunkBytes; }
+
+    /// Body size the header announces.
+    size_t bodySize() const;
+
+    void write(uint8_t* destination) const;
+
+    /**
+     * @brief Decodes a data chunk header.
+     *
+     * @return false if @p data is not a data chunk or its fields are inconsistent
+     */
+    static bool read(const uint8_t* data, size_t size, FrameChunkHeader& header);
+};
+
+/**
+ * @struct FrameChunk
+ * @brief One chunk ready to send: the encoded header and views of its body.
+ *
+ * The body spans point into the sender's payload, which @ref owner keeps
+ * alive; a transport that sends asynchronously holds a copy of @ref owner
+ * until it is done.
+ */
+struct CVDEVSHAREDLIB_EXPORT FrameChunk
+{
+    uint8_t header[FrameChunkHeader::Size];
+    std::vector<SerializedPayload::Segment> body;   ///< At most three: header, pixel and trailer segments
+    size_t bodySize{0};
+    std::shared_ptr<const SerializedPayload> owner;
+
+    size_t size() const { return FrameChunkHeader::Size + bodySize; }
+
+    /// Writes header and body to @p destination, which must hold size() bytes.
+    void copyTo(uint8_t* destination) const;
+
+    /// Header and body in one buffer.
+    std::vector<uint8_t> toBytes() const;
+};
+
+/**
+ * @struct FrameTransferStats
+ * @brief Chunk counters of one key, sender and receiver side.
+ */
+struct CVDEVSHAREDLIB_EXPORT FrameTransferStats
+{
+    QString key;
+
+    uint64_t framesSent{0};
+    uint64_t chunksSent{0};
+    uint64_t chunksResent{0};       ///< Chunks sent again for a NACK
+    uint64_t nacksReceived{0};
+    uint64_t nacksUnserved{0};      ///< NACKs for frames no longer kept
+
+    uint64_t chunksReceived{0};
+    uint64_t chunksDuplicate{0};
+    uint64_t chunksStale{0};        ///< Chunks of frames already delivered or discarded
+    uint64_t framesDelivered{0};
+    uint64_t framesExpired{0};      ///< Discarded for missing their deadline
+    uint64_t framesSuperseded{0};   ///< Discarded because a newer frame was delivered first
+    uint64_t nacksSent{0};
+
+    /// Adds the counters of @p other; keeps @ref key.
+    void add(const FrameTransferStats& other);
+
+    QJsonObject toJson() const;
+};
+
+/**
+ * @class PBFrameChunker
+ * @brief Sender side: splits payloads into chunks and answers NACKs.
+ *
+ * One chunker per key. Thread-safe; the sink is called without any lock held,
+ * on the thread calling send() or handleNack().
+ */
+class CVDEVSHAREDLIB_EXPORT PBFrameChunker
+{
+public:
+    /// Sends one chunk; returns false if the transport refused it.
+    using ChunkSink = std::function<bool(const FrameChunk&)>;
+
+    explicit PBFrameChunker(const FrameChunkingConfig& config);
+
+    PBFrameChunker(const PBFrameChunker&) = delete;
+    PBFrameChunker& operator=(const PBFrameChunker&) = delete;
+
+    const FrameChunkingConfig& config() const { return mConfig; }
+
+    /**
+     * @brief True if @p payload is large enough to be chunked.
+     */
+    bool shouldChunk(const SerializedPayload& payload) const;
+
+    /**
+     * @brief Sends @p payload as chunks through @p sink.
+     *
+     * Stops at the first chunk the sink refuses.
+     * @return false if a chunk was refused or @p payload is too large (4 GB)
+     */
+    bool send(SerializedPayload&& payload, const ChunkSink& sink);
+
+    /**
+     * @brief Sends again the chunks listed by a NACK message, if the frame is still kept.
+     *
+     * NACKs of other streams are ignored.
+     * @return chunks sent
+     */
+    size_t handleNack(const uint8_t* data, size_t size, const ChunkSink& sink);
+
+    void addStats(FrameTransferStats& stats) const;
+
+private:
+    struct SentFrame
+    {
+        uint32_t frameId{0};
+        std::shared_ptr<const SerializedPayload> payload;
+    };
+
+    /// Builds chunk @p index of @p payload.
+    FrameChunk makeChunk(const std::shared_ptr<const SerializedPayload>& payload,
+                         uint32_t frameId, uint32_t index, uint32_t count) const;
+
+    const FrameChunkingConfig mConfig;
+    const uint32_t muStreamId;
+
+    mutable QMutex mMutex;
+    uint32_t muNextFrameId{0};
+    std::deque<SentFrame> mSentFrames;      ///< Kept for retransmission, oldest first
+    FrameTransferStats mStats;
+};
+
+/**
+ * @class PBFrameReassembler
+ * @brief Receiver side: collects chunks into frames and enforces the deadline.
+ *
+ * One reassembler per key. Thread-safe. Keeps at most MaxPendingFrames
+ * incomplete frames per stream; starting another discards the oldest. A
+ * frame's buffer grows with the chunks that actually arrive rather than with
+ * the size its header claims, and all incomplete frames together hold at most
+ * MaxPendingBytes; past that the oldest incomplete frames are discarded.
+ */
+class CVDEVSHAREDLIB_EXPORT PBFrameReassembler
+{
+public:
+    static constexpr size_t MaxPendingFrames = 3;
+    static constexpr size_t MaxStreams = 16;
+    /// Largest payload accepted; bounds what a corrupt header can allocate.
+    static constexpr uint32_t MaxFrameBytes = 1u << 30;
+    /// Budget for the buffers of all incomplete frames of this reassembler.
+    static constexpr size_t MaxPendingBytes = MaxFrameBytes;
+    static constexpr size_t MaxNackChunks = 1024;
+
+    /// Copies the @p size body bytes of the current chunk to @p destination.
+    using BodyReader = std::function<void(uint8_t* destination, size_t size)>;
+
+    struct PushResult
+    {
+        bool complete{false};
+        uint32_t frameId{0};                            ///< Sender's frame ID of @ref frame
+        std::vector<uint8_t> frame;                     ///< The completed payload when @ref complete
+        std::vector<std::vector<uint8_t>> nacks;        ///< NACK messages to send back to the publisher
+    };
+
+    PBFrameReassembler() = default;
+
+    PBFrameReassembler(const PBFrameReassembler&) = delete;
+    PBFrameReassembler& operator=(const PBFrameReassembler&) = delete;
+
+    /**
+     * @brief True if @p data starts with the chunk magic (data chunk or NACK).
+     */
+    static bool isChunk(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Adds one chunk received at @p nowUs (FrameHop::now()).
+     *
+     * @p result is reset first. A chunk with an inconsistent header is ignored.
+     */
+    void push(const uint8_t* data, size_t size, int64_t nowUs, PushResult& result);
+
+    /**
+     * @brief push() for a chunk whose body is not contiguous in memory.
+     *
+     * @p readBody is called at most once, for header.bodySize() bytes.
+     */
+    void push(const FrameChunkHeader& header, const BodyReader& readBody, int64_t nowUs, PushResult& result);
+
+    /**
+     * @brief Discards frames past their deadline and sends due NACKs.
+     *
+     * push() does this for the chunk's stream only; the transports call it
+     * periodically so that frames whose chunks stopped arriving release their
+     * memory and request retransmits on a quiet link.
+     */
+    void expire(int64_t nowUs, PushResult& result);
+
+    void addStats(FrameTransferStats& stats) const;
+
+private:
+    struct Pending
+    {
+        std::vector<uint8_t> bytes;                 ///< Grown up to the furthest chunk received
+        std::vector<bool> received;
+        uint32_t totalSize{0};
+        uint32_t chunkBytes{0};
+        uint32_t receivedCount{0};
+        int64_t firstUs{0};
+        int64_t deadlineUs{0};
+        bool retransmit{false};     ///< The sender keeps this frame for NACKs
+        bool nacked{false};
+    };
+
+    struct Stream
+    {
+        bool hasFloor{false};
+        uint32_t floorFrameId{0};                   ///< Newest frame delivered or discarded; older ones are stale
+        int64_t lastActivityUs{0};
+        std::map<uint32_t, Pending> pending;        ///< Frame ID -> incomplete frame
+    };
+
+    /// Checks deadlines and NACKs of @p stream; caller holds mMutex.
+    void expireStream(uint32_t streamId, Stream& stream, int64_t nowUs, PushResult& result);
+
+    /// Appends a NACK for the chunks missing from @p pending; caller holds mMutex.
+    void appendNack(uint32_t streamId, uint32_t frameId, Pending& pending, PushResult& result);
+
+    Stream& streamFor(uint32_t streamId, int64_t nowUs);
+
+    /// Erases one incomplete frame and returns its buffer to the budget; caller holds mMutex.
+    std::map<uint32_t, Pending>::iterator erasePending(Stream& stream, std::map<uint32_t, Pending>::iterator it);
+
+    /**
+     * @brief Makes room for @p extra more buffered bytes; caller holds mMutex.
+     *
+     * Discards the oldest incomplete frames other than @p keep. Returns false
+     * if the budget cannot be met even then.
+     */
+    bool reserveBytes(size_t extra, const Pending* keep);
+
+    mutable QMutex mMutex;
+    std::map<uint32_t, Stream> mStreams;
+    size_t mPendingBytes{0};                        ///< Sum of Pending::bytes over all streams
+    FrameTransferStats mStats;
+};
+
+/**
+ * @struct FrameLoopbackConfig
+ * @brief Link simulated by PBFrameLoopback.
+ */
+struct CVDEVSHAREDLIB_EXPORT FrameLoopbackConfig
+{
+    FrameChunkingConfig chunking;
+    double dropRate{0.0};           ///< Probability of losing each chunk and each NACK
+    double linkMBps{1000.0};        ///< Simulated link rate; sets the virtual time a chunk takes
+    double frameIntervalMs{33.3};   ///< Virtual time between frames
+    uint32_t seed{1};
+};
+
+/**
+ * @struct FrameLoopbackResult
+ * @brief Outcome of PBFrameLoopback::run().
+ */
+struct CVDEVSHAREDLIB_EXPORT FrameLoopbackResult
+{
+    int framesSent{0};
+    int framesDelivered{0};
+    int framesIntact{0};            ///< Delivered byte-identical to what was sent
+    FrameTransferStats stats;
+    double wallMs{0.0};             ///< Real time spent chunking and reassembling
+};
+
+/**
+ * @class PBFrameLoopback
+ * @brief In-process sender and receiver connected by a lossy link.
+ *
+ * Time is virtual: each chunk advances the clock by its size over
+ * FrameLoopbackConfig::linkMBps, so deadlines behave as on a real link of that
+ * rate whatever the speed of the machine. NACKs are answered after the
+ * current frame's chunks, as on a link whose backward path is one frame late.
+ * Deterministic for a given seed.
+ */
+class CVDEVSHAREDLIB_EXPORT PBFrameLoopback
+{
+public:
+    explicit PBFrameLoopback(const FrameLoopbackConfig& config);
+
+    /**
+     * @brief Sends @p frames payloads of @p payloadBytes bytes each through the link.
+     */
+    FrameLoopbackResult run(int frames, size_t payloadBytes);
+
+private:
+    FrameLoopbackConfig mConfig;
+};
@@ -0,0 +1,187 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#include "PBLinkStats.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+struct PBLinkStats::Link
+{
+    QString hostId;
+    QString producerId;
+    uint64_t received{0};
+    uint64_t lost{0};
+    uint64_t reordered{0};
+    uint64_t expected{0};           ///< Next expected sequence; 0 before the first frame
+    int hops{0};
+
+    int64_t windowMinUs{std::numeric_limits<int64_t>::max()};
+    int64_t previousWindowMinUs{std::numeric_limits<int64_t>::max()};
+    uint64_t windowCount{0};
+
+    double delaySumUs{0.0};
+    double endToEndSumUs{0.0};
+    uint64_t endToEndCount{0};
+    bool hasLastDelay{false};
+    int64_t lastDelayUs{0};
+    double jitterUs{0.0};
+    PBLatencyHistogram queuing;
+
+    int64_t
+    baselineUs() const
+    {
+        return std::min(windowMinUs, previousWindowMinUs);
+    }
+};
+
+QJsonObject
+LinkStatsSnapshot::
+toJson() const
+{
+    QJsonObject json;
+    json["key"] = key;
+    json["host"] = hostId;
+    json["producer"] = producerId;
+    json["received"] = static_cast<qint64>(received);
+    json["lost"] = static_cast<qint64>(lost);
+    json["reordered"] = static_cast<qint64>(reordered);
+    json["loss_rate"] = lossRate;
+    json["mean_delay_ms"] = meanDelayMs;
+    json["baseline_delay_ms"] = baselineDelayMs;
+    json["jitter_ms"] = jitterMs;
+    json["mean_end_to_end_ms"] = meanEndToEndMs;
+    json["hops"] = hops;
+    json["queuing"] = queuing.toJson();
+    return json;
+}
+
+PBLinkStats &
+PBLinkStats::
+instance()
+{
+    static PBLinkStats stats;
+    return stats;
+}
+
+uint64_t
+PBLinkStats::
+nextSequence(const QString &key)
+{
+    QMutexLocker locker(&mMutex);
+    return ++mPublishSequences[key];
+}
+
+void
+PBLinkStats::
+recordReceive(const QString &key, const FrameMetadata &metadata)
+{
+    if (metadata.hops.empty() || metadata.hops.back().receiveUs == 0)
+        return;
+    const FrameHop &hop = metadata.hops.back();
+    const int64_t delayUs = hop.receiveUs - hop.publishUs;
+
+    QMutexLocker locker(&mMutex);
+    auto &link = mLinks[key];
+    if (!link)
+        link = std::make_shared<Link>();
+
+    link->hostId = hop.hostId;
+    link->producerId = metadata.producerId;
+    link->hops = static_cast<int>(metadata.hops.size());
+    ++link->received;
+
+    if (link->expected == 0 || hop.sequence >= link->expected)
+    {
+        if (link->expected != 0)
+            link->lost += hop.sequence - link->expected;
+        link->expected = hop.sequence + 1;
+    }
+    else if (link->expected - hop.sequence > WindowSize)
+    {
+        // Far behind: the publisher restarted its sequence
+        link->expected = hop.sequence + 1;
+    }
+    else
+    {
+        // A frame counted as lost arrived late
+        ++link->reordered;
+        if (link->lost > 0)
+            --link->lost;
+    }
+
+    link->windowMinUs = std::min(link->windowMinUs, delayUs);
+    if (++link->windowCount >= WindowSize)
+    {
+        link->previousWindowMinUs = link->windowMinUs;
+        link->windowMinUs = std::numeric_limits<int64_t>::max();
+        link->windowCount = 0;
+    }
+    link->queuing.record(static_cast<uint64_t>(std::max<int64_t>(0, delayUs - link->baselineUs())) * 1000);
+
+    // RFC 3550: the clock offset cancels in the difference of consecutive delays
+    if (link->hasLastDelay)
+        link->jitterUs += (std::abs(static_cast<double>(delayUs - link->lastDelayUs)) - link->jitterUs) / 16.0;
+    link->hasLastDelay = true;
+    link->lastDelayUs = delayUs;
+    link->delaySumUs += static_cast<double>(delayUs);
+
+    if (metadata.timestamp > 0)
+    {
+        link->endToEndSumUs += static_cast<double>(hop.receiveUs - static_cast<int64_t>(metadata.timestamp) * 1000);
+        ++link->endToEndCount;
+    }
+}
+
+QList<LinkStatsSnapshot>
+PBLinkStats::
+snapshot() const
+{
+    QList<LinkStatsSnapshot> result;
+    QMutexLocker locker(&mMutex);
+    for (auto it = mLinks.cbegin(); it != mLinks.cend(); ++it)
+    {
+        const Link &link = *it.value();
+        LinkStatsSnapshot entry;
+        entry.key = it.key();
+        entry.hostId = link.hostId;
+        entry.producerId = link.producerId;
+        entry.received = link.received;
+        entry.lost = link.lost;
+        entry.reordered = link.reordered;
+        entry.hops = link.hops;
+        if (link.received + link.lost > 0)
+            entry.lossRate = static_cast<double>(link.lost) / static_cast<double>(link.received + link.lost);
+        if (link.received > 0)
+        {
+            entry.meanDelayMs = link.delaySumUs / static_cast<double>(link.received) / 1000.0;
+            entry.baselineDelayMs = static_cast<double>(link.baselineUs()) / 1000.0;
+        }
+        if (link.endToEndCount > 0)
+            entry.meanEndToEndMs = link.endToEndSumUs / static_cast<double>(link.endToEndCount) / 1000.0;
+        entry.jitterMs = link.jitterUs / 1000.0;
+        entry.queuing = link.queuing.summary();
+        result.append(entry);
+    }
+    return result;
+}
+
+void
+PBLinkStats::
+reset()
+{
+    QMutexLocker locker(&mMutex);
+    mLinks.clear();
+}
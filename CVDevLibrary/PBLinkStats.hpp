@@ -0,0 +1,134 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#pragma once
+
+/**
+ * @file PBLinkStats.hpp
+ * @brief Latency, jitter and loss of each remote transport link.
+ *
+ * A link is one transport key (Zenoh key or DDS topic) seen from one side.
+ * Publishers take a sequence number per key from nextSequence() and write it
+ * with their wall-clock publish time into the frame trace extension of the
+ * payload (NodeDataSerializer::appendFrameTrace()). Receivers report every
+ * traced payload with recordReceive().
+ *
+ * **Clock offset:**
+ * Publish and receive times come from different hosts, so the raw one-way
+ * delay `receive - publish` is the true delay plus an unknown clock offset.
+ * The statistics avoid depending on it:
+ * - The smallest delay seen recently (two windows of WindowSize frames) is
+ *   taken as the baseline, i.e. offset plus propagation time. The queuing
+ *   histogram records `delay - baseline`, which is what grows when a link
+ *   or a receiver falls behind.
+ * - Jitter is the RFC 3550 interarrival jitter, computed from differences of
+ *   consecutive delays, in which the offset cancels.
+ * - Loss and reordering come from sequence gaps.
+ * The raw mean delay is reported as well; it is the real latency only when
+ * the hosts' clocks are synchronized (NTP/PTP).
+ *
+ * @code
+ * // Publisher
+ * NodeDataSerializer::appendFrameTrace(payload, computerId,
+ *                                      PBLinkStats::instance().nextSequence(key));
+ * // Receiver
+ * PBLinkStats::instance().recordReceive(key, image->metadata());
+ * @endcode
+ */
+
+#include "CVDevLibrary.hpp"
+#include "CVImagePool.hpp"
+#include "PBNodeMetrics.hpp"
+
+#include <QJsonObject>
+#include <QList>
+#include <QMap>
+#include <QMutex>
+#include <QString>
+
+#include <cstdint>
+#include <memory>
+
+/**
+ * @struct LinkStatsSnapshot
+ * @brief Receive-side statistics of one link.
+ */
+struct CVDEVSHAREDLIB_EXPORT LinkStatsSnapshot
+{
+    QString key;                 ///< Transport key or topic
+    QString hostId;              ///< Publishing computer ID of the last frame
+    QString producerId;          ///< Producer node of the last frame
+    uint64_t received{0};
+    uint64_t lost{0};            ///< Sequence numbers never received
+    uint64_t reordered{0};       ///< Frames older than one already received
+    double lossRate{0.0};        ///< lost / (received + lost)
+    double meanDelayMs{0.0};     ///< Raw one-way delay; includes the clock offset
+    double baselineDelayMs{0.0}; ///< Recent minimum raw delay: clock offset + propagation
+    double jitterMs{0.0};        ///< RFC 3550 interarrival jitter
+    double meanEndToEndMs{0.0};  ///< Producer timestamp to arrival; includes the clock offset
+    int hops{0};                 ///< Links crossed by the last frame, this one included
+    PBLatencyHistogram::Summary queuing;  ///< Delay above the baseline
+
+    QJsonObject toJson() const;
+};
+
+/**
+ * @class PBLinkStats
+ * @brief Process-wide registry of per-link publish sequences and receive statistics.
+ *
+ * Thread-safe: publishers call it from encoder workers and receivers from
+ * transport threads.
+ */
+class CVDEVSHAREDLIB_EXPORT PBLinkStats
+{
+public:
+    /// Frames per baseline window.
+    static constexpr uint64_t WindowSize = 512;
+
+    static PBLinkStats& instance();
+
+    /**
+     * @brief Next publish sequence number of @p key, starting at 1.
+     */
+    uint64_t nextSequence(const QString& key);
+
+    /**
+     * @brief Accounts a frame received on @p key.
+     *
+     * Uses the last hop of @p metadata; frames without hops or with no receive
+     * time are ignored.
+     */
+    void recordReceive(const QString& key, const FrameMetadata& metadata);
+
+    /**
+     * @brief Statistics of every link received so far, sorted by key.
+     */
+    QList<LinkStatsSnapshot> snapshot() const;
+
+    /**
+     * @brief Forgets receive statistics; publish sequences continue.
+     */
+    void reset();
+
+private:
+    struct Link;
+
+    PBLinkStats() = default;
+    PBLinkStats(const PBLinkStats&) = delete;
+    PBLinkStats& operator=(const PBLinkStats&) = delete;
+
+    mutable QMutex mMutex;
+    QMap<QString, uint64_t> mPublishSequences;
+    QMap<QString, std::shared_ptr<Link>> mLinks;
+};
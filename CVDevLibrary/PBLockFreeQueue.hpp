@@ -0,0 +1,606 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#pragma once
+/**
+ * @file PBLockFreeQueue.hpp
+ * @brief Lock-free bounded ring-buffer queues with the PBAsyncQueue API.
+ *
+ * PBAsyncQueue takes a mutex on every enqueue and dequeue. These variants
+ * move items through a fixed ring of cells instead; each cell carries a
+ * sequence number that tells producers and the consumer whose turn it is, so
+ * the fast path is a couple of atomic loads and stores (plus one CAS per item
+ * for multiple producers). No lock is taken unless a thread has to sleep.
+ *
+ * Variants:
+ * - PBSpscQueue<T>: exactly one producer thread and one consumer thread.
+ * - PBMpscQueue<T>: any number of producer threads, one consumer thread.
+ *
+ * Calling the consumer side (dequeue*, clear) from more than one thread at a
+ * time is not supported by either variant; neither is calling the producer
+ * side of PBSpscQueue from more than one thread.
+ *
+ * Features:
+ * - Same enqueue/dequeue/dequeue_optional/set_finished/size API as PBAsyncQueue
+ * - Non-blocking try_enqueue()/try_dequeue()
+ * - enqueue_bulk()/dequeue_bulk() to move many items per call; a multi-producer
+ *   bulk enqueue claims its whole range with one CAS
+ * - Spin-then-park waiting: a blocked call first polls with a CPU pause hint,
+ *   then yields, then sleeps on a condition variable. Wake-ups are only
+ *   signalled when a thread is actually asleep, so the uncontended path never
+ *   touches a mutex.
+ *
+ * Usage:
+ * @code
+ *   PBMpscQueue<cv::Mat> queue(64);
+ *
+ *   // Producers (any thread)
+ *   queue.enqueue(frame, 1000);
+ *
+ *   // Consumer (one thread): drain up to 16 items per wake-up
+ *   std::vector<cv::Mat> batch;
+ *   while (queue.dequeue_bulk(std::back_inserter(batch), 16) > 0) {
+ *       process(batch);
+ *       batch.clear();
+ *   }
+ *
+ *   queue.set_finished();  // Wakes all waiters
+ * @endcode
+ *
+ * @see PBAsyncQueue
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Number of producer threads a PBLockFreeQueue is built for.
+ */
+enum class PBQueueProducers
+{
+    Single,
+    Multi
+};
+
+/**
+ * @brief How long a blocked call busy-waits before it sleeps.
+ *
+ * Spinning keeps the hand-off latency in the sub-microsecond range when the
+ * other side is about to act, at the cost of burning the core meanwhile.
+ * Set both counts to 0 to park immediately.
+ */
+struct PBQueueWaitStrategy
+{
+    int spin_iterations{256};   ///< Polls with a CPU pause hint between them
+    int yield_iterations{32};   ///< Polls with std::this_thread::yield() between them
+};
+
+template<typename T, PBQueueProducers Producers>
+class PBLockFreeQueue {
+public:
+    /**
+     * @brief Construct a bounded queue with specified maximum capacity.
+     * @param max_size Maximum number of items the queue can hold
+     * @param wait_strategy Spin/yield budget of blocking calls before they park
+     * @throws std::invalid_argument if max_size is 0
+     */
+    explicit PBLockFreeQueue(size_t max_size, PBQueueWaitStrategy wait_strategy = {})
+        : max_size_(checked_size(max_size))
+        , cells_(new Cell[max_size_])
+        , wait_strategy_(wait_strategy)
+    {
+        for (size_t i = 0; i < max_size_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~PBLockFreeQueue() = default;
+
+    PBLockFreeQueue(const PBLockFreeQueue&) = delete;
+    PBLockFreeQueue& operator=(const PBLockFreeQueue&) = delete;
+
+    /**
+     * @brief Enqueue an item without blocking.
+     * @return true if the item was enqueued, false if the queue is full or finished.
+     *         On false the item is left untouched.
+     */
+    bool try_enqueue(T& item)
+    {
+        if (finished_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        if (!push_one(item)) {
+            return false;
+        }
+        wake(not_empty_);
+        return true;
+    }
+
+    /**
+     * @brief Enqueue an item with optional timeout.
+     *
+     * @param item Item to enqueue (moved into queue)
+     * @param timeout_ms Timeout in milliseconds (0 = infinite/blocking, default = infinite)
+     * @return true if item was enqueued, false if queue is finished or timeout occurred
+     */
+    bool enqueue(T item, int timeout_ms = 0)
+    {
+        if (finished_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        return wait_until_done([&]() { return try_enqueue(item); },
+                               [this]() { return has_space(); },
+                               not_full_, timeout_ms, false);
+    }
+
+    /**
+     * @brief Enqueue @p count items starting at @p first.
+     *
+     * Items are moved out of the source range as they are enqueued. Blocks
+     * until all of them are in, the timeout expires or the queue is finished.
+     *
+     * @return Number of items enqueued (a prefix of the range)
+     */
+    template<typename InputIt>
+    size_t enqueue_bulk(InputIt first, size_t count, int timeout_ms = 0)
+    {
+        size_t done = 0;
+        if (count == 0 || finished_.load(std::memory_order_acquire)) {
+            return 0;
+        }
+        wait_until_done([&]() {
+                            if (finished_.load(std::memory_order_acquire)) {
+                                return false;
+                            }
+                            size_t pushed = push_range(first, count - done);
+                            if (pushed > 0) {
+                                done += pushed;
+                                wake(not_empty_);
+                            }
+                            return done == count;
+                        },
+                        [this]() { return has_space(); },
+                        not_full_, timeout_ms, false);
+        return done;
+    }
+
+    /**
+     * @brief Dequeue an item without blocking.
+     * @return true if an item was dequeued, false if the queue is empty.
+     */
+    bool try_dequeue(T& item)
+    {
+        if (!pop_one(item)) {
+            return false;
+        }
+        wake(not_full_);
+        return true;
+    }
+
+    /**
+     * @brief Dequeue an item with optional timeout.
+     *
+     * @param item Output parameter to receive dequeued item
+     * @param timeout_ms Timeout in milliseconds (0 = infinite/blocking, default = infinite)
+     * @return true if item was dequeued, false if queue is empty/finished or timeout occurred
+     *
+     * Items enqueued before set_finished() are still delivered.
+     */
+    bool dequeue(T& item, int timeout_ms = 0)
+    {
+        return wait_until_done([&]() { return try_dequeue(item); },
+                               [this]() { return has_item(); },
+                               not_empty_, timeout_ms, true);
+    }
+
+    /**
+     * @brief Dequeue with std::optional (modern C++17 style).
+     *
+     * @param timeout_ms Timeout in milliseconds (0 = infinite)
+     * @return std::optional<T> with item if successful, empty if finished/timeout/empty
+     */
+    std::optional<T> dequeue_optional(int timeout_ms = 0)
+    {
+        T item;
+        if (dequeue(item, timeout_ms)) {
+            return std::optional<T>(std::move(item));
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Dequeue up to @p max_items items into @p out.
+     *
+     * Waits (subject to @p timeout_ms) until at least one item is available,
+     * then takes everything that is ready, up to @p max_items, without
+     * waiting again.
+     *
+     * @return Number of items written to @p out; 0 on timeout or when finished and empty
+     */
+    template<typename OutputIt>
+    size_t dequeue_bulk(OutputIt out, size_t max_items, int timeout_ms = 0)
+    {
+        size_t taken = 0;
+        if (max_items == 0) {
+            return 0;
+        }
+        wait_until_done([&]() {
+                            taken = pop_range(out, max_items);
+                            if (taken > 0) {
+                                wake(not_full_);
+                            }
+                            return taken > 0;
+                        },
+                        [this]() { return has_item(); },
+                        not_empty_, timeout_ms, true);
+        return taken;
+    }
+
+    /**
+     * @brief Mark the queue as finished (no more items will be enqueued).
+     *
+     * Wakes all threads waiting in enqueue() or dequeue(). Pending enqueue()
+     * calls return false; dequeue() returns false once the queue is empty.
+     *
+     * Safe to call multiple times.
+     */
+    void set_finished()
+    {
+        finished_.store(true, std::memory_order_seq_cst);
+        for (Waiters* waiters : {&not_empty_, &not_full_}) {
+            std::lock_guard<std::mutex> lock(waiters->mutex);
+            waiters->cv.notify_all();
+        }
+    }
+
+    /**
+     * @brief Check if the queue has been marked as finished.
+     * @return true if set_finished() was called
+     */
+    [[nodiscard]] bool is_finished() const
+    {
+        return finished_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get current size of the queue.
+     *
+     * Note: Value is approximate and may change immediately after return
+     * in multithreaded context. Items whose enqueue is still in progress are
+     * counted.
+     *
+     * @return Number of items currently in queue
+     */
+    [[nodiscard]] size_t size() const
+    {
+        // Head first: tail can only move forward meanwhile, so the difference never underflows.
+        const size_t head = head_.load(std::memory_order_acquire);
+        const size_t tail = tail_.load(std::memory_order_acquire);
+        const size_t used = tail - head;
+        return used < max_size_ ? used : max_size_;
+    }
+
+    /**
+     * @brief Check if queue is empty.
+     *
+     * Note: Result is approximate in multithreaded context.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Check if queue is at maximum capacity.
+     *
+     * Note: Result is approximate in multithreaded context.
+     */
+    [[nodiscard]] bool full() const
+    {
+        return size() >= max_size_;
+    }
+
+    /**
+     * @brief Get maximum capacity of the queue.
+     * @return Maximum size configured at construction
+     */
+    [[nodiscard]] size_t capacity() const
+    {
+        return max_size_;
+    }
+
+    /**
+     * @brief Clear all items from the queue.
+     *
+     * Consumer side only: must not run concurrently with dequeue().
+     * Does NOT affect the finished flag.
+     */
+    void clear()
+    {
+        T item;
+        bool cleared = false;
+        while (pop_one(item)) {
+            cleared = true;
+        }
+        if (cleared) {
+            wake(not_full_);
+        }
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence{0};    ///< == position: free for that lap; == position + 1: holds an item
+        T value{};
+    };
+
+    struct Waiters
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::atomic<int> sleeping{0};
+    };
+
+    static size_t checked_size(size_t max_size)
+    {
+        if (max_size == 0) {
+            throw std::invalid_argument("PBLockFreeQueue: max_size must be > 0");
+        }
+        return max_size;
+    }
+
+    static void cpu_relax()
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield");
+#endif
+    }
+
+    Cell& cell_at(size_t position) const
+    {
+        return cells_[position % max_size_];
+    }
+
+    /// Claims the next free cell and moves @p item into it.
+    bool push_one(T& item)
+    {
+        size_t position = tail_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        if constexpr (Producers == PBQueueProducers::Single) {
+            cell = &cell_at(position);
+            if (cell->sequence.load(std::memory_order_acquire) != position) {
+                return false;
+            }
+            tail_.store(position + 1, std::memory_order_relaxed);
+        } else {
+            for (;;) {
+                cell = &cell_at(position);
+                const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                const auto lag = static_cast<std::intptr_t>(sequence - position);
+                if (lag == 0) {
+                    if (tail_.compare_exchange_weak(position, position + 1,
+                                                    std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (lag < 0) {
+                    return false;   // the consumer has not freed this cell yet: full
+                } else {
+                    position = tail_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+        cell->value = std::move(item);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Claims as many cells as are free, up to @p count, and fills them from @p first.
+    template<typename InputIt>
+    size_t push_range(InputIt& first, size_t count)
+    {
+        size_t position;
+        size_t claimed;
+        // Cells below head + max_size_ have been released by the consumer, which
+        // publishes head_ only after their sequence stores, so the whole range is free.
+        // head_ may lag behind a bulk dequeue in progress, hence the used >= max_size_ guard.
+        if constexpr (Producers == PBQueueProducers::Single) {
+            const size_t head = head_.load(std::memory_order_acquire);
+            position = tail_.load(std::memory_order_relaxed);
+            const size_t used = position - head;
+            if (used >= max_size_) {
+                return 0;
+            }
+            claimed = std::min(count, max_size_ - used);
+            tail_.store(position + claimed, std::memory_order_relaxed);
+        } else {
+            for (;;) {
+                const size_t head = head_.load(std::memory_order_acquire);
+                position = tail_.load(std::memory_order_relaxed);
+                const size_t used = position - head;
+                if (used >= max_size_) {
+                    return 0;
+                }
+                claimed = std::min(count, max_size_ - used);
+                if (tail_.compare_exchange_weak(position, position + claimed,
+                                                std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+        }
+        for (size_t i = 0; i < claimed; ++i, ++first) {
+            Cell& cell = cell_at(position + i);
+            cell.value = std::move(*first);
+            cell.sequence.store(position + i + 1, std::memory_order_release);
+        }
+        return claimed;
+    }
+
+    /// Takes the item at the head, if it has been published.
+    bool pop_one(T& item)
+    {
+        const size_t position = head_.load(std::memory_order_relaxed);
+        Cell& cell = cell_at(position);
+        if (cell.sequence.load(std::memory_order_acquire) != position + 1) {
+            return false;
+        }
+        item = std::move(cell.value);
+        cell.sequence.store(position + max_size_, std::memory_order_release);
+        head_.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Takes up to @p max_items published items from the head.
+    template<typename OutputIt>
+    size_t pop_range(OutputIt& out, size_t max_items)
+    {
+        const size_t start = head_.load(std::memory_order_relaxed);
+        size_t position = start;
+        while (position - start < max_items) {
+            Cell& cell = cell_at(position);
+            if (cell.sequence.load(std::memory_order_acquire) != position + 1) {
+                break;
+            }
+            *out = std::move(cell.value);
+            ++out;
+            cell.sequence.store(position + max_size_, std::memory_order_release);
+            ++position;
+        }
+        if (position != start) {
+            head_.store(position, std::memory_order_release);
+        }
+        return position - start;
+    }
+
+    bool has_item() const
+    {
+        const size_t position = head_.load(std::memory_order_acquire);
+        return cell_at(position).sequence.load(std::memory_order_acquire) == position + 1;
+    }
+
+    bool has_space() const
+    {
+        return size() < max_size_;
+    }
+
+    /// Signals @p waiters if anyone sleeps there. Pairs with the fence in wait_until_done().
+    void wake(Waiters& waiters)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.sleeping.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(waiters.mutex);
+            waiters.cv.notify_all();
+        }
+    }
+
+    /**
+     * @brief Runs @p attempt until it succeeds: spin, then yield, then park on @p waiters.
+     *
+     * @p ready is a side-effect-free check evaluated under the waiters mutex
+     * just before sleeping; it must turn true whenever the other side's wake()
+     * would be needed. @p drain_when_finished makes a finished queue still
+     * hand out what it holds (consumer side).
+     */
+    template<typename Attempt, typename Ready>
+    bool wait_until_done(Attempt&& attempt, Ready&& ready, Waiters& waiters,
+                         int timeout_ms, bool drain_when_finished)
+    {
+        auto give_up = [&]() { return drain_when_finished && attempt(); };
+
+        for (int i = 0; i < wait_strategy_.spin_iterations; ++i) {
+            if (attempt()) {
+                return true;
+            }
+            if (finished_.load(std::memory_order_acquire)) {
+                return give_up();
+            }
+            cpu_relax();
+        }
+        for (int i = 0; i < wait_strategy_.yield_iterations; ++i) {
+            if (attempt()) {
+                return true;
+            }
+            if (finished_.load(std::memory_order_acquire)) {
+                return give_up();
+            }
+            std::this_thread::yield();
+        }
+
+        const auto deadline = std::chrono::steady_clock::now()
+                              + std::chrono::milliseconds(timeout_ms > 0 ? timeout_ms : 0);
+        for (;;) {
+            if (attempt()) {
+                return true;
+            }
+            if (finished_.load(std::memory_order_acquire)) {
+                return give_up();
+            }
+
+            std::unique_lock<std::mutex> lock(waiters.mutex);
+            waiters.sleeping.fetch_add(1, std::memory_order_seq_cst);
+            // Either this check sees the other side's progress or its wake() sees us sleeping.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            bool timed_out = false;
+            if (!ready() && !finished_.load(std::memory_order_seq_cst)) {
+                if (timeout_ms > 0) {
+                    timed_out = waiters.cv.wait_until(lock, deadline) == std::cv_status::timeout;
+                } else {
+                    waiters.cv.wait(lock);
+                }
+            }
+            waiters.sleeping.fetch_sub(1, std::memory_order_relaxed);
+            lock.unlock();
+
+            if (timed_out) {
+                return attempt();
+            }
+        }
+    }
+
+    const size_t max_size_;
+    std::unique_ptr<Cell[]> cells_;
+    const PBQueueWaitStrategy wait_strategy_;
+    std::atomic<bool> finished_{false};
+
+    alignas(64) std::atomic<size_t> tail_{0};      // next position producers claim
+    alignas(64) std::atomic<size_t> head_{0};      // next position the consumer takes
+
+    alignas(64) Waiters not_empty_;                // the consumer sleeps here
+    Waiters not_full_;                             // producers sleep here
+};
+
+/// Lock-free queue for exactly one producer thread and one consumer thread.
+template<typename T>
+using PBSpscQueue = PBLockFreeQueue<T, PBQueueProducers::Single>;
+
+/// Lock-free queue for any number of producer threads and one consumer thread.
+template<typename T>
+using PBMpscQueue = PBLockFreeQueue<T, PBQueueProducers::Multi>;
@@ -27,6 +27,7 @@
 
 #include "PBNodeDelegateModel.hpp"
 #include "CycloneDDSBridge.hpp"
+#include "SharedMemoryBridge.hpp"
 #include "TransportModeManager.hpp"
 #include "ZenohBridge.hpp"
 #include "NodeDataSerializer.hpp"
@@ -44,6 +45,8 @@
 
 using QtNodes::PortType;
 
+bool PBNodeDelegateModel::msHeadlessMode{false};
+
 PBNodeDelegateModel::PBNodeDelegateModel(QString modelName, bool bSource, bool bEnable)
     : QtNodes::NodeDelegateModel(),
       mMinPixmap(":NodeEditor.png"),
@@ -123,6 +126,14 @@ save() const
     if( mbSource )
         params["enable"] = false;
 
+    if( !mOutputCodecs.empty() )
+    {
+        QJsonObject codecs;
+        for( const auto& entry : mOutputCodecs )
+            codecs[ QString::number( entry.first ) ] = entry.second.toJson();
+        params["transport_codecs"] = codecs;
+    }
+
     modelJson["params"] = params;
 
     return modelJson;
@@ -220,6 +231,16 @@ load(QJsonObject const &p)
 
             mbHideInFocusView = v.toBool();
         }
+
+        mOutputCodecs.clear();
+        const QJsonObject codecs = paramsObj[ "transport_codecs" ].toObject();
+        for( auto it = codecs.begin(); it != codecs.end(); ++it )
+        {
+            bool ok = false;
+            const unsigned int port = it.key().toUInt( &ok );
+            if( ok )
+                setOutputCodec( port, ImageCodecSettings::fromJson( it.value().toObject() ) );
+        }
     }
 }
 
@@ -493,6 +514,13 @@ void
 PBNodeDelegateModel::
 emitOutputPort(PortIndex portIndex)
 {
+    if (mbHoldOutputs) {
+        mHeldOutputs.insert(portIndex);
+        return;
+    }
+
+    mMetrics.recordOutput(static_cast<unsigned int>(portIndex));
+
     const auto transportMode = TransportModeManager::instance().getTransportMode();
 
     if (transportMode == TransportMode::ZenohOnly) {
@@ -503,8 +531,8 @@ emitOutputPort(PortIndex portIndex)
         }
 
         const auto data = outData(portIndex);
-        if (data) {
-            ZenohBridge::instance().publish(getNodeId(), static_cast<int>(portIndex), data, getFlowFilename());
+        if (data && !publishRemote(portIndex, transportMode, data)) {
+            mMetrics.recordDrop();
         }
         return;
     }
@@ -516,21 +544,26 @@ emitOutputPort(PortIndex portIndex)
             return;
         }
 
+        const auto data = outData(portIndex);
+        if (data && !publishRemote(portIndex, transportMode, data)) {
+            mMetrics.recordDrop();
+        }
+        return;
+    }
+
+    if (transportMode == TransportMode::SharedMemoryOnly) {
+        if (!SharedMemoryBridge::instance().isInitialized()) {
+            DEBUG_LOG_WARNING() << "[PBNodeDelegateModel] SharedMemoryOnly mode requested but bridge is not initialized. Falling back to Qt propagation.";
+            Q_EMIT dataUpdated(portIndex);
+            return;
+        }
+
         const auto data = outData(portIndex);
         if (data) {
-            const std::vector<uint8_t> payloadVec = NodeDataSerializer::serialize(data);
-            if (!payloadVec.empty()) {
-                const QString computerId = CycloneDDSBridge::instance().getComputerId().trimmed();
-                const QString flowFilename = getFlowFilename().trimmed().isEmpty()
-                    ? QStringLiteral("Untitle")
-                    : getFlowFilename().trimmed();
-                const QString topicName = QStringLiteral("cvdev/%1/%2/%3/output/%4/data")
-                    .arg(computerId, flowFilename, getNodeId(), QString::number(static_cast<int>(portIndex)));
-
-                const QByteArray payload(
-                    reinterpret_cast<const char*>(payloadVec.data()),
-                    static_cast<int>(payloadVec.size()));
-                CycloneDDSBridge::instance().publishRaw(topicName, payload);
+            const QString topicKey = TransportModeManager::makeTransportOutputTopicKey(
+                SharedMemoryBridge::instance().getComputerId(), getFlowFilename(), getNodeId(), portIndex);
+            if (!SharedMemoryBridge::instance().publish(topicKey, data)) {
+                mMetrics.recordDrop();
             }
         }
         return;
@@ -539,6 +572,103 @@ emitOutputPort(PortIndex portIndex)
     Q_EMIT dataUpdated(portIndex);
 }
 
+void
+PBNodeDelegateModel::
+holdOutputs(bool hold)
+{
+    mbHoldOutputs = hold;
+    if (hold)
+        return;
+
+    const auto heldOutputs = std::move(mHeldOutputs);
+    mHeldOutputs.clear();
+    for (PortIndex portIndex : heldOutputs)
+        emitOutputPort(portIndex);
+}
+
+bool
+PBNodeDelegateModel::
+publishRemote(PortIndex portIndex, TransportMode transportMode, const std::shared_ptr<NodeData>& data)
+{
+    // The callback may run on an encoder worker: capture values, not this
+    PBPortEncoder::PublishCallback publish;
+    if (transportMode == TransportMode::ZenohOnly) {
+        std::shared_ptr<ZenohPortPublisher> publisher = resolveOutputPublisher(portIndex);
+        if (!publisher)
+            return false;
+        publish = [publisher](SerializedPayload&& payload) {
+            publisher->publish(std::move(payload));
+        };
+    } else {
+        const QString computerId = CycloneDDSBridge::instance().getComputerId().trimmed();
+        const QString flowFilename = getFlowFilename().trimmed().isEmpty()
+            ? QStringLiteral("Untitle")
+            : getFlowFilename().trimmed();
+        const QString topicName = QStringLiteral("cvdev/%1/%2/%3/output/%4/data")
+            .arg(computerId, flowFilename, getNodeId(), QString::number(static_cast<int>(portIndex)));
+        publish = [topicName](SerializedPayload&& payload) {
+            CycloneDDSBridge::instance().publishSerialized(topicName, std::move(payload));
+        };
+    }
+
+    const ImageCodecSettings codec = outputCodec(portIndex);
+    const auto image = std::dynamic_pointer_cast<CVImageData>(data);
+    if (codec.isCompressed() && image) {
+        auto& encoder = mPortEncoders[portIndex];
+        if (!encoder)
+            encoder = std::make_unique<PBPortEncoder>();
+        // The node keeps writing its output object on this thread, so the
+        // worker gets its own header and metadata; the pixels stay shared and
+        // producers write through writable()/overwrite(), which detach them.
+        const CVFrame frame = image->frame();
+        auto snapshot = std::make_shared<CVImageData>();
+        snapshot->updateMove(cv::Mat(frame.mat()), frame.metadata());
+        return encoder->submit(std::move(snapshot), codec, std::move(publish));
+    }
+
+    SerializedPayload payload = NodeDataSerializer::serializeSegments(data);
+    if (payload.empty())
+        return false;
+    publish(std::move(payload));
+    return true;
+}
+
+ImageCodecSettings
+PBNodeDelegateModel::
+outputCodec(PortIndex portIndex) const
+{
+    const auto it = mOutputCodecs.find(portIndex);
+    return it == mOutputCodecs.end() ? ImageCodecSettings() : it->second;
+}
+
+void
+PBNodeDelegateModel::
+setOutputCodec(PortIndex portIndex, const ImageCodecSettings& codec)
+{
+    if (codec.isDefault())
+        mOutputCodecs.erase(portIndex);
+    else
+        mOutputCodecs[portIndex] = codec;
+}
+
+bool
+PBNodeDelegateModel::
+isImageOutputPort(PortIndex portIndex) const
+{
+    return portIndex < nPorts(PortType::Out) &&
+           dataType(PortType::Out, portIndex).id == CVImageData().type().id;
+}
+
+std::shared_ptr<ZenohPortPublisher>
+PBNodeDelegateModel::
+resolveOutputPublisher(PortIndex portIndex)
+{
+    auto& publisher = mZenohPublishers[portIndex];
+    if (!publisher || !publisher->isValid())
+        publisher = ZenohBridge::instance().outputPublisher(getNodeId(), static_cast<int>(portIndex), getFlowFilename());
+    return publisher;
+}
+
 void
 PBNodeDelegateModel::
 updateAllOutputPorts()
@@ -558,6 +688,8 @@ setRuntimeTransportContext(NodeId nodeId, const QString& flowFilename)
 
     const QString trimmed = flowFilename.trimmed();
     msFlowFilename = trimmed.isEmpty() ? QStringLiteral("Untitle") : trimmed;
+    // Their keys were built from the previous context
+    mZenohPublishers.clear();
 }
 
 
@@ -27,10 +27,17 @@
 #include "CVDevLibrary.hpp"
 #include "Property.hpp"
 #include "DebugLogging.hpp"
+#include "PBNodeMetrics.hpp"
+#include "PBPortEncoder.hpp"
+#include "TransportMode.hpp"
 #include <functional>
+#include <map>
+#include <set>
 #include <QtCore/QTimer>
 #include <QtNodes/NodeDelegateModel>
 
+class ZenohPortPublisher;
+
 using QtNodes::PortIndex;
 using QtNodes::NodeData;
 using QtNodes::NodeStyle;
@@ -100,9 +107,53 @@ public:
     /// Returns true if headless mode has been activated.
     static bool isHeadlessMode() { return msHeadlessMode; }
 
+    /// Switches the process to headless mode (cvdev-run). Call before any node is created.
+    ///
+    /// In headless mode the graph model exposes no embedded widget to a scene and
+    /// nodes skip per-frame display work; widgets built by node constructors are never shown.
+    static void setHeadlessMode(bool headless) { msHeadlessMode = headless; }
+
     // Virtual method to check if node can be minimized
     virtual bool canMinimize() const { return true; }
 
+    /// Whether the node needs its inputs for its own sake in Pull evaluation.
+    enum class SinkState
+    {
+        Auto = 0,   ///< Only if none of its outputs is connected (default)
+        Active,     ///< Always, e.g. a visible display, a writer or a publisher
+        Idle        ///< Never by itself, e.g. a minimized display; still computes for demanded nodes downstream
+    };
+
+    /// Sink state read by PBDataFlowGraphModel in Pull mode. Emit sink_state_changed_signal() when it changes
+    /// for a reason other than enable or minimize.
+    virtual SinkState sinkState() const { return SinkState::Auto; }
+
+    /// True while work started by an earlier input has not emitted its result yet, e.g. a busy
+    /// asynchronous worker. A wave of PBDataFlowGraphModel holds the inputs of a join downstream
+    /// until it is false, so the join sees both branches of the same frame.
+    virtual bool hasWorkInFlight() const { return false; }
+
+    /// Called by PBDataFlowGraphModel around the inputs of one wave: while held, emitOutputPort()
+    /// only records the port, and releasing emits each recorded port once.
+    void holdOutputs( bool hold );
+
+    /// Set by PBDataFlowGraphModel before each input of a wave: true if more inputs of the same wave follow.
+    void setInputBatchPending( bool pending ) { mbInputBatchPending = pending; }
+
+    /// Called by PBDataFlowGraphModel with buffer reuse on, once the last consumer of output @p portIndex
+    /// in the execution plan has taken it: drop the node's own reference to that data, so the frame is
+    /// freed as soon as its consumers are done with it. Consumers hold their own references, so nothing
+    /// is taken from them. Returns true if a reference was dropped.
+    virtual bool releaseOutput( PortIndex portIndex ) { Q_UNUSED(portIndex); return false; }
+
+    /// True if releaseOutput() can drop the node's reference to output @p portIndex; the buffer
+    /// report only counts such outputs as released early.
+    virtual bool canReleaseOutput( PortIndex portIndex ) const { Q_UNUSED(portIndex); return false; }
+
+    /// Called by PBDataFlowGraphModel with buffer reuse on, after an input was delivered: drop inputs
+    /// kept only to recompute on a parameter change. Inputs the node still needs to compute are kept.
+    virtual void releaseInputs() { }
+
     /// Call this function when a node want to initialise somethings, eg. hardware interface, after it was added to the scene.
     ///
     /// The base implementation is idempotent: it records that late construction
@@ -144,6 +195,15 @@ public:
         return QString::number(reinterpret_cast<qulonglong>(this));
     }
 
+    /**
+     * @brief Processing time, latency, fps and drop counters of this node.
+     *
+     * Fed by PBDataFlowGraphModel, PBTransportRouter and emitOutputPort();
+     * see PBNodeMetrics for what each figure covers.
+     */
+    PBNodeMetrics &metrics() { return mMetrics; }
+    const PBNodeMetrics &metrics() const { return mMetrics; }
+
     /**
      * @brief Sets runtime context used for transport key construction.
      *
@@ -152,6 +212,32 @@ public:
      */
     void setRuntimeTransportContext(NodeId nodeId, const QString& flowFilename);
 
+    /**
+     * @brief Image codec used when @p portIndex is published over Zenoh or CycloneDDS.
+     *
+     * Defaults to RAW. Compressed codecs are encoded on PBWorkerExecutor by a
+     * per-port PBPortEncoder. Saved with the flow under "params" / "transport_codecs".
+     */
+    ImageCodecSettings outputCodec(PortIndex portIndex) const;
+
+    void setOutputCodec(PortIndex portIndex, const ImageCodecSettings& codec);
+
+    /**
+     * @brief True if output @p portIndex carries CVImageData, i.e. has a codec to choose.
+     */
+    bool isImageOutputPort(PortIndex portIndex) const;
+
+    /**
+     * @brief Zenoh publisher of output @p portIndex, declared on first use and kept by the node.
+     *
+     * PBTransportRouter calls it when a ZenohOnly connection leaves the port,
+     * so the first frame does not pay for the declaration. Dropped when the
+     * transport context changes.
+     *
+     * @return nullptr if ZenohBridge is not initialized
+     */
+    std::shared_ptr<ZenohPortPublisher> resolveOutputPublisher(PortIndex portIndex);
+
     /**
      * @brief Gets the flow filename scope used for transport key construction.
      */
@@ -250,6 +336,9 @@ Q_SIGNALS:
     void
     property_structure_changed_signal( );
 
+    void
+    sink_state_changed_signal( );
+
 public Q_SLOTS:
     virtual
     void editable_embedded_widget_selected_changed( bool );
@@ -269,6 +358,10 @@ protected Q_SLOTS:
     void lock_position_changed( bool );
 
 protected:
+    /// True in setInData() while another input of the same wave is about to arrive. A node
+    /// combining several inputs can store this one and compute on the last.
+    bool inputBatchPending() const { return mbInputBatchPending; }
+
     PropertyVector mvProperty;
     QMap<QString, std::shared_ptr<Property>> mMapIdToProperty;
     bool mbSelected{false};  // Nodes are NOT selected by default
@@ -293,7 +386,19 @@ private:
     NodeId miRuntimeNodeId{0};
     QString msFlowFilename{"Untitle"};
     bool mbHasRuntimeNodeId{false};
+    bool mbHoldOutputs{false};
+    bool mbInputBatchPending{false};
+    std::set<PortIndex> mHeldOutputs;   ///< Ports emitted while outputs were held
     QSize mSavedWidgetSize;
+    PBNodeMetrics mMetrics;
+    std::map<PortIndex, ImageCodecSettings> mOutputCodecs;               ///< Ports not listed use RAW
+    std::map<PortIndex, std::unique_ptr<PBPortEncoder>> mPortEncoders;   ///< Created on first compressed publish
+    std::map<PortIndex, std::shared_ptr<ZenohPortPublisher>> mZenohPublishers;  ///< Resolved on connect or first publish
+
+    /**
+     * @brief Publishes @p data with the codec of @p portIndex; false if it was not sent.
+     */
+    bool publishRemote(PortIndex portIndex, TransportMode transportMode, const std::shared_ptr<NodeData>& data);
     
     void enabled( bool );
     virtual void minimized( bool );
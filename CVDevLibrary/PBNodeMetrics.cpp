@@ -0,0 +1,364 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#include "PBNodeMetrics.hpp"
+
+#include <chrono>
+#include <cmath>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+
+constexpr int64_t FpsWindowNs = 1000000000;   // fps is averaged over one second
+constexpr int64_t FpsStaleNs = 2 * FpsWindowNs; // no frame for this long reads as 0 fps
+
+// Innermost open scope on this thread. Kept out of the exported class:
+// thread_local static members cannot be exported from a DLL.
+thread_local PBNodeMetrics::ProcessScope *tpCurrentScope = nullptr;
+
+int
+highestBit(uint64_t value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<int>(index);
+#else
+    return 63 - __builtin_clzll(value);
+#endif
+}
+
+void
+atomicMax(std::atomic<uint64_t> &target, uint64_t value)
+{
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (value > current &&
+           !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+double
+toMs(uint64_t nanos)
+{
+    return static_cast<double>(nanos) / 1.0e6;
+}
+
+QString
+formatMs(double ms)
+{
+    return QString::number(ms, 'f', ms < 10.0 ? 2 : 1);
+}
+
+} // namespace
+
+int
+PBLatencyHistogram::
+bucketFor(uint64_t nanos)
+{
+    if (nanos < SubBuckets)
+        return static_cast<int>(nanos);
+    const int msb = highestBit(nanos);
+    const int sub = static_cast<int>((nanos >> (msb - 3)) & (SubBuckets - 1));
+    return (msb - 2) * SubBuckets + sub;
+}
+
+uint64_t
+PBLatencyHistogram::
+bucketUpperBound(int bucket)
+{
+    if (bucket < SubBuckets)
+        return static_cast<uint64_t>(bucket);
+    const int msb = bucket / SubBuckets + 2;
+    const uint64_t sub = static_cast<uint64_t>(bucket % SubBuckets);
+    const uint64_t lower = (SubBuckets + sub) << (msb - 3);
+    return lower + ((uint64_t(1) << (msb - 3)) - 1);
+}
+
+void
+PBLatencyHistogram::
+record(uint64_t nanos)
+{
+    maBuckets[bucketFor(nanos)].fetch_add(1, std::memory_order_relaxed);
+    muCount.fetch_add(1, std::memory_order_relaxed);
+    muSum.fetch_add(nanos, std::memory_order_relaxed);
+    atomicMax(muMax, nanos);
+}
+
+uint64_t
+PBLatencyHistogram::
+percentile(double quantile) const
+{
+    // Sum the buckets rather than trusting muCount: both move concurrently.
+    std::array<uint64_t, BucketCount> counts;
+    uint64_t total = 0;
+    for (int i = 0; i < BucketCount; ++i)
+    {
+        counts[i] = maBuckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0)
+        return 0;
+
+    const uint64_t rank = qMax<uint64_t>(1, static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(total))));
+    uint64_t seen = 0;
+    for (int i = 0; i < BucketCount; ++i)
+    {
+        seen += counts[i];
+        if (seen >= rank)
+            return qMin(bucketUpperBound(i), muMax.load(std::memory_order_relaxed));
+    }
+    return muMax.load(std::memory_order_relaxed);
+}
+
+PBLatencyHistogram::Summary
+PBLatencyHistogram::
+summary() const
+{
+    Summary summary;
+    summary.count = muCount.load(std::memory_order_relaxed);
+    if (summary.count == 0)
+        return summary;
+    summary.meanMs = toMs(muSum.load(std::memory_order_relaxed)) / static_cast<double>(summary.count);
+    summary.p50Ms = toMs(percentile(0.50));
+    summary.p95Ms = toMs(percentile(0.95));
+    summary.p99Ms = toMs(percentile(0.99));
+    summary.maxMs = toMs(muMax.load(std::memory_order_relaxed));
+    return summary;
+}
+
+void
+PBLatencyHistogram::
+reset()
+{
+    for (auto &bucket : maBuckets)
+        bucket.store(0, std::memory_order_relaxed);
+    muCount.store(0, std::memory_order_relaxed);
+    muSum.store(0, std::memory_order_relaxed);
+    muMax.store(0, std::memory_order_relaxed);
+}
+
+QJsonObject
+PBLatencyHistogram::Summary::
+toJson() const
+{
+    QJsonObject json;
+    json["count"] = static_cast<qint64>(count);
+    json["mean_ms"] = meanMs;
+    json["p50_ms"] = p50Ms;
+    json["p95_ms"] = p95Ms;
+    json["p99_ms"] = p99Ms;
+    json["max_ms"] = maxMs;
+    return json;
+}
+
+QJsonObject
+NodeMetricsSnapshot::
+toJson() const
+{
+    QJsonObject json;
+    json["id"] = nodeId;
+    json["caption"] = caption;
+    json["inputs"] = static_cast<qint64>(inputs);
+    json["frames"] = static_cast<qint64>(frames);
+    json["dropped"] = static_cast<qint64>(dropped);
+    json["fps"] = fps;
+    json["processing"] = processing.toJson();
+    json["latency"] = latency.toJson();
+    json["queue_wait"] = queueWait.toJson();
+    return json;
+}
+
+QStringList
+NodeMetricsSnapshot::
+csvHeader()
+{
+    QStringList header = { "id", "caption", "inputs", "frames", "dropped", "fps" };
+    for (const char *name : { "processing", "latency", "queue_wait" })
+    {
+        for (const char *field : { "count", "mean_ms", "p50_ms", "p95_ms", "p99_ms", "max_ms" })
+            header << QString("%1_%2").arg(QLatin1String(name), QLatin1String(field));
+    }
+    return header;
+}
+
+QStringList
+NodeMetricsSnapshot::
+csvRow() const
+{
+    QString quotedCaption = caption;
+    quotedCaption.replace(QStringLiteral("\""), QStringLiteral("\"\""));
+    quotedCaption = QStringLiteral("\"%1\"").arg(quotedCaption);
+    QStringList row = { nodeId, quotedCaption, QString::number(inputs),
+                        QString::number(frames), QString::number(dropped), QString::number(fps, 'f', 2) };
+    for (const auto *summary : { &processing, &latency, &queueWait })
+    {
+        row << QString::number(summary->count)
+            << QString::number(summary->meanMs, 'f', 3)
+            << QString::number(summary->p50Ms, 'f', 3)
+            << QString::number(summary->p95Ms, 'f', 3)
+            << QString::number(summary->p99Ms, 'f', 3)
+            << QString::number(summary->maxMs, 'f', 3);
+    }
+    return row;
+}
+
+QString
+NodeMetricsSnapshot::
+overlayText() const
+{
+    QString text;
+    if (processing.count > 0)
+        text = QString("%1/%2 ms").arg(formatMs(processing.p50Ms), formatMs(processing.p95Ms));
+    if (frames > 0)
+        text += QString("  %1 fps").arg(fps, 0, 'f', 1);
+    if (dropped > 0)
+        text += QString("  drop %1").arg(dropped);
+    return text.trimmed();
+}
+
+PBNodeMetrics::ProcessScope::
+ProcessScope(PBNodeMetrics *metrics)
+    : mpMetrics(metrics),
+      mpParent(tpCurrentScope),
+      miStartNs(PBNodeMetrics::now())
+{
+    tpCurrentScope = this;
+    if (mpMetrics)
+    {
+        mpMetrics->muInputs.fetch_add(1, std::memory_order_relaxed);
+        if (!mpMetrics->isSelfTimed())
+            mpMetrics->markInput(miStartNs);
+    }
+}
+
+PBNodeMetrics::ProcessScope::
+~ProcessScope()
+{
+    const int64_t total = PBNodeMetrics::now() - miStartNs;
+    if (mpMetrics && !mpMetrics->isSelfTimed())
+        mpMetrics->recordProcessing(total - miChildNs);
+    if (mpParent)
+        mpParent->miChildNs += total;
+    tpCurrentScope = mpParent;
+}
+
+int64_t
+PBNodeMetrics::
+now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void
+PBNodeMetrics::
+markInput(int64_t arrivalNs)
+{
+    // Keep the oldest unanswered arrival so latency covers the whole wait.
+    int64_t expected = 0;
+    miPendingInputNs.compare_exchange_strong(expected, arrivalNs, std::memory_order_relaxed);
+}
+
+void
+PBNodeMetrics::
+recordOutput(unsigned int portIndex)
+{
+    const int64_t timestamp = now();
+
+    const int64_t arrival = miPendingInputNs.exchange(0, std::memory_order_relaxed);
+    if (arrival > 0)
+        mLatency.record(static_cast<uint64_t>(qMax<int64_t>(0, timestamp - arrival)));
+
+    if (portIndex != 0)
+        return;
+
+    muFrames.fetch_add(1, std::memory_order_relaxed);
+    miLastFrameNs.store(timestamp, std::memory_order_relaxed);
+    const uint64_t windowFrames = muWindowFrames.fetch_add(1, std::memory_order_relaxed) + 1;
+    const int64_t windowStart = miWindowStartNs.load(std::memory_order_relaxed);
+    if (windowStart == 0)
+    {
+        miWindowStartNs.store(timestamp, std::memory_order_relaxed);
+        muWindowFrames.store(0, std::memory_order_relaxed);
+        return;
+    }
+    const int64_t elapsed = timestamp - windowStart;
+    if (elapsed >= FpsWindowNs)
+    {
+        muFpsMilli.store(static_cast<uint64_t>(static_cast<double>(windowFrames) * 1.0e12 / static_cast<double>(elapsed)),
+                         std::memory_order_relaxed);
+        miWindowStartNs.store(timestamp, std::memory_order_relaxed);
+        muWindowFrames.store(0, std::memory_order_relaxed);
+    }
+}
+
+void
+PBNodeMetrics::
+recordProcessing(int64_t nanos)
+{
+    mProcessing.record(static_cast<uint64_t>(qMax<int64_t>(0, nanos)));
+}
+
+void
+PBNodeMetrics::
+recordQueueWait(int64_t nanos)
+{
+    mQueueWait.record(static_cast<uint64_t>(qMax<int64_t>(0, nanos)));
+}
+
+void
+PBNodeMetrics::
+recordDrop(uint64_t count)
+{
+    muDropped.fetch_add(count, std::memory_order_relaxed);
+}
+
+NodeMetricsSnapshot
+PBNodeMetrics::
+snapshot() const
+{
+    NodeMetricsSnapshot snapshot;
+    snapshot.inputs = muInputs.load(std::memory_order_relaxed);
+    snapshot.frames = muFrames.load(std::memory_order_relaxed);
+    snapshot.dropped = muDropped.load(std::memory_order_relaxed);
+    const int64_t lastFrame = miLastFrameNs.load(std::memory_order_relaxed);
+    if (lastFrame > 0 && now() - lastFrame < FpsStaleNs)
+        snapshot.fps = static_cast<double>(muFpsMilli.load(std::memory_order_relaxed)) / 1000.0;
+    snapshot.processing = mProcessing.summary();
+    snapshot.latency = mLatency.summary();
+    snapshot.queueWait = mQueueWait.summary();
+    return snapshot;
+}
+
+void
+PBNodeMetrics::
+reset()
+{
+    mProcessing.reset();
+    mLatency.reset();
+    mQueueWait.reset();
+    muInputs.store(0, std::memory_order_relaxed);
+    muFrames.store(0, std::memory_order_relaxed);
+    muDropped.store(0, std::memory_order_relaxed);
+    miPendingInputNs.store(0, std::memory_order_relaxed);
+    miWindowStartNs.store(0, std::memory_order_relaxed);
+    muWindowFrames.store(0, std::memory_order_relaxed);
+    miLastFrameNs.store(0, std::memory_order_relaxed);
+    muFpsMilli.store(0, std::memory_order_relaxed);
+}
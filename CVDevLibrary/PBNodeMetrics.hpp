@@ -0,0 +1,219 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+/**
+ * @file PBNodeMetrics.hpp
+ * @brief Per-node timing histograms and frame counters.
+ *
+ * Every PBNodeDelegateModel owns a PBNodeMetrics. The graph model and the
+ * async base class feed it; nothing has to be added to individual nodes.
+ *
+ * **What is measured:**
+ * - **processing**: time a node spends on one input. For synchronous nodes it
+ *   is the time inside setInData() minus the time spent in downstream nodes
+ *   called from it; for PBAsyncDataModel it is dispatch to completion.
+ * - **latency**: input arrival to the next output emitted by the node.
+ * - **queue wait**: input arrival to dispatch to the worker (async nodes).
+ * - **fps**: output frames (emits of port 0) per second over the last second.
+ * - **dropped**: inputs discarded by the back-pressure policy.
+ *
+ * Recording is lock-free: relaxed atomic increments into fixed log-scaled
+ * buckets, so it is safe from worker threads and costs a few nanoseconds.
+ * Percentiles are read from the buckets with at most 12.5 % relative error.
+ */
+
+#pragma once
+
+#include "CVDevLibrary.hpp"
+
+#include <QJsonObject>
+#include <QString>
+#include <QStringList>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class PBLatencyHistogram
+ * @brief Lock-free histogram of durations in nanoseconds.
+ *
+ * Values are bucketed by power of two with 8 linear sub-buckets per octave
+ * (HDR-style), covering the whole uint64_t range in 496 buckets.
+ */
+class CVDEVSHAREDLIB_EXPORT PBLatencyHistogram
+{
+public:
+    static constexpr int SubBuckets = 8;
+    static constexpr int BucketCount = 62 * SubBuckets;
+
+    /**
+     * @brief Summary of a histogram in milliseconds.
+     */
+    struct Summary
+    {
+        uint64_t count{0};
+        double meanMs{0.0};
+        double p50Ms{0.0};
+        double p95Ms{0.0};
+        double p99Ms{0.0};
+        double maxMs{0.0};
+
+        QJsonObject toJson() const;
+    };
+
+    /**
+     * @brief Adds one sample. Thread-safe, wait-free.
+     */
+    void record(uint64_t nanos);
+
+    /**
+     * @brief Upper bound of the bucket holding the @p quantile (0..1) sample, in nanoseconds.
+     */
+    uint64_t percentile(double quantile) const;
+
+    Summary summary() const;
+
+    uint64_t count() const { return muCount.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Clears all samples. Samples recorded concurrently may survive.
+     */
+    void reset();
+
+private:
+    static int bucketFor(uint64_t nanos);
+    static uint64_t bucketUpperBound(int bucket);
+
+    std::array<std::atomic<uint64_t>, BucketCount> maBuckets{};
+    std::atomic<uint64_t> muCount{0};
+    std::atomic<uint64_t> muSum{0};
+    std::atomic<uint64_t> muMax{0};
+};
+
+/**
+ * @struct NodeMetricsSnapshot
+ * @brief Point-in-time copy of one node's metrics, ready for display or export.
+ */
+struct CVDEVSHAREDLIB_EXPORT NodeMetricsSnapshot
+{
+    QString nodeId;                         ///< PBNodeDelegateModel::getNodeId()
+    QString caption;
+    uint64_t inputs{0};                     ///< Inputs delivered to setInData()
+    uint64_t frames{0};                     ///< Output frames (emits of port 0)
+    uint64_t dropped{0};
+    double fps{0.0};
+    PBLatencyHistogram::Summary processing;
+    PBLatencyHistogram::Summary latency;
+    PBLatencyHistogram::Summary queueWait;
+
+    QJsonObject toJson() const;
+
+    static QStringList csvHeader();
+    QStringList csvRow() const;
+
+    /**
+     * @brief One-line text for the node overlay, e.g. "3.1/7.8 ms  29.9 fps  drop 2".
+     */
+    QString overlayText() const;
+};
+
+/**
+ * @class PBNodeMetrics
+ * @brief Metrics sink of one node.
+ *
+ * Recording methods may be called from any thread. Arrival bookkeeping
+ * (markInput()/recordOutput()) assumes a node delivers its outputs from one
+ * thread at a time, which holds for every node type in this library.
+ */
+class CVDEVSHAREDLIB_EXPORT PBNodeMetrics
+{
+public:
+    /**
+     * @class ProcessScope
+     * @brief Times one synchronous input delivery.
+     *
+     * Place around the call that hands data to a node (setPortData(), transport
+     * routing). Scopes nest on the calling thread: time spent in scopes opened
+     * inside this one, i.e. downstream nodes reached through emitOutputPort(),
+     * is subtracted, so each node is charged only its own work.
+     */
+    class CVDEVSHAREDLIB_EXPORT ProcessScope
+    {
+    public:
+        explicit ProcessScope(PBNodeMetrics *metrics);
+        ~ProcessScope();
+
+        ProcessScope(const ProcessScope &) = delete;
+        ProcessScope &operator=(const ProcessScope &) = delete;
+
+    private:
+        PBNodeMetrics *mpMetrics;
+        ProcessScope *mpParent;
+        int64_t miStartNs;
+        int64_t miChildNs{0};
+    };
+
+    /**
+     * @brief Monotonic clock in nanoseconds used for every timestamp here.
+     */
+    static int64_t now();
+
+    /**
+     * @brief Nodes that time their own processing (PBAsyncDataModel) opt out of ProcessScope timing.
+     *
+     * A self-timed node also calls markInput() itself, with the arrival time of
+     * the frame it dispatches.
+     */
+    void setSelfTimed(bool selfTimed) { mbSelfTimed = selfTimed; }
+    bool isSelfTimed() const { return mbSelfTimed; }
+
+    /**
+     * @brief Records an input that arrived at @p arrivalNs; the next output measures latency from it.
+     */
+    void markInput(int64_t arrivalNs);
+
+    /**
+     * @brief Called for every emitted output port. Port 0 counts as a frame.
+     */
+    void recordOutput(unsigned int portIndex);
+
+    void recordProcessing(int64_t nanos);
+    void recordQueueWait(int64_t nanos);
+    void recordDrop(uint64_t count = 1);
+
+    /**
+     * @brief Copies the counters; nodeId and caption are left for the caller.
+     */
+    NodeMetricsSnapshot snapshot() const;
+
+    void reset();
+
+private:
+    PBLatencyHistogram mProcessing;
+    PBLatencyHistogram mLatency;
+    PBLatencyHistogram mQueueWait;
+
+    std::atomic<uint64_t> muInputs{0};
+    std::atomic<uint64_t> muFrames{0};
+    std::atomic<uint64_t> muDropped{0};
+    std::atomic<int64_t> miPendingInputNs{0};      ///< Arrival of the input not yet answered by an output; 0 if none
+
+    std::atomic<int64_t> miWindowStartNs{0};
+    std::atomic<uint64_t> muWindowFrames{0};
+    std::atomic<int64_t> miLastFrameNs{0};
+    std::atomic<uint64_t> muFpsMilli{0};           ///< fps of the last full window, times 1000
+
+    bool mbSelfTimed{false};
+};
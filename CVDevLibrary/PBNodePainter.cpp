@@ -28,10 +28,13 @@
 #include <QtNodes/internal/StyleCollection.hpp>
 
 #include <QtCore/QMargins>
+#include <QtGui/QFontMetricsF>
 #include <cmath>
 
 using namespace QtNodes;
 
+bool PBNodePainter::msbMetricsOverlayVisible{false};
+
 void PBNodePainter::paint(QPainter *painter, NodeGraphicsObject &ngo) const
 {
     // Check if node is minimized
@@ -95,6 +98,9 @@ void PBNodePainter::paint(QPainter *painter, NodeGraphicsObject &ngo) const
         drawLockCheckbox(painter, ngo);    // Custom lock position checkbox
         drawMinimizeCheckbox(painter, ngo); // Custom minimize checkbox
     }
+    if (msbMetricsOverlayVisible) {
+        drawMetricsOverlay(painter, ngo);
+    }
 }
 
 void PBNodePainter::drawNodeRect(QPainter *painter, NodeGraphicsObject &ngo) const
@@ -641,3 +647,37 @@ void PBNodePainter::drawMinimizeCheckbox(QPainter *painter, NodeGraphicsObject &
     
     painter->restore();
 }
+
+void PBNodePainter::drawMetricsOverlay(QPainter *painter, NodeGraphicsObject &ngo) const
+{
+    auto *dataFlowModel = dynamic_cast<DataFlowGraphModel*>(&ngo.graphModel());
+    if (!dataFlowModel)
+        return;
+    auto *delegateModel = dataFlowModel->delegateModel<PBNodeDelegateModel>(ngo.nodeId());
+    if (!delegateModel)
+        return;
+
+    const QString text = delegateModel->metrics().snapshot().overlayText();
+    if (text.isEmpty())
+        return;
+
+    AbstractNodeGeometry &geometry = ngo.nodeScene()->nodeGeometry();
+    QSize size = geometry.size(ngo.nodeId());
+
+    painter->save();
+
+    QFont font = painter->font();
+    font.setPointSizeF(7.5);
+    painter->setFont(font);
+    const qreal stripHeight = QFontMetricsF(font).height() + 2.0;
+    QRectF strip(1.0, size.height() - stripHeight - 1.0, size.width() - 2.0, stripHeight);
+
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(QColor(0, 0, 0, 150));
+    painter->drawRect(strip);
+
+    painter->setPen(QColor(120, 230, 120));
+    painter->drawText(strip, Qt::AlignCenter, text);
+
+    painter->restore();
+}
@@ -296,6 +296,15 @@ public:
      */
     void paint(QPainter *painter, QtNodes::NodeGraphicsObject &ngo) const override;
 
+    /**
+     * @brief Shows or hides the per-node metrics strip (processing p50/p95, fps, drops).
+     *
+     * Global to all scenes. The painter only draws on repaint, so the caller
+     * refreshes the scene periodically while the overlay is on.
+     */
+    static void setMetricsOverlayVisible(bool visible) { msbMetricsOverlayVisible = visible; }
+    static bool isMetricsOverlayVisible() { return msbMetricsOverlayVisible; }
+
 private:
     /**
      * @brief Draws the node's background rectangle and border.
@@ -552,4 +561,13 @@ private:
      * @note Minimize state affects NodeGeometry height calculation
      */
     void drawMinimizeCheckbox(QPainter *painter, QtNodes::NodeGraphicsObject &ngo) const;
+
+    /**
+     * @brief Draws NodeMetricsSnapshot::overlayText() in a strip along the bottom of the node.
+     *
+     * Nothing is drawn until the node has processed at least one input.
+     */
+    void drawMetricsOverlay(QPainter *painter, QtNodes::NodeGraphicsObject &ngo) const;
+
+    static bool msbMetricsOverlayVisible;
 };
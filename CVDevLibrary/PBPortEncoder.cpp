@@ -0,0 +1,124 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+/**
+ * @file PBPortEncoder.cpp
+ * @brief Implementation of the per-port parallel encoder.
+ */
+
+#include "PBPortEncoder.hpp"
+#include "PBWorkerExecutor.hpp"
+
+#include <QtCore/QMutex>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+
+struct PBPortEncoder::State
+{
+    struct Pending
+    {
+        SerializedPayload payload;
+        PublishCallback publish;
+    };
+
+    mutable QMutex mutex;
+    uint64_t nextSequence{0};              ///< Sequence of the next submitted frame
+    uint64_t nextToPublish{0};             ///< Oldest sequence not yet published
+    int inFlight{0};
+    std::map<uint64_t, Pending> finished;  ///< Encoded frames waiting for older ones
+    bool publishing{false};                ///< A worker is draining finished
+    std::atomic<uint64_t> dropped{0};
+
+    /// Stores an encoded frame and publishes every frame that is now in order.
+    void complete(uint64_t sequence, Pending&& pending)
+    {
+        QMutexLocker locker(&mutex);
+        finished.emplace(sequence, std::move(pending));
+        // One worker drains at a time so that publish calls never overlap
+        if (publishing)
+            return;
+        publishing = true;
+        auto it = finished.find(nextToPublish);
+        while (it != finished.end())
+        {
+            Pending ready = std::move(it->second);
+            finished.erase(it);
+            ++nextToPublish;
+            --inFlight;
+            locker.unlock();
+            if (!ready.payload.empty() && ready.publish)
+                ready.publish(std::move(ready.payload));
+            locker.relock();
+            it = finished.find(nextToPublish);
+        }
+        publishing = false;
+    }
+};
+
+PBPortEncoder::PBPortEncoder()
+    : mpState(std::make_shared<State>())
+{
+}
+
+PBPortEncoder::~PBPortEncoder() = default;
+
+bool PBPortEncoder::submit(std::shared_ptr<QtNodes::NodeData> data,
+                           const ImageCodecSettings& codec,
+                           PublishCallback publish)
+{
+    uint64_t sequence = 0;
+    {
+        QMutexLocker locker(&mpState->mutex);
+        if (mpState->inFlight >= std::clamp(codec.threads, 1, ImageCodecSettings::MaxThreads))
+        {
+            mpState->dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        ++mpState->inFlight;
+        sequence = mpState->nextSequence++;
+    }
+
+    // The job owns the state, so frames in flight outlive the encoder
+    const bool posted = PBWorkerExecutor::instance().post(
+        [state = mpState, sequence, data = std::move(data), codec, publish = std::move(publish)]() mutable
+        {
+            State::Pending pending;
+            pending.payload = NodeDataSerializer::serializeSegments(data, codec);
+            pending.publish = std::move(publish);
+            // Release the frame before waiting behind older ones
+            data.reset();
+            state->complete(sequence, std::move(pending));
+        });
+    if (!posted)
+    {
+        // The executor is shut down: give back the slot and let later sequences publish
+        mpState->dropped.fetch_add(1, std::memory_order_relaxed);
+        mpState->complete(sequence, State::Pending());
+        return false;
+    }
+    return true;
+}
+
+int PBPortEncoder::inFlight() const
+{
+    QMutexLocker locker(&mpState->mutex);
+    return mpState->inFlight;
+}
+
+uint64_t PBPortEncoder::droppedFrames() const
+{
+    return mpState->dropped.load(std::memory_order_relaxed);
+}
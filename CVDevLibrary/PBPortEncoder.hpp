@@ -0,0 +1,95 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+/**
+ * @file PBPortEncoder.hpp
+ * @brief Encodes the frames of one output port on the shared executor, in order.
+ *
+ * JPEG, PNG and LOSSLESS encoding of a large frame takes milliseconds, too
+ * long for the thread that emits the output. A PBPortEncoder moves encoding
+ * to PBWorkerExecutor and keeps up to ImageCodecSettings::threads frames in
+ * flight, so consecutive frames of a port are encoded on different cores.
+ *
+ * Payloads are published in submission order: a frame that finishes early
+ * waits in a small reorder buffer for the frames submitted before it. When
+ * all encoder slots are busy the new frame is dropped rather than queued, so
+ * a slow codec lowers the remote frame rate instead of growing the latency.
+ *
+ * @code
+ * mEncoder.submit(data, codec, [nodeId, port, flow](SerializedPayload&& payload) {
+ *     ZenohBridge::instance().publishSerialized(nodeId, port, std::move(payload), flow);
+ * });
+ * @endcode
+ *
+ * @see PBNodeDelegateModel::emitOutputPort(), ImageCodecSettings
+ */
+
+#pragma once
+
+#include "CVDevLibrary.hpp"
+#include "NodeDataSerializer.hpp"
+
+#include <QtNodes/NodeData>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+/**
+ * @class PBPortEncoder
+ * @brief Bounded, order-preserving parallel encoder for one output port.
+ *
+ * submit() is called from the node's thread; the publish callback runs on an
+ * executor worker, one call at a time. Destroying the encoder does not wait:
+ * frames in flight are still published by the jobs that own them.
+ */
+class CVDEVSHAREDLIB_EXPORT PBPortEncoder
+{
+public:
+    using PublishCallback = std::function<void(SerializedPayload&&)>;
+
+    PBPortEncoder();
+    ~PBPortEncoder();
+
+    PBPortEncoder(const PBPortEncoder&) = delete;
+    PBPortEncoder& operator=(const PBPortEncoder&) = delete;
+
+    /**
+     * @brief Encodes @p data with @p codec on a worker and hands it to @p publish in order.
+     *
+     * @p data is read on the worker, so it must not be modified after the
+     * call: pass a snapshot, not an object the node keeps writing.
+     *
+     * @return false if the frame was dropped: @p codec.threads frames are
+     *         already in flight, or the worker executor is shut down
+     */
+    bool submit(std::shared_ptr<QtNodes::NodeData> data,
+                const ImageCodecSettings& codec,
+                PublishCallback publish);
+
+    /**
+     * @brief Frames submitted but not yet published.
+     */
+    int inFlight() const;
+
+    /**
+     * @brief Frames dropped by submit() because every encoder slot was busy or the executor was shut down.
+     */
+    uint64_t droppedFrames() const;
+
+private:
+    struct State;
+
+    std::shared_ptr<State> mpState;
+};
@@ -0,0 +1,463 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#include "PBTransportRouter.hpp"
+#include "CycloneDDSBridge.hpp"
+#include "NodeDataSerializer.hpp"
+#include "PBDataFlowGraphModel.hpp"
+#include "PBFrameTransfer.hpp"
+#include "PBLinkStats.hpp"
+#include "PBNodeDelegateModel.hpp"
+#include "SharedMemoryBridge.hpp"
+#include "TransportModeManager.hpp"
+#include "ZenohBridge.hpp"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QPointer>
+#include <QSettings>
+#include <QStringList>
+#include <QSysInfo>
+
+using QtNodes::ConnectionId;
+using QtNodes::NodeData;
+using QtNodes::PortIndex;
+
+PBTransportRouter::
+PBTransportRouter(QObject *parent)
+    : QObject(parent)
+{
+}
+
+TransportMode
+PBTransportRouter::
+initializeBridges(QSettings &settings)
+{
+    QString computerId = settings.value("computer_id", "").toString().trimmed();
+    if (computerId.isEmpty()) {
+        computerId = QSysInfo::machineHostName();
+    }
+
+    settings.beginGroup("Zenoh");
+    QString mode = settings.value("mode", "").toString();
+    QString connect = settings.value("connect", "").toString();
+    QString listen = settings.value("listen", "").toString();
+    bool multicast = settings.value("multicast", true).toBool();
+    bool sharedMemory = settings.value("sharedMemory", true).toBool();
+    const int decodeQueueDepth = settings.value("decode_queue_depth", 8).toInt();
+    const int publishCoalesceMs = settings.value("publish_coalesce_ms", 0).toInt();
+    settings.endGroup();
+
+    ZenohBridge::instance().setDecodeQueueDepth(decodeQueueDepth);
+    ZenohBridge::instance().setPublishCoalescing(publishCoalesceMs);
+
+    // Large payloads as deadline-bound chunks on Zenoh and DDS
+    settings.beginGroup("FrameChunking");
+    FrameChunkingConfig chunking;
+    chunking.thresholdBytes = static_cast<size_t>(qMax(0LL, settings.value("threshold_bytes", 0).toLongLong()));
+    chunking.chunkBytes = static_cast<size_t>(qBound(1024LL, settings.value("chunk_bytes", 60000).toLongLong(), 16LL << 20));
+    chunking.deadlineMs = qBound(1, settings.value("deadline_ms", 100).toInt(), 65535);
+    chunking.retransmit = settings.value("retransmit", false).toBool();
+    chunking.retransmitFrames = qMax(1, settings.value("retransmit_frames", 2).toInt());
+    settings.endGroup();
+
+    ZenohBridge::instance().setFrameChunking(chunking);
+    CycloneDDSBridge::instance().setFrameChunking(chunking);
+
+    // Build configuration string if custom settings exist
+    QString zenohConfig;
+    if (!mode.isEmpty() && mode != "peer") {
+        // Only build config if non-default settings exist
+        QStringList configLines;
+        configLines << "{";
+        configLines << QString("  mode: \"%1\",").arg(mode);
+
+        if (!connect.isEmpty()) {
+            QStringList endpoints = connect.split(',', Qt::SkipEmptyParts);
+            configLines << "  connect: {";
+            configLines << "    endpoints: [";
+            for (int i = 0; i < endpoints.size(); ++i) {
+                QString ep = endpoints[i].trimmed();
+                configLines << QString("      \"%1\"%2").arg(ep).arg(i < endpoints.size() - 1 ? "," : "");
+            }
+            configLines << "    ]";
+            configLines << "  },";
+        }
+
+        if (!listen.isEmpty()) {
+            QStringList endpoints = listen.split(',', Qt::SkipEmptyParts);
+            configLines << "  listen: {";
+            configLines << "    endpoints: [";
+            for (int i = 0; i < endpoints.size(); ++i) {
+                QString ep = endpoints[i].trimmed();
+                configLines << QString("      \"%1\"%2").arg(ep).arg(i < endpoints.size() - 1 ? "," : "");
+            }
+            configLines << "    ]";
+            configLines << "  },";
+        }
+
+        configLines << "  scouting: {";
+        configLines << "    multicast: {";
+        configLines << QString("      enabled: %1").arg(multicast ? "true" : "false");
+        configLines << "    }";
+        configLines << "  },";
+
+        configLines << "  transport: {";
+        configLines << "    shared_memory: {";
+        configLines << QString("      enabled: %1").arg(sharedMemory ? "true" : "false");
+        configLines << "    }";
+        configLines << "  }";
+
+        configLines << "}";
+        zenohConfig = configLines.join("\n");
+    }
+
+    if (ZenohBridge::instance().initialize(computerId, zenohConfig)) {
+        qInfo() << "[PBTransportRouter] Zenoh initialized successfully with computer ID:" << computerId;
+        if (!zenohConfig.isEmpty()) {
+            qInfo() << "[PBTransportRouter] Using custom Zenoh configuration";
+        }
+    } else if (requiresZenoh(TransportModeManager::instance().getTransportMode())) {
+        qInfo() << "[PBTransportRouter] Zenoh not available - running in Qt-only mode";
+        TransportModeManager::instance().setTransportMode(TransportMode::QtOnly);
+    }
+
+    settings.beginGroup("CycloneDDS");
+    const int domainId = settings.value("domain_id", 0).toInt();
+    const QString partition = settings.value("partition", "").toString();
+    settings.endGroup();
+
+    if (CycloneDDSBridge::instance().initialize(computerId, domainId, partition)) {
+        qInfo() << "[PBTransportRouter] CycloneDDS initialized successfully";
+    } else if (requiresDDS(TransportModeManager::instance().getTransportMode())) {
+        qInfo() << "[PBTransportRouter] CycloneDDS not available - running in Qt-only mode";
+        TransportModeManager::instance().setTransportMode(TransportMode::QtOnly);
+    }
+
+    settings.beginGroup("SharedMemory");
+    const int slotCount = settings.value("slot_count", SharedMemoryBridge::DefaultSlotCount).toInt();
+    settings.endGroup();
+
+    if (SharedMemoryBridge::instance().initialize(computerId, slotCount)) {
+        qInfo() << "[PBTransportRouter] Shared memory transport initialized";
+    } else if (requiresSharedMemory(TransportModeManager::instance().getTransportMode())) {
+        qInfo() << "[PBTransportRouter] Shared memory transport not available - running in Qt-only mode";
+        TransportModeManager::instance().setTransportMode(TransportMode::QtOnly);
+    }
+
+    return TransportModeManager::instance().getTransportMode();
+}
+
+void
+PBTransportRouter::
+shutdownBridges()
+{
+    ZenohBridge::instance().shutdown();
+    CycloneDDSBridge::instance().shutdown();
+    SharedMemoryBridge::instance().shutdown();
+}
+
+void
+PBTransportRouter::
+attachModel(PBDataFlowGraphModel *model)
+{
+    if (!model) {
+        return;
+    }
+
+    connect(model, &PBDataFlowGraphModel::connectionCreated, this, [this, model](ConnectionId connectionId) {
+        routeConnection(model, connectionId);
+    });
+    connect(model, &PBDataFlowGraphModel::connectionDeleted, this, [this, model](ConnectionId connectionId) {
+        unrouteConnection(model, connectionId);
+    });
+}
+
+void
+PBTransportRouter::
+detachModel(PBDataFlowGraphModel *model)
+{
+    if (!model) {
+        return;
+    }
+
+    disconnect(model, nullptr, this, nullptr);
+
+    QMap<QString, QVector<RouteTarget>> cleaned;
+
+    for (auto it = mRoutesBySource.begin(); it != mRoutesBySource.end(); ++it) {
+        QVector<RouteTarget> keptTargets;
+        for (const auto& target : it.value()) {
+            if (target.model != model) {
+                keptTargets.push_back(target);
+            }
+        }
+
+        if (!keptTargets.isEmpty()) {
+            cleaned[it.key()] = keptTargets;
+            continue;
+        }
+
+        const QStringList parts = it.key().split(':');
+        if (parts.size() == 2) {
+            bool ok = false;
+            int outPort = parts[1].toInt(&ok);
+            if (ok) {
+                const auto mode = TransportModeManager::instance().getTransportMode();
+                if (isSharedMemoryTransport(mode)) {
+                    SharedMemoryBridge::instance().unsubscribe(
+                        TransportModeManager::makeTransportOutputTopicKey(
+                            SharedMemoryBridge::instance().getComputerId(),
+                            model->transportFlowFilename(),
+                            parts[0],
+                            outPort));
+                } else if (isDDSTransport(mode)) {
+                    CycloneDDSBridge::instance().unsubscribeRaw(
+                        TransportModeManager::makeTransportOutputTopicKey(
+                            CycloneDDSBridge::instance().getComputerId(),
+                            model->transportFlowFilename(),
+                            parts[0],
+                            outPort));
+                } else {
+                    ZenohBridge::instance().unsubscribe(parts[0], outPort, model->transportFlowFilename());
+                }
+            }
+        }
+    }
+
+    mRoutesBySource.swap(cleaned);
+}
+
+QString
+PBTransportRouter::
+makeSourceKey(const QString& sourceNodeId, PortIndex outPortIndex)
+{
+    return QString("%1:%2").arg(sourceNodeId).arg(outPortIndex);
+}
+
+void
+PBTransportRouter::
+deliver(const QString& sourceKey, const std::shared_ptr<NodeData>& data)
+{
+    auto it = mRoutesBySource.find(sourceKey);
+    if (it == mRoutesBySource.end() || !data) {
+        return;
+    }
+
+    const auto targets = it.value();
+    for (const auto& target : targets) {
+        if (!target.model) {
+            continue;
+        }
+
+        auto targetNode = dynamic_cast<PBNodeDelegateModel*>(
+            target.model->delegateModel<PBNodeDelegateModel>(target.inNodeId));
+        if (targetNode) {
+            PBNodeMetrics::ProcessScope processScope(&targetNode->metrics());
+            targetNode->setInData(data, target.inPortIndex);
+        }
+    }
+}
+
+void
+PBTransportRouter::
+routeConnection(PBDataFlowGraphModel *model, ConnectionId connectionId)
+{
+    const auto mode = TransportModeManager::instance().getTransportMode();
+    const bool useZenohTransport = (mode == TransportMode::ZenohOnly);
+    const bool useCycloneDDSTransport = (mode == TransportMode::CycloneDDSOnly);
+    const bool useSharedMemoryTransport = (mode == TransportMode::SharedMemoryOnly);
+
+    if (!useZenohTransport && !useCycloneDDSTransport && !useSharedMemoryTransport) {
+        return;
+    }
+
+    // Get node delegate models
+    auto outNode = dynamic_cast<PBNodeDelegateModel*>(model->delegateModel<PBNodeDelegateModel>(connectionId.outNodeId));
+    auto inNode = dynamic_cast<PBNodeDelegateModel*>(model->delegateModel<PBNodeDelegateModel>(connectionId.inNodeId));
+
+    if (!outNode || !inNode) {
+        return;
+    }
+
+    const PortIndex outPortIndex = connectionId.outPortIndex;
+    const QString sourceNodeId = outNode->getNodeId();
+    const QString sourceKey = makeSourceKey(sourceNodeId, outPortIndex);
+
+    auto& routeTargets = mRoutesBySource[sourceKey];
+    bool alreadyRouted = false;
+    for (const auto& target : routeTargets) {
+        if (target.model == model &&
+            target.inNodeId == connectionId.inNodeId &&
+            target.inPortIndex == connectionId.inPortIndex) {
+            alreadyRouted = true;
+            break;
+        }
+    }
+
+    if (!alreadyRouted) {
+        RouteTarget target;
+        target.model = model;
+        target.inNodeId = connectionId.inNodeId;
+        target.inPortIndex = connectionId.inPortIndex;
+        routeTargets.push_back(target);
+    }
+
+    // Subscribe once per source key and fan out in-process to all targets.
+    if (routeTargets.size() != 1) {
+        return;
+    }
+
+    // Bridge callbacks run on transport threads; hop to the GUI thread before
+    // touching the graph. qApp outlives the router, so it is the safe context.
+    QPointer<PBTransportRouter> weakThis(this);
+
+    if (useZenohTransport) {
+        // Declare the source's publisher now rather than on its first frame
+        outNode->resolveOutputPublisher(outPortIndex);
+
+        auto callback = [weakThis, sourceKey](std::shared_ptr<NodeData> data) {
+            QMetaObject::invokeMethod(qApp, [weakThis, sourceKey, data]() {
+                if (weakThis) {
+                    weakThis->deliver(sourceKey, data);
+                }
+            }, Qt::QueuedConnection);
+        };
+
+        if (ZenohBridge::instance().subscribe(sourceNodeId,
+                                              static_cast<int>(outPortIndex),
+                                              callback,
+                                              model->transportFlowFilename())) {
+            qInfo() << "[PBTransportRouter] Zenoh subscription created:"
+                    << sourceNodeId << "port" << outPortIndex;
+        } else {
+            mRoutesBySource.remove(sourceKey);
+        }
+        return;
+    }
+
+    if (useSharedMemoryTransport) {
+        // Images arrive as cv::Mat views of the shared slot; queuing the
+        // shared_ptr keeps the slot pinned until the graph is done with it.
+        auto callback = [weakThis, sourceKey](std::shared_ptr<NodeData> data) {
+            QMetaObject::invokeMethod(qApp, [weakThis, sourceKey, data]() {
+                if (weakThis) {
+                    weakThis->deliver(sourceKey, data);
+                }
+            }, Qt::QueuedConnection);
+        };
+
+        const QString topicKey = TransportModeManager::makeTransportOutputTopicKey(
+            SharedMemoryBridge::instance().getComputerId(),
+            model->transportFlowFilename(),
+            sourceNodeId,
+            outPortIndex);
+        if (SharedMemoryBridge::instance().subscribe(topicKey, callback)) {
+            qInfo() << "[PBTransportRouter] Shared memory subscription created:"
+                    << sourceNodeId << "port" << outPortIndex;
+        } else {
+            mRoutesBySource.remove(sourceKey);
+        }
+        return;
+    }
+
+    const QString topicName = TransportModeManager::makeTransportOutputTopicKey(
+        CycloneDDSBridge::instance().getComputerId(),
+        model->transportFlowFilename(),
+        sourceNodeId,
+        outPortIndex);
+
+    // Runs on this router's thread, in one queued call per batch of samples.
+    // The payload is DDS loan memory: deserialize before returning.
+    // receiveUs was taken on the reader thread, so queueing here is not counted as link latency.
+    auto rawCallback = [this, sourceKey, topicName](const QByteArray& payload, int64_t receiveUs) {
+        if (!payload.isEmpty()) {
+            auto data = NodeDataSerializer::deserialize(payload, receiveUs);
+            if (auto image = std::dynamic_pointer_cast<CVImageData>(data)) {
+                PBLinkStats::instance().recordReceive(topicName, image->metadata());
+            }
+            deliver(sourceKey, data);
+        }
+    };
+
+    if (CycloneDDSBridge::instance().subscribeRaw(topicName, rawCallback, this)) {
+        qInfo() << "[PBTransportRouter] CycloneDDS subscription created:"
+                << sourceNodeId << "port" << outPortIndex;
+    } else {
+        mRoutesBySource.remove(sourceKey);
+    }
+}
+
+void
+PBTransportRouter::
+unrouteConnection(PBDataFlowGraphModel *model, ConnectionId connectionId)
+{
+    const auto mode = TransportModeManager::instance().getTransportMode();
+    const bool useZenohTransport = (mode == TransportMode::ZenohOnly);
+    const bool useCycloneDDSTransport = (mode == TransportMode::CycloneDDSOnly);
+    const bool useSharedMemoryTransport = (mode == TransportMode::SharedMemoryOnly);
+
+    if (!useZenohTransport && !useCycloneDDSTransport && !useSharedMemoryTransport) {
+        return;
+    }
+
+    const PortIndex outPortIndex = connectionId.outPortIndex;
+    auto outNode = dynamic_cast<PBNodeDelegateModel*>(model->delegateModel<PBNodeDelegateModel>(connectionId.outNodeId));
+    if (!outNode) {
+        return;
+    }
+
+    const QString sourceNodeId = outNode->getNodeId();
+    const QString sourceKey = makeSourceKey(sourceNodeId, outPortIndex);
+
+    auto it = mRoutesBySource.find(sourceKey);
+    if (it == mRoutesBySource.end()) {
+        return;
+    }
+
+    auto& routeTargets = it.value();
+    for (int i = routeTargets.size() - 1; i >= 0; --i) {
+        const auto& target = routeTargets[i];
+        if (target.model == model &&
+            target.inNodeId == connectionId.inNodeId &&
+            target.inPortIndex == connectionId.inPortIndex) {
+            routeTargets.remove(i);
+        }
+    }
+
+    if (routeTargets.isEmpty()) {
+        if (useZenohTransport) {
+            ZenohBridge::instance().unsubscribe(sourceNodeId,
+                                                static_cast<int>(outPortIndex),
+                                                model->transportFlowFilename());
+        } else if (useSharedMemoryTransport) {
+            SharedMemoryBridge::instance().unsubscribe(TransportModeManager::makeTransportOutputTopicKey(
+                SharedMemoryBridge::instance().getComputerId(),
+                model->transportFlowFilename(),
+                sourceNodeId,
+                outPortIndex));
+        } else {
+            const QString topicName = TransportModeManager::makeTransportOutputTopicKey(
+                CycloneDDSBridge::instance().getComputerId(),
+                model->transportFlowFilename(),
+                sourceNodeId,
+                outPortIndex);
+            CycloneDDSBridge::instance().unsubscribeRaw(topicName);
+        }
+        mRoutesBySource.remove(sourceKey);
+
+        qInfo() << "[PBTransportRouter] Transport subscription removed:"
+                << sourceNodeId << "port" << outPortIndex;
+    }
+}
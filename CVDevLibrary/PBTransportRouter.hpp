@@ -0,0 +1,121 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+/**
+ * @file PBTransportRouter.hpp
+ * @brief Delivers Zenoh/CycloneDDS/shared-memory node outputs to the connected inputs of a graph.
+ *
+ * In ZenohOnly, CycloneDDSOnly and SharedMemoryOnly modes a node publishes its
+ * outputs instead of emitting dataUpdated(), so connections of the graph are
+ * not followed by the Qt data flow. The router subscribes once per source output and fans every
+ * received sample out, on the GUI thread, to all inputs connected to it.
+ *
+ * Used by MainWindow for the editor tabs and by cvdev-run for headless flows.
+ *
+ * **Typical Usage:**
+ * @code
+ * QSettings settings(CVDev::cvdevIniPath(), QSettings::IniFormat);
+ * TransportModeManager::instance().setTransportMode(TransportMode::ZenohOnly);
+ * PBTransportRouter::initializeBridges(settings);
+ *
+ * PBTransportRouter router;
+ * router.attachModel(model);        // before load_from_file()
+ * model->load_from_file("camera.flow");
+ * ...
+ * router.detachModel(model);
+ * PBTransportRouter::shutdownBridges();
+ * @endcode
+ */
+
+#pragma once
+
+#include "CVDevLibrary.hpp"
+#include "TransportMode.hpp"
+
+#include <QObject>
+#include <QMap>
+#include <QString>
+#include <QVector>
+#include <QtNodes/Definitions>
+#include <QtNodes/NodeData>
+
+#include <memory>
+
+class QSettings;
+class PBDataFlowGraphModel;
+
+/**
+ * @class PBTransportRouter
+ * @brief Subscription bookkeeping for graphs running on a pub/sub transport.
+ *
+ * Connections are tracked per source key "nodeId:port". The first connection
+ * of a source creates the subscription; removing its last connection drops it.
+ * Does nothing while the transport mode is QtOnly.
+ */
+class CVDEVSHAREDLIB_EXPORT PBTransportRouter : public QObject
+{
+    Q_OBJECT
+public:
+    explicit PBTransportRouter(QObject *parent = nullptr);
+
+    /**
+     * @brief Initializes ZenohBridge, CycloneDDSBridge and SharedMemoryBridge from cvdev.ini.
+     *
+     * Reads computer_id and the [Zenoh], [CycloneDDS] and [SharedMemory]
+     * (slot_count) groups. If the bridge
+     * required by the current transport mode cannot be initialized the mode
+     * falls back to QtOnly.
+     *
+     * @param settings Settings opened on cvdev.ini
+     * @return The transport mode in effect afterwards
+     */
+    static TransportMode initializeBridges(QSettings &settings);
+
+    /**
+     * @brief Shuts all bridges down. Call after every model has been detached.
+     */
+    static void shutdownBridges();
+
+    /**
+     * @brief Follows connectionCreated/connectionDeleted of @p model.
+     *
+     * Attach before loading a flow so that the connections it restores are routed.
+     */
+    void attachModel(PBDataFlowGraphModel *model);
+
+    /**
+     * @brief Drops every route into @p model and the subscriptions left without a target.
+     *
+     * Call for each attached model before it or the router is destroyed.
+     */
+    void detachModel(PBDataFlowGraphModel *model);
+
+private:
+    struct RouteTarget
+    {
+        PBDataFlowGraphModel *model{nullptr};
+        QtNodes::NodeId inNodeId{0};
+        QtNodes::PortIndex inPortIndex{0};
+    };
+
+    void routeConnection(PBDataFlowGraphModel *model, QtNodes::ConnectionId connectionId);
+    void unrouteConnection(PBDataFlowGraphModel *model, QtNodes::ConnectionId connectionId);
+
+    /// Hands @p data to every input routed from @p sourceKey. GUI thread only.
+    void deliver(const QString &sourceKey, const std::shared_ptr<QtNodes::NodeData> &data);
+
+    static QString makeSourceKey(const QString &sourceNodeId, QtNodes::PortIndex outPortIndex);
+
+    QMap<QString, QVector<RouteTarget>> mRoutesBySource;
+};
@@ -0,0 +1,478 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+/**
+ * @file PBWorkerExecutor.cpp
+ * @brief Implementation of the shared work-stealing executor.
+ */
+
+#include "PBWorkerExecutor.hpp"
+#include "DebugLogging.hpp"
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QThread>
+
+#include <algorithm>
+#include <exception>
+#include <map>
+
+#if defined( __linux__ )
+#include <pthread.h>
+#include <sched.h>
+#elif defined(WIN32) || defined(_WIN32) || defined(__WIN32__)
+#include <windows.h>
+#endif
+
+namespace
+{
+
+/// Parses a Linux cpulist such as "0-3,8-11".
+std::vector<int> parseCpuList(const QString &text)
+{
+    std::vector<int> cpus;
+    const auto ranges = text.trimmed().split(',', Qt::SkipEmptyParts);
+    for (const auto &range : ranges)
+    {
+        const auto bounds = range.split('-');
+        bool ok = false;
+        const int first = bounds.value(0).toInt(&ok);
+        if (!ok)
+            continue;
+        const int last = bounds.size() > 1 ? bounds.value(1).toInt(&ok) : first;
+        if (!ok)
+            continue;
+        for (int cpu = first; cpu <= last; ++cpu)
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+/// Returns the CPUs of each NUMA node, or a single node with every CPU.
+std::vector<std::vector<int>> numaTopology()
+{
+    std::map<int, std::vector<int>> nodes;
+#if defined( __linux__ )
+    QDir dir("/sys/devices/system/node");
+    const auto entries = dir.entryList({ "node*" }, QDir::Dirs);
+    for (const auto &entry : entries)
+    {
+        bool ok = false;
+        const int node = entry.mid(4).toInt(&ok);
+        if (!ok)
+            continue;
+        QFile file(dir.filePath(entry + "/cpulist"));
+        if (!file.open(QIODevice::ReadOnly))
+            continue;
+        auto cpus = parseCpuList(QString::fromLatin1(file.readAll()));
+        if (!cpus.empty())
+            nodes[node] = std::move(cpus);
+    }
+#endif
+    std::vector<std::vector<int>> topology;
+    for (auto &node : nodes)
+        topology.push_back(std::move(node.second));
+    if (topology.empty())
+    {
+        std::vector<int> cpus;
+        for (int cpu = 0; cpu < std::max(1, QThread::idealThreadCount()); ++cpu)
+            cpus.push_back(cpu);
+        topology.push_back(std::move(cpus));
+    }
+    return topology;
+}
+
+} // namespace
+
+// ========================================================================
+// Strand
+// ========================================================================
+
+PBWorkerExecutor::Strand::Strand(PBWorkerExecutor *executor, int homeWorker)
+    : mpExecutor(executor)
+    , miHomeWorker(homeWorker)
+{
+}
+
+void PBWorkerExecutor::Strand::post(Job job)
+{
+    if (!job)
+        return;
+    {
+        QMutexLocker locker(&mMutex);
+        if (mbClosed)
+            return;
+        mJobs.push_back(std::move(job));
+        if (mbScheduled)
+            return;
+        mbScheduled = true;
+    }
+    schedule();
+}
+
+void PBWorkerExecutor::Strand::close()
+{
+    QMutexLocker locker(&mMutex);
+    mbClosed = true;
+    mJobs.clear();
+    // A job closing its own strand must not wait for itself.
+    while (mbRunning && mRunningThread != QThread::currentThreadId())
+        mIdle.wait(&mMutex);
+}
+
+void PBWorkerExecutor::Strand::schedule()
+{
+    auto self = shared_from_this();
+    mpExecutor->post([self]() { self->runNext(); }, miHomeWorker);
+}
+
+void PBWorkerExecutor::Strand::runNext()
+{
+    Job job;
+    {
+        QMutexLocker locker(&mMutex);
+        if (mJobs.empty())
+        {
+            mbScheduled = false;
+            return;
+        }
+        job = std::move(mJobs.front());
+        mJobs.pop_front();
+        mbRunning = true;
+        mRunningThread = QThread::currentThreadId();
+    }
+
+    try
+    {
+        job();
+    }
+    catch (const std::exception &e)
+    {
+        DEBUG_LOG_WARNING() << "PBWorkerExecutor job threw:" << e.what();
+    }
+    catch (...)
+    {
+        DEBUG_LOG_WARNING() << "PBWorkerExecutor job threw an unknown exception";
+    }
+
+    bool bMore = false;
+    {
+        QMutexLocker locker(&mMutex);
+        mbRunning = false;
+        mRunningThread = nullptr;
+        bMore = !mJobs.empty();
+        if (!bMore)
+            mbScheduled = false;
+        mIdle.wakeAll();
+    }
+    // One job per turn so a busy node cannot starve the others on its worker.
+    if (bMore)
+        schedule();
+}
+
+// ========================================================================
+// PBWorkerExecutor
+// ========================================================================
+
+PBWorkerExecutor &PBWorkerExecutor::instance()
+{
+    static PBWorkerExecutor *executor = new PBWorkerExecutor();
+    return *executor;
+}
+
+void PBWorkerExecutor::configure(const ExecutorConfig &config)
+{
+    QMutexLocker configureLocker(&mConfigureMutex);
+    const bool bWasRunning = mbRunning.load(std::memory_order_acquire);
+    joinWorkers();
+
+    QWriteLocker locker(&mWorkersLock);
+    std::vector<Job> carried = takeLeftoversLocked();
+    mConfig = config;
+    mbShutdown.store(false, std::memory_order_release);
+    if (!bWasRunning && carried.empty())
+        return;
+
+    startLocked();
+    for (auto &job : carried)
+        pushLocked(std::move(job), -1);
+}
+
+ExecutorConfig PBWorkerExecutor::config() const
+{
+    QReadLocker locker(&mWorkersLock);
+    return mConfig;
+}
+
+std::shared_ptr<PBWorkerExecutor::Strand> PBWorkerExecutor::createStrand()
+{
+    const int home = static_cast<int>(muNextHome.fetch_add(1, std::memory_order_relaxed) % std::max(1, workerCount()));
+    return std::shared_ptr<Strand>(new Strand(this, home));
+}
+
+bool PBWorkerExecutor::post(Job job, int preferredWorker)
+{
+    if (!job)
+        return false;
+    for (;;)
+    {
+        {
+            QReadLocker locker(&mWorkersLock);
+            if (mbShutdown.load(std::memory_order_acquire))
+                return false;
+            if (mbRunning.load(std::memory_order_acquire))
+            {
+                pushLocked(std::move(job), preferredWorker);
+                return true;
+            }
+        }
+        QWriteLocker locker(&mWorkersLock);
+        if (!mbRunning.load(std::memory_order_acquire) && !mbShutdown.load(std::memory_order_acquire))
+            startLocked();
+    }
+}
+
+int PBWorkerExecutor::workerCount() const
+{
+    QReadLocker locker(&mWorkersLock);
+    if (!mWorkers.empty())
+        return static_cast<int>(mWorkers.size());
+    return mConfig.workerCount > 0 ? mConfig.workerCount : std::max(1, QThread::idealThreadCount());
+}
+
+ExecutorStats PBWorkerExecutor::stats() const
+{
+    ExecutorStats s;
+    s.executed = muExecuted.load(std::memory_order_relaxed);
+    s.stolen = muStolen.load(std::memory_order_relaxed);
+    s.parks = muParks.load(std::memory_order_relaxed);
+    QReadLocker locker(&mWorkersLock);
+    s.workers = static_cast<int>(mWorkers.size());
+    s.numaNodes = miNumaNodes;
+    return s;
+}
+
+void PBWorkerExecutor::shutdown()
+{
+    QMutexLocker configureLocker(&mConfigureMutex);
+    mbShutdown.store(true, std::memory_order_release);
+    joinWorkers();
+    QWriteLocker locker(&mWorkersLock);
+    takeLeftoversLocked();
+}
+
+void PBWorkerExecutor::startLocked()
+{
+    const int count = mConfig.workerCount > 0 ? mConfig.workerCount : std::max(1, QThread::idealThreadCount());
+    mWorkers.clear();
+    for (int i = 0; i < count; ++i)
+        mWorkers.push_back(std::make_unique<Worker>());
+    planPlacement();
+
+    mbStopping.store(false, std::memory_order_release);
+    mbRunning.store(true, std::memory_order_release);
+    for (int i = 0; i < count; ++i)
+    {
+        QThread *thread = QThread::create([this, i]() { workerLoop(i); });
+        thread->setObjectName(QString("PBWorker-%1").arg(i));
+        mWorkers[i]->thread = thread;
+        thread->start();
+    }
+    DEBUG_LOG_INFO() << "PBWorkerExecutor started" << count << "workers on" << miNumaNodes << "NUMA node(s)"
+                     << (mConfig.pinThreads ? "(pinned)" : "");
+}
+
+void PBWorkerExecutor::joinWorkers()
+{
+    if (!mbRunning.load(std::memory_order_acquire))
+        return;
+    mbStopping.store(true, std::memory_order_seq_cst);
+    {
+        QMutexLocker locker(&mParkMutex);
+        mWorkAvailable.wakeAll();
+    }
+    // Only configure()/shutdown() resize mWorkers and both hold mConfigureMutex,
+    // so the vector is stable here without mWorkersLock. Not holding it lets a
+    // finishing job still post() its follow-up work.
+    for (auto &worker : mWorkers)
+    {
+        if (worker->thread)
+            worker->thread->wait();
+    }
+}
+
+std::vector<PBWorkerExecutor::Job> PBWorkerExecutor::takeLeftoversLocked()
+{
+    std::vector<Job> leftovers;
+    for (auto &worker : mWorkers)
+    {
+        delete worker->thread;
+        worker->thread = nullptr;
+        for (auto &job : worker->jobs)
+            leftovers.push_back(std::move(job));
+    }
+    mWorkers.clear();
+    mStealOrder.clear();
+    miQueued.store(0, std::memory_order_relaxed);
+    mbRunning.store(false, std::memory_order_release);
+    mbStopping.store(false, std::memory_order_release);
+    return leftovers;
+}
+
+void PBWorkerExecutor::pushLocked(Job job, int preferredWorker)
+{
+    const int count = static_cast<int>(mWorkers.size());
+    const int index = preferredWorker >= 0
+        ? preferredWorker % count
+        : static_cast<int>(muNextWorker.fetch_add(1, std::memory_order_relaxed) % count);
+    {
+        QMutexLocker locker(&mWorkers[index]->mutex);
+        mWorkers[index]->jobs.push_back(std::move(job));
+    }
+    // Pairs with the fence in workerLoop(): either the worker sees the job or we see it parked.
+    miQueued.fetch_add(1, std::memory_order_seq_cst);
+    if (miParked.load(std::memory_order_seq_cst) > 0)
+    {
+        QMutexLocker locker(&mParkMutex);
+        mWorkAvailable.wakeOne();
+    }
+}
+
+void PBWorkerExecutor::workerLoop(int index)
+{
+    const int cpu = mWorkers[index]->cpu;
+    if (mConfig.pinThreads && cpu >= 0)
+        pinCurrentThread(cpu);
+
+    for (;;)
+    {
+        if (mbStopping.load(std::memory_order_acquire))
+            return;
+
+        Job job;
+        if (takeJob(index, job))
+        {
+            try
+            {
+                job();
+            }
+            catch (const std::exception &e)
+            {
+                DEBUG_LOG_WARNING() << "PBWorkerExecutor job threw:" << e.what();
+            }
+            catch (...)
+            {
+                DEBUG_LOG_WARNING() << "PBWorkerExecutor job threw an unknown exception";
+            }
+            muExecuted.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        QMutexLocker locker(&mParkMutex);
+        miParked.fetch_add(1, std::memory_order_seq_cst);
+        if (miQueued.load(std::memory_order_seq_cst) == 0 && !mbStopping.load(std::memory_order_acquire))
+        {
+            muParks.fetch_add(1, std::memory_order_relaxed);
+            mWorkAvailable.wait(&mParkMutex);
+        }
+        miParked.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+bool PBWorkerExecutor::takeJob(int index, Job &job)
+{
+    {
+        Worker &own = *mWorkers[index];
+        QMutexLocker locker(&own.mutex);
+        if (!own.jobs.empty())
+        {
+            job = std::move(own.jobs.front());
+            own.jobs.pop_front();
+            miQueued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    // Steal the newest job of a victim: the oldest one is next in its owner's
+    // line and most likely to have warm data there.
+    for (int victim : mStealOrder[index])
+    {
+        Worker &other = *mWorkers[victim];
+        QMutexLocker locker(&other.mutex);
+        if (!other.jobs.empty())
+        {
+            job = std::move(other.jobs.back());
+            other.jobs.pop_back();
+            miQueued.fetch_sub(1, std::memory_order_relaxed);
+            muStolen.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void PBWorkerExecutor::planPlacement()
+{
+    const int count = static_cast<int>(mWorkers.size());
+    auto topology = numaTopology();
+    if (!mConfig.numaAware && topology.size() > 1)
+    {
+        std::vector<int> all;
+        for (const auto &node : topology)
+            all.insert(all.end(), node.begin(), node.end());
+        topology = { all };
+    }
+
+    // Interleave workers over the nodes so each memory domain gets its share.
+    const int nodes = static_cast<int>(topology.size());
+    for (int i = 0; i < count; ++i)
+    {
+        const int node = i % nodes;
+        const auto &cpus = topology[node];
+        mWorkers[i]->numaNode = node;
+        mWorkers[i]->cpu = cpus[(i / nodes) % cpus.size()];
+    }
+    miNumaNodes = std::min(nodes, count);
+
+    mStealOrder.assign(count, {});
+    for (int i = 0; i < count; ++i)
+    {
+        std::vector<int> local, remote;
+        for (int step = 1; step < count; ++step)
+        {
+            const int victim = (i + step) % count;
+            if (mWorkers[victim]->numaNode == mWorkers[i]->numaNode)
+                local.push_back(victim);
+            else
+                remote.push_back(victim);
+        }
+        local.insert(local.end(), remote.begin(), remote.end());
+        mStealOrder[i] = std::move(local);
+    }
+}
+
+void PBWorkerExecutor::pinCurrentThread(int cpu)
+{
+#if defined( __linux__ )
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        DEBUG_LOG_WARNING() << "PBWorkerExecutor could not pin worker to CPU" << cpu;
+#elif defined(WIN32) || defined(_WIN32) || defined(__WIN32__)
+    if (cpu < 64 && SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) == 0)
+        DEBUG_LOG_WARNING() << "PBWorkerExecutor could not pin worker to CPU" << cpu;
+#else
+    Q_UNUSED(cpu);
+#endif
+}
@@ -0,0 +1,264 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+/**
+ * @file PBWorkerExecutor.hpp
+ * @brief Process-wide work-stealing executor shared by async nodes.
+ *
+ * By default every PBAsyncDataModel owns a QThread. Large flows therefore run
+ * one OS thread per node, most of them asleep. Nodes switched to the shared
+ * executor instead post their jobs to a fixed set of worker threads sized to
+ * the machine.
+ *
+ * **Scheduling:**
+ * - Each worker has its own deque. Jobs are pushed to a preferred worker and
+ *   idle workers steal from the others, trying workers on the same NUMA node
+ *   before remote ones.
+ * - A Strand serializes the jobs of one node: at most one of its jobs runs at
+ *   a time and they run in post order, so frame order within a node is kept.
+ *   Each strand has a home worker, which keeps a node's data in one cache
+ *   while the executor is not saturated.
+ * - Idle workers park on a wait condition; nothing spins.
+ *
+ * **Placement:**
+ * With pinning enabled, worker threads are bound to one CPU each (Linux and
+ * Windows). With NUMA awareness enabled (Linux), CPUs are taken from
+ * /sys/devices/system/node and interleaved across nodes so workers spread
+ * evenly over memory domains.
+ *
+ * **Typical Usage:**
+ * @code
+ * ExecutorConfig config;
+ * config.workerCount = 8;
+ * config.pinThreads = true;
+ * PBWorkerExecutor::instance().configure(config);
+ *
+ * auto strand = PBWorkerExecutor::instance().createStrand();
+ * strand->post([frame]() { process(frame); });
+ * ...
+ * strand->close();   // drops queued jobs, waits for the running one
+ * @endcode
+ *
+ * @see PBAsyncDataModel::invokeWorker()
+ */
+
+#pragma once
+
+#include "CVDevLibrary.hpp"
+
+#include <QtCore/QMutex>
+#include <QtCore/QReadWriteLock>
+#include <QtCore/QWaitCondition>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+class QThread;
+
+/**
+ * @struct ExecutorConfig
+ * @brief Settings of the shared worker executor.
+ */
+struct ExecutorConfig
+{
+    int workerCount{0};     ///< Number of worker threads; 0 uses QThread::idealThreadCount()
+    bool pinThreads{false}; ///< Bind each worker to one CPU
+    bool numaAware{true};   ///< Interleave workers across NUMA nodes and steal locally first
+};
+
+/**
+ * @struct ExecutorStats
+ * @brief Snapshot of the executor counters.
+ */
+struct ExecutorStats
+{
+    uint64_t executed{0};   ///< Jobs run
+    uint64_t stolen{0};     ///< Jobs taken from another worker's deque
+    uint64_t parks{0};      ///< Times a worker went to sleep for lack of work
+    int workers{0};         ///< Running worker threads
+    int numaNodes{1};       ///< NUMA nodes the workers are spread over
+};
+
+/**
+ * @class PBWorkerExecutor
+ * @brief Singleton pool of worker threads with per-worker deques and stealing.
+ *
+ * Threads are started lazily on the first post. All methods are thread-safe.
+ */
+class CVDEVSHAREDLIB_EXPORT PBWorkerExecutor
+{
+public:
+    using Job = std::function<void()>;
+
+    /**
+     * @class Strand
+     * @brief Serial job queue of one node on top of the shared executor.
+     */
+    class CVDEVSHAREDLIB_EXPORT Strand : public std::enable_shared_from_this<Strand>
+    {
+    public:
+        /**
+         * @brief Queues a job. Jobs of one strand never overlap and run in order.
+         *
+         * Ignored after close().
+         */
+        void post(Job job);
+
+        /**
+         * @brief Drops queued jobs and blocks until the running job, if any, returns.
+         *
+         * After close() returns no job of this strand runs again, so objects
+         * captured by the jobs may be destroyed.
+         */
+        void close();
+
+        /**
+         * @brief Worker this strand prefers to run on.
+         */
+        int homeWorker() const { return miHomeWorker; }
+
+    private:
+        friend class PBWorkerExecutor;
+        Strand(PBWorkerExecutor *executor, int homeWorker);
+
+        /// Hands runNext() to the executor.
+        void schedule();
+
+        /// Runs the next queued job on an executor thread.
+        void runNext();
+
+        PBWorkerExecutor *mpExecutor;
+        const int miHomeWorker;
+        QMutex mMutex;
+        QWaitCondition mIdle;
+        std::deque<Job> mJobs;
+        bool mbScheduled{false};
+        bool mbRunning{false};
+        bool mbClosed{false};
+        Qt::HANDLE mRunningThread{nullptr};
+    };
+
+    /**
+     * @brief Returns the process-wide executor.
+     *
+     * The instance is intentionally never destroyed so that strands released
+     * during static destruction still find it.
+     */
+    static PBWorkerExecutor &instance();
+
+    /**
+     * @brief Applies new settings, restarting the worker threads if they run.
+     *
+     * Jobs queued at the time are carried over to the new workers.
+     */
+    void configure(const ExecutorConfig &config);
+
+    /**
+     * @brief Current settings.
+     */
+    ExecutorConfig config() const;
+
+    /**
+     * @brief Creates a serial queue with the next home worker in round-robin order.
+     */
+    std::shared_ptr<Strand> createStrand();
+
+    /**
+     * @brief Queues an independent job.
+     *
+     * @param job Callable run on a worker thread
+     * @param preferredWorker Worker whose deque receives the job; -1 picks round-robin
+     * @return false if the job was not queued (empty job, or after shutdown()); it is then destroyed unrun
+     */
+    bool post(Job job, int preferredWorker = -1);
+
+    /**
+     * @brief Number of worker threads the executor runs (or will run once started).
+     */
+    int workerCount() const;
+
+    /**
+     * @brief Returns a snapshot of the executor counters.
+     */
+    ExecutorStats stats() const;
+
+    /**
+     * @brief Stops and joins the worker threads. Queued jobs are dropped.
+     */
+    void shutdown();
+
+private:
+    struct Worker
+    {
+        QMutex mutex;
+        std::deque<Job> jobs;
+        QThread *thread{nullptr};
+        int cpu{-1};
+        int numaNode{0};
+    };
+
+    PBWorkerExecutor() = default;
+    PBWorkerExecutor(const PBWorkerExecutor &) = delete;
+    PBWorkerExecutor &operator=(const PBWorkerExecutor &) = delete;
+
+    /// Starts the workers. Caller holds mWorkersLock for writing.
+    void startLocked();
+
+    /// Asks the workers to exit and joins them. Caller holds mConfigureMutex.
+    void joinWorkers();
+
+    /// Destroys the joined workers and returns every job left in their deques.
+    /// Caller holds mWorkersLock for writing.
+    std::vector<Job> takeLeftoversLocked();
+
+    /// Pushes a job into a worker deque and wakes a parked worker. Caller holds mWorkersLock.
+    void pushLocked(Job job, int preferredWorker);
+
+    /// Worker thread main loop.
+    void workerLoop(int index);
+
+    /// Pops from the worker's own deque, then steals. Returns false if nothing was found.
+    bool takeJob(int index, Job &job);
+
+    /// Assigns CPUs and NUMA nodes to mWorkers according to mConfig.
+    void planPlacement();
+
+    /// Binds the calling thread to @p cpu.
+    static void pinCurrentThread(int cpu);
+
+    mutable QMutex mConfigureMutex;                ///< Serializes configure() and shutdown(), guards mConfig writes
+    mutable QReadWriteLock mWorkersLock;           ///< Read: post(); write: (re)building mWorkers
+    ExecutorConfig mConfig;
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    std::vector<std::vector<int>> mStealOrder;     ///< Per worker: victims, same NUMA node first
+    std::atomic<bool> mbRunning{false};
+    std::atomic<bool> mbStopping{false};
+    std::atomic<bool> mbShutdown{false};
+    int miNumaNodes{1};
+
+    QMutex mParkMutex;
+    QWaitCondition mWorkAvailable;
+    std::atomic<int> miParked{0};
+    std::atomic<int64_t> miQueued{0};              ///< Jobs sitting in any deque
+
+    std::atomic<uint32_t> muNextWorker{0};
+    std::atomic<uint32_t> muNextHome{0};
+    std::atomic<uint64_t> muExecuted{0};
+    std::atomic<uint64_t> muStolen{0};
+    std::atomic<uint64_t> muParks{0};
+};
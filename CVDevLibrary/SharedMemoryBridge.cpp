@@ -0,0 +1,855 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+/**
+ * @file SharedMemoryBridge.cpp
+ * @brief Shared-memory frame rings, futex wake-up and zero-copy subscriber frames.
+ *
+ * The segment layouts below are shared between processes. Any change to them
+ * must bump kShmLayoutVersion.
+ */
+
+#include "SharedMemoryBridge.hpp"
+#include "CVImageData.hpp"
+#include "DebugLogging.hpp"
+#include "NodeDataSerializer.hpp"
+
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSysInfo>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#if defined(__linux__)
+#define CVDEV_SHM_TRANSPORT
+#include <climits>
+#include <fcntl.h>
+#include <csignal>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef CVDEV_SHM_TRANSPORT
+namespace {
+
+constexpr uint32_t kShmMagic = 0x43564D53;          // "CVMS"
+constexpr uint32_t kShmLayoutVersion = 2;
+constexpr int kDescriptorRingSize = 16;
+constexpr uint32_t kSlotWriting = 0x80000000u;      // Slot state bit held by the publisher while filling
+constexpr size_t kPageSize = 4096;
+constexpr size_t kMinSlotSize = 64 * 1024;
+constexpr int kWaitTimeoutMs = 200;                 // Bounds shutdown latency of subscriber threads
+constexpr int kMaxPinOwners = 8;                    // Subscriber processes that can pin one slot at once
+constexpr int64_t kPinLeaseMs = 2000;               // Pins not renewed this long are checked for a dead owner
+
+enum class PayloadKind : uint32_t
+{
+    Image = 1,      ///< Pixels of a 2-D cv::Mat, continuous rows
+    Serialized = 2  ///< NodeDataSerializer payload
+};
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32-bit integer");
+static_assert(std::atomic<int64_t>::is_always_lock_free, "lease times are shared between processes");
+
+struct DescriptorFields
+{
+    uint32_t generation;
+    uint32_t slot;
+    uint32_t kind;
+    int32_t rows;
+    int32_t cols;
+    int32_t cvType;
+    uint64_t step;
+    uint64_t bytes;
+};
+
+struct FrameDescriptor
+{
+    std::atomic<uint64_t> sequence;     ///< Seqlock: 0 while fields is rewritten
+    DescriptorFields fields;
+};
+
+struct ControlBlock
+{
+    uint32_t magic;
+    uint32_t version;
+    std::atomic<uint32_t> notify;       ///< Futex word, incremented on every publish
+    std::atomic<uint32_t> generation;   ///< Generation of the current data segment
+    std::atomic<uint64_t> sequence;     ///< Last published frame; 0 if none
+    std::atomic<uint32_t> closed;       ///< Set by shutdown() before the segment is unlinked
+    FrameDescriptor ring[kDescriptorRingSize];
+};
+
+/**
+ * @brief Lease of one subscriber process on a slot.
+ *
+ * The pins of state are also counted here per process, so that the pins of a
+ * process that died without releasing them can be taken back.
+ */
+struct PinOwner
+{
+    std::atomic<int32_t> pid;           ///< Owning process; 0 if free
+    std::atomic<uint32_t> pins;         ///< Pins of this process included in SlotHeader::state
+    std::atomic<int64_t> renewedMs;     ///< monotonicMs() of its latest pin
+};
+
+struct alignas(64) SlotHeader
+{
+    std::atomic<uint32_t> state;        ///< kSlotWriting | pinned reader count
+    std::atomic<uint64_t> sequence;     ///< Frame held by the slot
+    PinOwner owners[kMaxPinOwners];
+};
+
+struct DataHeader
+{
+    uint32_t magic;
+    uint32_t slotCount;
+    uint64_t slotSize;
+    SlotHeader slots[SharedMemoryBridge::MaxSlotCount];
+};
+
+constexpr size_t kDataOffset = ((sizeof(DataHeader) + kPageSize - 1) / kPageSize) * kPageSize;
+
+size_t roundToPage(size_t bytes)
+{
+    return ((bytes + kPageSize - 1) / kPageSize) * kPageSize;
+}
+
+/// CLOCK_MONOTONIC in milliseconds; the same clock in every process of the host.
+int64_t monotonicMs()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<int64_t>(now.tv_sec) * 1000 + now.tv_nsec / 1000000;
+}
+
+/**
+ * @brief Lease entry of this process on @p slot, claiming a free one if needed.
+ *
+ * @return nullptr if kMaxPinOwners other processes hold entries
+ */
+PinOwner* pinOwner(SlotHeader& slot)
+{
+    const int32_t self = static_cast<int32_t>(getpid());
+    for (PinOwner& owner : slot.owners) {
+        if (owner.pid.load(std::memory_order_acquire) == self) {
+            return &owner;
+        }
+    }
+    for (PinOwner& owner : slot.owners) {
+        int32_t expected = 0;
+        if (owner.pid.compare_exchange_strong(expected, self, std::memory_order_acq_rel)) {
+            return &owner;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Takes back the pins of subscriber processes that no longer exist.
+ *
+ * Only leases not renewed for kPinLeaseMs are checked, so the owners of
+ * frames in active use cost no system call. A live owner keeps its pins
+ * however long it holds them, since its cv::Mat still points into the slot.
+ *
+ * @return Number of pins released
+ */
+uint32_t reclaimDeadPins(DataHeader& header)
+{
+    const int64_t nowMs = monotonicMs();
+    uint32_t released = 0;
+    for (uint32_t i = 0; i < header.slotCount; ++i) {
+        SlotHeader& slot = header.slots[i];
+        for (PinOwner& owner : slot.owners) {
+            const int32_t pid = owner.pid.load(std::memory_order_acquire);
+            if (pid == 0 || nowMs - owner.renewedMs.load(std::memory_order_relaxed) < kPinLeaseMs) {
+                continue;
+            }
+            if (kill(pid, 0) == 0 || errno != ESRCH) {
+                continue;
+            }
+            // A dead process changes nothing any more: its counts are final
+            const uint32_t pins = owner.pins.exchange(0, std::memory_order_acq_rel);
+            if (pins > 0) {
+                slot.state.fetch_sub(pins, std::memory_order_release);
+                released += pins;
+            }
+            owner.pid.store(0, std::memory_order_release);
+        }
+    }
+    return released;
+}
+
+/**
+ * @brief One mmap()ed segment; unmapped when the last owner goes away.
+ */
+struct ShmMapping
+{
+    void* base{nullptr};
+    size_t size{0};
+
+    ~ShmMapping()
+    {
+        if (base) {
+            munmap(base, size);
+        }
+    }
+
+    template <typename T>
+    T* as() const { return static_cast<T*>(base); }
+
+    uchar* bytes() const { return static_cast<uchar*>(base); }
+};
+
+/**
+ * @brief Maps segment @p name, creating it with @p size bytes if @p create is set.
+ *
+ * Without @p create the existing size is used and must be at least @p size.
+ */
+std::shared_ptr<ShmMapping> mapSegment(const std::string& name, size_t size, bool create)
+{
+    const int fd = shm_open(name.c_str(), O_RDWR | (create ? O_CREAT : 0), 0600);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return nullptr;
+    }
+    size_t mappedSize = static_cast<size_t>(info.st_size);
+    if (create && mappedSize < size) {
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            close(fd);
+            return nullptr;
+        }
+        mappedSize = size;
+    }
+    if (mappedSize < size) {
+        close(fd);
+        return nullptr;
+    }
+
+    void* base = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return nullptr;
+    }
+
+    auto mapping = std::make_shared<ShmMapping>();
+    mapping->base = base;
+    mapping->size = mappedSize;
+    return mapping;
+}
+
+std::string dataSegmentName(const std::string& baseName, uint32_t generation)
+{
+    return baseName + "-" + std::to_string(generation);
+}
+
+void futexWait(std::atomic<uint32_t>* word, uint32_t expected, int timeoutMs)
+{
+    timespec timeout;
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_nsec = static_cast<long>(timeoutMs % 1000) * 1000000L;
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+}
+
+void futexWakeAll(std::atomic<uint32_t>* word)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+/**
+ * @brief Keeps a slot pinned and its segment mapped while a cv::Mat refers to it.
+ */
+struct SlotLease
+{
+    std::shared_ptr<ShmMapping> mapping;
+    SlotHeader* slot;
+    PinOwner* owner;
+};
+
+/**
+ * @brief cv::MatAllocator of subscriber frames: dropping the last reference unpins the slot.
+ *
+ * A frame that is reallocated (create() with another shape) gets ordinary
+ * heap storage from the default allocator.
+ */
+class SlotAllocator : public cv::MatAllocator
+{
+public:
+    cv::UMatData* allocate(int dims, const int* sizes, int type,
+                           void* data0, size_t* step,
+                           cv::AccessFlag flags, cv::UMatUsageFlags usageFlags) const override
+    {
+        return cv::Mat::getDefaultAllocator()->allocate(dims, sizes, type, data0, step, flags, usageFlags);
+    }
+
+    bool allocate(cv::UMatData* u, cv::AccessFlag flags, cv::UMatUsageFlags usageFlags) const override
+    {
+        return cv::Mat::getDefaultAllocator()->allocate(u, flags, usageFlags);
+    }
+
+    void deallocate(cv::UMatData* u) const override
+    {
+        if (!u) {
+            return;
+        }
+        auto* lease = static_cast<SlotLease*>(u->userdata);
+        if (lease) {
+            // Lease first: a crash in between leaves one pin that is never reclaimed, never one too few
+            lease->owner->pins.fetch_sub(1, std::memory_order_relaxed);
+            lease->slot->state.fetch_sub(1, std::memory_order_release);
+            delete lease;
+        }
+        delete u;
+    }
+};
+
+SlotAllocator& slotAllocator()
+{
+    static SlotAllocator sAllocator;
+    return sAllocator;
+}
+
+/**
+ * @brief Wraps a pinned slot in a cv::Mat that owns the pin.
+ */
+cv::Mat wrapSlot(const std::shared_ptr<ShmMapping>& mapping, SlotHeader* slot, PinOwner* owner,
+                 uchar* data, const DescriptorFields& fields)
+{
+    cv::Mat mat(fields.rows, fields.cols, fields.cvType, data, static_cast<size_t>(fields.step));
+
+    cv::UMatData* u = new cv::UMatData(&slotAllocator());
+    u->data = u->origdata = data;
+    u->size = static_cast<size_t>(fields.bytes);
+    u->flags |= cv::UMatData::USER_ALLOCATED;
+    u->userdata = new SlotLease{mapping, slot, owner};
+    u->refcount = 1;
+
+    mat.allocator = &slotAllocator();
+    mat.u = u;
+    return mat;
+}
+
+/**
+ * @brief Reads ring entry @p entry if it still describes frame @p sequence.
+ */
+bool readDescriptor(const FrameDescriptor& entry, uint64_t sequence, DescriptorFields& fields)
+{
+    if (entry.sequence.load(std::memory_order_acquire) != sequence) {
+        return false;
+    }
+    fields = entry.fields;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return entry.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+/**
+ * @brief Pins the slot of frame @p sequence and turns it into NodeData.
+ *
+ * Images reference the slot directly; the pin is released with the last
+ * cv::Mat. Serialized payloads are decoded and unpinned immediately.
+ */
+std::shared_ptr<QtNodes::NodeData> takeFrame(const std::shared_ptr<ShmMapping>& mapping,
+                                             uint64_t sequence,
+                                             const DescriptorFields& fields)
+{
+    auto* header = mapping->as<DataHeader>();
+    if (fields.slot >= header->slotCount || fields.bytes > header->slotSize) {
+        return nullptr;
+    }
+
+    SlotHeader& slot = header->slots[fields.slot];
+    PinOwner* owner = pinOwner(slot);
+    if (!owner) {
+        return nullptr;
+    }
+    uint32_t state = slot.state.load(std::memory_order_acquire);
+    do {
+        if (state & kSlotWriting) {
+            return nullptr;
+        }
+    } while (!slot.state.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel));
+    // The pin is counted in state before the lease, so reclaiming a lease never takes more than was pinned
+    owner->pins.fetch_add(1, std::memory_order_relaxed);
+    owner->renewedMs.store(monotonicMs(), std::memory_order_relaxed);
+
+    auto unpin = [&slot, owner]() {
+        owner->pins.fetch_sub(1, std::memory_order_relaxed);
+        slot.state.fetch_sub(1, std::memory_order_release);
+    };
+
+    // The publisher may have recycled the slot between the descriptor and the pin
+    if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+        unpin();
+        return nullptr;
+    }
+
+    uchar* data = mapping->bytes() + kDataOffset + fields.slot * header->slotSize;
+    if (fields.kind == static_cast<uint32_t>(PayloadKind::Image)) {
+        return std::make_shared<CVImageData>(wrapSlot(mapping, &slot, owner, data, fields));
+    }
+
+    auto result = NodeDataSerializer::deserialize(
+        QByteArray::fromRawData(reinterpret_cast<const char*>(data), static_cast<int>(fields.bytes)));
+    unpin();
+    return result;
+}
+
+} // namespace
+#endif
+
+struct SharedMemoryBridge::Impl
+{
+#ifdef CVDEV_SHM_TRANSPORT
+    struct Publisher
+    {
+        std::string baseName;
+        std::shared_ptr<ShmMapping> control;
+        std::shared_ptr<ShmMapping> data;
+        std::string dataName;
+        uint32_t nextSlot{0};
+        int64_t reclaimedMs{0};         ///< monotonicMs() of the last reclaimDeadPins()
+        bool exhaustedLogged{false};
+    };
+
+    struct Subscription
+    {
+        std::thread thread;
+        std::atomic<bool> stop{false};
+    };
+
+    std::shared_ptr<Publisher> openPublisher(const QString& topicKey);
+    bool createDataSegment(Publisher& publisher, size_t frameBytes);
+    static void subscriberLoop(std::string baseName, DataCallback callback, Subscription* subscription);
+
+    QHash<QString, std::shared_ptr<Publisher>> publishers;
+    QHash<QString, std::shared_ptr<Subscription>> subscriptions;
+#endif
+
+    QMutex mutex;
+    QString computerId{QSysInfo::machineHostName()};
+    int slotCount{DefaultSlotCount};
+    bool initialized{false};
+    std::atomic<uint64_t> dropped{0};
+};
+
+#ifdef CVDEV_SHM_TRANSPORT
+std::shared_ptr<SharedMemoryBridge::Impl::Publisher> SharedMemoryBridge::Impl::openPublisher(const QString& topicKey)
+{
+    auto publisher = std::make_shared<Publisher>();
+    publisher->baseName = segmentName(topicKey).toStdString();
+
+    // Reuse an existing control segment so that running subscribers keep
+    // following this key across publisher restarts.
+    publisher->control = mapSegment(publisher->baseName, sizeof(ControlBlock), true);
+    if (!publisher->control) {
+        DEBUG_LOG_WARNING() << "[SharedMemoryBridge] Cannot create control segment for" << topicKey
+                            << "-" << std::strerror(errno);
+        return nullptr;
+    }
+
+    auto* control = publisher->control->as<ControlBlock>();
+    if (control->magic != kShmMagic || control->version != kShmLayoutVersion ||
+        control->closed.load(std::memory_order_acquire)) {
+        std::memset(control, 0, sizeof(ControlBlock));
+        control->version = kShmLayoutVersion;
+        std::atomic_thread_fence(std::memory_order_release);
+        control->magic = kShmMagic;
+    }
+    return publisher;
+}
+
+bool SharedMemoryBridge::Impl::createDataSegment(Publisher& publisher, size_t frameBytes)
+{
+    auto* control = publisher.control->as<ControlBlock>();
+    const uint32_t generation = control->generation.load(std::memory_order_relaxed) + 1;
+    const std::string name = dataSegmentName(publisher.baseName, generation);
+
+    // Leave headroom so that small size changes do not start a new generation
+    const size_t slotSize = roundToPage(std::max(kMinSlotSize, frameBytes + frameBytes / 4));
+
+    shm_unlink(name.c_str());
+    auto mapping = mapSegment(name, kDataOffset + slotSize * static_cast<size_t>(slotCount), true);
+    if (!mapping) {
+        DEBUG_LOG_WARNING() << "[SharedMemoryBridge] Cannot create data segment" << QString::fromStdString(name)
+                            << "-" << std::strerror(errno);
+        return false;
+    }
+
+    auto* header = mapping->as<DataHeader>();
+    header->slotCount = static_cast<uint32_t>(slotCount);
+    header->slotSize = slotSize;
+    header->magic = kShmMagic;
+
+    // Subscribers keep the old segment mapped as long as they hold its frames
+    if (!publisher.dataName.empty()) {
+        shm_unlink(publisher.dataName.c_str());
+    }
+    publisher.data = std::move(mapping);
+    publisher.dataName = name;
+    publisher.nextSlot = 0;
+    control->generation.store(generation, std::memory_order_release);
+    return true;
+}
+
+void SharedMemoryBridge::Impl::subscriberLoop(std::string baseName, DataCallback callback, Subscription* subscription)
+{
+    std::shared_ptr<ShmMapping> control;
+    std::shared_ptr<ShmMapping> data;
+    uint32_t dataGeneration = 0;
+    uint64_t lastSequence = 0;
+
+    while (!subscription->stop.load(std::memory_order_acquire)) {
+        if (!control) {
+            // The publisher may start later; poll for its control segment
+            control = mapSegment(baseName, sizeof(ControlBlock), false);
+            if (!control || control->as<ControlBlock>()->magic != kShmMagic ||
+                control->as<ControlBlock>()->version != kShmLayoutVersion ||
+                control->as<ControlBlock>()->closed.load(std::memory_order_acquire)) {
+                control.reset();
+                std::this_thread::sleep_for(std::chrono::milliseconds(kWaitTimeoutMs));
+                continue;
+            }
+            lastSequence = control->as<ControlBlock>()->sequence.load(std::memory_order_acquire);
+        }
+
+        auto* block = control->as<ControlBlock>();
+        if (block->closed.load(std::memory_order_acquire)) {
+            // The publisher shut down and unlinked the segment: wait for the next one
+            control.reset();
+            data.reset();
+            continue;
+        }
+        const uint32_t notify = block->notify.load(std::memory_order_acquire);
+        const uint64_t sequence = block->sequence.load(std::memory_order_acquire);
+        if (sequence == lastSequence) {
+            futexWait(&block->notify, notify, kWaitTimeoutMs);
+            continue;
+        }
+
+        // Entries older than the ring have been overwritten: skip to the oldest kept one
+        uint64_t first = lastSequence + 1;
+        if (sequence < first || sequence - first >= static_cast<uint64_t>(kDescriptorRingSize)) {
+            first = sequence - kDescriptorRingSize + 1;
+        }
+
+        for (uint64_t current = first; current <= sequence; ++current) {
+            if (subscription->stop.load(std::memory_order_acquire)) {
+                break;
+            }
+            DescriptorFields fields;
+            if (!readDescriptor(block->ring[current % kDescriptorRingSize], current, fields)) {
+                continue;
+            }
+            if (!data || dataGeneration != fields.generation) {
+                data = mapSegment(dataSegmentName(baseName, fields.generation), kDataOffset, false);
+                dataGeneration = fields.generation;
+                if (!data || data->as<DataHeader>()->magic != kShmMagic) {
+                    data.reset();
+                    continue;
+                }
+            }
+            auto frame = takeFrame(data, current, fields);
+            if (frame) {
+                callback(frame);
+            }
+        }
+        lastSequence = sequence;
+    }
+}
+#endif
+
+SharedMemoryBridge& SharedMemoryBridge::instance()
+{
+    static SharedMemoryBridge sInstance;
+    return sInstance;
+}
+
+SharedMemoryBridge::SharedMemoryBridge()
+    : mpImpl(std::make_unique<Impl>())
+{
+}
+
+SharedMemoryBridge::~SharedMemoryBridge()
+{
+    shutdown();
+}
+
+bool SharedMemoryBridge::initialize(const QString& computerId, int slotCount)
+{
+#ifdef CVDEV_SHM_TRANSPORT
+    shutdown();
+
+    QMutexLocker locker(&mpImpl->mutex);
+    const QString trimmed = computerId.trimmed();
+    mpImpl->computerId = trimmed.isEmpty() ? QSysInfo::machineHostName() : trimmed;
+    mpImpl->slotCount = qBound(2, slotCount, static_cast<int>(MaxSlotCount));
+    mpImpl->initialized = true;
+    DEBUG_LOG_INFO() << "[SharedMemoryBridge] Initialized with computer ID:" << mpImpl->computerId
+                     << "slots per key:" << mpImpl->slotCount;
+    return true;
+#else
+    Q_UNUSED(computerId);
+    Q_UNUSED(slotCount);
+    DEBUG_LOG_WARNING() << "[SharedMemoryBridge] Shared memory transport is only available on Linux";
+    return false;
+#endif
+}
+
+void SharedMemoryBridge::shutdown()
+{
+#ifdef CVDEV_SHM_TRANSPORT
+    QHash<QString, std::shared_ptr<Impl::Subscription>> subscriptions;
+    {
+        QMutexLocker locker(&mpImpl->mutex);
+        subscriptions.swap(mpImpl->subscriptions);
+        for (const auto& publisher : mpImpl->publishers) {
+            if (!publisher->dataName.empty()) {
+                shm_unlink(publisher->dataName.c_str());
+            }
+            // Subscribers drop the closed segment and poll for the next publisher's
+            auto* control = publisher->control->as<ControlBlock>();
+            control->closed.store(1, std::memory_order_release);
+            control->notify.fetch_add(1, std::memory_order_release);
+            futexWakeAll(&control->notify);
+            shm_unlink(publisher->baseName.c_str());
+        }
+        mpImpl->publishers.clear();
+        if (mpImpl->initialized) {
+            DEBUG_LOG_INFO() << "[SharedMemoryBridge] Shutdown";
+        }
+        mpImpl->initialized = false;
+    }
+
+    // Join outside the lock: callbacks may publish
+    for (const auto& subscription : subscriptions) {
+        subscription->stop.store(true, std::memory_order_release);
+    }
+    for (const auto& subscription : subscriptions) {
+        if (subscription->thread.joinable()) {
+            subscription->thread.join();
+        }
+    }
+#endif
+}
+
+bool SharedMemoryBridge::isInitialized() const
+{
+    QMutexLocker locker(&mpImpl->mutex);
+    return mpImpl->initialized;
+}
+
+QString SharedMemoryBridge::getComputerId() const
+{
+    QMutexLocker locker(&mpImpl->mutex);
+    return mpImpl->computerId;
+}
+
+uint64_t SharedMemoryBridge::droppedFrames() const
+{
+    return mpImpl->dropped.load(std::memory_order_relaxed);
+}
+
+QString SharedMemoryBridge::segmentName(const QString& topicKey)
+{
+    // Keys contain '/' and can exceed NAME_MAX; a hash is short and stable
+    const QByteArray hash = QCryptographicHash::hash(topicKey.toUtf8(), QCryptographicHash::Sha1).toHex();
+    return QStringLiteral("/cvdev-") + QString::fromLatin1(hash.left(24));
+}
+
+bool SharedMemoryBridge::publish(const QString& topicKey, const std::shared_ptr<QtNodes::NodeData>& data)
+{
+#ifdef CVDEV_SHM_TRANSPORT
+    if (!data) {
+        return false;
+    }
+
+    // Images travel as pixels; everything else through the serializer
+    cv::Mat image;
+    if (auto imageData = std::dynamic_pointer_cast<CVImageData>(data)) {
+        image = imageData->data();
+    }
+    std::vector<uint8_t> serialized;
+    const bool isImage = !image.empty() && image.dims <= 2;
+    if (!isImage) {
+        serialized = NodeDataSerializer::serialize(data);
+        if (serialized.empty()) {
+            return false;
+        }
+    }
+    const size_t bytes = isImage ? image.total() * image.elemSize() : serialized.size();
+
+    QMutexLocker locker(&mpImpl->mutex);
+    if (!mpImpl->initialized) {
+        return false;
+    }
+
+    std::shared_ptr<Impl::Publisher>& publisher = mpImpl->publishers[topicKey];
+    if (!publisher) {
+        publisher = mpImpl->openPublisher(topicKey);
+        if (!publisher) {
+            mpImpl->publishers.remove(topicKey);
+            return false;
+        }
+    }
+    if (!publisher->data || publisher->data->as<DataHeader>()->slotSize < bytes) {
+        if (!mpImpl->createDataSegment(*publisher, bytes)) {
+            return false;
+        }
+    }
+
+    auto* control = publisher->control->as<ControlBlock>();
+    auto* header = publisher->data->as<DataHeader>();
+
+    // Claim a slot nobody has pinned, starting after the last one written
+    auto claimSlot = [&]() {
+        for (uint32_t i = 0; i < header->slotCount; ++i) {
+            const uint32_t candidate = (publisher->nextSlot + i) % header->slotCount;
+            uint32_t expected = 0;
+            if (header->slots[candidate].state.compare_exchange_strong(expected, kSlotWriting,
+                                                                       std::memory_order_acq_rel)) {
+                return candidate;
+            }
+        }
+        return header->slotCount;
+    };
+    uint32_t slotIndex = claimSlot();
+    if (slotIndex == header->slotCount) {
+        // Pins of a crashed subscriber would otherwise block the slot forever
+        const int64_t nowMs = monotonicMs();
+        if (nowMs - publisher->reclaimedMs >= kPinLeaseMs) {
+            publisher->reclaimedMs = nowMs;
+            const uint32_t released = reclaimDeadPins(*header);
+            if (released > 0) {
+                DEBUG_LOG_WARNING() << "[SharedMemoryBridge] Released" << released
+                                    << "pins of exited subscribers on" << topicKey;
+                slotIndex = claimSlot();
+            }
+        }
+    }
+    if (slotIndex == header->slotCount) {
+        mpImpl->dropped.fetch_add(1, std::memory_order_relaxed);
+        if (!publisher->exhaustedLogged) {
+            DEBUG_LOG_WARNING() << "[SharedMemoryBridge] All slots pinned by subscribers, dropping frames on" << topicKey;
+            publisher->exhaustedLogged = true;
+        }
+        return false;
+    }
+    publisher->exhaustedLogged = false;
+    publisher->nextSlot = (slotIndex + 1) % header->slotCount;
+    SlotHeader& slot = header->slots[slotIndex];
+
+    DescriptorFields fields{};
+    fields.generation = control->generation.load(std::memory_order_relaxed);
+    fields.slot = slotIndex;
+    fields.bytes = bytes;
+
+    uchar* slotData = publisher->data->bytes() + kDataOffset + slotIndex * header->slotSize;
+    if (isImage) {
+        // The single copy of the frame; ROIs are compacted on the way
+        cv::Mat target(image.rows, image.cols, image.type(), slotData);
+        image.copyTo(target);
+        fields.kind = static_cast<uint32_t>(PayloadKind::Image);
+        fields.rows = image.rows;
+        fields.cols = image.cols;
+        fields.cvType = image.type();
+        fields.step = target.step;
+    } else {
+        std::memcpy(slotData, serialized.data(), bytes);
+        fields.kind = static_cast<uint32_t>(PayloadKind::Serialized);
+    }
+
+    const uint64_t sequence = control->sequence.load(std::memory_order_relaxed) + 1;
+    slot.sequence.store(sequence, std::memory_order_relaxed);
+    slot.state.store(0, std::memory_order_release);
+
+    FrameDescriptor& entry = control->ring[sequence % kDescriptorRingSize];
+    entry.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    entry.fields = fields;
+    entry.sequence.store(sequence, std::memory_order_release);
+
+    control->sequence.store(sequence, std::memory_order_release);
+    control->notify.fetch_add(1, std::memory_order_release);
+    futexWakeAll(&control->notify);
+    return true;
+#else
+    Q_UNUSED(topicKey);
+    Q_UNUSED(data);
+    return false;
+#endif
+}
+
+bool SharedMemoryBridge::subscribe(const QString& topicKey, DataCallback callback)
+{
+#ifdef CVDEV_SHM_TRANSPORT
+    QMutexLocker locker(&mpImpl->mutex);
+    if (!mpImpl->initialized || !callback) {
+        return false;
+    }
+    if (mpImpl->subscriptions.contains(topicKey)) {
+        DEBUG_LOG_WARNING() << "[SharedMemoryBridge] Already subscribed to" << topicKey;
+        return false;
+    }
+
+    auto subscription = std::make_shared<Impl::Subscription>();
+    subscription->thread = std::thread(&Impl::subscriberLoop,
+                                       segmentName(topicKey).toStdString(),
+                                       std::move(callback),
+                                       subscription.get());
+    mpImpl->subscriptions.insert(topicKey, subscription);
+    DEBUG_LOG_INFO() << "[SharedMemoryBridge] Subscribed to" << topicKey;
+    return true;
+#else
+    Q_UNUSED(topicKey);
+    Q_UNUSED(callback);
+    return false;
+#endif
+}
+
+void SharedMemoryBridge::unsubscribe(const QString& topicKey)
+{
+#ifdef CVDEV_SHM_TRANSPORT
+    std::shared_ptr<Impl::Subscription> subscription;
+    {
+        QMutexLocker locker(&mpImpl->mutex);
+        subscription = mpImpl->subscriptions.take(topicKey);
+    }
+    if (!subscription) {
+        return;
+    }
+    subscription->stop.store(true, std::memory_order_release);
+    if (subscription->thread.joinable()) {
+        subscription->thread.join();
+    }
+    DEBUG_LOG_INFO() << "[SharedMemoryBridge] Unsubscribed from" << topicKey;
+#else
+    Q_UNUSED(topicKey);
+#endif
+}
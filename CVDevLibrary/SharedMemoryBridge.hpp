@@ -0,0 +1,161 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#pragma once
+
+/**
+ * @file SharedMemoryBridge.hpp
+ * @brief Same-host transport that passes frames through POSIX shared memory.
+ *
+ * Backs TransportMode::SharedMemoryOnly. Each output key
+ * (TransportModeManager::makeTransportOutputTopicKey()) owns two segments:
+ *
+ * - **Control segment** `/cvdev-<hash>`: a ring of small frame descriptors
+ *   (sequence, slot, shape, type) and a futex word bumped on every publish.
+ *   This is the only "message" a subscriber receives.
+ * - **Data segment** `/cvdev-<hash>-<generation>`: a ring of frame slots.
+ *   Image pixels are copied once into a free slot by the publisher;
+ *   subscribers wrap the slot in a cv::Mat without copying. A bigger frame
+ *   than the slot size starts a new generation with larger slots.
+ *
+ * **Slot ownership:**
+ * Every slot has a shared state word: a writer flag plus a reader count. A
+ * subscriber pins the slot before handing the frame to the graph and the pin
+ * is dropped when the last cv::Mat referring to it is released, so a slot is
+ * never overwritten while any process still uses it. Each slot also keeps a
+ * lease per subscriber process (pid, pin count, time of the latest pin).
+ * When every slot is pinned the publisher takes back the pins of processes
+ * that have exited and whose lease is older than two seconds; if no slot is
+ * freed that way it drops the frame and counts it.
+ *
+ * **Waking:**
+ * Subscriber threads sleep in FUTEX_WAIT on the control segment's futex word;
+ * the publisher wakes them with FUTEX_WAKE. No socket or network stack is
+ * involved. Non-image data (a few bytes) is serialized with
+ * NodeDataSerializer into the slot.
+ *
+ * **Limitations:**
+ * - Linux only; initialize() fails elsewhere and the mode falls back to QtOnly.
+ * - Frames are shared between processes: nodes must not write into their
+ *   input image in place (the same rule as for pooled frames).
+ * - Publisher and subscribers must share a PID namespace, since dead owners
+ *   are detected with kill(pid, 0). At most 8 subscriber processes can pin
+ *   one slot at a time; a ninth skips the frame.
+ * - shutdown() marks each control segment closed and unlinks it along with
+ *   the data segment. Running subscribers then drop it and poll for the
+ *   segment of a restarted publisher.
+ *
+ * @code
+ * SharedMemoryBridge::instance().initialize(computerId, 8);
+ * const QString key = TransportModeManager::makeTransportOutputTopicKey(
+ *     computerId, "camera.flow", "Camera_1", 0);
+ *
+ * // Process A
+ * SharedMemoryBridge::instance().publish(key, imageData);
+ *
+ * // Process B
+ * SharedMemoryBridge::instance().subscribe(key, [](std::shared_ptr<QtNodes::NodeData> data) {
+ *     // Called on the subscriber thread; hop to the GUI thread before touching the graph
+ * });
+ * @endcode
+ *
+ * @see PBTransportRouter, which subscribes for every routed connection
+ */
+
+#include "CVDevLibrary.hpp"
+
+#include <QString>
+#include <QtNodes/NodeData>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+/**
+ * @class SharedMemoryBridge
+ * @brief Singleton publisher/subscriber over per-key shared-memory frame rings.
+ *
+ * Thread-safe. Subscription callbacks run on one background thread per
+ * subscribed key.
+ */
+class CVDEVSHAREDLIB_EXPORT SharedMemoryBridge
+{
+public:
+    using DataCallback = std::function<void(std::shared_ptr<QtNodes::NodeData>)>;
+
+    static constexpr int DefaultSlotCount = 8;
+    static constexpr int MaxSlotCount = 32;
+
+    static SharedMemoryBridge& instance();
+
+    /**
+     * @brief Enables the bridge.
+     *
+     * @param computerId Identifier used in output keys; defaults to the host name
+     * @param slotCount Frame slots per published key (2..MaxSlotCount)
+     * @return false if shared memory transport is not supported on this platform
+     */
+    bool initialize(const QString& computerId, int slotCount = DefaultSlotCount);
+
+    /**
+     * @brief Stops subscriber threads and unmaps and unlinks published data segments.
+     *
+     * Frames still referenced by the graph stay valid until released.
+     */
+    void shutdown();
+
+    bool isInitialized() const;
+
+    QString getComputerId() const;
+
+    /**
+     * @brief Copies @p data into a free slot of @p topicKey and wakes its subscribers.
+     *
+     * @return false if not initialized, the type cannot be serialized, or every slot is pinned
+     */
+    bool publish(const QString& topicKey, const std::shared_ptr<QtNodes::NodeData>& data);
+
+    /**
+     * @brief Starts a thread delivering every frame published on @p topicKey.
+     *
+     * The publisher does not need to exist yet. Frames published before the
+     * subscription are not replayed.
+     *
+     * @return false if not initialized or @p topicKey is already subscribed
+     */
+    bool subscribe(const QString& topicKey, DataCallback callback);
+
+    void unsubscribe(const QString& topicKey);
+
+    /**
+     * @brief Frames dropped by publish() because every slot was pinned.
+     */
+    uint64_t droppedFrames() const;
+
+    /**
+     * @brief Name of the control segment of @p topicKey, e.g. "/cvdev-3f2a...".
+     */
+    static QString segmentName(const QString& topicKey);
+
+private:
+    struct Impl;
+
+    SharedMemoryBridge();
+    ~SharedMemoryBridge();
+
+    SharedMemoryBridge(const SharedMemoryBridge&) = delete;
+    SharedMemoryBridge& operator=(const SharedMemoryBridge&) = delete;
+
+    std::unique_ptr<Impl> mpImpl;
+};
@@ -43,7 +43,7 @@
  * // Producer node
  * auto data = std::make_shared<StdVectorIntData>();
  * data->data() = {1, 2, 3, 4, 5};  // Set vector contents
- * data->set_information();          // Update display text
+ * QString text = data->info();      // Display text, formatted on demand
  * emit dataUpdated(0);              // Send to output port
  * 
  * // Consumer node
@@ -207,7 +207,7 @@ using QtNodes::NodeDataType;
  * @endcode
  *
  * @note Vector size is not automatically limited - consider truncating display for large vectors
- * @note set_information() must be called to update display after data changes
+ * @note Calling data() marks the display text stale; info() reformats it on demand
  *
  * @see InformationData::set_information() for display update mechanism
  * @see InformationData::information() for retrieving formatted string
@@ -328,12 +328,13 @@ public:
      * }
      * @endcode
      *
-     * @warning Modifications are not automatically reflected in UI - call set_information()
+     * @note Marks the information text stale; the next info() reformats it
      * @note Returns reference - changes directly affect stored data
      */
     std::vector<T> &
     data()
     {
+        invalidate_information();
         return mvData;
     }
 
@@ -379,7 +380,7 @@ public:
      * largeData->set_information();      // May create very long string
      * @endcode
      *
-     * @note Call this after modifying data() to update property browser display
+     * @note Called by info() after data() was accessed; explicit calls are not required
      * @note QString::number() handles type-specific formatting (int vs float precision)
      * @note All elements are included - no automatic truncation for large vectors
      *
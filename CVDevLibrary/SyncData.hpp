@@ -286,6 +286,7 @@ public:
     bool&
     data()
     {
+        invalidate_information();
         return mbSync;
     }
 
@@ -309,6 +310,7 @@ public:
     set_data( bool data )
     {
         mbSync = data;
+        invalidate_information();
         InformationData::set_timestamp();
     }
 
@@ -0,0 +1,177 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+/**
+ * @file TransportCodecDialog.cpp
+ * @brief Implementation of the per-port transport codec dialog.
+ */
+
+#include "TransportCodecDialog.hpp"
+
+#include "PBNodeDelegateModel.hpp"
+
+#include <QComboBox>
+#include <QDialogButtonBox>
+#include <QGridLayout>
+#include <QLabel>
+#include <QSpinBox>
+#include <QVBoxLayout>
+
+using QtNodes::PortType;
+
+TransportCodecDialog::TransportCodecDialog(PBNodeDelegateModel *model, QWidget *parent)
+    : QDialog(parent)
+    , mpModel(model)
+{
+    setWindowTitle(QString("Transport Codec - %1").arg(model->caption()));
+    setMinimumWidth(480);
+
+    auto *layout = new QVBoxLayout(this);
+    auto *hint = new QLabel("Encoding of image outputs published over Zenoh or CycloneDDS. "
+                            "RAW sends pixels as they are; LOSSLESS and PNG are bit-exact; "
+                            "JPEG is smallest. Receivers detect the codec from the payload.",
+                            this);
+    hint->setWordWrap(true);
+    layout->addWidget(hint);
+
+    auto *grid = new QGridLayout();
+    grid->addWidget(new QLabel("<b>Output</b>", this), 0, 0);
+    grid->addWidget(new QLabel("<b>Codec</b>", this), 0, 1);
+    grid->addWidget(new QLabel("<b>Quality / Level</b>", this), 0, 2);
+    grid->addWidget(new QLabel("<b>Encoder Threads</b>", this), 0, 3);
+
+    const unsigned int nOutputs = model->nPorts(PortType::Out);
+    for (unsigned int port = 0; port < nOutputs; ++port)
+    {
+        if (!model->isImageOutputPort(port))
+            continue;
+
+        Row row;
+        row.port = port;
+        row.settings = model->outputCodec(port);
+
+        QString name = model->portCaption(PortType::Out, port);
+        if (name.isEmpty())
+            name = model->dataType(PortType::Out, port).name;
+
+        row.codecCombo = new QComboBox(this);
+        for (auto encoding : { NodeDataSerializer::ImageEncoding::RAW,
+                               NodeDataSerializer::ImageEncoding::LOSSLESS,
+                               NodeDataSerializer::ImageEncoding::PNG,
+                               NodeDataSerializer::ImageEncoding::JPEG })
+        {
+            row.codecCombo->addItem(ImageCodecSettings::encodingName(encoding).toUpper(),
+                                    static_cast<int>(encoding));
+        }
+        row.codecCombo->setCurrentIndex(row.codecCombo->findData(static_cast<int>(row.settings.encoding)));
+
+        row.qualitySpin = new QSpinBox(this);
+        row.threadsSpin = new QSpinBox(this);
+        row.threadsSpin->setRange(1, ImageCodecSettings::MaxThreads);
+        row.threadsSpin->setValue(row.settings.threads);
+        row.threadsSpin->setToolTip("Frames of this output encoded concurrently; "
+                                    "frames arriving while all are busy are dropped");
+
+        const int gridRow = static_cast<int>(mvRows.size()) + 1;
+        grid->addWidget(new QLabel(QString("%1: %2").arg(port).arg(name), this), gridRow, 0);
+        grid->addWidget(row.codecCombo, gridRow, 1);
+        grid->addWidget(row.qualitySpin, gridRow, 2);
+        grid->addWidget(row.threadsSpin, gridRow, 3);
+
+        connect(row.codecCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+                this, &TransportCodecDialog::onCodecChanged);
+
+        mvRows.push_back(row);
+        updateQualityRange(mvRows.back());
+    }
+    layout->addLayout(grid);
+
+    if (mvRows.empty())
+        layout->addWidget(new QLabel("<i>This node has no image output.</i>", this));
+
+    auto *buttons = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel, this);
+    connect(buttons, &QDialogButtonBox::accepted, this, &QDialog::accept);
+    connect(buttons, &QDialogButtonBox::rejected, this, &QDialog::reject);
+    layout->addWidget(buttons);
+}
+
+bool TransportCodecDialog::apply() const
+{
+    bool changed = false;
+    for (const Row &row : mvRows)
+    {
+        const ImageCodecSettings settings = settingsOf(row);
+        if (settings != mpModel->outputCodec(row.port))
+        {
+            mpModel->setOutputCodec(row.port, settings);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+void TransportCodecDialog::onCodecChanged()
+{
+    for (Row &row : mvRows)
+    {
+        if (row.codecCombo != sender())
+            continue;
+        // Keep the value typed for the previous codec before switching the range
+        row.settings = settingsOf(row);
+        row.settings.encoding = static_cast<NodeDataSerializer::ImageEncoding>(row.codecCombo->currentData().toInt());
+        updateQualityRange(row);
+        return;
+    }
+}
+
+void TransportCodecDialog::updateQualityRange(Row &row)
+{
+    const auto encoding = row.settings.encoding;
+    QSpinBox *spin = row.qualitySpin;
+    spin->setSpecialValueText(QString());
+    if (encoding == NodeDataSerializer::ImageEncoding::JPEG)
+    {
+        spin->setRange(1, 100);
+        spin->setValue(row.settings.jpegQuality);
+        spin->setToolTip("JPEG quality (1-100)");
+        spin->setEnabled(true);
+    }
+    else if (encoding == NodeDataSerializer::ImageEncoding::PNG)
+    {
+        spin->setRange(0, 9);
+        spin->setValue(row.settings.pngLevel);
+        spin->setToolTip("PNG compression level (0 fastest - 9 smallest)");
+        spin->setEnabled(true);
+    }
+    else
+    {
+        spin->setRange(0, 0);
+        spin->setSpecialValueText("-");
+        spin->setToolTip(QString());
+        spin->setEnabled(false);
+    }
+    row.threadsSpin->setEnabled(row.settings.isCompressed());
+}
+
+ImageCodecSettings TransportCodecDialog::settingsOf(const Row &row) const
+{
+    ImageCodecSettings settings = row.settings;
+    if (settings.encoding == NodeDataSerializer::ImageEncoding::JPEG)
+        settings.jpegQuality = row.qualitySpin->value();
+    else if (settings.encoding == NodeDataSerializer::ImageEncoding::PNG)
+        settings.pngLevel = row.qualitySpin->value();
+    // Threads only matter for codecs encoded off the node's thread
+    settings.threads = settings.isCompressed() ? row.threadsSpin->value() : 1;
+    return settings;
+}
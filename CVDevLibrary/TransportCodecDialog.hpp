@@ -0,0 +1,91 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#pragma once
+
+/**
+ * @file TransportCodecDialog.hpp
+ * @brief Dialog choosing the image codec of each output port of a node.
+ *
+ * Opened from the node context menu ("Transport Codec...") of
+ * PBFlowGraphicsView. Lists the image output ports of one
+ * PBNodeDelegateModel with their codec, JPEG quality or PNG level, and the
+ * number of frames encoded in parallel. The settings only matter while the
+ * flow runs in ZenohOnly or CycloneDDSOnly mode.
+ */
+
+#include "NodeDataSerializer.hpp"
+
+#include <QDialog>
+#include <QtNodes/Definitions>
+
+#include <vector>
+
+class PBNodeDelegateModel;
+class QComboBox;
+class QSpinBox;
+
+/**
+ * @class TransportCodecDialog
+ * @brief Edits PBNodeDelegateModel::outputCodec() of every image output port.
+ *
+ * **Usage:**
+ * ```cpp
+ * TransportCodecDialog dialog(model, this);
+ * if (dialog.exec() == QDialog::Accepted && dialog.apply()) {
+ *     // Settings changed; the flow needs saving
+ * }
+ * ```
+ */
+class TransportCodecDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Builds one row per image output port of @p model.
+     */
+    explicit TransportCodecDialog(PBNodeDelegateModel *model, QWidget *parent = nullptr);
+
+    /**
+     * @brief Writes the edited settings back to the model.
+     *
+     * @return true if any port's settings changed
+     */
+    bool apply() const;
+
+    /**
+     * @brief False if the node has no image output port; the dialog then only shows a note.
+     */
+    bool hasImagePorts() const { return !mvRows.empty(); }
+
+private Q_SLOTS:
+    void onCodecChanged();
+
+private:
+    struct Row
+    {
+        QtNodes::PortIndex port;
+        QComboBox *codecCombo;
+        QSpinBox *qualitySpin;   ///< JPEG quality or PNG level, depending on the codec
+        QSpinBox *threadsSpin;
+        ImageCodecSettings settings;  ///< Settings being edited
+    };
+
+    void updateQualityRange(Row &row);
+    ImageCodecSettings settingsOf(const Row &row) const;
+
+    PBNodeDelegateModel *mpModel;
+    std::vector<Row> mvRows;
+};
@@ -18,7 +18,7 @@
  *
  * Defines available transport modes for CVDev and CVDevDaemon, including local
  * execution (Qt only, Qt+Zenoh, Qt+CycloneDDS), distributed backends (Zenoh only,
- * CycloneDDS only), and remote operation modes (Remote Monitor, Remote Control).
+ * CycloneDDS only), same-host shared memory, and remote operation modes (Remote Monitor, Remote Control).
  * Provides constexpr helper functions for mode classification and capability checking.
  */
 
@@ -28,12 +28,14 @@ enum class TransportMode
 {
     QtOnly = 0,
     ZenohOnly = 1,
-    CycloneDDSOnly = 2
+    CycloneDDSOnly = 2,
+    SharedMemoryOnly = 3    ///< Same-host processes via SharedMemoryBridge
 };
 
 inline constexpr const char* kTransportModeQtOnly = "qt_only";
 inline constexpr const char* kTransportModeZenohOnly = "zenoh_only";
 inline constexpr const char* kTransportModeCycloneDDSOnly = "cyclonedds_only";
+inline constexpr const char* kTransportModeSharedMemoryOnly = "shared_memory_only";
 
 inline constexpr bool isZenohTransport(TransportMode mode)
 {
@@ -49,7 +51,13 @@ inline constexpr bool isLocalRuntimeTransport(TransportMode mode)
 {
     return mode == TransportMode::QtOnly ||
            mode == TransportMode::ZenohOnly ||
-           mode == TransportMode::CycloneDDSOnly;
+           mode == TransportMode::CycloneDDSOnly ||
+           mode == TransportMode::SharedMemoryOnly;
+}
+
+inline constexpr bool isSharedMemoryTransport(TransportMode mode)
+{
+    return mode == TransportMode::SharedMemoryOnly;
 }
 
 inline constexpr bool requiresZenoh(TransportMode mode)
@@ -61,3 +69,8 @@ inline constexpr bool requiresDDS(TransportMode mode)
 {
     return isDDSTransport(mode);
 }
+
+inline constexpr bool requiresSharedMemory(TransportMode mode)
+{
+    return isSharedMemoryTransport(mode);
+}
@@ -54,6 +54,9 @@ TransportMode TransportModeManager::transportModeFromSetting(const QString& sett
     if (setting == QString::fromLatin1(kTransportModeCycloneDDSOnly)) {
         return TransportMode::CycloneDDSOnly;
     }
+    if (setting == QString::fromLatin1(kTransportModeSharedMemoryOnly)) {
+        return TransportMode::SharedMemoryOnly;
+    }
     return TransportMode::QtOnly;
 }
 
@@ -64,6 +67,8 @@ QString TransportModeManager::settingFromTransportMode(TransportMode mode)
         return QString::fromLatin1(kTransportModeZenohOnly);
     case TransportMode::CycloneDDSOnly:
         return QString::fromLatin1(kTransportModeCycloneDDSOnly);
+    case TransportMode::SharedMemoryOnly:
+        return QString::fromLatin1(kTransportModeSharedMemoryOnly);
     case TransportMode::QtOnly:
     default:
         return QString::fromLatin1(kTransportModeQtOnly);
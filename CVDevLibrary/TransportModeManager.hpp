@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include "CVDevLibrary.hpp"
 #include "TransportMode.hpp"
 #include <QString>
 #include <QtNodes/Definitions>
@@ -39,7 +40,7 @@
  * Use instance() to access the singleton; all state mutations are thread-safe
  * via Qt's implicit shared containers and atomic setters.
  */
-class TransportModeManager
+class CVDEVSHAREDLIB_EXPORT TransportModeManager
 {
 public:
     /**
@@ -23,9 +23,21 @@
 #include "ZenohBridge.hpp"
 #include "NodeDataSerializer.hpp"
 #include "DebugLogging.hpp"
+#include "PBLinkStats.hpp"
+#include "PBWorkerExecutor.hpp"
+#include <QDeadlineTimer>
 #include <QDebug>
 #include <QRegularExpression>
 #include <QSysInfo>
+#include <QWaitCondition>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace {
 
@@ -46,6 +58,92 @@ QString sanitizeZenohKeySegment(const QString& value, const QString& fallback)
 }
 
 #ifdef ZENOH_ENABLED
+void releasePixelSegment(void* /*data*/, void* context)
+{
+    // Called by Zenoh once the last reference to the bytes is gone, possibly
+    // from a Zenoh thread; drops our reference to the frame buffer.
+    delete static_cast<cv::Mat*>(context);
+}
+
+/**
+ * @brief Builds Zenoh bytes from a payload with at most one copy.
+ *
+ * The header and trailer segments are copied (a few dozen bytes for
+ * images). The pixel segment is handed to Zenoh by reference, kept alive by a
+ * cv::Mat owned by the release callback.
+ */
+bool makeZenohBytes(SerializedPayload&& payload, z_owned_bytes_t* bytes)
+{
+    if (payload.pixelBytes() == 0) {
+        const std::vector<uint8_t> flat = payload.flatten();
+        return z_bytes_copy_from_buf(bytes, flat.data(), flat.size()) == Z_OK;
+    }
+
+    auto* pixels = new cv::Mat(std::move(payload.pixels));
+    z_owned_bytes_t pixelBytes;
+    if (z_bytes_from_buf(&pixelBytes, pixels->data, pixels->total() * pixels->elemSize(),
+                         releasePixelSegment, pixels) != Z_OK) {
+        delete pixels;
+        return false;
+    }
+
+    z_owned_bytes_writer_t writer;
+    z_bytes_writer_empty(&writer);
+    z_bytes_writer_write_all(z_loan_mut(writer), payload.header.data(), payload.header.size());
+    z_bytes_writer_append(z_loan_mut(writer), z_move(pixelBytes));
+    if (!payload.trailer.empty()) {
+        z_bytes_writer_write_all(z_loan_mut(writer), payload.trailer.data(), payload.trailer.size());
+    }
+    z_bytes_writer_finish(z_move(writer), bytes);
+    return true;
+}
+
+void releaseChunkOwner(void* /*data*/, void* context)
+{
+    // One reference to the chunked payload per slice handed to Zenoh
+    delete static_cast<std::shared_ptr<const SerializedPayload>*>(context);
+}
+
+void nackHandlerDrop(void* arg)
+{
+    delete static_cast<std::weak_ptr<ZenohPortPublisher>*>(arg);
+}
+
+/// Key on which receivers of @p key ask its publisher for lost chunks.
+QString nackKey(const QString& key)
+{
+    return key + QStringLiteral("/nack");
+}
+
+void sendNacks(const QString& key, const std::vector<std::vector<uint8_t>>& nacks)
+{
+    if (nacks.empty()) {
+        return;
+    }
+    const std::shared_ptr<ZenohPortPublisher> publisher = ZenohBridge::instance().publisherForKey(nackKey(key));
+    if (!publisher) {
+        return;
+    }
+    for (const auto& nack : nacks) {
+        publisher->publishBytes(nack.data(), nack.size());
+    }
+}
+
+/// Reports the frame trace of a contiguous image payload to PBLinkStats.
+void recordFrameTrace(const QString& key, const uint8_t* data, size_t size, int64_t arrivalUs)
+{
+    const size_t dataEnd = NodeDataSerializer::dataSectionEnd(data, size);
+    if (dataEnd == 0 || dataEnd >= size) {
+        return;
+    }
+    FrameMetadata metadata;
+    if (NodeDataSerializer::readFrameTrace(data + dataEnd, size - dataEnd, metadata) &&
+        !metadata.hops.empty()) {
+        metadata.hops.back().receiveUs = arrivalUs;
+        PBLinkStats::instance().recordReceive(key, metadata);
+    }
+}
+
 void insertZenohConfigJson5(z_owned_config_t& config, const char* key, const QString& value)
 {
     if (!key || value.trimmed().isEmpty()) {
@@ -157,6 +255,257 @@ void applyLegacyKvZenohConfig(z_owned_config_t& config, const QString& zenohConf
 
 } // namespace
 
+/**
+ * @brief Small payloads waiting for the end of the coalescing window.
+ *
+ * Keyed by publisher; a newer payload replaces the waiting one.
+ */
+struct ZenohBridge::PublishQueue
+{
+    struct Pending
+    {
+        std::shared_ptr<ZenohPortPublisher> publisher;
+        std::vector<uint8_t> bytes;
+    };
+
+    QMutex mutex;
+    QWaitCondition wake;
+    std::unordered_map<const ZenohPortPublisher*, Pending> pending;
+    std::thread thread;
+    bool running{false};
+    bool stopping{false};
+};
+
+// ============================================================================
+// Port Publisher
+// ============================================================================
+
+ZenohPortPublisher::ZenohPortPublisher(const QString& key, const QString& hostId, const FrameChunkingConfig& chunking)
+    : msKey(key)
+    , msHostId(hostId)
+{
+    if (chunking.enabled()) {
+        mpChunker = std::make_shared<PBFrameChunker>(chunking);
+    }
+}
+
+ZenohPortPublisher::~ZenohPortPublisher()
+{
+    close();
+}
+
+bool ZenohPortPublisher::publish(SerializedPayload&& payload)
+{
+#ifdef ZENOH_ENABLED
+    if (!isValid()) {
+        return false;
+    }
+
+    if (payload.empty()) {
+        DEBUG_LOG_WARNING() << "[ZenohBridge] Empty payload - cannot publish";
+        return false;
+    }
+
+    ZenohBridge& bridge = ZenohBridge::instance();
+    if (payload.hasMetadata) {
+        NodeDataSerializer::appendFrameTrace(payload, msHostId, PBLinkStats::instance().nextSequence(msKey));
+    } else if (bridge.enqueueCoalesced(shared_from_this(), payload)) {
+        return true;
+    }
+    // A queued payload of this key is older than this one
+    bridge.cancelCoalesced(this);
+
+    if (mpChunker && mpChunker->shouldChunk(payload)) {
+        return publishChunked(std::move(payload));
+    }
+
+    const size_t payloadSize = payload.size();
+    z_owned_bytes_t bytes;
+    if (!makeZenohBytes(std::move(payload), &bytes)) {
+        DEBUG_LOG_WARNING() << "[ZenohBridge] Failed to build payload for key:" << msKey;
+        return false;
+    }
+
+    if (!put(&bytes)) {
+        return false;
+    }
+
+    DEBUG_LOG_INFO() << "[ZenohBridge] Published data to key:" << msKey
+                     << "bytes:" << static_cast<qulonglong>(payloadSize);
+    return true;
+
+#else
+    Q_UNUSED(payload);
+    return false;
+#endif
+}
+
+bool ZenohPortPublisher::publishBytes(const uint8_t* data, size_t size)
+{
+#ifdef ZENOH_ENABLED
+    if (!isValid()) {
+        return false;
+    }
+
+    z_owned_bytes_t bytes;
+    if (z_bytes_copy_from_buf(&bytes, data, size) != Z_OK) {
+        DEBUG_LOG_WARNING() << "[ZenohBridge] Failed to build payload for key:" << msKey;
+        return false;
+    }
+    return put(&bytes);
+
+#else
+    Q_UNUSED(data);
+    Q_UNUSED(size);
+    return false;
+#endif
+}
+
+bool ZenohPortPublisher::publishChunked(SerializedPayload&& payload)
+{
+#ifdef ZENOH_ENABLED
+    if (mpChunker->config().retransmit) {
+        QMutexLocker locker(&mNackMutex);
+        declareNackSubscriber();
+    }
+
+    const size_t payloadSize = payload.size();
+    if (!mpChunker->send(std::move(payload), [this](const FrameChunk& chunk) { return putChunk(chunk); })) {
+        DEBUG_LOG_WARNING() << "[ZenohBridge] Failed to publish chunked payload on key:" << msKey;
+        return false;
+    }
+
+    DEBUG_LOG_INFO() << "[ZenohBridge] Published chunked data to key:" << msKey
+                     << "bytes:" << static_cast<qulonglong>(payloadSize);
+    return true;
+
+#else
+    Q_UNUSED(payload);
+    return false;
+#endif
+}
+
+ZenohPublisherStats ZenohPortPublisher::stats() const
+{
+    ZenohPublisherStats stats;
+    stats.key = msKey;
+    stats.published = muPublished.load(std::memory_order_relaxed);
+    stats.coalesced = muCoalesced.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ZenohPortPublisher::addTransferStats(FrameTransferStats& stats) const
+{
+    if (mpChunker) {
+        mpChunker->addStats(stats);
+    }
+}
+
+#ifdef ZENOH_ENABLED
+bool ZenohPortPublisher::put(z_owned_bytes_t* bytes)
+{
+    // Only puts on this key wait for each other; close() waits for the put in progress
+    QMutexLocker locker(&mMutex);
+    if (!mbValid.load(std::memory_order_relaxed)) {
+        z_drop(z_move(*bytes));
+        return false;
+    }
+
+    z_publisher_put_options_t options;
+    z_publisher_put_options_default(&options);
+    z_publisher_put(z_loan(mPublisher), z_move(*bytes), &options);
+    muPublished.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool ZenohPortPublisher::putChunk(const FrameChunk& chunk)
+{
+    z_owned_bytes_writer_t writer;
+    z_bytes_writer_empty(&writer);
+    z_bytes_writer_write_all(z_loan_mut(writer), chunk.header, FrameChunkHeader::Size);
+    for (const auto& span : chunk.body) {
+        auto* owner = new std::shared_ptr<const SerializedPayload>(chunk.owner);
+        z_owned_bytes_t slice;
+        if (z_bytes_from_buf(&slice, const_cast<uint8_t*>(span.data), span.size, releaseChunkOwner, owner) != Z_OK) {
+            delete owner;
+            z_drop(z_move(writer));
+            return false;
+        }
+        z_bytes_writer_append(z_loan_mut(writer), z_move(slice));
+    }
+
+    z_owned_bytes_t bytes;
+    z_bytes_writer_finish(z_move(writer), &bytes);
+    return put(&bytes);
+}
+
+void ZenohPortPublisher::declareNackSubscriber()
+{
+    if (mbNackDeclared || !isValid()) {
+        return;
+    }
+
+    auto* holder = new std::weak_ptr<ZenohPortPublisher>(shared_from_this());
+    z_owned_closure_sample_t closure;
+    z_closure_sample(&closure, nackHandler, nackHandlerDrop, holder);
+
+    const std::string keyStr = nackKey(msKey).toStdString();
+    z_view_keyexpr_t keyexpr;
+    z_view_keyexpr_from_str(&keyexpr, keyStr.c_str());
+
+    z_result_t result = z_declare_subscriber(z_loan(ZenohBridge::instance().mZenohSession),
+                                              &mNackSubscriber,
+                                              z_loan(keyexpr),
+                                              z_move(closure),
+                                              NULL);
+    if (result != Z_OK) {
+        DEBUG_LOG_WARNING() << "[ZenohBridge] Failed to create NACK subscriber for key:" << msKey;
+        return;
+    }
+    mbNackDeclared = true;
+}
+
+void ZenohPortPublisher::nackHandler(z_loaned_sample_t* sample, void* arg)
+{
+    const std::shared_ptr<ZenohPortPublisher> publisher =
+        static_cast<std::weak_ptr<ZenohPortPublisher>*>(arg)->lock();
+    if (!publisher || !publisher->mpChunker) {
+        return;
+    }
+
+    z_bytes_reader_t reader = z_bytes_get_reader(z_sample_payload(sample));
+    std::vector<uint8_t> nack(z_bytes_reader_remaining(&reader));
+    z_bytes_reader_read(&reader, nack.data(), nack.size());
+
+    // Runs on Zenoh's thread; the lost chunks are put from here
+    publisher->mpChunker->handleNack(nack.data(), nack.size(), [&publisher](const FrameChunk& chunk) {
+        return publisher->putChunk(chunk);
+    });
+}
+#endif
+
+void ZenohPortPublisher::close()
+{
+    {
+        QMutexLocker locker(&mMutex);
+        if (!mbValid.exchange(false, std::memory_order_acq_rel)) {
+            return;
+        }
+#ifdef ZENOH_ENABLED
+        z_undeclare_publisher(z_move(mPublisher));
+#endif
+    }
+
+#ifdef ZENOH_ENABLED
+    // Outside mMutex: a NACK being answered takes it in put() and now fails fast
+    QMutexLocker locker(&mNackMutex);
+    if (mbNackDeclared) {
+        z_undeclare_subscriber(z_move(mNackSubscriber));
+        mbNackDeclared = false;
+    }
+#endif
+}
+
 // ============================================================================
 // Singleton Instance
 // ============================================================================
@@ -175,7 +524,10 @@ ZenohBridge::ZenohBridge()
     : QObject(nullptr)
     , msComputerId(QSysInfo::machineHostName())
     , mbInitialized(false)
+    , mpPublishQueue(std::make_unique<PublishQueue>())
 {
+    mExpireTimer.setInterval(FrameExpireIntervalMs);
+    connect(&mExpireTimer, &QTimer::timeout, this, &ZenohBridge::expireFrames);
 #ifndef ZENOH_ENABLED
     DEBUG_LOG_INFO() << "[ZenohBridge] Zenoh not available - hybrid mode disabled (Qt-only)";
 #endif
@@ -237,6 +589,11 @@ bool ZenohBridge::initialize(const QString& computerId, const QString& zenohConf
     }
 
     mbInitialized = true;
+    if (publishCoalescing() > 0) {
+        startPublishQueue();
+    }
+    // The timer lives on the bridge's thread, which need not be the caller's
+    QMetaObject::invokeMethod(&mExpireTimer, qOverload<>(&QTimer::start));
     DEBUG_LOG_INFO() << "[ZenohBridge] Initialized with computer ID:" << msComputerId;
     return true;
 
@@ -257,17 +614,34 @@ void ZenohBridge::shutdown()
 
     DEBUG_LOG_INFO() << "[ZenohBridge] Shutting down...";
 
+    // Send what is still waiting for its coalescing window
+    stopPublishQueue();
+    QMetaObject::invokeMethod(&mExpireTimer, &QTimer::stop);
+
     // Close all subscribers
     for (auto it = mSubscribers.begin(); it != mSubscribers.end(); ++it) {
         z_undeclare_subscriber(z_move(it.value()));
     }
     mSubscribers.clear();
 
-    // Close all publishers
-    for (auto it = mPublishers.begin(); it != mPublishers.end(); ++it) {
-        z_undeclare_publisher(z_move(it.value()));
+    QMap<QString, std::shared_ptr<ZenohDecodeSubscription>> decodeSubscriptions;
+    {
+        QMutexLocker locker(&mDecodeMutex);
+        decodeSubscriptions.swap(mDecodeSubscriptions);
+    }
+    for (const auto& subscription : decodeSubscriptions) {
+        subscription->strand->close();
+    }
+
+    // Close all publishers; handles still held by nodes become invalid
+    QMap<QString, std::shared_ptr<ZenohPortPublisher>> publishers;
+    {
+        QMutexLocker locker(&mPublisherMutex);
+        publishers.swap(mPublishers);
+    }
+    for (const auto& publisher : publishers) {
+        publisher->close();
     }
-    mPublishers.clear();
 
     // Close session (Zenoh 1.x API - use z_loan_mut for mutable reference)
     z_close(z_loan_mut(mZenohSession), NULL);
@@ -322,58 +696,43 @@ bool ZenohBridge::publish(const QString& nodeId, int portIdx, std::shared_ptr<Qt
         return false;
     }
 
-    // Construct key
-    QString key = makeOutputKey(nodeId, portIdx, flowFilename);
-
-    // Serialize data
-    std::vector<uint8_t> payload = NodeDataSerializer::serialize(data);
+    // Serialize data; image pixels stay in the frame buffer
+    SerializedPayload payload = NodeDataSerializer::serializeSegments(data);
     if (payload.empty()) {
-        DEBUG_LOG_WARNING() << "[ZenohBridge] Serialization failed for key:" << key;
+        DEBUG_LOG_WARNING() << "[ZenohBridge] Serialization failed for key:"
+                            << makeOutputKey(nodeId, portIdx, flowFilename);
         return false;
     }
+    return publishSerialized(nodeId, portIdx, std::move(payload), flowFilename);
 
-    // Get or create publisher (Zenoh 1.x API)
-    if (!mPublishers.contains(key)) {
-        // Store std::string to keep it alive while using c_str()
-        std::string keyStr = key.toStdString();
-        z_view_keyexpr_t keyexpr;
-        z_view_keyexpr_from_str(&keyexpr, keyStr.c_str());
-        
-        z_owned_publisher_t pub;
-        z_result_t result = z_declare_publisher(z_loan(mZenohSession),
-                                                 &pub,
-                                                 z_loan(keyexpr),
-                                                 NULL);
-
-        if (result != Z_OK) {
-            DEBUG_LOG_WARNING() << "[ZenohBridge] Failed to create publisher for key:" << key;
-            return false;
-        }
+#else
+    Q_UNUSED(nodeId);
+    Q_UNUSED(portIdx);
+    Q_UNUSED(data);
+    Q_UNUSED(flowFilename);
+    return false;
+#endif
+}
 
-        mPublishers[key] = pub;
-        DEBUG_LOG_INFO() << "[ZenohBridge] Created publisher for key:" << key;
+bool ZenohBridge::publishSerialized(const QString& nodeId, int portIdx, SerializedPayload&& payload, const QString& flowFilename)
+{
+#ifdef ZENOH_ENABLED
+    if (!mbInitialized) {
+        DEBUG_LOG_WARNING() << "[ZenohBridge] Not initialized - cannot publish";
+        return false;
     }
 
-    // Publish data (Zenoh 1.x API)
-    z_publisher_put_options_t options;
-    z_publisher_put_options_default(&options);
-    
-    z_owned_bytes_t bytes;
-    z_bytes_copy_from_buf(&bytes, payload.data(), payload.size());
-    
-    z_publisher_put(z_loan(mPublishers[key]),
-                    z_move(bytes),
-                    &options);
-
-    DEBUG_LOG_INFO() << "[ZenohBridge] Published data to key:" << key
-                     << "bytes:" << static_cast<qulonglong>(payload.size());
-
-    return true;
+    const std::shared_ptr<ZenohPortPublisher> publisher = outputPublisher(nodeId, portIdx, flowFilename);
+    if (!publisher) {
+        return false;
+    }
+    return publisher->publish(std::move(payload));
 
 #else
     Q_UNUSED(nodeId);
     Q_UNUSED(portIdx);
-    Q_UNUSED(data);
+    Q_UNUSED(payload);
+    Q_UNUSED(flowFilename);
     return false;
 #endif
 }
@@ -391,41 +750,12 @@ bool ZenohBridge::publishRaw(const QString& key, const QByteArray& payload)
         return false;
     }
 
-    // Get or create publisher for this key (Zenoh 1.x API)
-    if (!mPublishers.contains(key)) {
-        // Store std::string to keep it alive while using c_str()
-        std::string keyStr = key.toStdString();
-        z_view_keyexpr_t keyexpr;
-        z_view_keyexpr_from_str(&keyexpr, keyStr.c_str());
-        
-        z_owned_publisher_t pub;
-        z_result_t result = z_declare_publisher(z_loan(mZenohSession),
-                                                 &pub,
-                                                 z_loan(keyexpr),
-                                                 NULL);
-
-        if (result != Z_OK) {
-            DEBUG_LOG_WARNING() << "[ZenohBridge] Failed to create publisher for key:" << key;
-            return false;
-        }
-
-        mPublishers[key] = pub;
-        DEBUG_LOG_INFO() << "[ZenohBridge] Created publisher for key:" << key;
+    const std::shared_ptr<ZenohPortPublisher> publisher = publisherForKey(key);
+    if (!publisher || !publisher->publishBytes(reinterpret_cast<const uint8_t*>(payload.data()),
+                                               static_cast<size_t>(payload.size()))) {
+        return false;
     }
 
-    // Publish raw data (Zenoh 1.x API)
-    z_publisher_put_options_t options;
-    z_publisher_put_options_default(&options);
-    
-    z_owned_bytes_t bytes;
-    z_bytes_copy_from_buf(&bytes, 
-                          reinterpret_cast<const uint8_t*>(payload.data()),
-                          payload.size());
-    
-    z_publisher_put(z_loan(mPublishers[key]),
-                    z_move(bytes),
-                    &options);
-
     DEBUG_LOG_INFO() << "[ZenohBridge] Published raw data to key:" << key
                      << "bytes:" << static_cast<qulonglong>(payload.size());
 
@@ -438,46 +768,410 @@ bool ZenohBridge::publishRaw(const QString& key, const QByteArray& payload)
 #endif
 }
 
+std::shared_ptr<ZenohPortPublisher> ZenohBridge::outputPublisher(const QString& nodeId, int portIdx, const QString& flowFilename)
+{
+    return publisherForKey(makeOutputKey(nodeId, portIdx, flowFilename));
+}
+
+std::shared_ptr<ZenohPortPublisher> ZenohBridge::publisherForKey(const QString& key)
+{
+#ifdef ZENOH_ENABLED
+    if (!mbInitialized) {
+        DEBUG_LOG_WARNING() << "[ZenohBridge] Not initialized - cannot declare publisher";
+        return nullptr;
+    }
+
+    // Encoder threads of PBNodeDelegateModel resolve keys concurrently with the GUI thread
+    QMutexLocker locker(&mPublisherMutex);
+    auto it = mPublishers.find(key);
+    if (it != mPublishers.end() && it.value()->isValid()) {
+        return it.value();
+    }
+
+    std::shared_ptr<ZenohPortPublisher> publisher(new ZenohPortPublisher(key, msComputerId, mFrameChunking));
+
+    // Store std::string to keep it alive while using c_str()
+    std::string keyStr = key.toStdString();
+    z_view_keyexpr_t keyexpr;
+    z_view_keyexpr_from_str(&keyexpr, keyStr.c_str());
+
+    z_result_t result = z_declare_publisher(z_loan(mZenohSession),
+                                             &publisher->mPublisher,
+                                             z_loan(keyexpr),
+                                             NULL);
+    if (result != Z_OK) {
+        DEBUG_LOG_WARNING() << "[ZenohBridge] Failed to create publisher for key:" << key;
+        return nullptr;
+    }
+
+    publisher->mbValid.store(true, std::memory_order_release);
+    mPublishers.insert(key, publisher);
+    DEBUG_LOG_INFO() << "[ZenohBridge] Created publisher for key:" << key;
+    return publisher;
+
+#else
+    Q_UNUSED(key);
+    return nullptr;
+#endif
+}
+
+QList<ZenohPublisherStats> ZenohBridge::publisherStats() const
+{
+    QList<ZenohPublisherStats> result;
+    QMutexLocker locker(&mPublisherMutex);
+    for (const auto& publisher : mPublishers) {
+        result.append(publisher->stats());
+    }
+    return result;
+}
+
+void ZenohBridge::setFrameChunking(const FrameChunkingConfig& config)
+{
+    QMutexLocker locker(&mPublisherMutex);
+    mFrameChunking = config;
+}
+
+FrameChunkingConfig ZenohBridge::frameChunking() const
+{
+    QMutexLocker locker(&mPublisherMutex);
+    return mFrameChunking;
+}
+
+// ============================================================================
+// Publish Coalescing
+// ============================================================================
+
+void ZenohBridge::setPublishCoalescing(int windowMs)
+{
+    miCoalesceWindowMs.store(qMax(0, windowMs), std::memory_order_relaxed);
+    if (windowMs <= 0) {
+        stopPublishQueue();
+    } else if (mbInitialized) {
+        startPublishQueue();
+    }
+}
+
+bool ZenohBridge::enqueueCoalesced(const std::shared_ptr<ZenohPortPublisher>& publisher, const SerializedPayload& payload)
+{
+    if (miCoalesceWindowMs.load(std::memory_order_relaxed) <= 0 ||
+        payload.pixelBytes() > 0 || payload.size() > CoalesceMaxBytes) {
+        return false;
+    }
+
+    std::vector<uint8_t> bytes = payload.flatten();
+    PublishQueue& queue = *mpPublishQueue;
+    QMutexLocker locker(&queue.mutex);
+    if (!queue.running) {
+        return false;
+    }
+
+    const bool wasEmpty = queue.pending.empty();
+    auto& pending = queue.pending[publisher.get()];
+    if (pending.publisher) {
+        publisher->muCoalesced.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        pending.publisher = publisher;
+    }
+    pending.bytes = std::move(bytes);
+
+    // The thread only needs waking to open a window; later payloads join it
+    if (wasEmpty) {
+        queue.wake.wakeOne();
+    }
+    return true;
+}
+
+void ZenohBridge::cancelCoalesced(const ZenohPortPublisher* publisher)
+{
+    if (miCoalesceWindowMs.load(std::memory_order_relaxed) <= 0) {
+        return;
+    }
+
+    PublishQueue& queue = *mpPublishQueue;
+    QMutexLocker locker(&queue.mutex);
+    queue.pending.erase(publisher);
+}
+
+void ZenohBridge::startPublishQueue()
+{
+    PublishQueue& queue = *mpPublishQueue;
+    QMutexLocker locker(&queue.mutex);
+    if (queue.running) {
+        return;
+    }
+
+    queue.running = true;
+    queue.stopping = false;
+    queue.thread = std::thread([this, &queue]() {
+        std::unordered_map<const ZenohPortPublisher*, PublishQueue::Pending> batch;
+        QMutexLocker locker(&queue.mutex);
+        for (;;) {
+            while (queue.pending.empty() && !queue.stopping) {
+                queue.wake.wait(&queue.mutex);
+            }
+            if (queue.pending.empty()) {
+                break;
+            }
+
+            // Payloads arriving during the window replace the waiting ones of their key
+            QDeadlineTimer window(miCoalesceWindowMs.load(std::memory_order_relaxed));
+            while (!queue.stopping && !window.hasExpired()) {
+                queue.wake.wait(&queue.mutex, window);
+            }
+
+            batch.swap(queue.pending);
+            locker.unlock();
+            for (const auto& entry : batch) {
+                entry.second.publisher->publishBytes(entry.second.bytes.data(), entry.second.bytes.size());
+            }
+            batch.clear();
+            locker.relock();
+        }
+    });
+}
+
+void ZenohBridge::stopPublishQueue()
+{
+    PublishQueue& queue = *mpPublishQueue;
+    std::thread thread;
+    {
+        QMutexLocker locker(&queue.mutex);
+        if (!queue.running) {
+            return;
+        }
+        // Publishing goes direct from here on; the thread sends what is queued and exits
+        queue.running = false;
+        queue.stopping = true;
+        queue.wake.wakeAll();
+        thread = std::move(queue.thread);
+    }
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
 // ============================================================================
 // Subscribe
 // ============================================================================
 
 #ifdef ZENOH_ENABLED
-struct ZenohDataCallbackHolder {
+/**
+ * @brief Reference to a received sample; the bytes are not copied until decoding.
+ */
+struct ZenohSample
+{
+    explicit ZenohSample(const z_loaned_bytes_t* payload, int64_t arrivalUs)
+        : receivedUs(arrivalUs)
+        , hasBytes(true)
+    {
+        z_bytes_clone(&bytes, payload);
+    }
+    /// A payload reassembled from chunks.
+    ZenohSample(std::vector<uint8_t>&& frame, int64_t arrivalUs)
+        : receivedUs(arrivalUs)
+        , assembled(std::move(frame))
+    {
+    }
+    ~ZenohSample()
+    {
+        if (hasBytes) {
+            z_drop(z_move(bytes));
+        }
+    }
+
+    ZenohSample(const ZenohSample&) = delete;
+    ZenohSample& operator=(const ZenohSample&) = delete;
+
+    z_owned_bytes_t bytes;
+    int64_t receivedUs;   ///< FrameHop::now() on arrival, before any decode queueing
+    bool hasBytes{false};
+    std::vector<uint8_t> assembled;
+};
+#endif
+
+/**
+ * @brief Decode queue of one subscribe() subscription.
+ *
+ * At most one decode job per subscription is posted to its strand at a time;
+ * it handles one sample and reposts itself while samples remain, so busy
+ * topics do not monopolize a worker.
+ */
+struct ZenohDecodeSubscription
+{
+    QString key;
     ZenohBridge::DataCallback callback;
+    std::shared_ptr<PBWorkerExecutor::Strand> strand;
+    size_t queueDepth{8};
+
+    QMutex mutex;
+#ifdef ZENOH_ENABLED
+    std::deque<std::unique_ptr<ZenohSample>> pending;
+#endif
+    bool scheduled{false};
+
+    std::atomic<uint64_t> received{0};
+    std::atomic<uint64_t> decoded{0};
+    std::atomic<uint64_t> dropped{0};
+    PBLatencyHistogram decodeTime;
+    PBFrameReassembler reassembler;     ///< Chunks of payloads sent by a chunking publisher
+
+#ifdef ZENOH_ENABLED
+    void enqueue(std::unique_ptr<ZenohSample> sample, bool latestOnly)
+    {
+        received.fetch_add(1, std::memory_order_relaxed);
+        {
+            QMutexLocker locker(&mutex);
+            if (latestOnly && !pending.empty()) {
+                dropped.fetch_add(pending.size(), std::memory_order_relaxed);
+                pending.clear();
+            } else if (pending.size() >= queueDepth) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                pending.pop_front();
+            }
+            pending.push_back(std::move(sample));
+            if (scheduled) {
+                return;
+            }
+            scheduled = true;
+        }
+        post();
+    }
+
+    void post()
+    {
+        // The job owns a reference: the subscription may be dropped by Zenoh
+        // while a decode is queued. close() on unsubscribe cancels it.
+        auto self = this->self.lock();
+        if (self) {
+            strand->post([self]() { self->decodeNext(); });
+        }
+    }
+
+    void decodeNext()
+    {
+        std::unique_ptr<ZenohSample> sample;
+        {
+            QMutexLocker locker(&mutex);
+            if (pending.empty()) {
+                scheduled = false;
+                return;
+            }
+            sample = std::move(pending.front());
+            pending.pop_front();
+        }
+
+        const int64_t start = PBNodeMetrics::now();
+        std::vector<uint8_t> payload;
+        if (sample->hasBytes) {
+            z_bytes_reader_t reader = z_bytes_get_reader(z_loan(sample->bytes));
+            payload.resize(z_bytes_reader_remaining(&reader));
+            z_bytes_reader_read(&reader, payload.data(), payload.size());
+        } else {
+            payload = std::move(sample->assembled);
+        }
+        const int64_t receivedUs = sample->receivedUs;
+        sample.reset();
+        auto data = NodeDataSerializer::deserialize(payload, receivedUs);
+        decodeTime.record(static_cast<uint64_t>(PBNodeMetrics::now() - start));
+
+        if (data) {
+            decoded.fetch_add(1, std::memory_order_relaxed);
+            callback(data);
+        }
+
+        {
+            QMutexLocker locker(&mutex);
+            if (pending.empty()) {
+                scheduled = false;
+                return;
+            }
+        }
+        post();
+    }
+#endif
+
+    std::weak_ptr<ZenohDecodeSubscription> self;
+};
+
+#ifdef ZENOH_ENABLED
+struct ZenohDataCallbackHolder {
+    std::shared_ptr<ZenohDecodeSubscription> subscription;
 };
 
 struct ZenohRawCallbackHolder {
     ZenohBridge* bridge;
     QString key;
+    std::shared_ptr<PBFrameReassembler> reassembler;
 };
 
+/**
+ * @brief Adds a chunk to its frame; a completed frame joins the decode queue like a whole sample.
+ *
+ * @p reader is positioned after the chunk header.
+ */
+static void receiveChunk(ZenohDecodeSubscription& subscription, const uint8_t* header, size_t headerSize,
+                         z_bytes_reader_t& reader, int64_t arrivalUs)
+{
+    FrameChunkHeader chunk;
+    if (!FrameChunkHeader::read(header, headerSize, chunk) ||
+        z_bytes_reader_remaining(&reader) != chunk.bodySize()) {
+        return;
+    }
+
+    PBFrameReassembler::PushResult result;
+    subscription.reassembler.push(chunk, [&reader](uint8_t* destination, size_t size) {
+        z_bytes_reader_read(&reader, destination, size);
+    }, arrivalUs, result);
+    sendNacks(subscription.key, result.nacks);
+    if (!result.complete) {
+        return;
+    }
+
+    const bool isImage = result.frame.size() > 1 && result.frame[1] == NodeDataSerializer::TYPE_CVIMAGE;
+    if (isImage) {
+        recordFrameTrace(subscription.key, result.frame.data(), result.frame.size(), arrivalUs);
+    }
+    subscription.enqueue(std::make_unique<ZenohSample>(std::move(result.frame), arrivalUs), isImage);
+}
+
 // Static callback wrapper for Zenoh (C API requires static function) - Zenoh 1.x API
 static void zenohDataHandler(z_loaned_sample_t* sample, void* arg)
 {
-    // Extract callback from user data
     auto* callbackHolder = static_cast<ZenohDataCallbackHolder*>(arg);
     if (!callbackHolder) {
         return;
     }
 
-    // Extract payload (Zenoh 1.x API)
+    // Runs on Zenoh's thread, shared by every subscription of the session:
+    // only peek at the header and the frame trace, then hand the sample over
+    // to the decode queue.
+    const int64_t arrivalUs = FrameHop::now();
     const z_loaned_bytes_t* payload_bytes = z_sample_payload(sample);
-    
-    // Get payload data
+    uint8_t header[FrameChunkHeader::Size] = {};
     z_bytes_reader_t reader = z_bytes_get_reader(payload_bytes);
-    size_t payload_len = z_bytes_reader_remaining(&reader);
-    
-    std::vector<uint8_t> payload(payload_len);
-    z_bytes_reader_read(&reader, payload.data(), payload_len);
-
-    // Deserialize
-    auto data = NodeDataSerializer::deserialize(payload);
-
-    if (data) {
-        // Invoke user callback
-        callbackHolder->callback(data);
+    const size_t headerSize = z_bytes_reader_read(&reader, header, sizeof(header));
+    if (PBFrameReassembler::isChunk(header, headerSize)) {
+        receiveChunk(*callbackHolder->subscription, header, headerSize, reader, arrivalUs);
+        return;
+    }
+    const bool isImage = (header[1] == NodeDataSerializer::TYPE_CVIMAGE);
+
+    // Link statistics are taken on arrival, so frames later dropped by the
+    // decode queue are not mistaken for network loss
+    const size_t dataEnd = NodeDataSerializer::dataSectionEnd(header, headerSize);
+    if (isImage && dataEnd > 0 &&
+        z_bytes_reader_seek(&reader, static_cast<int64_t>(dataEnd), SEEK_SET) == Z_OK) {
+        std::vector<uint8_t> trailer(std::min<size_t>(z_bytes_reader_remaining(&reader), 4096));
+        z_bytes_reader_read(&reader, trailer.data(), trailer.size());
+        FrameMetadata metadata;
+        if (NodeDataSerializer::readFrameTrace(trailer.data(), trailer.size(), metadata) &&
+            !metadata.hops.empty()) {
+            metadata.hops.back().receiveUs = arrivalUs;
+            PBLinkStats::instance().recordReceive(callbackHolder->subscription->key, metadata);
+        }
     }
+
+    callbackHolder->subscription->enqueue(std::make_unique<ZenohSample>(payload_bytes, arrivalUs), isImage);
 }
 
 static void zenohDataHandlerDrop(void* arg)
@@ -504,6 +1198,17 @@ static void zenohRawDataHandler(z_loaned_sample_t* sample, void* arg)
     QByteArray payload(payload_len, Qt::Uninitialized);
     z_bytes_reader_read(&reader, reinterpret_cast<uint8_t*>(payload.data()), payload_len);
 
+    const auto* data = reinterpret_cast<const uint8_t*>(payload.constData());
+    if (PBFrameReassembler::isChunk(data, payload_len)) {
+        PBFrameReassembler::PushResult result;
+        callbackHolder->reassembler->push(data, payload_len, FrameHop::now(), result);
+        sendNacks(callbackHolder->key, result.nacks);
+        if (!result.complete) {
+            return;
+        }
+        payload = QByteArray(reinterpret_cast<const char*>(result.frame.data()), static_cast<int>(result.frame.size()));
+    }
+
     callbackHolder->bridge->dispatchRawPayload(callbackHolder->key, payload);
 }
 
@@ -530,8 +1235,18 @@ bool ZenohBridge::subscribe(const QString& nodeId, int portIdx, DataCallback cal
         return false;
     }
 
+    auto subscription = std::make_shared<ZenohDecodeSubscription>();
+    subscription->key = key;
+    subscription->callback = callback;
+    subscription->strand = PBWorkerExecutor::instance().createStrand();
+    subscription->self = subscription;
+    {
+        QMutexLocker locker(&mDecodeMutex);
+        subscription->queueDepth = static_cast<size_t>(miDecodeQueueDepth);
+    }
+
     // Keep callback userdata alive independently from container reallocation/removal.
-    auto* callbackHolder = new ZenohDataCallbackHolder{callback};
+    auto* callbackHolder = new ZenohDataCallbackHolder{subscription};
 
     // Create Zenoh subscriber (Zenoh 1.x API)
     z_owned_closure_sample_t closure;
@@ -555,10 +1270,15 @@ bool ZenohBridge::subscribe(const QString& nodeId, int portIdx, DataCallback cal
     if (result != Z_OK) {
         DEBUG_LOG_WARNING() << "[ZenohBridge] Failed to create subscriber for key:" << key;
         delete callbackHolder;
+        subscription->strand->close();
         return false;
     }
 
     mSubscribers[key] = sub;
+    {
+        QMutexLocker locker(&mDecodeMutex);
+        mDecodeSubscriptions.insert(key, subscription);
+    }
     DEBUG_LOG_INFO() << "[ZenohBridge] Subscribed to key:" << key;
     return true;
 
@@ -586,6 +1306,7 @@ void ZenohBridge::unsubscribe(const QString& nodeId, int portIdx, const QString&
     if (mSubscribers.contains(key)) {
         z_undeclare_subscriber(z_move(mSubscribers[key]));
         mSubscribers.remove(key);
+        closeDecodeSubscription(key);
         DEBUG_LOG_INFO() << "[ZenohBridge] Unsubscribed from key:" << key;
     }
 #else
@@ -635,7 +1356,8 @@ bool ZenohBridge::subscribeRaw(const QString& key, const QString& subscriberId,
     }
 
     // Keep callback userdata alive independently from container reallocation/removal.
-    auto* callbackHolder = new ZenohRawCallbackHolder{this, key};
+    auto reassembler = std::make_shared<PBFrameReassembler>();
+    auto* callbackHolder = new ZenohRawCallbackHolder{this, key, reassembler};
 
     // Create Zenoh subscriber with raw data handler (Zenoh 1.x API)
     z_owned_closure_sample_t closure;
@@ -666,6 +1388,7 @@ bool ZenohBridge::subscribeRaw(const QString& key, const QString& subscriberId,
     {
         QMutexLocker locker(&mRawSubscriberMutex);
         mRawSubscribersByKey[key].insert(subscriberId, callback);
+        mRawReassemblers.insert(key, reassembler);
     }
     DEBUG_LOG_INFO() << "[ZenohBridge] Subscribed to raw key:" << key;
     return true;
@@ -697,6 +1420,7 @@ void ZenohBridge::unsubscribeRaw(const QString& key, const QString& subscriberId
             byKeyIt->remove(subscriberId);
             if (byKeyIt->isEmpty()) {
                 mRawSubscribersByKey.erase(byKeyIt);
+                mRawReassemblers.remove(key);
                 removeTransportSubscriber = true;
             }
         }
@@ -713,6 +1437,105 @@ void ZenohBridge::unsubscribeRaw(const QString& key, const QString& subscriberId
 #endif
 }
 
+void ZenohBridge::setDecodeQueueDepth(int depth)
+{
+    QMutexLocker locker(&mDecodeMutex);
+    miDecodeQueueDepth = qMax(1, depth);
+}
+
+QList<ZenohSubscriptionStats> ZenohBridge::subscriptionStats() const
+{
+    QList<ZenohSubscriptionStats> result;
+    QMutexLocker locker(&mDecodeMutex);
+    for (const auto& subscription : mDecodeSubscriptions) {
+        ZenohSubscriptionStats stats;
+        stats.key = subscription->key;
+        stats.received = subscription->received.load(std::memory_order_relaxed);
+        stats.decoded = subscription->decoded.load(std::memory_order_relaxed);
+        stats.dropped = subscription->dropped.load(std::memory_order_relaxed);
+        stats.decode = subscription->decodeTime.summary();
+        result.append(stats);
+    }
+    return result;
+}
+
+void ZenohBridge::expireFrames()
+{
+#ifdef ZENOH_ENABLED
+    std::vector<std::pair<QString, std::shared_ptr<ZenohDecodeSubscription>>> subscriptions;
+    std::vector<std::pair<QString, std::shared_ptr<PBFrameReassembler>>> rawReassemblers;
+    {
+        QMutexLocker locker(&mDecodeMutex);
+        for (auto it = mDecodeSubscriptions.cbegin(); it != mDecodeSubscriptions.cend(); ++it) {
+            subscriptions.emplace_back(it.key(), it.value());
+        }
+    }
+    {
+        QMutexLocker locker(&mRawSubscriberMutex);
+        for (auto it = mRawReassemblers.cbegin(); it != mRawReassemblers.cend(); ++it) {
+            rawReassemblers.emplace_back(it.key(), it.value());
+        }
+    }
+
+    PBFrameReassembler::PushResult result;
+    const int64_t nowUs = FrameHop::now();
+    for (const auto& entry : subscriptions) {
+        entry.second->reassembler.expire(nowUs, result);
+        sendNacks(entry.first, result.nacks);
+    }
+    for (const auto& entry : rawReassemblers) {
+        entry.second->expire(nowUs, result);
+        sendNacks(entry.first, result.nacks);
+    }
+#endif
+}
+
+QList<FrameTransferStats> ZenohBridge::frameTransferStats() const
+{
+    QMap<QString, FrameTransferStats> byKey;
+    {
+        QMutexLocker locker(&mPublisherMutex);
+        for (auto it = mPublishers.cbegin(); it != mPublishers.cend(); ++it) {
+            it.value()->addTransferStats(byKey[it.key()]);
+        }
+    }
+    {
+        QMutexLocker locker(&mDecodeMutex);
+        for (auto it = mDecodeSubscriptions.cbegin(); it != mDecodeSubscriptions.cend(); ++it) {
+            it.value()->reassembler.addStats(byKey[it.key()]);
+        }
+    }
+    {
+        QMutexLocker locker(&mRawSubscriberMutex);
+        for (auto it = mRawReassemblers.cbegin(); it != mRawReassemblers.cend(); ++it) {
+            it.value()->addStats(byKey[it.key()]);
+        }
+    }
+
+    QList<FrameTransferStats> result;
+    for (auto it = byKey.begin(); it != byKey.end(); ++it) {
+        if (it.value().framesSent == 0 && it.value().chunksReceived == 0) {
+            continue;
+        }
+        it.value().key = it.key();
+        result.append(it.value());
+    }
+    return result;
+}
+
+void ZenohBridge::closeDecodeSubscription(const QString& key)
+{
+    std::shared_ptr<ZenohDecodeSubscription> subscription;
+    {
+        QMutexLocker locker(&mDecodeMutex);
+        subscription = mDecodeSubscriptions.take(key);
+    }
+    // Blocks until a running decode returns; no callback runs afterwards
+    if (subscription) {
+        subscription->strand->close();
+    }
+}
+
 void ZenohBridge::dispatchRawPayload(const QString& key, const QByteArray& payload)
 {
     QList<RawDataCallback> callbacks;
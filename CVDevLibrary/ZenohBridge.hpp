@@ -85,6 +85,34 @@
  * camera_feed                                               (bridge channel)
  * @endcode
  *
+ * **Receive Path:**
+ * The Zenoh callback thread only takes a reference to each sample. Decoding
+ * (NodeDataSerializer::deserialize(), which may imdecode a JPEG/PNG) and the
+ * subscriber callback run on PBWorkerExecutor, serialized per subscription so
+ * samples of one key are delivered in order. Image topics are coalesced
+ * latest-only: a frame still waiting when the next one arrives is dropped.
+ * Other types queue up to the decode queue depth, dropping the oldest.
+ * subscriptionStats() reports received/decoded/dropped counts and decode time.
+ *
+ * **Publish Path:**
+ * Nodes publish through a ZenohPortPublisher obtained once per output port
+ * from outputPublisher(): the key is formatted and the Zenoh publisher
+ * declared when the port is first connected, not per frame. With
+ * setPublishCoalescing() a window is set, small non-image payloads (at most
+ * CoalesceMaxBytes) are queued instead of put on the emitting thread;
+ * a background thread sends them once per window, keeping only the latest
+ * payload of each key. publisherStats() reports published and coalesced counts.
+ *
+ * **Large Frames:**
+ * With setFrameChunking() a threshold is set, payloads above it are sent as
+ * chunks (PBFrameTransfer.hpp) instead of one put; the pixel segment is still
+ * passed to Zenoh by reference, one slice per chunk. Subscriptions reassemble
+ * chunks whatever their own settings and discard frames that miss the
+ * sender's deadline; a timer expires frames whose chunks stopped arriving
+ * every FrameExpireIntervalMs. When the sender enables retransmit, it listens on
+ * `{key}/nack` for the chunks a receiver lost. frameTransferStats() reports
+ * the chunk counters of every key.
+ *
  * **Performance Considerations:**
  * - Qt signals (same process): 10-100 nanoseconds latency
  * - Zenoh (same machine): 1-10 milliseconds latency
@@ -102,13 +130,125 @@
 #include <QObject>
 #include <QString>
 #include <QMap>
+#include <QList>
 #include <QMutex>
+#include <QTimer>
+#include <atomic>
 #include <memory>
 #include <functional>
 #include <QtNodes/NodeData>
 
+#include "NodeDataSerializer.hpp"
+#include "PBFrameTransfer.hpp"
+#include "PBNodeMetrics.hpp"
 #include "TransportMode.hpp"
 
+struct ZenohDecodeSubscription;
+
+/**
+ * @struct ZenohSubscriptionStats
+ * @brief Counters of one subscribe() subscription.
+ */
+struct ZenohSubscriptionStats
+{
+    QString key;
+    uint64_t received{0};                   ///< Samples delivered by Zenoh
+    uint64_t decoded{0};                    ///< Samples deserialized and passed to the callback
+    uint64_t dropped{0};                    ///< Samples discarded by coalescing or a full queue
+    PBLatencyHistogram::Summary decode;     ///< Deserialization time
+};
+
+/**
+ * @struct ZenohPublisherStats
+ * @brief Counters of one declared publisher.
+ */
+struct ZenohPublisherStats
+{
+    QString key;
+    uint64_t published{0};                  ///< Puts on the key; a chunked payload counts once per chunk
+    uint64_t coalesced{0};                  ///< Queued payloads replaced by a newer one before sending
+};
+
+/**
+ * @class ZenohPortPublisher
+ * @brief Declared Zenoh publisher of one key, shared by everyone publishing on it.
+ *
+ * Obtained from ZenohBridge::outputPublisher() or publisherForKey(), which
+ * build the key and declare the publisher once. publish() is thread-safe and
+ * does no key formatting or map lookup. ZenohBridge::shutdown() undeclares the
+ * publisher; publish() then returns false and holders fetch a new handle.
+ */
+class ZenohPortPublisher : public std::enable_shared_from_this<ZenohPortPublisher>
+{
+public:
+    ~ZenohPortPublisher();
+
+    const QString& key() const { return msKey; }
+
+    /**
+     * @brief False once the bridge has shut down.
+     */
+    bool isValid() const { return mbValid.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Publishes @p payload, or queues it when coalescing applies.
+     *
+     * Image payloads get the frame trace extension first. Images are never
+     * coalesced: a replaced frame would count as lost in PBLinkStats.
+     */
+    bool publish(SerializedPayload&& payload);
+
+    /**
+     * @brief Puts already flattened bytes on the key immediately.
+     */
+    bool publishBytes(const uint8_t* data, size_t size);
+
+    ZenohPublisherStats stats() const;
+
+    /**
+     * @brief Adds the chunk counters of this key to @p stats; nothing if chunking is off.
+     */
+    void addTransferStats(FrameTransferStats& stats) const;
+
+private:
+    friend class ZenohBridge;
+
+    ZenohPortPublisher(const QString& key, const QString& hostId, const FrameChunkingConfig& chunking);
+
+    /// Sends @p payload as chunks; see PBFrameChunker.
+    bool publishChunked(SerializedPayload&& payload);
+
+#ifdef ZENOH_ENABLED
+    /// Puts and consumes @p bytes.
+    bool put(z_owned_bytes_t* bytes);
+
+    /// Puts one chunk; its body is referenced, not copied.
+    bool putChunk(const FrameChunk& chunk);
+
+    /// Declares the `{key}/nack` subscriber once; caller holds mNackMutex.
+    void declareNackSubscriber();
+
+    static void nackHandler(z_loaned_sample_t* sample, void* arg);
+#endif
+
+    /// Undeclares the publisher; later publishes fail.
+    void close();
+
+    QString msKey;
+    QString msHostId;                       ///< Computer ID written into frame traces
+    mutable QMutex mMutex;                  ///< Serializes puts with close()
+    std::atomic<bool> mbValid{false};
+    std::atomic<uint64_t> muPublished{0};
+    std::atomic<uint64_t> muCoalesced{0};
+    std::shared_ptr<PBFrameChunker> mpChunker;  ///< Null when chunking is off
+    QMutex mNackMutex;                      ///< Guards the NACK subscriber
+    bool mbNackDeclared{false};
+#ifdef ZENOH_ENABLED
+    z_owned_publisher_t mPublisher;
+    z_owned_subscriber_t mNackSubscriber;
+#endif
+};
+
 /**
  * @class ZenohBridge
  * @brief Singleton class managing Zenoh pub/sub for distributed dataflow.
@@ -290,6 +430,64 @@ public:
      */
     bool publish(const QString& nodeId, int portIdx, std::shared_ptr<QtNodes::NodeData> data, const QString& flowFilename = QString());
 
+    /**
+     * @brief Publishes an already serialized payload on the output key of @p nodeId / @p portIdx.
+     *
+     * Used when the payload was encoded elsewhere, e.g. with a per-port
+     * ImageCodecSettings on a worker thread. Thread-safe.
+     */
+    bool publishSerialized(const QString& nodeId, int portIdx, SerializedPayload&& payload, const QString& flowFilename = QString());
+
+    /**
+     * @brief Publisher of the output key of @p nodeId / @p portIdx, declared on first request.
+     *
+     * Every caller asking for the same key shares one handle. Keep the handle
+     * and publish through it; ask again once it is no longer valid().
+     *
+     * @return nullptr if Zenoh is not initialized or the declaration failed
+     */
+    std::shared_ptr<ZenohPortPublisher> outputPublisher(const QString& nodeId, int portIdx, const QString& flowFilename = QString());
+
+    /**
+     * @brief Publisher of a custom key expression; see outputPublisher().
+     */
+    std::shared_ptr<ZenohPortPublisher> publisherForKey(const QString& key);
+
+    /// Largest non-image payload that the publish queue coalesces.
+    static constexpr size_t CoalesceMaxBytes = 4096;
+
+    /// Period at which incomplete frames of every subscription are checked for their deadline.
+    static constexpr int FrameExpireIntervalMs = 20;
+
+    /**
+     * @brief Coalescing window of small payloads in milliseconds; 0 (default) puts every payload at once.
+     *
+     * While a window is set, a background thread sends the latest queued
+     * payload of every key once per window. Setting 0 sends what is queued and
+     * stops the thread. Read from `[Zenoh] publish_coalesce_ms` in cvdev.ini.
+     */
+    void setPublishCoalescing(int windowMs);
+    int publishCoalescing() const { return miCoalesceWindowMs.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Counters of every declared publisher.
+     */
+    QList<ZenohPublisherStats> publisherStats() const;
+
+    /**
+     * @brief Chunked transfer of payloads above @p config.thresholdBytes; off by default.
+     *
+     * Applies to publishers declared afterwards. Read from `[FrameChunking]`
+     * in cvdev.ini. Receiving chunks needs no setting.
+     */
+    void setFrameChunking(const FrameChunkingConfig& config);
+    FrameChunkingConfig frameChunking() const;
+
+    /**
+     * @brief Chunk counters of every key that sent or received chunks.
+     */
+    QList<FrameTransferStats> frameTransferStats() const;
+
     /**
      * @brief Publishes raw serialized data to a custom Zenoh key.
      *
@@ -350,8 +548,10 @@ public:
      * };
      * @endcode
      *
-     * @warning Callback invoked on Zenoh thread - use Qt::QueuedConnection for GUI updates
-     * @note Deserialization happens automatically via NodeDataSerializer
+     * @warning Callback invoked on a PBWorkerExecutor thread, never concurrently for
+     *          one subscription - use Qt::QueuedConnection for GUI updates
+     * @note Deserialization happens automatically via NodeDataSerializer, off the
+     *       Zenoh callback thread
      */
     bool subscribe(const QString& nodeId, int portIdx, DataCallback callback, const QString& flowFilename = QString());
 
@@ -415,6 +615,19 @@ public:
     void dispatchRawPayload(const QString& key, const QByteArray& payload);
     void unsubscribeRaw(const QString& key, const QString& subscriberId);
 
+    /**
+     * @brief Samples of a non-image subscription that may wait for decoding (default 8).
+     *
+     * Applies to subscriptions created afterwards. Image topics always keep
+     * only the latest sample.
+     */
+    void setDecodeQueueDepth(int depth);
+
+    /**
+     * @brief Counters of every active subscribe() subscription.
+     */
+    QList<ZenohSubscriptionStats> subscriptionStats() const;
+
     /**
      * @brief Checks if Zenoh is initialized and ready.
      *
@@ -469,13 +682,48 @@ private:
      */
     QString makeInputKey(const QString& nodeId, int portIdx, const QString& flowFilename = QString()) const;
 
+    /**
+     * @brief Cancels queued decodes of @p key and waits for the running one.
+     */
+    void closeDecodeSubscription(const QString& key);
+
+    friend class ZenohPortPublisher;
+    struct PublishQueue;
+
+    /**
+     * @brief Queues @p payload of @p publisher for the next coalescing window.
+     *
+     * @return false if coalescing is off or @p payload does not qualify
+     */
+    bool enqueueCoalesced(const std::shared_ptr<ZenohPortPublisher>& publisher, const SerializedPayload& payload);
+
+    /// Drops the queued payload of @p publisher, superseded by one sent directly.
+    void cancelCoalesced(const ZenohPortPublisher* publisher);
+
+    void startPublishQueue();
+    void stopPublishQueue();
+
+    /// Expires incomplete frames of every subscription and sends their due NACKs.
+    void expireFrames();
+
 #ifdef ZENOH_ENABLED
     z_owned_session_t mZenohSession;       ///< Zenoh session handle
-    QMap<QString, z_owned_publisher_t> mPublishers;  ///< Topic → Publisher map
     QMap<QString, z_owned_subscriber_t> mSubscribers; ///< Topic → Subscriber map
 #endif
-    QMutex mRawSubscriberMutex;
+    mutable QMutex mPublisherMutex;        ///< Guards mPublishers and mFrameChunking
+    QMap<QString, std::shared_ptr<ZenohPortPublisher>> mPublishers;  ///< Key → declared publisher
+    FrameChunkingConfig mFrameChunking;
+    std::unique_ptr<PublishQueue> mpPublishQueue;  ///< Running while a coalescing window is set
+    std::atomic<int> miCoalesceWindowMs{0};
+
+    mutable QMutex mDecodeMutex;
+    QMap<QString, std::shared_ptr<ZenohDecodeSubscription>> mDecodeSubscriptions; ///< Topic -> decode queue of subscribe()
+    int miDecodeQueueDepth{8};
+
+    mutable QMutex mRawSubscriberMutex;
     QMap<QString, QMap<QString, RawDataCallback>> mRawSubscribersByKey; ///< Topic -> subscriberId -> callback
+    QMap<QString, std::shared_ptr<PBFrameReassembler>> mRawReassemblers; ///< Topic -> chunks of the raw subscription
+    QTimer mExpireTimer;                   ///< Runs expireFrames() while initialized
 
     QString msComputerId;               ///< Computer ID used in all key prefixes (default: hostname)
     bool mbInitialized;                    ///< Initialization state
@@ -13,6 +13,7 @@
 //limitations under the License.
 
 #include "MainWindow.hpp"
+#include "DebugLogging.hpp"
 
 #include <QApplication>
 #include <QSurfaceFormat>
@@ -29,21 +30,6 @@
 //#define __ENABLE_DEBUG_LOG_INFO__
 //#define __ENABLE_DEBUG_LOG_WARNING__
 
-#if defined (__SAVE_LOG__)
-
-QMutex lLockMutex;
-QFile lLogFile;
-
-void messageHandler(QtMsgType type, const QMessageLogContext &context, const QString &msg)
-{
-    QMutexLocker locker(&lLockMutex);
-
-    QTextStream out(&lLogFile);
-    out << msg << "\n";
-    out.flush();
-}
-#endif
-
 int main(int argc, char *argv[])
 {
 #if (QT_VERSION < QT_VERSION_CHECK(6, 0, 0) )
@@ -62,16 +48,14 @@ int main(int argc, char *argv[])
         logDir.mkpath(".");
 
     auto log_filename = logDir.filePath("log-" +  QDateTime::currentDateTime().toString("yyyy-MM-dd-hh-mm-ss") + ".txt");
-    lLogFile.setFileName(log_filename);
 
-    if( !lLogFile.open(QIODevice::Append | QIODevice::Text) )
+    // Messages are written by a background thread; callers never wait on the disk.
+    if( !DebugLogSink::instance().start(log_filename) )
     {
         QMessageBox::critical(nullptr, "CVDev", "<p>Could not open log file! "
                             "Please check a storage free space or log directory permission/</p>");
         return 1;
     }
-
-    qInstallMessageHandler(messageHandler);
 #endif   // __SAVE_LOG__
 
     // Configure debug logging - must set both rules together
@@ -85,7 +69,14 @@ int main(int argc, char *argv[])
     QLoggingCategory::setFilterRules("DebugLogging.info=false\nDebugLogging.warning=false");
 #endif
 
-    MainWindow window;
-    window.show();
-    return app.exec();
+    int result;
+    {
+        MainWindow window;
+        window.show();
+        result = app.exec();
+    }
+#if defined( __SAVE_LOG__)
+    DebugLogSink::instance().stop();
+#endif
+    return result;
 }
@@ -416,18 +416,18 @@ ensure_frame_pool(int width, int height, int type)
 
     const int desiredSize = qMax( 1, miPoolSize );
     QMutexLocker locker( &mFramePoolMutex );
+    // Pool slots reallocate through CVMatArena on geometry/type changes,
+    // so only a new pool size requires a new pool.
     const bool shouldRecreate = !mpFramePool ||
-        miPoolFrameWidth != width ||
-        miPoolFrameHeight != height ||
         miActivePoolSize != desiredSize;
 
     if( shouldRecreate )
     {
         mpFramePool = std::make_shared<CVImagePool>( getNodeId(), width, height, type, static_cast<size_t>( desiredSize ) );
-        miPoolFrameWidth = width;
-        miPoolFrameHeight = height;
         miActivePoolSize = desiredSize;
     }
+    miPoolFrameWidth = width;
+    miPoolFrameHeight = height;
 
     if( mpFramePool )
         mpFramePool->setMode( meSharingMode );
@@ -241,14 +241,13 @@ void CVBilateralFilterModel::dispatchPendingWork()
 
         setWorkerBusy(true);
 
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                                 Qt::QueuedConnection,
-                                 Q_ARG(cv::Mat, mPendingFrame),
-                                 Q_ARG(CVBilateralFilterParameters, mPendingParams),
-                                 Q_ARG(FrameSharingMode, getSharingMode()),
-                                 Q_ARG(std::shared_ptr<CVImagePool>, pool),
-                                 Q_ARG(long, frameId),
-                                 Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, mPendingFrame),
+                     WORKER_ARG(CVBilateralFilterParameters, mPendingParams),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, pool),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
 
         mPendingFrame = cv::Mat(); // Clear pending
     }
@@ -262,7 +261,7 @@ void CVBilateralFilterModel::process_cached_input()
 
     if (isWorkerBusy()) {
         // Store pending frame
-        mPendingFrame = mpCVImageInData->data().clone();
+        mPendingFrame = mpCVImageInData->data();
         mPendingParams = mParams;
         setPendingWork(true);
         return;
@@ -278,14 +277,13 @@ void CVBilateralFilterModel::process_cached_input()
 
     setWorkerBusy(true);
 
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                             Qt::QueuedConnection,
-                             Q_ARG(cv::Mat, input),
-                             Q_ARG(CVBilateralFilterParameters, mParams),
-                             Q_ARG(FrameSharingMode, getSharingMode()),
-                             Q_ARG(std::shared_ptr<CVImagePool>, pool),
-                             Q_ARG(long, frameId),
-                             Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, input),
+                 WORKER_ARG(CVBilateralFilterParameters, mParams),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, pool),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 QString
@@ -204,7 +204,7 @@ processData(const std::vector< cv::Mat >&in, std::shared_ptr<CVImageData> &out,
         {
             cv::bitwise_not(in[0], temp);
         }
-        temp.copyTo( out->data() );
+        temp.copyTo( out->overwrite() );
         return;
     }
     else
@@ -244,7 +244,7 @@ processData(const std::vector< cv::Mat >&in, std::shared_ptr<CVImageData> &out,
                 cv::bitwise_xor(in[0], in[1], temp);
             }
         }
-        temp.copyTo( out->data() );
+        temp.copyTo( out->overwrite() );
     }
 }
 
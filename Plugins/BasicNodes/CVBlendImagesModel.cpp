@@ -121,6 +121,9 @@ setInData(std::shared_ptr<NodeData> nodeData, PortIndex portIndex)
         if (d)
         {
             mapCVImageInData[portIndex] = d;
+            // In wave scheduling the other image of this frame follows; blend once with both
+            if(inputBatchPending())
+                return;
             if(allports_are_active(mapCVImageInData))
             {
                 processData(mapCVImageInData, mpCVImageData, mParams);
@@ -283,11 +286,11 @@ processData(const std::shared_ptr< CVImageData > (&in)[2], std::shared_ptr<CVIma
             switch(mpEmbeddedWidget->getCurrentState())
             {
             case 0:
-                cv::add(i0,Temp,out->data());
+                cv::add(i0,Temp,out->overwrite());
                 break;
 
             case 1:
-                cv::addWeighted(i0,params.mdAlpha,Temp,params.mdBeta,params.mdGamma,out->data(),-1);
+                cv::addWeighted(i0,params.mdAlpha,Temp,params.mdBeta,params.mdGamma,out->overwrite(),-1);
                 break;
             }
         }
@@ -300,11 +303,11 @@ processData(const std::shared_ptr< CVImageData > (&in)[2], std::shared_ptr<CVIma
             switch(mpEmbeddedWidget->getCurrentState())
             {
             case 0:
-                cv::add(Temp,i1,out->data());
+                cv::add(Temp,i1,out->overwrite());
                 break;
 
             case 1:
-                cv::addWeighted(Temp,params.mdAlpha,i1,params.mdBeta,params.mdGamma,out->data(),-1);
+                cv::addWeighted(Temp,params.mdAlpha,i1,params.mdBeta,params.mdGamma,out->overwrite(),-1);
                 break;
             }
         }
@@ -174,17 +174,17 @@ void CVCLAHEEqualizationModel::dispatchPendingWork()
     ensure_frame_pool(input.cols, input.rows, input.type());
     long frameId = getNextFrameId(); QString producerId = getNodeId(); std::shared_ptr<CVImagePool> poolCopy = getFramePool();
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame", Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, input.clone()),
-                              Q_ARG(double, params.mdClipLimit),
-                              Q_ARG(int, params.miTileSize),
-                              Q_ARG(bool, params.mbApplyColorLuma),
-                              Q_ARG(int, params.miColorSpaceIndex),
-                              Q_ARG(bool, params.mbConvertTo8Bit),
-                              Q_ARG(FrameSharingMode, getSharingMode()),
-                              Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                              Q_ARG(long, frameId),
-                              Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(input)),
+                 WORKER_ARG(double, params.mdClipLimit),
+                 WORKER_ARG(int, params.miTileSize),
+                 WORKER_ARG(bool, params.mbApplyColorLuma),
+                 WORKER_ARG(int, params.miColorSpaceIndex),
+                 WORKER_ARG(bool, params.mbConvertTo8Bit),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 QJsonObject CVCLAHEEqualizationModel::save() const
@@ -235,22 +235,22 @@ void CVCLAHEEqualizationModel::process_cached_input()
     if (!mpCVImageInData || mpCVImageInData->data().empty()) return;
     cv::Mat input = mpCVImageInData->data();
     QTimer::singleShot(0, this, [this]() { mpSyncData->data() = false; emitOutputPort(1); });
-    if (isWorkerBusy()) { mPendingFrame = input.clone(); mPendingParams = mParams; setPendingWork(true); }
+    if (isWorkerBusy()) { mPendingFrame = input; mPendingParams = mParams; setPendingWork(true); }
     else {
         setWorkerBusy(true);
         ensure_frame_pool(input.cols, input.rows, input.type());
         long frameId = getNextFrameId(); QString producerId = getNodeId(); std::shared_ptr<CVImagePool> poolCopy = getFramePool();
-        QMetaObject::invokeMethod(mpWorker, "processFrame", Qt::QueuedConnection,
-                                  Q_ARG(cv::Mat, input.clone()),
-                                  Q_ARG(double, mParams.mdClipLimit),
-                                  Q_ARG(int, mParams.miTileSize),
-                                  Q_ARG(bool, mParams.mbApplyColorLuma),
-                                  Q_ARG(int, mParams.miColorSpaceIndex),
-                                  Q_ARG(bool, mParams.mbConvertTo8Bit),
-                                  Q_ARG(FrameSharingMode, getSharingMode()),
-                                  Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                                  Q_ARG(long, frameId),
-                                  Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(input)),
+                     WORKER_ARG(double, mParams.mdClipLimit),
+                     WORKER_ARG(int, mParams.miTileSize),
+                     WORKER_ARG(bool, mParams.mbApplyColorLuma),
+                     WORKER_ARG(int, mParams.miColorSpaceIndex),
+                     WORKER_ARG(bool, mParams.mbConvertTo8Bit),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 }
 
@@ -144,17 +144,16 @@ dispatchPendingWork()
     std::shared_ptr<CVImagePool> poolCopy = getFramePool();
 
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                              Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, input.clone()),
-                              Q_ARG(int, params.miThresholdL),
-                              Q_ARG(int, params.miThresholdU),
-                              Q_ARG(int, params.miSizeKernel),
-                              Q_ARG(bool, params.mbEnableGradient),
-                              Q_ARG(FrameSharingMode, getSharingMode()),
-                              Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                              Q_ARG(long, frameId),
-                              Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(input)),
+                 WORKER_ARG(int, params.miThresholdL),
+                 WORKER_ARG(int, params.miThresholdU),
+                 WORKER_ARG(int, params.miSizeKernel),
+                 WORKER_ARG(bool, params.mbEnableGradient),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 QJsonObject
@@ -311,7 +310,7 @@ void CVCannyEdgeModel::
     if (isWorkerBusy())
     {
         // Store as pending - will be processed when worker finishes
-        mPendingFrame = input.clone();
+        mPendingFrame = input;
         mPendingParams = mParams;
         setPendingWork(true);
     }
@@ -326,17 +325,16 @@ void CVCannyEdgeModel::
         
         std::shared_ptr<CVImagePool> poolCopy = getFramePool();
         
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                                  Qt::QueuedConnection,
-                                  Q_ARG(cv::Mat, input.clone()),
-                                  Q_ARG(int, mParams.miThresholdL),
-                                  Q_ARG(int, mParams.miThresholdU),
-                                  Q_ARG(int, mParams.miSizeKernel),
-                                  Q_ARG(bool, mParams.mbEnableGradient),
-                                  Q_ARG(FrameSharingMode, getSharingMode()),
-                                  Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                                  Q_ARG(long, frameId),
-                                  Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(input)),
+                     WORKER_ARG(int, mParams.miThresholdL),
+                     WORKER_ARG(int, mParams.miThresholdU),
+                     WORKER_ARG(int, mParams.miSizeKernel),
+                     WORKER_ARG(bool, mParams.mbEnableGradient),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 }
 
@@ -275,7 +275,7 @@ processData(const std::shared_ptr< CVImageData > &in, std::shared_ptr<CVImageDat
     cv::Mat& in_image = in->data();
     if(!in_image.empty() && (in_image.type()==CV_8UC1 || in_image.type()==CV_8UC3))
     {
-        cv::applyColorMap(in_image,out->data(),params.miCVColorMap);
+        cv::applyColorMap(in_image,out->overwrite(),params.miCVColorMap);
     }
 }
 
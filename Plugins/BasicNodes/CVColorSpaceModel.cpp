@@ -78,10 +78,9 @@ void CVColorSpaceModel::
     setPendingWork(false);
 
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                              Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, input.clone()),
-                              Q_ARG(CVColorSpaceParameters, params));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(input)),
+                 WORKER_ARG(CVColorSpaceParameters, params));
 }
 
 void CVColorSpaceModel::
@@ -101,17 +100,16 @@ void CVColorSpaceModel::
     if (isWorkerBusy())
     {
         // Store as pending - will be processed when worker finishes
-        mPendingFrame = input.clone();
+        mPendingFrame = input;
         mPendingParams = mParams;
         setPendingWork(true);
     }
     else
     {
         setWorkerBusy(true);
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                                  Qt::QueuedConnection,
-                                  Q_ARG(cv::Mat, input.clone()),
-                                  Q_ARG(CVColorSpaceParameters, mParams));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(input)),
+                     WORKER_ARG(CVColorSpaceParameters, mParams));
     }
 }
 
@@ -291,7 +291,7 @@ processData( const std::shared_ptr< CVImageData> & in, std::shared_ptr< CVImageD
     {
         return;
     }
-    cv::Mat& out_image = outImage->data();
+    cv::Mat& out_image = outImage->overwrite();
     cv::Mat Temp;
     outInt->data() = cv::connectedComponents(in_image,
                                                Temp,
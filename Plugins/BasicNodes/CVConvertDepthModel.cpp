@@ -234,7 +234,7 @@ processData( const std::shared_ptr< CVImageData> & in, std::shared_ptr<CVImageDa
 {
     if(!in->data().empty())
     {
-        in->data().convertTo(out->data(),
+        in->data().convertTo(out->overwrite(),
                                params.miImageDepth,
                                params.mdAlpha,
                                params.mdBeta);
@@ -431,7 +431,7 @@ processData( const std::shared_ptr<CVImageData> & in, std::shared_ptr<CVImageDat
              const CVCreateHistogramParameters & params )
 {
     cv::Mat& in_image = in->data();
-    cv::Mat& out_image = out->data();
+    cv::Mat& out_image = out->writable();
     if(in_image.empty() || (in_image.depth()!=CV_8U && in_image.depth()!=CV_16U && in_image.depth()!=CV_32F))
     {
         return;
@@ -258,7 +258,7 @@ processData(const std::shared_ptr< CVImageData > & in, std::shared_ptr<CVImageDa
     }
     cv::Mat Temp;
     cv::distanceTransform(in->data(),Temp,params.miOperationType,params.miMaskSize,CV_32F);
-    cv::convertScaleAbs(Temp,out->data());
+    cv::convertScaleAbs(Temp,out->overwrite());
 }
 
 QString
@@ -314,7 +314,7 @@ void CVDrawContourModel::processData(const std::shared_ptr<CVImageData> &in, std
     cv::Mat& in_image = in->data();
     if(in_image.empty())
         return;
-    cv::Mat& out_image = outImage->data();
+    cv::Mat& out_image = outImage->overwrite();
     in_image.copyTo( out_image );
     std::vector<std::vector<cv::Point>> vvPtContours = ctrPnts->data();
 
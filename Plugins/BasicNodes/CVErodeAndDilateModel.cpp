@@ -178,14 +178,13 @@ dispatchPendingWork()
     std::shared_ptr<CVImagePool> poolCopy = getFramePool();
 
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                              Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, input.clone()),
-                              Q_ARG(CVErodeAndDilateParameters, params),
-                              Q_ARG(FrameSharingMode, getSharingMode()),
-                              Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                              Q_ARG(long, frameId),
-                              Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(input)),
+                 WORKER_ARG(CVErodeAndDilateParameters, params),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 QJsonObject
@@ -449,7 +448,7 @@ void CVErodeAndDilateModel::process_cached_input()
 
     if (isWorkerBusy())
     {
-        mPendingFrame = input.clone();
+        mPendingFrame = input;
         mPendingParams = mParams;
         mPendingParams.miOperation = op;
         setPendingWork(true);
@@ -468,14 +467,13 @@ void CVErodeAndDilateModel::process_cached_input()
 
         CVErodeAndDilateParameters params = mParams;
         params.miOperation = op;
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                      Qt::QueuedConnection,
-                      Q_ARG(cv::Mat, input.clone()),
-                      Q_ARG(CVErodeAndDilateParameters, params),
-                      Q_ARG(FrameSharingMode, getSharingMode()),
-                      Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                      Q_ARG(long, frameId),
-                      Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(input)),
+                     WORKER_ARG(CVErodeAndDilateParameters, params),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 }
 
@@ -183,14 +183,13 @@ dispatchPendingWork()
     std::shared_ptr<CVImagePool> poolCopy = getFramePool();
 
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                              Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, input.clone()),
-                              Q_ARG(CVFilter2DParameters, params),
-                              Q_ARG(FrameSharingMode, getSharingMode()),
-                              Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                              Q_ARG(long, frameId),
-                              Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(input)),
+                 WORKER_ARG(CVFilter2DParameters, params),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 void
@@ -211,7 +210,7 @@ process_cached_input()
     if (isWorkerBusy())
     {
         // Store as pending - will be processed when worker finishes
-        mPendingFrame = input.clone();
+        mPendingFrame = input;
         mPendingParams = mParams;
         setPendingWork(true);
     }
@@ -225,14 +224,13 @@ process_cached_input()
         QString producerId = getNodeId();
         std::shared_ptr<CVImagePool> poolCopy = getFramePool();
 
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                                  Qt::QueuedConnection,
-                                  Q_ARG(cv::Mat, input.clone()),
-                                  Q_ARG(CVFilter2DParameters, mParams),
-                                  Q_ARG(FrameSharingMode, getSharingMode()),
-                                  Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                                  Q_ARG(long, frameId),
-                                  Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(input)),
+                     WORKER_ARG(CVFilter2DParameters, mParams),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 }
 
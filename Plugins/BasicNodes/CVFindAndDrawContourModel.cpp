@@ -376,7 +376,7 @@ void CVFindAndDrawContourModel::processData(const std::shared_ptr<CVImageData> &
         msg.exec();
         return;
     }
-    cv::Mat& out_image = outImage->data();
+    cv::Mat& out_image = outImage->overwrite();
     cv::Mat cvTemp = in_image.clone();
     std::vector<std::vector<cv::Point>> vvPtContours;
     std::vector<cv::Vec4i> vV4iHierarchy;
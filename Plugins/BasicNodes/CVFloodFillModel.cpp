@@ -246,15 +246,14 @@ dispatchPendingWork()
     std::shared_ptr<CVImagePool> poolCopy = getFramePool();
 
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                              Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, input.clone()),
-                              Q_ARG(cv::Mat, maskInput.empty() ? cv::Mat() : maskInput.clone()),
-                              Q_ARG(CVFloodFillParameters, params),
-                              Q_ARG(FrameSharingMode, getSharingMode()),
-                              Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                              Q_ARG(long, frameId),
-                              Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(input)),
+                 WORKER_ARG(cv::Mat, workerInput(maskInput)),
+                 WORKER_ARG(CVFloodFillParameters, params),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 unsigned int
@@ -339,7 +338,7 @@ setInData(std::shared_ptr<NodeData> nodeData, PortIndex portIndex)
                 }
                 
                 if (!isShuttingDown())
-                    process_cached_input();
+                    admit_input();
             }
         }
         else if (portIndex == 1)
@@ -402,8 +401,6 @@ void
 CVFloodFillModel::
 customHandleFrameReady(std::shared_ptr<CVImageData> img, std::shared_ptr<CVImageData> mask)
 {
-    setWorkerBusy(false);
-    
     if (img)
     {
         mapCVImageData[0] = img;
@@ -423,11 +420,8 @@ customHandleFrameReady(std::shared_ptr<CVImageData> img, std::shared_ptr<CVImage
         emitOutputPort(2);
     }
     
-    // Process pending work if available
-    if (hasPendingWork())
-    {
-        dispatchPendingWork();
-    }
+    // Process queued or pending work if available
+    onWorkCompleted();
 }
 
 QJsonObject
@@ -703,9 +697,9 @@ process_cached_input()
     if (isWorkerBusy())
     {
         // Store as pending - will be processed when worker finishes
-        mPendingFrame = input.clone();
+        mPendingFrame = input;
         if (!maskInput.empty())
-            mPendingMask = maskInput.clone();
+            mPendingMask = maskInput;
         else
             mPendingMask = cv::Mat();
         mPendingParams = mParams;
@@ -735,15 +729,14 @@ process_cached_input()
             upperDiff = cv::Scalar(mParams.mucUpperDiff[0], mParams.mucUpperDiff[1], mParams.mucUpperDiff[2]);
         }
         
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                                  Qt::QueuedConnection,
-                                  Q_ARG(cv::Mat, input.clone()),
-                                  Q_ARG(cv::Mat, maskInput.empty() ? cv::Mat() : maskInput.clone()),
-                                  Q_ARG(CVFloodFillParameters, mParams),
-                                  Q_ARG(FrameSharingMode, getSharingMode()),
-                                  Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                                  Q_ARG(long, frameId),
-                                  Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(input)),
+                     WORKER_ARG(cv::Mat, workerInput(maskInput)),
+                     WORKER_ARG(CVFloodFillParameters, mParams),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 }
 
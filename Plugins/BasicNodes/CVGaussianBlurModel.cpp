@@ -149,14 +149,13 @@ dispatchPendingWork()
     std::shared_ptr<CVImagePool> poolCopy = getFramePool();
     
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-        Qt::QueuedConnection,
-        Q_ARG(cv::Mat, input.clone()),
-        Q_ARG(CVGaussianBlurParameters, params),
-        Q_ARG(FrameSharingMode, getSharingMode()),
-        Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-        Q_ARG(long, frameId),
-        Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(input)),
+                 WORKER_ARG(CVGaussianBlurParameters, params),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 QJsonObject
@@ -335,7 +334,7 @@ process_cached_input()
     
     if(isWorkerBusy())
     {
-        mPendingFrame = input.clone();
+        mPendingFrame = input;
         mPendingParams = mParams;
         setPendingWork(true);
     }
@@ -350,14 +349,13 @@ process_cached_input()
         
         std::shared_ptr<CVImagePool> poolCopy = getFramePool();
         
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-            Qt::QueuedConnection,
-            Q_ARG(cv::Mat, input.clone()),
-            Q_ARG(CVGaussianBlurParameters, mParams),
-            Q_ARG(FrameSharingMode, getSharingMode()),
-            Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-            Q_ARG(long, frameId),
-            Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(input)),
+                     WORKER_ARG(CVGaussianBlurParameters, mParams),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 }
 
@@ -183,15 +183,15 @@ void CVHistogramEqualizationModel::dispatchPendingWork()
     QString producerId = getNodeId();
     std::shared_ptr<CVImagePool> poolCopy = getFramePool();
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame", Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, input.clone()),
-                              Q_ARG(bool, params.mbApplyColorLuma),
-                              Q_ARG(int, params.miColorSpaceIndex),
-                              Q_ARG(bool, params.mbConvertTo8Bit),
-                              Q_ARG(FrameSharingMode, getSharingMode()),
-                              Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                              Q_ARG(long, frameId),
-                              Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(input)),
+                 WORKER_ARG(bool, params.mbApplyColorLuma),
+                 WORKER_ARG(int, params.miColorSpaceIndex),
+                 WORKER_ARG(bool, params.mbConvertTo8Bit),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 QJsonObject CVHistogramEqualizationModel::save() const
@@ -281,7 +281,7 @@ void CVHistogramEqualizationModel::process_cached_input()
                        { mpSyncData->data() = false; emitOutputPort(1); });
     if (isWorkerBusy())
     {
-        mPendingFrame = input.clone();
+        mPendingFrame = input;
         mPendingParams = mParams;
         setPendingWork(true);
     }
@@ -292,15 +292,15 @@ void CVHistogramEqualizationModel::process_cached_input()
         long frameId = getNextFrameId();
         QString producerId = getNodeId();
         std::shared_ptr<CVImagePool> poolCopy = getFramePool();
-        QMetaObject::invokeMethod(mpWorker, "processFrame", Qt::QueuedConnection,
-                                  Q_ARG(cv::Mat, input.clone()),
-                                  Q_ARG(bool, mParams.mbApplyColorLuma),
-                                  Q_ARG(int, mParams.miColorSpaceIndex),
-                                  Q_ARG(bool, mParams.mbConvertTo8Bit),
-                                  Q_ARG(FrameSharingMode, getSharingMode()),
-                                  Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                                  Q_ARG(long, frameId),
-                                  Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(input)),
+                     WORKER_ARG(bool, mParams.mbApplyColorLuma),
+                     WORKER_ARG(int, mParams.miColorSpaceIndex),
+                     WORKER_ARG(bool, mParams.mbConvertTo8Bit),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 }
 
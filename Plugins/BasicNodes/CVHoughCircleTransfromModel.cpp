@@ -64,7 +64,7 @@ void CVHoughCircleTransformWorker::
     
     if (mode == FrameSharingMode::PoolMode && pool)
     {
-        auto handle = pool->acquire(3, metadata); // 3 channels for BGR
+        auto handle = pool->acquire(1, metadata);
         if (handle)
         {
             cv::cvtColor(input, handle.matrix(), cv::COLOR_GRAY2BGR);
@@ -272,8 +272,7 @@ connectWorker(QObject* worker)
                     mpSyncData->data() = true;
                     emitOutputPort(2);
                     
-                    setWorkerBusy(false);
-                    dispatchPendingWork();
+                    onWorkCompleted();
                 },
                 Qt::QueuedConnection);
     }
@@ -350,14 +349,13 @@ dispatchPendingWork()
     std::shared_ptr<CVImagePool> poolCopy = getFramePool();
 
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                              Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, input.clone()),
-                              Q_ARG(CVHoughCircleTransformParameters, params),
-                              Q_ARG(FrameSharingMode, getSharingMode()),
-                              Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                              Q_ARG(long, frameId),
-                              Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(input)),
+                 WORKER_ARG(CVHoughCircleTransformParameters, params),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 QJsonObject
@@ -710,7 +708,7 @@ void CVHoughCircleTransformModel::
     if (isWorkerBusy())
     {
         // Store as pending - will be processed when worker finishes
-        mPendingFrame = input.clone();
+        mPendingFrame = input;
         mPendingParams = mParams;
         setPendingWork(true);
     }
@@ -726,14 +724,13 @@ void CVHoughCircleTransformModel::
         std::shared_ptr<CVImagePool> poolCopy = getFramePool();
         
         CVHoughCircleTransformParameters params = mParams;
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                      Qt::QueuedConnection,
-                      Q_ARG(cv::Mat, input.clone()),
-                      Q_ARG(CVHoughCircleTransformParameters, params),
-                      Q_ARG(FrameSharingMode, getSharingMode()),
-                      Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                      Q_ARG(long, frameId),
-                      Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(input)),
+                     WORKER_ARG(CVHoughCircleTransformParameters, params),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 }
 
@@ -56,7 +56,7 @@ void CVHoughLinesWorker::
     
     if (mode == FrameSharingMode::PoolMode && pool)
     {
-        auto handle = pool->acquire(3, metadata); // 3 channels for BGR
+        auto handle = pool->acquire(1, metadata);
         if (handle)
         {
             cv::cvtColor(input, handle.matrix(), cv::COLOR_GRAY2BGR);
@@ -218,8 +218,7 @@ connectWorker(QObject* worker)
                     mpSyncData->data() = true;
                     emitOutputPort(2); // sync
                     
-                    setWorkerBusy(false);
-                    dispatchPendingWork();
+                    onWorkCompleted();
                 },
                 Qt::QueuedConnection);
     }
@@ -296,14 +295,13 @@ dispatchPendingWork()
     std::shared_ptr<CVImagePool> poolCopy = getFramePool();
 
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                              Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, input.clone()),
-                              Q_ARG(CVHoughLinesParameters, params),
-                              Q_ARG(FrameSharingMode, getSharingMode()),
-                              Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                              Q_ARG(long, frameId),
-                              Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(input)),
+                 WORKER_ARG(CVHoughLinesParameters, params),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 QJsonObject
@@ -495,7 +493,7 @@ process_cached_input()
     
     if (isWorkerBusy())
     {
-        mPendingFrame = input.clone();
+        mPendingFrame = input;
         mPendingParams = mParams;
         setPendingWork(true);
     }
@@ -511,14 +509,13 @@ process_cached_input()
         std::shared_ptr<CVImagePool> poolCopy = getFramePool();
         
         CVHoughLinesParameters params = mParams;
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                                  Qt::QueuedConnection,
-                                  Q_ARG(cv::Mat, input.clone()),
-                                  Q_ARG(CVHoughLinesParameters, params),
-                                  Q_ARG(FrameSharingMode, getSharingMode()),
-                                  Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                                  Q_ARG(long, frameId),
-                                  Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(input)),
+                     WORKER_ARG(CVHoughLinesParameters, params),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 }
 
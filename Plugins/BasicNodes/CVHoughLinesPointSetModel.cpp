@@ -83,7 +83,7 @@ void CVHoughLinesPointSetWorker::processFrame(cv::Mat input,
     bool pooled = false;
     if (mode == FrameSharingMode::PoolMode && pool)
     {
-        auto handle = pool->acquire(3, metadata); // 3 channel BGR
+        auto handle = pool->acquire(1, metadata);
         if (handle)
         {
             cv::cvtColor(gray, handle.matrix(), cv::COLOR_GRAY2BGR);
@@ -556,7 +556,7 @@ void CVHoughLinesPointSetModel::connectWorker(QObject *worker)
     if (w)
     {
         connect(w, &CVHoughLinesPointSetWorker::frameReady, this, [this](std::shared_ptr<CVImageData> img, std::shared_ptr<IntegerData> count)
-                { mpCVImageData=img; mpIntegerData=count; emitOutputPort(0); emitOutputPort(1); mpSyncData->data()=true; emitOutputPort(2); setWorkerBusy(false); dispatchPendingWork(); }, Qt::QueuedConnection);
+                { mpCVImageData=img; mpIntegerData=count; emitOutputPort(0); emitOutputPort(1); mpSyncData->data()=true; emitOutputPort(2); onWorkCompleted(); }, Qt::QueuedConnection);
     }
 }
 
@@ -573,13 +573,13 @@ void CVHoughLinesPointSetModel::dispatchPendingWork()
     double minTheta = params.mdMinThetaDeg * CV_PI / 180.0;
     double maxTheta = params.mdMaxThetaDeg * CV_PI / 180.0;
     double thetaStep = params.mdThetaStepDeg * CV_PI / 180.0;
-    QMetaObject::invokeMethod(mpWorker, "processFrame", Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, input),
-                              Q_ARG(CVHoughLinesPointSetParams, params),
-                              Q_ARG(FrameSharingMode, getSharingMode()),
-                              Q_ARG(std::shared_ptr<CVImagePool>, getFramePool()),
-                              Q_ARG(long, frameId),
-                              Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, input),
+                 WORKER_ARG(CVHoughLinesPointSetParams, params),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, getFramePool()),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
     setWorkerBusy(true);
 }
 
@@ -587,14 +587,13 @@ void CVHoughLinesPointSetModel::process_cached_input()
 {
     if (!mpCVImageInData)
         return;
-    mPendingFrame = mpCVImageInData->data().clone();
+    mPendingFrame = mpCVImageInData->data();
     mPendingParams = mParams;
     if (!mpWorker)
     {
-        mpWorker = createWorker();
-        mpWorker->moveToThread(&mWorkerThread);
-        mWorkerThread.start();
-        connectWorker(mpWorker);
+        QObject *worker = createWorker();
+        connectWorker(worker);
+        bindWorker(worker);
     }
     if (hasPendingWork() || isWorkerBusy())
     {
@@ -24,6 +24,7 @@
 
 #include "CVImageData.hpp"
 #include "NodeDataSerializer.hpp"
+#include "qtvariantproperty_p.h"
 
 const QString CVImageDisplayModel::_category = QString( "Output" );
 
@@ -35,7 +36,6 @@ CVImageDisplayModel()
       mpEmbeddedWidget( new PBImageDisplayWidget(qobject_cast<QWidget *>(this)) ),
     _minPixmap(":/ImageDisplay.png")
 {
-    mpEmbeddedWidget->installEventFilter( this );
     mpEmbeddedWidget->resize(640, 480);
 
     // Make the minimize property read-only for display nodes
@@ -62,6 +62,23 @@ CVImageDisplayModel()
     auto propFormat = std::make_shared< TypedProperty< QString > >( "Format", propId, QMetaType::QString, "", "", true );
     mvProperty.push_back( propFormat );
     mMapIdToProperty[ propId ] = propFormat;
+
+    IntPropertyType intPropertyType;
+    intPropertyType.miValue = mpEmbeddedWidget->maxPreviewFps();
+    intPropertyType.miMin = 0;
+    intPropertyType.miMax = 240;
+    propId = "preview_max_fps";
+    auto propMaxFps = std::make_shared< TypedProperty< IntPropertyType > >( "Max Preview FPS", propId, QMetaType::Int, intPropertyType, "Display" );
+    mvProperty.push_back( propMaxFps );
+    mMapIdToProperty[ propId ] = propMaxFps;
+
+    EnumPropertyType enumPropertyType;
+    enumPropertyType.mslEnumNames = QStringList( { "Widget", "Half", "Quarter" } );
+    enumPropertyType.miCurrentIndex = static_cast< int >( mpEmbeddedWidget->previewResolution() );
+    propId = "preview_resolution";
+    auto propResolution = std::make_shared< TypedProperty< EnumPropertyType > >( "Preview Resolution", propId, QtVariantPropertyManager::enumTypeId(), enumPropertyType, "Display" );
+    mvProperty.push_back( propResolution );
+    mMapIdToProperty[ propId ] = propResolution;
 }
 
 CVImageDisplayModel::
@@ -91,18 +108,80 @@ nPorts(PortType portType) const
         return 0;
 }
 
-bool
+PBNodeDelegateModel::SinkState
+CVImageDisplayModel::
+sinkState() const
+{
+    if( isHeadlessMode() || isMinimize() )
+        return SinkState::Idle;
+    return SinkState::Active;
+}
+
+QJsonObject
 CVImageDisplayModel::
-eventFilter(QObject *object, QEvent *event)
+save() const
 {
-    if( object == mpEmbeddedWidget )
+    QJsonObject modelJson = PBNodeDelegateModel::save();
+
+    QJsonObject cParams;
+    cParams[ "preview_max_fps" ] = mpEmbeddedWidget->maxPreviewFps();
+    cParams[ "preview_resolution" ] = static_cast< int >( mpEmbeddedWidget->previewResolution() );
+    modelJson[ "cParams" ] = cParams;
+
+    return modelJson;
+}
+
+void
+CVImageDisplayModel::
+load(const QJsonObject &p)
+{
+    PBNodeDelegateModel::load(p);
+
+    QJsonObject paramsObj = p[ "cParams" ].toObject();
+    if( !paramsObj.isEmpty() )
     {
-        if( event->type() == QEvent::Resize )
-            display_image();
+        QJsonValue v = paramsObj[ "preview_max_fps" ];
+        if( !v.isNull() )
+        {
+            auto prop = mMapIdToProperty[ "preview_max_fps" ];
+            auto typedProp = std::static_pointer_cast< TypedProperty< IntPropertyType > >( prop );
+            typedProp->getData().miValue = qBound( 0, v.toInt(), 240 );
+            mpEmbeddedWidget->setMaxPreviewFps( typedProp->getData().miValue );
+        }
+        v = paramsObj[ "preview_resolution" ];
+        if( !v.isNull() )
+        {
+            auto prop = mMapIdToProperty[ "preview_resolution" ];
+            auto typedProp = std::static_pointer_cast< TypedProperty< EnumPropertyType > >( prop );
+            typedProp->getData().miCurrentIndex = qBound( 0, v.toInt(), 2 );
+            mpEmbeddedWidget->setPreviewResolution( static_cast< PBImageDisplayWidget::PreviewResolution >( typedProp->getData().miCurrentIndex ) );
+        }
     }
-    return false;
 }
 
+void
+CVImageDisplayModel::
+setModelProperty( QString & id, const QVariant & value )
+{
+    PBNodeDelegateModel::setModelProperty( id, value );
+
+    if( !mMapIdToProperty.contains( id ) )
+        return;
+
+    auto prop = mMapIdToProperty[ id ];
+    if( id == "preview_max_fps" )
+    {
+        auto typedProp = std::static_pointer_cast< TypedProperty< IntPropertyType > >( prop );
+        typedProp->getData().miValue = qBound( 0, value.toInt(), 240 );
+        mpEmbeddedWidget->setMaxPreviewFps( typedProp->getData().miValue );
+    }
+    else if( id == "preview_resolution" )
+    {
+        auto typedProp = std::static_pointer_cast< TypedProperty< EnumPropertyType > >( prop );
+        typedProp->getData().miCurrentIndex = qBound( 0, value.toInt(), 2 );
+        mpEmbeddedWidget->setPreviewResolution( static_cast< PBImageDisplayWidget::PreviewResolution >( typedProp->getData().miCurrentIndex ) );
+    }
+}
 
 NodeDataType
 CVImageDisplayModel::
@@ -149,9 +228,11 @@ updateDisplayFromFrame(const cv::Mat& frame, bool emitSyncSignal)
     mpSyncData->data() = false;
 
     // Consumer: read-only access to the pooled or owned frame.
-    // Copy only when displaying to avoid holding the pool slot.
-    frame.copyTo(mCVImageDisplay);
-    display_image();
+    // The widget holds it only until its downscaled preview is rendered.
+    // Headless runs have nothing to display; only the sync output is kept.
+    if (!isHeadlessMode()) {
+        display_image(frame);
+    }
 
     mpSyncData->data() = true;
     if (emitSyncSignal) {
@@ -161,19 +242,19 @@ updateDisplayFromFrame(const cv::Mat& frame, bool emitSyncSignal)
 
 void
 CVImageDisplayModel::
-display_image()
+display_image( const cv::Mat& frame )
 {
     // Don't try to display when node is minimized - the widget may not be visible
     // Also check if the widget itself is valid and visible
     if (isMinimize() || !mpEmbeddedWidget || !mpEmbeddedWidget->isVisible())
         return;
     
-    mpEmbeddedWidget->Display( mCVImageDisplay );
+    mpEmbeddedWidget->Display( frame );
 
-    if( mCVImageDisplay.cols != miImageWidth || mCVImageDisplay.rows != miImageHeight )
+    if( frame.cols != miImageWidth || frame.rows != miImageHeight )
     {
-        miImageWidth = mCVImageDisplay.cols;
-        miImageHeight = mCVImageDisplay.rows;
+        miImageWidth = frame.cols;
+        miImageHeight = frame.rows;
 
         // Update the widget size to match the new image aspect ratio
         if (mpEmbeddedWidget && miImageWidth > 0 && miImageHeight > 0)
@@ -198,13 +279,13 @@ display_image()
         Q_EMIT property_changed_signal( prop );
     }
 
-    if( mCVImageDisplay.channels() != miImageFormat )
+    if( frame.channels() != miImageFormat )
     {
-        miImageFormat = mCVImageDisplay.channels();
+        miImageFormat = frame.channels();
 
         auto prop = mMapIdToProperty[ "image_format" ];
         auto typedPropFormat = std::static_pointer_cast<TypedProperty<QString>>( prop );
-        if( mCVImageDisplay.channels() == 1 )
+        if( frame.channels() == 1 )
             typedPropFormat->getData() = "CV_8UC1";
         else
             typedPropFormat->getData() = "CV_8UC3";
@@ -42,7 +42,8 @@ using QtNodes::NodeValidationState;
  * 
  * This model provides functionality to receive and display images from
  * the data flow graph. Key features include:
- * - Real-time image display with automatic conversion from cv::Mat to QPixmap
+ * - Real-time preview downscaled to the widget on a worker thread, rendered and
+ *   painted at most "Max Preview FPS" times a second at the chosen "Preview Resolution"
  * - Resizable display window with aspect ratio preservation
  * - Support for various image formats (grayscale, RGB, BGR, etc.)
  * - Optional synchronization signal input for frame-controlled display
@@ -127,9 +128,8 @@ public:
      * 
      * When image data arrives on port 0, this method:
      * 1. Extracts the cv::Mat from CVImageData
-     * 2. Converts the image format if necessary (BGR to RGB)
-     * 3. Creates a QPixmap for display
-     * 4. Updates the embedded widget
+     * 2. Hands it to the embedded widget, which renders the preview asynchronously
+     * 3. Updates the size and format properties
      * 
      * Port 1 receives optional synchronization signals to control
      * when the display updates (useful for frame-by-frame inspection).
@@ -153,21 +153,28 @@ public:
     QPixmap
     minPixmap() const override{ return _minPixmap; }
 
-     /**
-     * @brief Event filter for capturing widget events
-     * 
-     * Intercepts events from the embedded widget, particularly mouse events,
-     * to enable interactive features like:
-     * - Pixel value inspection on mouse hover
-     * - Region selection for zooming
-     * - Click-to-measure functionality
-     * 
-     * @param object The object that generated the event
-     * @param event The event to process
-     * @return true if the event was handled, false to pass it along
+    /**
+     * @brief Active while the preview can be seen, Idle when minimized or headless.
+     *
+     * In Pull evaluation an idle display does not keep its upstream branch computing.
      */
-    bool
-    eventFilter(QObject *object, QEvent *event) override;
+    SinkState
+    sinkState() const override;
+
+    /**
+     * @brief Saves the preview settings in cParams.
+     */
+    QJsonObject
+    save() const override;
+
+    void
+    load(QJsonObject const &p) override;
+
+    /**
+     * @brief Applies "preview_max_fps" and "preview_resolution" to the widget.
+     */
+    void
+    setModelProperty( QString &, const QVariant & ) override;
 
     /** @brief Category name for node organization */
     static const QString _category;
@@ -181,21 +188,15 @@ private:
     /**
      * @brief Internal helper to update the displayed image
      * 
-     * Performs the actual image conversion and widget update:
-     * 1. Converts cv::Mat to QImage (handling color space conversion)
-     * 2. Creates QPixmap from QImage
-     * 3. Updates the widget's pixmap
-     * 4. Triggers widget repaint
+     * Passes the frame to the widget without copying it and keeps the
+     * node's size and format properties in step with it.
      * 
      * @note This method handles various image formats (CV_8UC1, CV_8UC3, CV_8UC4)
      */
-    void display_image( );
+    void display_image( const cv::Mat& frame );
 
     /** @brief Pointer to the embedded display widget */
     PBImageDisplayWidget * mpEmbeddedWidget;
-
-    /** @brief OpenCV image buffer for the current displayed image */
-    cv::Mat mCVImageDisplay;
     
     /** @brief Cached pixmap for efficient rendering */
     QPixmap _minPixmap;
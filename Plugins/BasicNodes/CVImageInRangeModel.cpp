@@ -274,7 +274,7 @@ processData(const std::shared_ptr< CVImageData > & in, std::shared_ptr<CVImageDa
         {
             return;
         }
-        outInt->data() = cv::threshold(in_image,outImage->data(),params.mdThresholdValue,params.mdBinaryValue,params.miThresholdType);
+        outInt->data() = cv::threshold(in_image,outImage->overwrite(),params.mdThresholdValue,params.mdBinaryValue,params.miThresholdType);
     }
     else
     {
@@ -282,13 +282,13 @@ processData(const std::shared_ptr< CVImageData > & in, std::shared_ptr<CVImageDa
         {
             return;
         }
-        cv::threshold(in_image,outImage->data(),params.mdThresholdValue,params.mdBinaryValue,params.miThresholdType);
+        cv::threshold(in_image,outImage->overwrite(),params.mdThresholdValue,params.mdBinaryValue,params.miThresholdType);
         outInt->data() = 0;
     }
     */
     if( in_image.empty() )
         return;
-    cv::inRange(in_image, cv::Scalar(0,0,0), cv::Scalar(180,255,110), outImage->data());
+    cv::inRange(in_image, cv::Scalar(0,0,0), cv::Scalar(180,255,110), outImage->overwrite());
     outInt->data() = 0;
 }
 
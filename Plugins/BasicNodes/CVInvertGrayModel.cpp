@@ -51,9 +51,8 @@ void CVInvertGrayModel::dispatchPendingWork()
     setPendingWork(false);
 
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                            Qt::QueuedConnection,
-                            Q_ARG(cv::Mat, input.clone()));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(input)));
 }
 
 void CVInvertGrayModel::process_cached_input()
@@ -75,15 +74,14 @@ void CVInvertGrayModel::process_cached_input()
     if (isWorkerBusy())
     {
         // Store as pending - will be processed when worker finishes
-        mPendingFrame = input.clone();
+        mPendingFrame = input;
         setPendingWork(true);
     }
     else
     {
         setWorkerBusy(true);
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                                Qt::QueuedConnection,
-                                Q_ARG(cv::Mat, input.clone()));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(input)));
     }
 }
 
@@ -361,7 +361,7 @@ processData(const std::shared_ptr< CVImageData > & in, std::shared_ptr<CVImageDa
     {
         return;
     }
-    cv::Mat& out_image = out->data();
+    cv::Mat& out_image = out->overwrite();
 
     cv::copyMakeBorder(in_image,
                        out_image,
@@ -112,7 +112,6 @@ setInData(std::shared_ptr<NodeData> nodeData, PortIndex)
         if( d )
         {
             mpIntegerData->data() = cv::sum( d->data() )[0];
-            mpIntegerData->set_information();
             emitOutputPort(0);
         }
     }
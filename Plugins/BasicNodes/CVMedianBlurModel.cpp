@@ -194,14 +194,13 @@ void CVMedianBlurModel::dispatchPendingWork()
 
         setWorkerBusy(true);
 
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                                 Qt::QueuedConnection,
-                                 Q_ARG(cv::Mat, mPendingFrame),
-                                 Q_ARG(CVMedianBlurParameters, mPendingParams),
-                                 Q_ARG(FrameSharingMode, getSharingMode()),
-                                 Q_ARG(std::shared_ptr<CVImagePool>, pool),
-                                 Q_ARG(long, frameId),
-                                 Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, mPendingFrame),
+                     WORKER_ARG(CVMedianBlurParameters, mPendingParams),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, pool),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
 
         mPendingFrame = cv::Mat(); // Clear pending
     }
@@ -215,7 +214,7 @@ void CVMedianBlurModel::process_cached_input()
 
     if (isWorkerBusy()) {
         // Store pending frame
-        mPendingFrame = mpCVImageInData->data().clone();
+        mPendingFrame = mpCVImageInData->data();
         mPendingParams = mParams;
         setPendingWork(true);
         return;
@@ -231,14 +230,13 @@ void CVMedianBlurModel::process_cached_input()
 
     setWorkerBusy(true);
 
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                             Qt::QueuedConnection,
-                             Q_ARG(cv::Mat, input),
-                             Q_ARG(CVMedianBlurParameters, mParams),
-                             Q_ARG(FrameSharingMode, getSharingMode()),
-                             Q_ARG(std::shared_ptr<CVImagePool>, pool),
-                             Q_ARG(long, frameId),
-                             Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, input),
+                 WORKER_ARG(CVMedianBlurParameters, mParams),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, pool),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 QString
@@ -131,16 +131,15 @@ void CVNormalizationModel::dispatchPendingWork()
     std::shared_ptr<CVImagePool> poolCopy = getFramePool();
 
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                              Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, frame.clone()),
-                              Q_ARG(double, params.mdRangeMin),
-                              Q_ARG(double, params.mdRangeMax),
-                              Q_ARG(int, params.miNormType),
-                              Q_ARG(FrameSharingMode, getSharingMode()),
-                              Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                              Q_ARG(long, frameId),
-                              Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(frame)),
+                 WORKER_ARG(double, params.mdRangeMin),
+                 WORKER_ARG(double, params.mdRangeMax),
+                 WORKER_ARG(int, params.miNormType),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 void CVNormalizationModel::process_cached_input()
@@ -158,7 +157,7 @@ void CVNormalizationModel::process_cached_input()
 
     if (isWorkerBusy())
     {
-        mPendingFrame = frame.clone();
+        mPendingFrame = frame;
         mPendingParams = mParams;
         setPendingWork(true);
     }
@@ -172,16 +171,15 @@ void CVNormalizationModel::process_cached_input()
         QString producerId = getNodeId();
         std::shared_ptr<CVImagePool> poolCopy = getFramePool();
 
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                                  Qt::QueuedConnection,
-                                  Q_ARG(cv::Mat, frame.clone()),
-                                  Q_ARG(double, mParams.mdRangeMin),
-                                  Q_ARG(double, mParams.mdRangeMax),
-                                  Q_ARG(int, mParams.miNormType),
-                                  Q_ARG(FrameSharingMode, getSharingMode()),
-                                  Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                                  Q_ARG(long, frameId),
-                                  Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(frame)),
+                     WORKER_ARG(double, mParams.mdRangeMin),
+                     WORKER_ARG(double, mParams.mdRangeMax),
+                     WORKER_ARG(int, mParams.miNormType),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 }
 
@@ -247,15 +247,14 @@ void CVOpticalFlowFarnebackModel::dispatchPendingWork()
     std::shared_ptr<CVImagePool> poolCopy = getFramePool();
 
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                              Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, currentFrame.clone()),
-                              Q_ARG(cv::Mat, previousFrame.clone()),
-                              Q_ARG(CVOpticalFlowFarnebackParameters, params),
-                              Q_ARG(FrameSharingMode, getSharingMode()),
-                              Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                              Q_ARG(long, frameId),
-                              Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(currentFrame)),
+                 WORKER_ARG(cv::Mat, workerInput(previousFrame)),
+                 WORKER_ARG(CVOpticalFlowFarnebackParameters, params),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 void CVOpticalFlowFarnebackModel::process_cached_input()
@@ -283,8 +282,8 @@ void CVOpticalFlowFarnebackModel::process_cached_input()
     if (isWorkerBusy())
     {
         // Store as pending - will be processed when worker finishes
-        mPendingCurrentFrame = currentFrame.clone();
-        mPendingPreviousFrame = mPreviousFrame.clone();
+        mPendingCurrentFrame = currentFrame;
+        mPendingPreviousFrame = mPreviousFrame;
         mPendingParams = mParams;
         setPendingWork(true);
     }
@@ -301,15 +300,14 @@ void CVOpticalFlowFarnebackModel::process_cached_input()
 
         
         CVOpticalFlowFarnebackParameters params = mParams;
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                      Qt::QueuedConnection,
-                      Q_ARG(cv::Mat, currentFrame.clone()),
-                      Q_ARG(cv::Mat, mPreviousFrame.clone()),
-                      Q_ARG(CVOpticalFlowFarnebackParameters, params),
-                      Q_ARG(FrameSharingMode, getSharingMode()),
-                      Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                      Q_ARG(long, frameId),
-                      Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(currentFrame)),
+                     WORKER_ARG(cv::Mat, workerInput(mPreviousFrame)),
+                     WORKER_ARG(CVOpticalFlowFarnebackParameters, params),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 
     // Store current as previous for next iteration
@@ -382,15 +382,14 @@ void CVOpticalFlowPyrLKModel::dispatchPendingWork()
     std::shared_ptr<CVImagePool> poolCopy = getFramePool();
 
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-                              Qt::QueuedConnection,
-                              Q_ARG(cv::Mat, currentFrame.clone()),
-                              Q_ARG(cv::Mat, previousFrame.clone()),
-                              Q_ARG(CVOpticalFlowPyrLKParameters, params),
-                              Q_ARG(FrameSharingMode, getSharingMode()),
-                              Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                              Q_ARG(long, frameId),
-                              Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(currentFrame)),
+                 WORKER_ARG(cv::Mat, workerInput(previousFrame)),
+                 WORKER_ARG(CVOpticalFlowPyrLKParameters, params),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 void CVOpticalFlowPyrLKModel::process_cached_input()
@@ -415,8 +414,8 @@ void CVOpticalFlowPyrLKModel::process_cached_input()
 
     if (isWorkerBusy())
     {
-        mPendingCurrentFrame = currentFrame.clone();
-        mPendingPreviousFrame = mPreviousFrame.clone();
+        mPendingCurrentFrame = currentFrame;
+        mPendingPreviousFrame = mPreviousFrame;
         mPendingParams = mParams;
         setPendingWork(true);
     }
@@ -431,15 +430,14 @@ void CVOpticalFlowPyrLKModel::process_cached_input()
         std::shared_ptr<CVImagePool> poolCopy = getFramePool();
 
         CVOpticalFlowPyrLKParameters params = mParams;
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-                      Qt::QueuedConnection,
-                      Q_ARG(cv::Mat, currentFrame.clone()),
-                      Q_ARG(cv::Mat, mPreviousFrame.clone()),
-                      Q_ARG(CVOpticalFlowPyrLKParameters, params),
-                      Q_ARG(FrameSharingMode, getSharingMode()),
-                      Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-                      Q_ARG(long, frameId),
-                      Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(currentFrame)),
+                     WORKER_ARG(cv::Mat, workerInput(mPreviousFrame)),
+                     WORKER_ARG(CVOpticalFlowPyrLKParameters, params),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 
     // Store current as previous for next iteration
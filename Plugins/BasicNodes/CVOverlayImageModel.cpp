@@ -259,7 +259,7 @@ processData(const std::vector< cv::Mat >&in, std::shared_ptr<CVImageData> &out)
     }
 
     // Copy result to output
-    result.copyTo( out->data() );
+    result.copyTo( out->overwrite() );
 }
 
 void
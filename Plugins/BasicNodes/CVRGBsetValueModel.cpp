@@ -203,7 +203,7 @@ void CVRGBsetValueModel::setModelProperty(QString &id, const QVariant & value)
 
 void CVRGBsetValueModel::processData(std::shared_ptr<CVImageData> &out, const CVRGBsetValueProperties &props)
 {
-    cv::Mat& out_image = out->data();
+    cv::Mat& out_image = out->writable();
     if(out_image.empty() || out_image.type()!=CV_8UC3)
     {
         return;
@@ -116,13 +116,12 @@ dispatchPendingWork()
     std::shared_ptr<CVImagePool> poolCopy = getFramePool();
     
     setWorkerBusy(true);
-    QMetaObject::invokeMethod(mpWorker, "processFrame",
-        Qt::QueuedConnection,
-        Q_ARG(cv::Mat, input.clone()),
-        Q_ARG(FrameSharingMode, getSharingMode()),
-        Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-        Q_ARG(long, frameId),
-        Q_ARG(QString, producerId));
+    invokeWorker("processFrame",
+                 WORKER_ARG(cv::Mat, workerInput(input)),
+                 WORKER_ARG(FrameSharingMode, getSharingMode()),
+                 WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                 WORKER_ARG(long, frameId),
+                 WORKER_ARG(QString, producerId));
 }
 
 void
@@ -142,7 +141,7 @@ process_cached_input()
     
     if(isWorkerBusy())
     {
-        mPendingFrame = input.clone();
+        mPendingFrame = input;
         setPendingWork(true);
     }
     else
@@ -156,13 +155,12 @@ process_cached_input()
         
         std::shared_ptr<CVImagePool> poolCopy = getFramePool();
         
-        QMetaObject::invokeMethod(mpWorker, "processFrame",
-            Qt::QueuedConnection,
-            Q_ARG(cv::Mat, input.clone()),
-            Q_ARG(FrameSharingMode, getSharingMode()),
-            Q_ARG(std::shared_ptr<CVImagePool>, poolCopy),
-            Q_ARG(long, frameId),
-            Q_ARG(QString, producerId));
+        invokeWorker("processFrame",
+                     WORKER_ARG(cv::Mat, workerInput(input)),
+                     WORKER_ARG(FrameSharingMode, getSharingMode()),
+                     WORKER_ARG(std::shared_ptr<CVImagePool>, poolCopy),
+                     WORKER_ARG(long, frameId),
+                     WORKER_ARG(QString, producerId));
     }
 }
 
@@ -311,6 +311,13 @@ public:
     QPixmap
     minPixmap() const override{ return _minPixmap; }
 
+    /**
+     * @brief Always Active: in Pull evaluation the saver keeps writing files even
+     * when its output only feeds a minimized display.
+     */
+    SinkState
+    sinkState() const override { return SinkState::Active; }
+
     /**
      * @brief Late constructor for thread initialization.
      *
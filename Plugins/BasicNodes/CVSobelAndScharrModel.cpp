@@ -400,9 +400,9 @@ void CVSobelAndScharrModel::processData(const std::shared_ptr<CVImageData> &in,
         cv::Sobel(in_image,Temp[0],CV_16S,params.miOrderX,0,params.miKernelSize,params.mdScale,params.mdDelta,params.miBorderType);
         cv::Sobel(in_image,Temp[1],CV_16S,0,params.miOrderY,params.miKernelSize,params.mdScale,params.mdDelta,params.miBorderType);
     }
-    cv::convertScaleAbs(Temp[0],out[1]->data());
-    cv::convertScaleAbs(Temp[1],out[2]->data());
-    cv::addWeighted(out[1]->data(),0.5,out[2]->data(),0.5,0,out[0]->data());
+    cv::convertScaleAbs(Temp[0],out[1]->overwrite());
+    cv::convertScaleAbs(Temp[1],out[2]->overwrite());
+    cv::addWeighted(out[1]->data(),0.5,out[2]->data(),0.5,0,out[0]->overwrite());
 }
 
 QString
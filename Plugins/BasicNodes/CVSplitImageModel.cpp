@@ -187,7 +187,7 @@ processData(const std::shared_ptr< CVImageData > & in, std::shared_ptr< CVImageD
             {
                 arr[j] = (j==i)? vImage[i] : cv::Mat::zeros(vImage[i].size(), vImage[i].type()) ;
             }
-            cv::merge(arr,3,out[i]->data());
+            cv::merge(arr,3,out[i]->overwrite());
         }
     }
     else
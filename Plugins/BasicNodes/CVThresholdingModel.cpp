@@ -273,7 +273,7 @@ processData(const std::shared_ptr< CVImageData > & in, std::shared_ptr<CVImageDa
         {
             return;
         }
-        outInt->data() = cv::threshold(in_image,outImage->data(),params.mdThresholdValue,params.mdBinaryValue,params.miThresholdType);
+        outInt->data() = cv::threshold(in_image,outImage->overwrite(),params.mdThresholdValue,params.mdBinaryValue,params.miThresholdType);
     }
     else
     {
@@ -281,7 +281,7 @@ processData(const std::shared_ptr< CVImageData > & in, std::shared_ptr<CVImageDa
         {
             return;
         }
-        cv::threshold(in_image,outImage->data(),params.mdThresholdValue,params.mdBinaryValue,params.miThresholdType);
+        cv::threshold(in_image,outImage->overwrite(),params.mdThresholdValue,params.mdBinaryValue,params.miThresholdType);
         outInt->data() = 0;
     }
 }
@@ -815,20 +815,19 @@ ensure_frame_pool(int width, int height, int type)
 
     const int desiredSize = qMax( 1, miPoolSize );
     QMutexLocker locker( &mFramePoolMutex );
+    // Pool slots reallocate through CVMatArena when the video geometry changes,
+    // so only a new pool size requires a new pool.
     const bool shouldRecreate = !mpFramePool ||
-        miPoolFrameWidth != width ||
-        miPoolFrameHeight != height ||
-        miFrameMatType != type ||
         miActivePoolSize != desiredSize;
 
     if( shouldRecreate )
     {
         mpFramePool = std::make_shared<CVImagePool>( getNodeId(), width, height, type, static_cast<size_t>( desiredSize ) );
-        miPoolFrameWidth = width;
-        miPoolFrameHeight = height;
-        miFrameMatType = type;
         miActivePoolSize = desiredSize;
     }
+    miPoolFrameWidth = width;
+    miPoolFrameHeight = height;
+    miFrameMatType = type;
 
     if( mpFramePool )
         mpFramePool->setMode( meSharingMode );
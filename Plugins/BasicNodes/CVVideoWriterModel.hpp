@@ -358,6 +358,13 @@ public:
     QWidget *
     embeddedWidget() override { return mpEmbeddedWidget; }
 
+    /**
+     * @brief Always Active: in Pull evaluation the writer keeps recording whatever
+     * is connected to it.
+     */
+    SinkState
+    sinkState() const override { return SinkState::Active; }
+
     /**
      * @brief Returns the minimized node icon.
      * @return Icon pixmap (CVVideoWriter.png).
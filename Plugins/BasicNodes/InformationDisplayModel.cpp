@@ -88,14 +88,14 @@ void
 InformationDisplayModel::
 setInData( std::shared_ptr< NodeData > nodeData, PortIndex portIndex)
 {
-    if( !isEnable() )
+    // Headless: nothing shows the text, so don't format it either.
+    if( !isEnable() || isHeadlessMode() )
         return;
     if(portIndex == 0)
     {
         auto d = std::dynamic_pointer_cast< InformationData >( nodeData );
         if( d )
         {
-            d->set_information();
             appendDisplayText("............................................");
             appendDisplayText(d->info());
         }
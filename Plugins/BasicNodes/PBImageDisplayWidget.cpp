@@ -14,19 +14,100 @@
 
 #include <QtOpenGL/QtOpenGL>
 #include "PBImageDisplayWidget.hpp"
+#include "PBWorkerExecutor.hpp"
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 #include <QDebug>
+#include <QMutex>
+#include <QPainter>
+#include <algorithm>
 #include <cmath>
 
+struct PBImageDisplayWidget::PreviewState
+{
+    QMutex mutex;
+    PBImageDisplayWidget *pWidget{ nullptr };   ///< Cleared by the widget's destructor
+    cv::Mat pending;                            ///< Newest frame not rendered yet; shares the caller's pixels
+    QSize pendingSize;
+    bool busy{ false };                         ///< A render job is queued or running, or its preview is not taken yet
+    QImage ready;                               ///< Rendered, not yet taken by the widget
+};
+
+namespace
+{
+/// Shrinks @p frame to @p size straight into the pixels of a new QImage.
+QImage
+renderPreview( const cv::Mat &frame, const QSize &size )
+{
+    QImage::Format format;
+    int conversion = -1;
+    switch( frame.type() )
+    {
+    case CV_8UC1:
+        format = QImage::Format_Grayscale8;
+        break;
+    case CV_8UC3:
+#if QT_VERSION < QT_VERSION_CHECK(5, 13, 0)
+        format = QImage::Format_RGB888;
+        conversion = cv::COLOR_BGR2RGB;
+#else
+        format = QImage::Format_BGR888;
+#endif
+        break;
+    case CV_8UC4:
+        format = QImage::Format_RGBA8888;
+        conversion = cv::COLOR_BGRA2RGBA;
+        break;
+    default:
+        return QImage();
+    }
+
+    QImage image( size, format );
+    if( image.isNull() )
+        return QImage();
+    // Same size and type: OpenCV writes into the QImage instead of reallocating
+    cv::Mat target( image.height(), image.width(), frame.type(), image.bits(), static_cast< size_t >( image.bytesPerLine() ) );
+
+    cv::Mat source = frame;
+    if( size.width() != frame.cols || size.height() != frame.rows )
+    {
+        if( conversion < 0 )
+        {
+            cv::resize( frame, target, target.size(), 0, 0, cv::INTER_AREA );
+            return image;
+        }
+        cv::resize( frame, source, target.size(), 0, 0, cv::INTER_AREA );
+    }
+    if( conversion >= 0 )
+        cv::cvtColor( source, target, conversion );
+    else
+        source.copyTo( target );
+    return image;
+}
+}
+
 PBImageDisplayWidget::
 PBImageDisplayWidget(QWidget *parent)
-    : ImageDisplayWidget( parent )
+    : ImageDisplayWidget( parent ),
+      mpPreviewState( std::make_shared< PreviewState >() )
 {
     QSize minSize = QSize( 80, 60 );
     setMinimumSize( minSize );
     resize(QSize(640,480));
     setAutoFillBackground( false );
+
+    mpPreviewState->pWidget = this;
+    mRenderTimer.setSingleShot( true );
+    connect( &mRenderTimer, &QTimer::timeout, this, &PBImageDisplayWidget::schedulePreview );
+}
+
+PBImageDisplayWidget::
+~PBImageDisplayWidget()
+{
+    // A running job posts under the mutex; Qt drops events posted to a deleted object
+    QMutexLocker locker( &mpPreviewState->mutex );
+    mpPreviewState->pWidget = nullptr;
+    mpPreviewState->pending.release();
 }
 
 void
@@ -36,50 +117,130 @@ Display( const cv::Mat &image )
     // Don't process if the widget is not visible or image is empty
     if (!isVisible() || image.empty())
         return;
-        
-    // Create a deep copy to avoid race conditions with paintEvent
-    mCVImage = image.clone();
-    muImageFormat = static_cast< quint8 >( mCVImage.channels() );
-    if( mCVImage.cols != miImageWidth || mCVImage.rows != miImageHeight )
+
+    miImageWidth = image.cols;
+    miImageHeight = image.rows;
+
+    // Keep a reference only; the worker reads the full-resolution pixels once
     {
-        miImageWidth = mCVImage.cols;
-        miImageHeight = mCVImage.rows;
-        if( mCVImage.cols != 0 && mCVImage.rows != 0 )
-        {
-            mrScale_x = static_cast< qreal >( this->width() )/static_cast< qreal >( mCVImage.cols );
-            mrScale_y = static_cast< qreal >( this->height() )/static_cast< qreal >( mCVImage.rows );
-        }
+        QMutexLocker locker( &mpPreviewState->mutex );
+        mpPreviewState->pending = image;
+        mpPreviewState->pendingSize = previewSize( image );
     }
-    repaint();
+    schedulePreview();
 }
 
 void
 PBImageDisplayWidget::
-paintEvent( QPaintEvent * )
+setMaxPreviewFps( int fps )
+{
+    miMaxPreviewFps = std::max( 0, fps );
+}
+
+void
+PBImageDisplayWidget::
+setPreviewResolution( PreviewResolution resolution )
+{
+    mePreviewResolution = resolution;
+}
+
+QSize
+PBImageDisplayWidget::
+previewSize( const cv::Mat &image ) const
 {
-    // Don't paint if widget is not visible or image data is invalid
-    if (!isVisible() || mCVImage.empty() || mCVImage.data == nullptr)
+    int divisor = 1;
+    if( mePreviewResolution == PreviewResolution::Half )
+        divisor = 2;
+    else if( mePreviewResolution == PreviewResolution::Quarter )
+        divisor = 4;
+
+    // Fit the frame in the widget's device pixels; never scale up
+    const qreal ratio = devicePixelRatioF() / divisor;
+    const qreal scale = std::min( { width() * ratio / image.cols, height() * ratio / image.rows, qreal( 1. ) } );
+    return QSize( std::max( 1, qRound( image.cols * scale ) ), std::max( 1, qRound( image.rows * scale ) ) );
+}
+
+void
+PBImageDisplayWidget::
+schedulePreview()
+{
+    QMutexLocker locker( &mpPreviewState->mutex );
+    if( mpPreviewState->busy || mpPreviewState->pending.empty() )
         return;
-        
-    mPainter.begin( this );
-    mPainter.setRenderHint(QPainter::Antialiasing);
-    if( muImageFormat == 1 )
+
+    // Coalesce to the display rate before downsampling: a frame arriving early
+    // waits for the timer, and a newer one replaces it before it is rendered
+    if( miMaxPreviewFps > 0 && mLastRender.isValid() && mLastRender.elapsed() < 1000 / miMaxPreviewFps )
     {
-        QImage image( static_cast< uchar* >( mCVImage.data ), mCVImage.cols, mCVImage.rows, static_cast< qint32 >( mCVImage.step ), QImage::Format_Grayscale8 );
-        mPainter.scale( mrScale_x, mrScale_y );
-        mPainter.drawImage( 0, 0, image, 0, 0, image.width(), image.height(), Qt::MonoOnly );
+        if( !mRenderTimer.isActive() )
+            mRenderTimer.start( static_cast< int >( 1000 / miMaxPreviewFps - mLastRender.elapsed() ) );
+        return;
     }
-    else if( muImageFormat == 3 )
+    mpPreviewState->busy = true;
+    locker.unlock();
+
+    mLastRender.start();
+    PBWorkerExecutor::instance().post( [state = mpPreviewState]() { renderPending( state ); } );
+}
+
+void
+PBImageDisplayWidget::
+renderPending( const std::shared_ptr< PreviewState > &state )
+{
+    QMutexLocker locker( &state->mutex );
+    const cv::Mat frame = state->pending;
+    const QSize size = state->pendingSize;
+    state->pending.release();
+    locker.unlock();
+
+    QImage preview = frame.empty() ? QImage() : renderPreview( frame, size );
+
+    locker.relock();
+    state->ready = std::move( preview );
+    // The widget clears busy, so no render starts before this one is taken
+    if( state->pWidget )
     {
-#if QT_VERSION < QT_VERSION_CHECK(5, 13, 0)
-        QImage image = QImage( static_cast<uchar*>(mCVImage.data), mCVImage.cols, mCVImage.rows, static_cast< qint32 >( mCVImage.step ), QImage::Format_RGB888 ).rgbSwapped();
-#else
-        QImage image = QImage( static_cast<uchar*>(mCVImage.data), mCVImage.cols, mCVImage.rows, static_cast< qint32 >( mCVImage.step ), QImage::Format_BGR888 );
-#endif
-        mPainter.scale( mrScale_x, mrScale_y );
-        mPainter.drawImage( 0, 0, image, 0, 0, image.width(), image.height(), Qt::ColorOnly );
+        PBImageDisplayWidget *widget = state->pWidget;
+        QMetaObject::invokeMethod( widget, [widget]() { widget->takePreview(); }, Qt::QueuedConnection );
     }
-    mPainter.end();
+}
+
+void
+PBImageDisplayWidget::
+takePreview()
+{
+    bool taken = false;
+    {
+        QMutexLocker locker( &mpPreviewState->mutex );
+        if( !mpPreviewState->ready.isNull() )
+        {
+            mPreview = std::move( mpPreviewState->ready );
+            mpPreviewState->ready = QImage();
+            taken = true;
+        }
+        mpPreviewState->busy = false;
+    }
+    if( taken )
+        update();
+
+    // A frame that arrived during the render goes out at the next slot
+    schedulePreview();
+}
+
+void
+PBImageDisplayWidget::
+paintEvent( QPaintEvent * )
+{
+    // Don't paint if widget is not visible or no preview is ready
+    if (!isVisible() || mPreview.isNull())
+        return;
+
+    QPainter painter( this );
+    // The preview is already at device-pixel size; smoothing only matters after a resize
+    const bool scaled = qAbs( mPreview.width() - width() * devicePixelRatioF() ) > 1 ||
+                        qAbs( mPreview.height() - height() * devicePixelRatioF() ) > 1;
+    painter.setRenderHint( QPainter::SmoothPixmapTransform, scaled );
+    painter.drawImage( rect(), mPreview );
 }
 
 void
@@ -103,11 +264,5 @@ resizeEvent( QResizeEvent * ev )
         }
     }
     
-    if( mCVImage.cols != 0 && mCVImage.rows != 0 )
-    {
-        mrScale_x = static_cast< qreal >( this->width() )/static_cast< qreal >( mCVImage.cols );
-        mrScale_y = static_cast< qreal >( this->height() )/static_cast< qreal >( mCVImage.rows );
-    }
     ImageDisplayWidget::resizeEvent(ev);
 }
-
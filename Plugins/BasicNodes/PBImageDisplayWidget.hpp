@@ -22,11 +22,12 @@
  * rendering when available.
  *
  * **Key Features:**
- * - Automatic cv::Mat to QPixmap/QImage conversion
- * - Adaptive scaling to fit widget size
+ * - Downscaled preview: frames are shrunk to the widget's device-pixel size
+ *   (INTER_AREA) on a PBWorkerExecutor thread, straight into a cached QImage
+ * - Render and display rate capped per widget; frames arriving faster are
+ *   coalesced before they are downsampled
  * - Supports grayscale and color images
  * - Hardware acceleration (OpenGL) when available
- * - Efficient repainting on resize events
  *
  * **Typical Use:**
  * Used internally by CVImageDisplay node for image visualization.
@@ -45,9 +46,13 @@
     #include <QLabel>
 #endif
 
-#include <QPainter>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QTimer>
 #include <opencv2/core/core.hpp>
 
+#include <memory>
+
 /**
  * @class PBImageDisplayWidget
  * @brief Optimized Qt widget for displaying OpenCV images.
@@ -79,27 +84,55 @@
  * - Supports both upscaling and downscaling
  *
  * **Performance:**
- * - Caches converted QImage internally (avoids repeated conversion)
- * - Only repaints on explicit Display() calls or resize events
- * - Uses Qt's optimized image rendering pipeline
- * - Hardware acceleration when QOpenGLWidget is used
+ * - Display() only keeps a reference to the frame; no full-resolution copy is made
+ * - At most setMaxPreviewFps() previews are rendered a second, one at a time: a
+ *   frame arriving before the next slot or while the worker is busy replaces the
+ *   one waiting, so only the newest is downsampled
+ * - Each rendered preview is painted through update() and drawn from the cached
+ *   QImage at (or near) 1:1
+ * - A resize redraws the cached preview scaled until the next frame
  *
- * @note Images are converted from BGR (OpenCV) to RGB (Qt) for correct color display
+ * @note The frame is read after Display() returns, on a worker thread. A producer
+ *       that rewrites its output buffer in place may show a torn preview, never a
+ *       crash: the reference keeps the buffer alive.
  * @see CVImageDisplay for the node implementation using this widget
  */
 class PBImageDisplayWidget : public ImageDisplayWidget
 {
     Q_OBJECT
 public:
+    /**
+     * @brief Pixel size of the preview relative to the widget.
+     */
+    enum class PreviewResolution
+    {
+        Widget = 0,     ///< Device pixels of the widget (sharp on HiDPI screens)
+        Half,           ///< Half of them in each direction, drawn scaled up
+        Quarter         ///< A quarter in each direction
+    };
+
     PBImageDisplayWidget( QWidget *parent = nullptr );
-    
+    ~PBImageDisplayWidget() override;
+
     /**
      * @brief Displays a cv::Mat image in the widget.
-     * @param image OpenCV image to display (grayscale or BGR color)
-     * @note Triggers automatic conversion and repaint
+     * @param image OpenCV image to display (CV_8UC1, CV_8UC3 BGR or CV_8UC4 BGRA)
+     * @note The preview is rendered asynchronously and painted at the next allowed time
      */
     void Display( const cv::Mat &image );
 
+    /**
+     * @brief Caps how often a new frame is rendered and painted; 0 renders every frame the worker can.
+     */
+    void setMaxPreviewFps( int fps );
+    int maxPreviewFps() const { return miMaxPreviewFps; }
+
+    /**
+     * @brief Sets the preview size used from the next frame on.
+     */
+    void setPreviewResolution( PreviewResolution resolution );
+    PreviewResolution previewResolution() const { return mePreviewResolution; }
+
 protected:
     /**
      * @brief Handles paint events to render the image.
@@ -114,13 +147,29 @@ protected:
     void resizeEvent( QResizeEvent * ) override;
 
 private:
-    cv::Mat mCVImage;       ///< Stored OpenCV image for rendering
+    /// Frame waiting for the worker and the last preview it rendered; shared with the worker job.
+    struct PreviewState;
+
+    /// Preview size of @p image for the current widget size and resolution setting.
+    QSize previewSize( const cv::Mat &image ) const;
+
+    /// Posts the render of the waiting frame if the worker is idle and the next render slot is due.
+    void schedulePreview();
+
+    /// Takes the rendered preview on the GUI thread, paints it and schedules the next frame.
+    void takePreview();
+
+    /// Renders the waiting frame; runs on PBWorkerExecutor.
+    static void renderPending( const std::shared_ptr<PreviewState> &state );
+
+    std::shared_ptr<PreviewState> mpPreviewState;
 
-    QPainter mPainter;      ///< Qt painter for drawing operations
+    QImage mPreview;            ///< Preview drawn by paintEvent()
+    QTimer mRenderTimer;        ///< Delays the render of a frame that arrived early
+    QElapsedTimer mLastRender;  ///< Time the last render was posted
 
-    quint8 muImageFormat{0};    ///< Image format identifier (grayscale=1, BGR=3, BGRA=4)
-    qreal mrScale_x{1.};        ///< Horizontal scaling factor
-    qreal mrScale_y{1.};        ///< Vertical scaling factor
+    int miMaxPreviewFps{30};
+    PreviewResolution mePreviewResolution{PreviewResolution::Widget};
 
     int miImageWidth{0};    ///< Original image width (pixels)
     int miImageHeight{0};   ///< Original image height (pixels)
@@ -90,10 +90,17 @@ PythonEditorEmbeddedWidget::PythonEditorEmbeddedWidget(QWidget* parent)
     // Execute button
     mpExecuteButton = new QPushButton("Execute (Ctrl+Return)", this);
     mpExecuteButton->setStyleSheet("QPushButton { background-color: #4CAF50; color: white; font-weight: bold; padding: 5px; }");
-    mainLayout->addWidget(mpExecuteButton);
+    mpBenchmarkButton = new QPushButton("Benchmark IPC", this);
+    mpBenchmarkButton->setToolTip("Compare the round trip of input0 through shared memory and through JSON/PNG");
+
+    auto* buttonLayout = new QHBoxLayout();
+    buttonLayout->addWidget(mpExecuteButton, 1);
+    buttonLayout->addWidget(mpBenchmarkButton);
+    mainLayout->addLayout(buttonLayout);
 
     // Connect signals
     connect(mpExecuteButton, &QPushButton::clicked, this, &PythonEditorEmbeddedWidget::executeClicked);
+    connect(mpBenchmarkButton, &QPushButton::clicked, this, &PythonEditorEmbeddedWidget::benchmarkClicked);
     connect(mpNumInputsSpinBox, QOverload<int>::of(&QSpinBox::valueChanged),
             this, &PythonEditorEmbeddedWidget::numInputsChanged);
     connect(mpNumOutputsSpinBox, QOverload<int>::of(&QSpinBox::valueChanged),
@@ -38,6 +38,7 @@ public:
 
 Q_SIGNALS:
     void executeClicked();
+    void benchmarkClicked();
     void numInputsChanged();
     void numOutputsChanged();
     void widgetClicked(); // Signal to request node selection
@@ -68,6 +69,7 @@ protected:
 private:
     QTextEdit* mpCodeEditor;
     QPushButton* mpExecuteButton;
+    QPushButton* mpBenchmarkButton;
     QSpinBox* mpNumInputsSpinBox;
     QSpinBox* mpNumOutputsSpinBox;
 };
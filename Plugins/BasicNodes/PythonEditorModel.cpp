@@ -23,11 +23,9 @@
 #include "CVSizeData.hpp"
 #include "SyncData.hpp"
 #include <QJsonArray>
-#include <QJsonDocument>
 #include <QDebug>
 #include <QMetaObject>
 #include <algorithm>
-#include <opencv2/imgcodecs.hpp>
 #include <opencv2/core.hpp>
 #include "qtvariantproperty_p.h"
 
@@ -81,9 +79,19 @@ PythonEditorModel::PythonEditorModel()
     mvProperty.push_back(propExe);
     mMapIdToProperty[propId] = propExe;
 
+    EnumPropertyType transportPropertyType;
+    transportPropertyType.mslEnumNames = QStringList({"Shared Memory", "JSON (PNG)"});
+    transportPropertyType.miCurrentIndex = miIpcTransport;
+    propId = "ipc_transport";
+    auto propTransport = std::make_shared<TypedProperty<EnumPropertyType>>("IPC Transport", propId, QtVariantPropertyManager::enumTypeId(), transportPropertyType, "Code");
+    mvProperty.push_back(propTransport);
+    mMapIdToProperty[propId] = propTransport;
+
     // Connect widget signals
     connect(mpEmbeddedWidget, &PythonEditorEmbeddedWidget::executeClicked,
             this, &PythonEditorModel::onExecutePython);
+    connect(mpEmbeddedWidget, &PythonEditorEmbeddedWidget::benchmarkClicked,
+            this, &PythonEditorModel::onBenchmarkIpc);
     connect(mpEmbeddedWidget, &PythonEditorEmbeddedWidget::numInputsChanged,
             this, &PythonEditorModel::onNumInputsChanged);
     connect(mpEmbeddedWidget, &PythonEditorEmbeddedWidget::numOutputsChanged,
@@ -143,11 +151,20 @@ void PythonEditorModel::late_constructor()
                       this,
                       &PythonEditorModel::onExecutionError );
 
+    QObject::connect( mpSessionWorker,
+                      &PythonSessionWorker::benchmarkFinished,
+                      this,
+                      &PythonEditorModel::onBenchmarkFinished );
+
     mpWorkerThread->start();
     QMetaObject::invokeMethod( mpSessionWorker,
                                "setExecutablePath",
                                Qt::QueuedConnection,
                                Q_ARG( QString, msPythonExecutable ) );
+    QMetaObject::invokeMethod( mpSessionWorker,
+                               "setTransport",
+                               Qt::QueuedConnection,
+                               Q_ARG( int, miIpcTransport ) );
     QMetaObject::invokeMethod( mpSessionWorker, "startSession", Qt::QueuedConnection );
 }
 
@@ -353,6 +370,9 @@ void PythonEditorModel::setModelProperty(QString& id, const QVariant& value)
             Q_EMIT property_changed_signal(prop);
             Q_EMIT embeddedWidgetSizeUpdated();
 
+            // The data kept for an unchanged output may have the old type
+            mbResendOutputs = true;
+
             // Propagate only the changed output port so downstream links refresh immediately.
             emitOutputPort(static_cast<PortIndex>(index));
         }
@@ -369,6 +389,18 @@ void PythonEditorModel::setModelProperty(QString& id, const QVariant& value)
         auto typedProp = std::static_pointer_cast<TypedProperty<FilePathPropertyType>>(prop);
         typedProp->getData().msFilename = msPythonExecutable;
     }
+    else if (id == "ipc_transport")
+    {
+        miIpcTransport = value.toInt();
+        auto prop = mMapIdToProperty["ipc_transport"];
+        auto typedProp = std::static_pointer_cast<TypedProperty<EnumPropertyType>>(prop);
+        typedProp->getData().miCurrentIndex = miIpcTransport;
+        if( mpSessionWorker )
+            QMetaObject::invokeMethod( mpSessionWorker,
+                                       "setTransport",
+                                       Qt::QueuedConnection,
+                                       Q_ARG( int, miIpcTransport ) );
+    }
 }
 
 QJsonObject PythonEditorModel::save() const
@@ -380,6 +412,7 @@ QJsonObject PythonEditorModel::save() const
     cParams["num_outputs"] = miNumOutputs;
     cParams["python_code"] = mpEmbeddedWidget->getPythonCode();
     cParams["python_executable"] = msPythonExecutable;
+    cParams["ipc_transport"] = miIpcTransport;
 
     QJsonArray inputTypes;
     for (int typeIndex : mvInputTypeIndices)
@@ -487,6 +520,20 @@ void PythonEditorModel::load(QJsonObject const &p)
             auto typedProp = std::static_pointer_cast<TypedProperty<FilePathPropertyType>>(prop);
             typedProp->getData().msFilename = msPythonExecutable;
         }
+
+        v = paramsObj["ipc_transport"];
+        if (!v.isNull())
+        {
+            miIpcTransport = v.toInt();
+            auto prop = mMapIdToProperty["ipc_transport"];
+            auto typedProp = std::static_pointer_cast<TypedProperty<EnumPropertyType>>(prop);
+            typedProp->getData().miCurrentIndex = miIpcTransport;
+            if( mpSessionWorker )
+                QMetaObject::invokeMethod( mpSessionWorker,
+                                           "setTransport",
+                                           Qt::QueuedConnection,
+                                           Q_ARG( int, miIpcTransport ) );
+        }
     }
 }
 
@@ -569,36 +616,20 @@ void PythonEditorModel::onSessionFailed( const QString& errorMessage )
     emitOutputPort( static_cast<PortIndex>( miNumOutputs ) );
 }
 
-void PythonEditorModel::onResultReady( const QString& outputsJson )
+void PythonEditorModel::onResultReady( const PythonFrameResult& result )
 {
     mbBusy = false;
 
-    QJsonDocument outputsDoc = QJsonDocument::fromJson( outputsJson.toUtf8() );
-    if( !outputsDoc.isObject() )
-    {
-        mpExecutionInfo->set_information( "Error: Invalid output format" );
-        mbExecutionSuccess = false;
-        emitOutputPort( static_cast<PortIndex>( miNumOutputs ) );
-        return;
-    }
-
-    const QJsonObject outputsObj = outputsDoc.object();
+    // Outputs left out by the host kept their value; they are emitted again
+    // below, so sync gates and joins downstream still see one output per run
     for( int i = 0; i < miNumOutputs; ++i )
     {
         const QString key = QStringLiteral( "output" ) + QString::number( i );
-        if( !outputsObj.contains( key ) )
+        if( !result.outputs.contains( key ) )
             continue;
 
-        if( !outputsObj[key].isString() )
-        {
-            mpExecutionInfo->set_information( QStringLiteral( "Error: output%1 payload must be a JSON string" ).arg( i ) );
-            mbExecutionSuccess = false;
-            emitOutputPort( static_cast<PortIndex>( miNumOutputs ) );
-            return;
-        }
-
         QString errorMessage;
-        if( !deserializeOutputData( i, outputsObj[key].toString(), errorMessage ) )
+        if( !deserializeOutputData( i, result.outputs[key].toObject(), result.images, errorMessage ) )
         {
             mpExecutionInfo->set_information( QStringLiteral( "Error: %1" ).arg( errorMessage.left( 450 ) ) );
             mbExecutionSuccess = false;
@@ -607,7 +638,11 @@ void PythonEditorModel::onResultReady( const QString& outputsJson )
         }
     }
 
-    mpExecutionInfo->set_information( "Execution successful ✓" );
+    QString information = QStringLiteral( "Execution successful ✓" );
+    const QString printed = result.stdoutText.trimmed();
+    if( !printed.isEmpty() )
+        information += "\n" + printed.right( 450 );
+    mpExecutionInfo->set_information( information );
     mbExecutionSuccess = true;
 
     for( int i = 0; i <= miNumOutputs; ++i )
@@ -620,6 +655,8 @@ void PythonEditorModel::onResultReady( const QString& outputsJson )
 void PythonEditorModel::onExecutionError( const QString& errorMessage )
 {
     mbBusy = false;
+    // Outputs the host counts as sent may not have reached the node
+    mbResendOutputs = true;
 
     mpExecutionInfo->set_information( QStringLiteral( "Execution failed:\n%1" ).arg( errorMessage.left( 460 ) ) );
     mbExecutionSuccess = false;
@@ -629,22 +666,27 @@ void PythonEditorModel::onExecutionError( const QString& errorMessage )
         executePythonCode();
 }
 
-QString PythonEditorModel::buildInputsJson()
+PythonFrameRequest PythonEditorModel::buildFrameRequest()
 {
-    QJsonObject inputsJson;
+    PythonFrameRequest request;
+    request.code = msPythonCode;
+    request.numOutputs = miNumOutputs;
+    request.resendOutputs = mbResendOutputs;
+    mbResendOutputs = false;
+
     for( int i = 0; i < miNumInputs; ++i )
     {
         const QString key = QStringLiteral( "input" ) + QString::number( i );
-        inputsJson[key] = serializeInputData( i );
+        request.inputs[key] = serializeInputData( i, request.images, request.imageOwners );
     }
 
-    return QString::fromUtf8( QJsonDocument( inputsJson ).toJson( QJsonDocument::Compact ) );
+    return request;
 }
 
-QString PythonEditorModel::serializeInputData(int index)
+QJsonValue PythonEditorModel::serializeInputData(int index, std::vector<cv::Mat>& images, std::vector<std::shared_ptr<const void>>& owners)
 {
     if (index >= static_cast<int>(mvInputData.size()) || !mvInputData[index])
-        return "null";
+        return QJsonValue();
     
     auto data = mvInputData[index];
     QJsonObject json;
@@ -654,19 +696,13 @@ QString PythonEditorModel::serializeInputData(int index)
     {
         cv::Mat img = imgData->data();
         if (img.empty())
-            return "null";
-        
-        // Encode image as base64 PNG
-        std::vector<uchar> buf;
-        cv::imencode(".png", img, buf);
-        QByteArray byteArray(reinterpret_cast<const char*>(buf.data()), buf.size());
+            return QJsonValue();
         
+        // The worker places the pixels in shared memory or encodes them as PNG
         json["type"] = "image";
-        json["data"] = QString::fromLatin1(byteArray.toBase64());
-        json["rows"] = img.rows;
-        json["cols"] = img.cols;
-        json["channels"] = img.channels();
-        json["dtype"] = img.type();
+        json["image"] = static_cast<int>(images.size());
+        images.push_back(img);
+        owners.push_back(imgData);
     }
     else if (auto doubleData = std::dynamic_pointer_cast<DoubleData>(data))
     {
@@ -722,29 +758,20 @@ QString PythonEditorModel::serializeInputData(int index)
     }
     else
     {
-        return "null";
+        return QJsonValue();
     }
     
-    QJsonDocument doc(json);
-    return doc.toJson(QJsonDocument::Compact);
+    return json;
 }
 
-bool PythonEditorModel::deserializeOutputData(int index, const QString& jsonStr, QString& errorMessage)
+bool PythonEditorModel::deserializeOutputData(int index, const QJsonObject& json, const std::vector<cv::Mat>& images, QString& errorMessage)
 {
-    if (jsonStr.isEmpty() || jsonStr == "null")
+    if (json.isEmpty())
     {
         errorMessage = QStringLiteral("Output%1 is empty or null").arg(index);
         return false;
     }
     
-    QJsonDocument doc = QJsonDocument::fromJson(jsonStr.toUtf8());
-    if (!doc.isObject())
-    {
-        errorMessage = QStringLiteral("Output%1 is not a valid JSON object").arg(index);
-        return false;
-    }
-    
-    QJsonObject json = doc.object();
     const QString type = json["type"].toString();
     if (type.isEmpty())
     {
@@ -754,15 +781,12 @@ bool PythonEditorModel::deserializeOutputData(int index, const QString& jsonStr,
 
     if (type == "image")
     {
-        // Decode base64 PNG
-        QByteArray byteArray = QByteArray::fromBase64(json["data"].toString().toLatin1());
-        std::vector<uchar> buf(byteArray.begin(), byteArray.end());
-        cv::Mat img = cv::imdecode(buf, cv::IMREAD_UNCHANGED);
-        
-        if (!img.empty())
+        // Already decoded by the worker
+        const int imageIndex = json["image"].toInt(-1);
+        if (imageIndex >= 0 && imageIndex < static_cast<int>(images.size()) && !images[imageIndex].empty())
         {
             auto imgData = std::make_shared<CVImageData>();
-            imgData->set_image(img);
+            imgData->set_image(images[imageIndex]);
             mvOutputData[index] = imgData;
             return true;
         }
@@ -888,16 +912,55 @@ void PythonEditorModel::executePythonCode()
         return;
     }
 
-    const QString inputsJson = buildInputsJson();
+    PythonFrameRequest request = buildFrameRequest();
     mbBusy = true;
     mbPendingExecution = false;
 
+    PythonSessionWorker* worker = mpSessionWorker;
     QMetaObject::invokeMethod( mpSessionWorker,
-                               "executeFrame",
-                               Qt::QueuedConnection,
-                               Q_ARG( QString, msPythonCode ),
-                               Q_ARG( QString, inputsJson ),
-                               Q_ARG( int, miNumOutputs ) );
+                               [worker, request]()
+                               {
+                                   worker->executeFrame( request );
+                               },
+                               Qt::QueuedConnection );
+}
+
+void PythonEditorModel::onBenchmarkIpc()
+{
+    if( !mpSessionWorker || mbBenchmarkRunning )
+        return;
+
+    // Measure with the frame the script receives, or a noisy 1080p frame
+    cv::Mat frame;
+    if( !mvInputData.empty() )
+    {
+        if( auto imgData = std::dynamic_pointer_cast<CVImageData>( mvInputData[0] ) )
+            frame = imgData->data().clone();
+    }
+    if( frame.empty() )
+    {
+        frame.create( 1080, 1920, CV_8UC3 );
+        cv::randu( frame, cv::Scalar::all( 0 ), cv::Scalar::all( 256 ) );
+    }
+
+    mbBenchmarkRunning = true;
+    mpExecutionInfo->set_information( "Running IPC benchmark..." );
+    emitOutputPort( static_cast<PortIndex>( miNumOutputs ) );
+
+    PythonSessionWorker* worker = mpSessionWorker;
+    QMetaObject::invokeMethod( mpSessionWorker,
+                               [worker, frame]()
+                               {
+                                   worker->runBenchmark( frame, 30 );
+                               },
+                               Qt::QueuedConnection );
+}
+
+void PythonEditorModel::onBenchmarkFinished( const QString& report )
+{
+    mbBenchmarkRunning = false;
+    mpExecutionInfo->set_information( report );
+    emitOutputPort( static_cast<PortIndex>( miNumOutputs ) );
 }
 
 QString
@@ -39,6 +39,8 @@ using QtNodes::NodeDataType;
  * - Variable persistence across executions
  * - Access to input data via input0, input1, ... variables
  * - Return output via output0, output1, ... variables
+ * - Images exchanged through shared memory as numpy views (see PythonFrameChannel);
+ *   only outputs that changed are sent back; every output is emitted on every run
  */
 class PythonEditorModel : public PBNodeDelegateModel
 {
@@ -78,8 +80,10 @@ private Q_SLOTS:
     void onNumOutputsChanged();
     void onSessionStarted();
     void onSessionFailed( const QString& errorMessage );
-    void onResultReady( const QString& outputsJson );
+    void onResultReady( const PythonFrameResult& result );
     void onExecutionError( const QString& errorMessage );
+    void onBenchmarkIpc();
+    void onBenchmarkFinished( const QString& report );
 
 private:
     enum PortDataTypeIndex
@@ -103,9 +107,9 @@ private:
     void rebuildPortTypeProperties();
 
     void executePythonCode();
-    QString buildInputsJson();
-    QString serializeInputData(int index);
-    bool deserializeOutputData(int index, const QString& jsonStr, QString& errorMessage);
+    PythonFrameRequest buildFrameRequest();
+    QJsonValue serializeInputData(int index, std::vector<cv::Mat>& images, std::vector<std::shared_ptr<const void>>& owners);
+    bool deserializeOutputData(int index, const QJsonObject& json, const std::vector<cv::Mat>& images, QString& errorMessage);
     
     PythonEditorEmbeddedWidget* mpEmbeddedWidget {nullptr};
     
@@ -138,4 +142,10 @@ private:
     QString msLastExecutedCode;
     QString msPythonExecutable { "python3" };
     QString msLastSessionExecutable;
+
+    // PythonFrameChannel::Transport of the session
+    int miIpcTransport { 0 };
+    // Ask the host for every output on the next frame
+    bool mbResendOutputs { false };
+    bool mbBenchmarkRunning { false };
 };
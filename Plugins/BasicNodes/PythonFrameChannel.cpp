@@ -0,0 +1,391 @@
+//Copyright © 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#include "PythonFrameChannel.hpp"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QtEndian>
+
+#include <opencv2/imgcodecs.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+constexpr qint64 kAlignment = 64;
+constexpr qint64 kMinBankSize = 1 << 20;
+constexpr quint32 kMaxFrameBytes = 1u << 30;
+
+qint64
+alignUp( qint64 bytes )
+{
+    return ( bytes + kAlignment - 1 ) / kAlignment * kAlignment;
+}
+
+qint64
+imageBytes( const cv::Mat& image )
+{
+    return static_cast<qint64>( image.rows ) * image.cols * static_cast<qint64>( image.elemSize() );
+}
+
+QString
+segmentDirectory()
+{
+#ifdef Q_OS_LINUX
+    // tmpfs: the segment never touches the disk
+    const QFileInfo shm( QStringLiteral( "/dev/shm" ) );
+    if( shm.isDir() && shm.isWritable() )
+        return shm.absoluteFilePath();
+#endif
+    return QDir::tempPath();
+}
+
+QJsonObject
+encodePng( const cv::Mat& image )
+{
+    std::vector<uchar> buffer;
+    cv::imencode( ".png", image, buffer );
+    const QByteArray bytes( reinterpret_cast<const char*>( buffer.data() ), static_cast<int>( buffer.size() ) );
+
+    QJsonObject json;
+    json["type"] = "image";
+    json["data"] = QString::fromLatin1( bytes.toBase64() );
+    json["rows"] = image.rows;
+    json["cols"] = image.cols;
+    json["channels"] = image.channels();
+    json["dtype"] = image.type();
+    return json;
+}
+}
+
+PythonFrameChannel::PythonFrameChannel() = default;
+
+PythonFrameChannel::~PythonFrameChannel()
+{
+    reset();
+}
+
+QByteArray
+PythonFrameChannel::frame( const QJsonObject& message )
+{
+    const QByteArray body = QJsonDocument( message ).toJson( QJsonDocument::Compact );
+    QByteArray framed( 4, Qt::Uninitialized );
+    qToLittleEndian<quint32>( static_cast<quint32>( body.size() ), framed.data() );
+    framed += body;
+    return framed;
+}
+
+bool
+PythonFrameChannel::takeFrame( QByteArray& buffer, QJsonObject& message, QString& errorMessage )
+{
+    errorMessage.clear();
+    if( buffer.size() < 4 )
+        return false;
+
+    const quint32 length = qFromLittleEndian<quint32>( buffer.constData() );
+    if( length > kMaxFrameBytes )
+    {
+        // The stream is out of step; nothing after this point can be trusted
+        buffer.clear();
+        errorMessage = QStringLiteral( "Python session sent an oversized frame (%1 bytes)" ).arg( length );
+        return false;
+    }
+    if( static_cast<quint64>( buffer.size() ) < 4 + static_cast<quint64>( length ) )
+        return false;
+
+    const QJsonDocument document = QJsonDocument::fromJson( buffer.mid( 4, static_cast<int>( length ) ) );
+    buffer.remove( 0, 4 + static_cast<int>( length ) );
+    if( !document.isObject() )
+    {
+        errorMessage = QStringLiteral( "Python session returned invalid JSON response" );
+        return false;
+    }
+
+    message = document.object();
+    return true;
+}
+
+QByteArray
+PythonFrameChannel::encodeRequest( const PythonFrameRequest& request, QString& errorMessage )
+{
+    QJsonObject message;
+    message["cmd"] = "execute";
+    message["code"] = request.code;
+    message["num_outputs"] = request.numOutputs;
+    message["transport"] = meTransport == Transport::SharedMemory ? "shm" : "json";
+    message["resend"] = request.resendOutputs;
+
+    const bool shared = ( meTransport == Transport::SharedMemory );
+    std::vector<qint64> offsets( request.images.size(), 0 );
+    if( shared )
+    {
+        qint64 bankBytes = 0;
+        for( size_t i = 0; i < request.images.size(); ++i )
+        {
+            offsets[i] = bankBytes;
+            bankBytes += alignUp( imageBytes( request.images[i] ) );
+        }
+        if( bankBytes > 0 && !ensureInputCapacity( bankBytes, errorMessage ) )
+            return QByteArray();
+
+        if( mbAnnounceInput )
+        {
+            QJsonObject segment;
+            segment["path"] = mpInputFile->fileName();
+            segment["size"] = 2 * miBankSize;
+            message["input_segment"] = segment;
+            mbAnnounceInput = false;
+        }
+    }
+
+    QJsonObject inputs;
+    for( auto it = request.inputs.constBegin(); it != request.inputs.constEnd(); ++it )
+    {
+        const QJsonObject value = it.value().toObject();
+        if( value["type"].toString() != QLatin1String( "image" ) )
+        {
+            inputs[it.key()] = it.value();
+            continue;
+        }
+
+        const int index = value["image"].toInt( -1 );
+        if( index < 0 || index >= static_cast<int>( request.images.size() ) || request.images[index].empty() )
+        {
+            inputs[it.key()] = QJsonValue();
+            continue;
+        }
+
+        const cv::Mat& image = request.images[index];
+        if( !shared )
+        {
+            inputs[it.key()] = encodePng( image );
+            continue;
+        }
+
+        // Pack the rows: the host sees a contiguous array whatever the source stride
+        const qint64 offset = miBank * miBankSize + offsets[index];
+        const size_t step = image.cols * image.elemSize();
+        cv::Mat view( image.rows, image.cols, image.type(), mpInputMap + offset, step );
+        image.copyTo( view );
+
+        QJsonObject descriptor;
+        descriptor["type"] = "image";
+        descriptor["offset"] = offset;
+        descriptor["rows"] = image.rows;
+        descriptor["cols"] = image.cols;
+        descriptor["channels"] = image.channels();
+        descriptor["depth"] = image.depth();
+        descriptor["step"] = static_cast<qint64>( step );
+        inputs[it.key()] = descriptor;
+    }
+    message["inputs"] = inputs;
+
+    if( shared )
+        miBank = 1 - miBank;
+    return frame( message );
+}
+
+bool
+PythonFrameChannel::decodeResult( const QJsonObject& response, PythonFrameResult& result, QString& errorMessage )
+{
+    result = PythonFrameResult();
+    result.stdoutText = response["stdout"].toString();
+
+    if( response.contains( "output_segment" ) )
+    {
+        const QJsonObject segment = response["output_segment"].toObject();
+        if( !mapOutputSegment( segment["path"].toString(),
+                               static_cast<qint64>( segment["size"].toDouble() ),
+                               errorMessage ) )
+            return false;
+    }
+
+    const QJsonObject outputs = response["outputs"].toObject();
+    for( auto it = outputs.constBegin(); it != outputs.constEnd(); ++it )
+    {
+        if( !it.value().isObject() )
+        {
+            errorMessage = QStringLiteral( "%1 payload must be a JSON object" ).arg( it.key() );
+            return false;
+        }
+
+        const QJsonObject value = it.value().toObject();
+        if( value["type"].toString() != QLatin1String( "image" ) )
+        {
+            result.outputs[it.key()] = value;
+            continue;
+        }
+
+        cv::Mat image;
+        if( value.contains( "data" ) )
+        {
+            const QByteArray bytes = QByteArray::fromBase64( value["data"].toString().toLatin1() );
+            const std::vector<uchar> buffer( bytes.begin(), bytes.end() );
+            image = cv::imdecode( buffer, cv::IMREAD_UNCHANGED );
+        }
+        else
+        {
+            const int rows = value["rows"].toInt();
+            const int cols = value["cols"].toInt();
+            const int channels = value["channels"].toInt();
+            const int depth = value["depth"].toInt( -1 );
+            const qint64 offset = static_cast<qint64>( value["offset"].toDouble( -1 ) );
+            const qint64 step = static_cast<qint64>( value["step"].toDouble() );
+            if( mpOutputMap && rows > 0 && cols > 0 && channels >= 1 && channels <= CV_CN_MAX &&
+                depth >= CV_8U && depth <= CV_16F && offset >= 0 )
+            {
+                const int type = CV_MAKETYPE( depth, channels );
+                const qint64 rowBytes = static_cast<qint64>( cols ) * CV_ELEM_SIZE( type );
+                if( step >= rowBytes && offset + ( rows - 1 ) * step + rowBytes <= miOutputSize )
+                {
+                    // The region is rewritten by the next frame
+                    image = cv::Mat( rows, cols, type, mpOutputMap + offset, static_cast<size_t>( step ) ).clone();
+                }
+            }
+        }
+
+        if( image.empty() )
+        {
+            errorMessage = QStringLiteral( "%1 image decode failed" ).arg( it.key() );
+            return false;
+        }
+
+        QJsonObject reference;
+        reference["type"] = "image";
+        reference["image"] = static_cast<int>( result.images.size() );
+        result.images.push_back( image );
+        result.outputs[it.key()] = reference;
+    }
+    return true;
+}
+
+void
+PythonFrameChannel::reset()
+{
+    releaseInputSegment();
+    miBankSize = 0;
+
+    // The host removes its segment on exit; this covers a host that crashed
+    if( mpOutputFile )
+    {
+        const QString path = mpOutputFile->fileName();
+        releaseOutputSegment();
+        QFile::remove( path );
+    }
+}
+
+bool
+PythonFrameChannel::ensureInputCapacity( qint64 bankBytes, QString& errorMessage )
+{
+    if( mpInputMap && bankBytes <= miBankSize )
+        return true;
+
+    qint64 bankSize = std::max( miBankSize, kMinBankSize );
+    while( bankSize < bankBytes )
+        bankSize *= 2;
+
+    // The host keeps its mapping of the old file until it maps the new one;
+    // removing the name does not invalidate it
+    releaseInputSegment();
+
+    static std::atomic<int> segmentCounter { 0 };
+    const QString path = QStringLiteral( "%1/cvdev_py_%2_in_%3" )
+                             .arg( segmentDirectory() )
+                             .arg( QCoreApplication::applicationPid() )
+                             .arg( ++segmentCounter );
+
+    mpInputFile.reset( new QFile( path ) );
+    if( !mpInputFile->open( QIODevice::ReadWrite | QIODevice::Truncate ) ||
+        !mpInputFile->resize( 2 * bankSize ) )
+    {
+        errorMessage = QStringLiteral( "Cannot create shared memory segment %1" ).arg( path );
+        releaseInputSegment();
+        return false;
+    }
+
+    mpInputMap = mpInputFile->map( 0, 2 * bankSize );
+    if( !mpInputMap )
+    {
+        errorMessage = QStringLiteral( "Cannot map shared memory segment %1" ).arg( path );
+        releaseInputSegment();
+        return false;
+    }
+
+    miBankSize = bankSize;
+    miBank = 0;
+    mbAnnounceInput = true;
+    return true;
+}
+
+void
+PythonFrameChannel::releaseInputSegment()
+{
+    if( mpInputFile )
+    {
+        if( mpInputMap )
+            mpInputFile->unmap( mpInputMap );
+        mpInputFile->close();
+        mpInputFile->remove();
+        mpInputFile.reset();
+    }
+    mpInputMap = nullptr;
+    miBank = 0;
+    mbAnnounceInput = false;
+}
+
+bool
+PythonFrameChannel::mapOutputSegment( const QString& path, qint64 size, QString& errorMessage )
+{
+    if( mpOutputFile && mpOutputFile->fileName() == path && miOutputSize == size )
+        return true;
+
+    releaseOutputSegment();
+
+    mpOutputFile.reset( new QFile( path ) );
+    if( size <= 0 || !mpOutputFile->open( QIODevice::ReadOnly ) || mpOutputFile->size() < size )
+    {
+        errorMessage = QStringLiteral( "Cannot open Python output segment %1" ).arg( path );
+        releaseOutputSegment();
+        return false;
+    }
+
+    mpOutputMap = mpOutputFile->map( 0, size );
+    if( !mpOutputMap )
+    {
+        errorMessage = QStringLiteral( "Cannot map Python output segment %1" ).arg( path );
+        releaseOutputSegment();
+        return false;
+    }
+
+    miOutputSize = size;
+    return true;
+}
+
+void
+PythonFrameChannel::releaseOutputSegment()
+{
+    if( mpOutputFile )
+    {
+        if( mpOutputMap )
+            mpOutputFile->unmap( mpOutputMap );
+        mpOutputFile->close();
+        mpOutputFile.reset();
+    }
+    mpOutputMap = nullptr;
+    miOutputSize = 0;
+}
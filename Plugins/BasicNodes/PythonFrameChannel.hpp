@@ -0,0 +1,172 @@
+//Copyright © 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#pragma once
+
+/**
+ * @file PythonFrameChannel.hpp
+ * @brief Binary IPC between PythonSessionWorker and its Python host process.
+ *
+ * **Control channel:**
+ * Requests go to the host's stdin and responses come back on its stdout as
+ * frames of a 4-byte little-endian length followed by that many bytes of
+ * UTF-8 JSON. The JSON only describes the frame; pixels never pass through it
+ * in SharedMemory mode.
+ *
+ * **Shared memory:**
+ * Each side owns the segment it writes, a file mapped by both processes
+ * (under /dev/shm on Linux, the temp directory elsewhere):
+ * - The input segment belongs to the worker and holds two banks used by
+ *   alternate frames. The host wraps each input image in a read-only numpy
+ *   view of the bank, valid for the call that received it: the bank is
+ *   rewritten two frames later, so a script that keeps a frame needs `.copy()`.
+ * - The output segment belongs to the host, which gives every image output a
+ *   fixed region. The worker copies an output out of its region as soon as the
+ *   response arrives.
+ * A segment that becomes too small is replaced by a larger file, announced
+ * with its path and size in the next message.
+ *
+ * **Changed outputs only:**
+ * In SharedMemory mode the host leaves out of the response every output whose
+ * value is the one sent last time: the same non-image value, or the same array
+ * object with the same content as its region. The node keeps its previous data
+ * for those ports and emits it again, so every run still emits every port.
+ *
+ * The Json transport is the original protocol: images as base64 PNG inside
+ * the JSON, every output on every frame. It needs no shared memory and is the
+ * baseline of PythonSessionWorker::runBenchmark().
+ */
+
+#include <QByteArray>
+#include <QFile>
+#include <QJsonObject>
+#include <QMetaType>
+#include <QString>
+
+#include <opencv2/core.hpp>
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief One execution request of the Python session.
+ *
+ * Image inputs appear in @ref inputs as `{"type":"image","image":i}` where
+ * `i` indexes @ref images; PythonFrameChannel replaces them with shared
+ * memory descriptors or PNG data.
+ */
+struct PythonFrameRequest
+{
+    QString code;
+    int numOutputs{0};
+    QJsonObject inputs;             ///< input0, input1, ... -> value object or null
+    std::vector<cv::Mat> images;
+    std::vector<std::shared_ptr<const void>> imageOwners;  ///< Keep pooled frames from being recycled until copied
+    bool resendOutputs{false};      ///< Send every output, changed or not
+};
+
+/**
+ * @brief Outputs returned by one execution.
+ *
+ * Image outputs appear in @ref outputs as `{"type":"image","image":i}` with
+ * `i` indexing @ref images, which own their pixels.
+ */
+struct PythonFrameResult
+{
+    QJsonObject outputs;            ///< Changed outputs only: output0, ... -> value object
+    std::vector<cv::Mat> images;
+    QString stdoutText;             ///< What the script printed
+};
+
+Q_DECLARE_METATYPE(PythonFrameResult)
+
+/**
+ * @class PythonFrameChannel
+ * @brief Encodes requests and decodes responses of one Python host process.
+ *
+ * Owns the input segment and the mapping of the host's output segment; both
+ * are released by reset(). Not thread-safe: used by the worker thread only.
+ */
+class PythonFrameChannel
+{
+public:
+    enum class Transport
+    {
+        SharedMemory = 0,
+        Json
+    };
+
+    PythonFrameChannel();
+    ~PythonFrameChannel();
+
+    PythonFrameChannel( const PythonFrameChannel& ) = delete;
+    PythonFrameChannel& operator=( const PythonFrameChannel& ) = delete;
+
+    void setTransport( Transport transport ) { meTransport = transport; }
+    Transport transport() const { return meTransport; }
+
+    /**
+     * @brief Wraps @p message in a length-prefixed frame.
+     */
+    static QByteArray frame( const QJsonObject& message );
+
+    /**
+     * @brief Removes the first complete frame from @p buffer.
+     *
+     * @return false if @p buffer does not hold a complete frame yet, or on a
+     *         malformed frame, in which case @p errorMessage is set
+     */
+    static bool takeFrame( QByteArray& buffer, QJsonObject& message, QString& errorMessage );
+
+    /**
+     * @brief Builds the framed execute command of @p request.
+     *
+     * In SharedMemory mode the input images are copied into the next bank of
+     * the input segment, growing it first if needed.
+     *
+     * @return the frame, or an empty array with @p errorMessage set
+     */
+    QByteArray encodeRequest( const PythonFrameRequest& request, QString& errorMessage );
+
+    /**
+     * @brief Extracts the outputs of a successful response.
+     */
+    bool decodeResult( const QJsonObject& response, PythonFrameResult& result, QString& errorMessage );
+
+    /**
+     * @brief Unmaps both segments and removes the input segment file.
+     *
+     * Called when the host process ends; the next request announces a new
+     * input segment.
+     */
+    void reset();
+
+private:
+    bool ensureInputCapacity( qint64 bankBytes, QString& errorMessage );
+    void releaseInputSegment();
+    bool mapOutputSegment( const QString& path, qint64 size, QString& errorMessage );
+    void releaseOutputSegment();
+
+    Transport meTransport { Transport::SharedMemory };
+
+    std::unique_ptr<QFile> mpInputFile;
+    uchar* mpInputMap { nullptr };
+    qint64 miBankSize { 0 };
+    int miBank { 0 };               ///< Bank written by the next request
+    bool mbAnnounceInput { false };
+
+    std::unique_ptr<QFile> mpOutputFile;
+    uchar* mpOutputMap { nullptr };
+    qint64 miOutputSize { 0 };
+};
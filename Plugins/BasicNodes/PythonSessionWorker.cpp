@@ -13,19 +13,26 @@
 //limitations under the License.
 
 #include "PythonSessionWorker.hpp"
+#include "PBNodeMetrics.hpp"
 
 #include <QByteArray>
 #include <QDebug>
 #include <QDir>
-#include <QJsonDocument>
+#include <QElapsedTimer>
 #include <QJsonObject>
 
 namespace
 {
 const char* kPythonHostScript = R"PY(
 import base64
+import contextlib
+import io
 import json
+import mmap
+import os
+import struct
 import sys
+import tempfile
 import traceback
 
 import numpy as np
@@ -38,6 +45,75 @@ except ImportError:
 
 _session = {}
 
+# Framed control channel: 4-byte little-endian length + UTF-8 JSON. Anything
+# else written to stdout (print() outside a frame, C extensions) goes to stderr.
+_protocol_in = sys.stdin.buffer
+_protocol_out = os.fdopen(os.dup(sys.stdout.fileno()), 'wb')
+os.dup2(sys.stderr.fileno(), sys.stdout.fileno())
+if sys.platform == 'win32':
+    import msvcrt
+    msvcrt.setmode(_protocol_in.fileno(), os.O_BINARY)
+    msvcrt.setmode(_protocol_out.fileno(), os.O_BINARY)
+
+_ALIGNMENT = 64
+_MIN_SEGMENT_SIZE = 1 << 20
+
+# OpenCV depth <-> numpy dtype
+_DEPTH_TO_DTYPE = {
+    0: np.dtype(np.uint8),
+    1: np.dtype(np.int8),
+    2: np.dtype(np.uint16),
+    3: np.dtype(np.int16),
+    4: np.dtype(np.int32),
+    5: np.dtype(np.float32),
+    6: np.dtype(np.float64),
+    7: np.dtype(np.float16),
+}
+_DTYPE_TO_DEPTH = {dtype: depth for depth, dtype in _DEPTH_TO_DTYPE.items()}
+
+
+def _align(size):
+    return (size + _ALIGNMENT - 1) // _ALIGNMENT * _ALIGNMENT
+
+
+class Segment:
+    def __init__(self, path, size, create=False):
+        self.path = path
+        self.size = size
+        with open(path, 'w+b' if create else 'r+b') as handle:
+            if create:
+                handle.truncate(size)
+            self.buffer = mmap.mmap(handle.fileno(), size)
+
+    def remove(self):
+        # Views still alive keep the mapping; only the name goes away
+        try:
+            os.remove(self.path)
+        except OSError:
+            pass
+
+
+_input_segment = None
+
+
+def image_view(segment, desc):
+    dtype = _DEPTH_TO_DTYPE[int(desc['depth'])]
+    rows = int(desc['rows'])
+    cols = int(desc['cols'])
+    channels = int(desc['channels'])
+    step = int(desc['step'])
+    if channels == 1:
+        shape = (rows, cols)
+        strides = (step, dtype.itemsize)
+    else:
+        shape = (rows, cols, channels)
+        strides = (step, dtype.itemsize * channels, dtype.itemsize)
+    view = np.ndarray(shape, dtype, buffer=segment.buffer, offset=int(desc['offset']), strides=strides)
+    # The bank is rewritten two frames later: in-place edits fail instead of
+    # leaking into it, and a script keeping the frame must take a .copy()
+    view.setflags(write=False)
+    return view
+
 
 def decode_input(value):
     if value is None:
@@ -57,10 +133,16 @@ def decode_input(value):
 
     data_type = payload.get('type')
 
-    if data_type == 'image' and HAS_CV2:
-        img_data = base64.b64decode(payload.get('data', ''))
-        nparr = np.frombuffer(img_data, np.uint8)
-        return cv2.imdecode(nparr, cv2.IMREAD_UNCHANGED)
+    if data_type == 'image':
+        if 'offset' in payload:
+            if _input_segment is None:
+                return None
+            return image_view(_input_segment, payload)
+        if HAS_CV2:
+            img_data = base64.b64decode(payload.get('data', ''))
+            nparr = np.frombuffer(img_data, np.uint8)
+            return cv2.imdecode(nparr, cv2.IMREAD_UNCHANGED)
+        return None
 
     if data_type == 'double':
         return float(payload.get('data', 0.0))
@@ -94,21 +176,7 @@ def decode_input(value):
     return None
 
 
-def encode_output(value, output_name):
-    if HAS_CV2 and isinstance(value, np.ndarray):
-        ok, buffer = cv2.imencode('.png', value)
-        if not ok:
-            raise ValueError(f'{output_name} image encode failed')
-
-        return {
-            'type': 'image',
-            'data': base64.b64encode(buffer).decode('utf-8'),
-            'rows': value.shape[0],
-            'cols': value.shape[1],
-            'channels': value.shape[2] if len(value.shape) > 2 else 1,
-            'dtype': int(value.dtype.num),
-        }
-
+def encode_value(value, output_name):
     if isinstance(value, (bool, np.bool_)):
         return {'type': 'sync', 'data': bool(value)}
 
@@ -140,71 +208,267 @@ def encode_output(value, output_name):
     raise TypeError(f"{output_name} has unsupported type: {type(value).__name__}")
 
 
+def encode_output(value, output_name):
+    if HAS_CV2 and isinstance(value, np.ndarray):
+        ok, buffer = cv2.imencode('.png', value)
+        if not ok:
+            raise ValueError(f'{output_name} image encode failed')
+
+        return {
+            'type': 'image',
+            'data': base64.b64encode(buffer).decode('utf-8'),
+            'rows': value.shape[0],
+            'cols': value.shape[1],
+            'channels': value.shape[2] if len(value.shape) > 2 else 1,
+            'dtype': int(value.dtype.num),
+        }
+
+    return encode_value(value, output_name)
+
+
+def as_image(value, output_name):
+    if value.dtype == np.bool_:
+        value = value.astype(np.uint8) * 255
+    if value.dtype not in _DTYPE_TO_DEPTH:
+        raise TypeError(f'{output_name} has unsupported image dtype: {value.dtype}')
+    if value.ndim not in (2, 3) or value.size == 0:
+        raise ValueError(f'{output_name} must be a non-empty 2-D or 3-D array, got shape {value.shape}')
+    return value
+
+
+class OutputWriter:
+    """Places image outputs in the output segment and drops unchanged outputs."""
+
+    def __init__(self):
+        self.segment = None
+        self.counter = 0
+        self.announce = False
+        self.regions = {}   # output name -> (offset, capacity)
+        self.sent = {}      # output name -> array object or encoded value sent last
+
+    def close(self):
+        if self.segment is not None:
+            self.segment.remove()
+            self.segment = None
+
+    def _layout(self, images, directory):
+        total = sum(_align(image.nbytes) for image in images.values())
+        if self.segment is None or total > self.segment.size:
+            size = max(self.segment.size if self.segment is not None else 0, _MIN_SEGMENT_SIZE)
+            while size < total:
+                size *= 2
+            self.close()
+            self.counter += 1
+            path = os.path.join(directory, f'cvdev_py_{os.getpid()}_out_{self.counter}')
+            self.segment = Segment(path, size, create=True)
+            self.announce = True
+
+        self.regions = {}
+        offset = 0
+        for name in sorted(images):
+            self.regions[name] = (offset, images[name].nbytes)
+            offset += _align(images[name].nbytes)
+        # The regions moved: nothing the worker holds is in them any more
+        for name in images:
+            self.sent.pop(name, None)
+
+    def encode(self, values, directory):
+        outputs = {}
+        images = {}
+        for name, value in values.items():
+            if isinstance(value, np.ndarray):
+                images[name] = as_image(value, name)
+            else:
+                encoded = encode_value(value, name)
+                if self.sent.get(name) != encoded:
+                    outputs[name] = encoded
+                    self.sent[name] = encoded
+
+        if any(name not in self.regions or self.regions[name][1] < image.nbytes for name, image in images.items()):
+            self._layout(images, directory)
+
+        for name, image in images.items():
+            offset = self.regions[name][0]
+            region = np.ndarray(image.shape, image.dtype, buffer=self.segment.buffer, offset=offset)
+            previous = self.sent.get(name)
+            # Same object: unchanged unless it was modified in place
+            if previous is image and np.array_equal(region, image):
+                continue
+            np.copyto(region, image)
+            self.sent[name] = image
+            outputs[name] = {
+                'type': 'image',
+                'offset': offset,
+                'rows': image.shape[0],
+                'cols': image.shape[1],
+                'channels': image.shape[2] if image.ndim > 2 else 1,
+                'depth': _DTYPE_TO_DEPTH[image.dtype],
+                'step': image.shape[1] * image.itemsize * (image.shape[2] if image.ndim > 2 else 1),
+            }
+        return outputs
+
+
+_writer = OutputWriter()
+_segment_dir = None
+
+
+def read_exact(size):
+    data = bytearray()
+    while len(data) < size:
+        chunk = _protocol_in.read(size - len(data))
+        if not chunk:
+            return None
+        data += chunk
+    return bytes(data)
+
+
+def read_request():
+    header = read_exact(4)
+    if header is None:
+        return None
+    (length,) = struct.unpack('<I', header)
+    body = read_exact(length)
+    if body is None:
+        return None
+    return body
+
+
 def send_response(payload):
-    print(json.dumps(payload), flush=True)
-
-
-while True:
-    line = sys.stdin.readline()
-    if line == '':
-        break
-
-    line = line.strip()
-    if not line:
-        continue
-
-    try:
-        request = json.loads(line)
-    except Exception as exc:
-        send_response({'ok': False, 'error': f'Invalid request JSON: {exc}'})
-        continue
-
-    command = request.get('cmd', 'execute')
-    if command == 'quit':
-        break
-
-    if command != 'execute':
-        send_response({'ok': False, 'error': f"Unknown command: {command}"})
-        continue
-
-    code = request.get('code', '')
-    num_outputs = int(request.get('num_outputs', 0))
-    inputs = request.get('inputs', {})
-
-    for key, value in inputs.items():
-        _session[key] = decode_input(value)
-
-    try:
-        exec(code, _session)
-    except Exception as exc:
-        send_response({
-            'ok': False,
-            'error': f'{type(exc).__name__}: {exc}',
-            'traceback': traceback.format_exc(),
-        })
-        continue
-
-    outputs = {}
-    try:
-        for index in range(num_outputs):
-            output_name = f'output{index}'
-            if output_name in _session:
-                outputs[output_name] = json.dumps(encode_output(_session[output_name], output_name))
-    except Exception as exc:
-        send_response({
-            'ok': False,
-            'error': f'{type(exc).__name__}: {exc}',
-            'traceback': traceback.format_exc(),
-        })
-        continue
-
-    send_response({'ok': True, 'outputs': outputs})
+    body = json.dumps(payload).encode('utf-8')
+    _protocol_out.write(struct.pack('<I', len(body)) + body)
+    _protocol_out.flush()
+
+
+def error_response(exc, captured):
+    return {
+        'ok': False,
+        'error': f'{type(exc).__name__}: {exc}',
+        'traceback': traceback.format_exc(),
+        'stdout': captured.getvalue(),
+    }
+
+
+try:
+    while True:
+        body = read_request()
+        if body is None:
+            break
+
+        try:
+            request = json.loads(body.decode('utf-8'))
+        except Exception as exc:
+            send_response({'ok': False, 'error': f'Invalid request JSON: {exc}'})
+            continue
+
+        command = request.get('cmd', 'execute')
+        if command == 'quit':
+            break
+
+        if command != 'execute':
+            send_response({'ok': False, 'error': f"Unknown command: {command}"})
+            continue
+
+        segment = request.get('input_segment')
+        if segment is not None:
+            # Views of the previous segment keep their own mapping alive
+            _input_segment = Segment(segment['path'], int(segment['size']))
+            _segment_dir = os.path.dirname(segment['path'])
+
+        if request.get('resend', False):
+            _writer.sent.clear()
+
+        code = request.get('code', '')
+        num_outputs = int(request.get('num_outputs', 0))
+        inputs = request.get('inputs', {})
+        shared = request.get('transport', 'json') == 'shm'
+
+        for key, value in inputs.items():
+            _session[key] = decode_input(value)
+
+        captured = io.StringIO()
+        try:
+            with contextlib.redirect_stdout(captured):
+                exec(code, _session)
+        except Exception as exc:
+            send_response(error_response(exc, captured))
+            continue
+
+        response = {'ok': True, 'stdout': captured.getvalue()}
+        try:
+            values = {}
+            for index in range(num_outputs):
+                output_name = f'output{index}'
+                if output_name in _session:
+                    values[output_name] = _session[output_name]
+
+            if shared:
+                outputs = _writer.encode(values, _segment_dir or tempfile.gettempdir())
+                if _writer.announce:
+                    response['output_segment'] = {'path': _writer.segment.path, 'size': _writer.segment.size}
+                    _writer.announce = False
+            else:
+                _writer.sent.clear()
+                outputs = {name: encode_output(value, name) for name, value in values.items()}
+        except Exception as exc:
+            # Some outputs may be marked sent although this response drops them
+            _writer.sent.clear()
+            send_response(error_response(exc, captured))
+            continue
+
+        response['outputs'] = outputs
+        send_response(response)
+finally:
+    _writer.close()
 )PY";
+
+/// Sends @p request to @p process and waits for its answer; used by the benchmark.
+bool
+roundTrip( QProcess& process, PythonFrameChannel& channel, const PythonFrameRequest& request, QString& errorMessage )
+{
+    const QByteArray payload = channel.encodeRequest( request, errorMessage );
+    if( payload.isEmpty() || process.write( payload ) != payload.size() )
+    {
+        if( errorMessage.isEmpty() )
+            errorMessage = QStringLiteral( "Failed to send the request" );
+        return false;
+    }
+
+    QByteArray buffer;
+    QJsonObject response;
+    while( !PythonFrameChannel::takeFrame( buffer, response, errorMessage ) )
+    {
+        if( !errorMessage.isEmpty() )
+            return false;
+        if( !process.waitForReadyRead( 10000 ) )
+        {
+            errorMessage = QStringLiteral( "No answer from Python" );
+            return false;
+        }
+        buffer += process.readAllStandardOutput();
+    }
+
+    if( !response["ok"].toBool( false ) )
+    {
+        errorMessage = response["error"].toString( "Unknown execution error" );
+        return false;
+    }
+
+    PythonFrameResult result;
+    if( !channel.decodeResult( response, result, errorMessage ) )
+        return false;
+    if( result.images.empty() )
+    {
+        errorMessage = QStringLiteral( "output0 did not come back" );
+        return false;
+    }
+    return true;
+}
 }
 
 PythonSessionWorker::PythonSessionWorker( QObject* parent )
     : QObject( parent )
 {
+    qRegisterMetaType<PythonFrameResult>();
 }
 
 PythonSessionWorker::~PythonSessionWorker()
@@ -223,18 +487,24 @@ PythonSessionWorker::createHostScriptFile()
     }
 
     mpHostScriptFile = new QTemporaryFile();
-    mpHostScriptFile->setAutoRemove( true );
-    mpHostScriptFile->setFileTemplate( QDir::tempPath() + "/cvdev_python_host_XXXXXX.py" );
+    return writeHostScript( *mpHostScriptFile );
+}
+
+bool
+PythonSessionWorker::writeHostScript( QTemporaryFile& file )
+{
+    file.setAutoRemove( true );
+    file.setFileTemplate( QDir::tempPath() + "/cvdev_python_host_XXXXXX.py" );
 
-    if( !mpHostScriptFile->open() )
+    if( !file.open() )
         return false;
 
     const QByteArray scriptBytes( kPythonHostScript );
-    if( mpHostScriptFile->write( scriptBytes ) != scriptBytes.size() )
+    if( file.write( scriptBytes ) != scriptBytes.size() )
         return false;
 
-    mpHostScriptFile->flush();
-    mpHostScriptFile->close();
+    file.flush();
+    file.close();
     return true;
 }
 
@@ -248,7 +518,8 @@ PythonSessionWorker::cleanupProcess()
         mpProcess = nullptr;
     }
 
-    msStdoutBuffer.clear();
+    mChannel.reset();
+    mStdoutBuffer.clear();
     msStderrBuffer.clear();
 }
 
@@ -301,8 +572,9 @@ PythonSessionWorker::stopSession()
     {
         if( mpProcess->state() == QProcess::Running )
         {
-            const QByteArray quitCommand = "{\"cmd\":\"quit\"}\n";
-            mpProcess->write( quitCommand );
+            QJsonObject quitCommand;
+            quitCommand["cmd"] = "quit";
+            mpProcess->write( PythonFrameChannel::frame( quitCommand ) );
             mpProcess->waitForBytesWritten( 500 );
 
             if( !mpProcess->waitForFinished( 1500 ) )
@@ -325,7 +597,7 @@ PythonSessionWorker::stopSession()
 }
 
 void
-PythonSessionWorker::executeFrame( const QString& code, const QString& inputsJson, int numOutputs )
+PythonSessionWorker::executeFrame( const PythonFrameRequest& request )
 {
     if( !mpProcess || mpProcess->state() != QProcess::Running )
     {
@@ -333,15 +605,14 @@ PythonSessionWorker::executeFrame( const QString& code, const QString& inputsJso
         return;
     }
 
-    QJsonObject request;
-    request["cmd"] = "execute";
-    request["code"] = code;
-    request["num_outputs"] = numOutputs;
-
-    QJsonDocument inputsDoc = QJsonDocument::fromJson( inputsJson.toUtf8() );
-    request["inputs"] = inputsDoc.isObject() ? inputsDoc.object() : QJsonObject();
+    QString errorMessage;
+    const QByteArray payload = mChannel.encodeRequest( request, errorMessage );
+    if( payload.isEmpty() )
+    {
+        Q_EMIT executionError( errorMessage );
+        return;
+    }
 
-    const QByteArray payload = QJsonDocument( request ).toJson( QJsonDocument::Compact ) + '\n';
     if( mpProcess->write( payload ) != payload.size() )
     {
         Q_EMIT executionError( "Failed to send execution request to Python session" );
@@ -358,49 +629,137 @@ PythonSessionWorker::setExecutablePath( const QString& executablePath )
 }
 
 void
-PythonSessionWorker::onReadyReadStdout()
+PythonSessionWorker::setTransport( int transport )
 {
-    if( !mpProcess )
-        return;
+    mChannel.setTransport( transport == static_cast<int>( PythonFrameChannel::Transport::Json )
+                               ? PythonFrameChannel::Transport::Json
+                               : PythonFrameChannel::Transport::SharedMemory );
+}
 
-    msStdoutBuffer += QString::fromUtf8( mpProcess->readAllStandardOutput() );
+void
+PythonSessionWorker::runBenchmark( const cv::Mat& frame, int iterations )
+{
+    QTemporaryFile script;
+    if( frame.empty() || iterations < 1 || !writeHostScript( script ) )
+    {
+        Q_EMIT benchmarkFinished( "IPC benchmark: nothing to measure" );
+        return;
+    }
 
-    int newlineIndex = msStdoutBuffer.indexOf( '\n' );
-    while( newlineIndex >= 0 )
+    PythonFrameRequest request;
+    request.code = QStringLiteral( "output0 = input0" );
+    request.numOutputs = 1;
+    request.images.push_back( frame );
+    QJsonObject image;
+    image["type"] = "image";
+    image["image"] = 0;
+    request.inputs["input0"] = image;
+
+    QString report = QStringLiteral( "IPC benchmark: %1x%2, %3 channel(s), %4 frames, output0 = input0\n" )
+                         .arg( frame.cols )
+                         .arg( frame.rows )
+                         .arg( frame.channels() )
+                         .arg( iterations );
+    double meanMs[2] = { 0.0, 0.0 };
+
+    const PythonFrameChannel::Transport transports[2] = { PythonFrameChannel::Transport::SharedMemory,
+                                                          PythonFrameChannel::Transport::Json };
+    for( int t = 0; t < 2; ++t )
     {
-        const QString line = msStdoutBuffer.left( newlineIndex ).trimmed();
-        msStdoutBuffer.remove( 0, newlineIndex + 1 );
+        const QString name = t == 0 ? QStringLiteral( "shared memory" ) : QStringLiteral( "json/png" );
+        PythonFrameChannel channel;
+        channel.setTransport( transports[t] );
+
+        QProcess process;
+        process.start( msExecutablePath, QStringList() << script.fileName() );
+        if( !process.waitForStarted( 3000 ) )
+        {
+            report += QStringLiteral( "%1: cannot start Python interpreter\n" ).arg( name );
+            continue;
+        }
+
+        PBLatencyHistogram histogram;
+        QString errorMessage;
+        // The first frame pays for imports and segment creation
+        bool ok = roundTrip( process, channel, request, errorMessage );
+        QElapsedTimer timer;
+        for( int i = 0; ok && i < iterations; ++i )
+        {
+            timer.start();
+            ok = roundTrip( process, channel, request, errorMessage );
+            histogram.record( static_cast<uint64_t>( timer.nsecsElapsed() ) );
+        }
+
+        QJsonObject quitCommand;
+        quitCommand["cmd"] = "quit";
+        process.write( PythonFrameChannel::frame( quitCommand ) );
+        if( !process.waitForFinished( 1500 ) )
+            process.kill();
+        channel.reset();
 
-        if( line.isEmpty() )
+        if( !ok )
         {
-            newlineIndex = msStdoutBuffer.indexOf( '\n' );
+            report += QStringLiteral( "%1: failed: %2\n" ).arg( name, errorMessage.left( 200 ) );
             continue;
         }
 
-        const QJsonDocument responseDoc = QJsonDocument::fromJson( line.toUtf8() );
-        if( !responseDoc.isObject() )
+        const PBLatencyHistogram::Summary summary = histogram.summary();
+        meanMs[t] = summary.meanMs;
+        report += QStringLiteral( "%1: mean %2 ms, p50 %3 ms, p95 %4 ms, max %5 ms\n" )
+                      .arg( name )
+                      .arg( summary.meanMs, 0, 'f', 2 )
+                      .arg( summary.p50Ms, 0, 'f', 2 )
+                      .arg( summary.p95Ms, 0, 'f', 2 )
+                      .arg( summary.maxMs, 0, 'f', 2 );
+    }
+
+    if( meanMs[0] > 0.0 && meanMs[1] > 0.0 )
+        report += QStringLiteral( "speedup: %1x" ).arg( meanMs[1] / meanMs[0], 0, 'f', 1 );
+
+    qInfo().noquote() << report;
+    Q_EMIT benchmarkFinished( report.trimmed() );
+}
+
+void
+PythonSessionWorker::onReadyReadStdout()
+{
+    if( !mpProcess )
+        return;
+
+    mStdoutBuffer += mpProcess->readAllStandardOutput();
+
+    while( true )
+    {
+        QJsonObject responseObj;
+        QString errorMessage;
+        if( !PythonFrameChannel::takeFrame( mStdoutBuffer, responseObj, errorMessage ) )
         {
-            Q_EMIT executionError( "Python session returned invalid JSON response" );
-            newlineIndex = msStdoutBuffer.indexOf( '\n' );
+            if( errorMessage.isEmpty() )
+                break;
+            Q_EMIT executionError( errorMessage );
             continue;
         }
 
-        const QJsonObject responseObj = responseDoc.object();
         if( responseObj["ok"].toBool( false ) )
         {
-            const QJsonObject outputsObj = responseObj["outputs"].toObject();
-            Q_EMIT resultReady( QString::fromUtf8( QJsonDocument( outputsObj ).toJson( QJsonDocument::Compact ) ) );
+            // Output images are copied out of the host's segment before the next request
+            PythonFrameResult result;
+            if( mChannel.decodeResult( responseObj, result, errorMessage ) )
+                Q_EMIT resultReady( result );
+            else
+                Q_EMIT executionError( errorMessage );
         }
         else
         {
-            QString errorMessage = responseObj["error"].toString( "Unknown execution error" );
+            errorMessage = responseObj["error"].toString( "Unknown execution error" );
             const QString traceback = responseObj["traceback"].toString();
             if( !traceback.isEmpty() )
                 errorMessage += "\n" + traceback;
+            const QString printed = responseObj["stdout"].toString().trimmed();
+            if( !printed.isEmpty() )
+                errorMessage += "\n" + printed;
             Q_EMIT executionError( errorMessage );
         }
-
-        newlineIndex = msStdoutBuffer.indexOf( '\n' );
     }
 }
 
@@ -14,11 +14,20 @@
 
 #pragma once
 
+#include "PythonFrameChannel.hpp"
+
 #include <QObject>
 #include <QProcess>
 #include <QTemporaryFile>
 #include <QString>
 
+/**
+ * @brief Runs the Python session of a PythonEditorModel in a host process.
+ *
+ * Lives on the node's worker thread. Frames are exchanged through
+ * PythonFrameChannel: images in shared memory by default, or base64 PNG
+ * inside the JSON with the Json transport.
+ */
 class PythonSessionWorker : public QObject
 {
     Q_OBJECT
@@ -30,14 +39,34 @@ public:
 public Q_SLOTS:
     void startSession();
     void stopSession();
-    void executeFrame( const QString& code, const QString& inputsJson, int numOutputs );
     void setExecutablePath( const QString& executablePath );
+    /// @param transport a PythonFrameChannel::Transport value; applies from the next frame
+    void setTransport( int transport );
+
+public:
+    /**
+     * @brief Sends one frame to the session; the answer is resultReady() or executionError().
+     *
+     * Call on the worker thread, e.g. through QMetaObject::invokeMethod() with a functor.
+     */
+    void executeFrame( const PythonFrameRequest& request );
+
+    /**
+     * @brief Measures the round trip of @p frame through each transport.
+     *
+     * Starts a separate host process per transport running
+     * `output0 = input0` and times @p iterations frames after one warm-up
+     * frame. The running session is not touched. Blocks the worker thread
+     * until done, then emits benchmarkFinished() with a text report.
+     */
+    void runBenchmark( const cv::Mat& frame, int iterations );
 
 Q_SIGNALS:
     void sessionStarted();
     void sessionFailed( const QString& errorMessage );
-    void resultReady( const QString& outputsJson );
+    void resultReady( const PythonFrameResult& result );
     void executionError( const QString& errorMessage );
+    void benchmarkFinished( const QString& report );
 
 private Q_SLOTS:
     void onReadyReadStdout();
@@ -47,13 +76,15 @@ private Q_SLOTS:
 
 private:
     bool createHostScriptFile();
+    static bool writeHostScript( QTemporaryFile& file );
     void cleanupProcess();
 
     QProcess* mpProcess { nullptr };
     QTemporaryFile* mpHostScriptFile { nullptr };
     QString msExecutablePath { "python3" };
+    PythonFrameChannel mChannel;
 
-    QString msStdoutBuffer;
+    QByteArray mStdoutBuffer;
     QString msStderrBuffer;
 
     bool mbStopping { false };
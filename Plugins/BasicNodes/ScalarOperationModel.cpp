@@ -176,10 +176,6 @@ ScalarOperationModel::
 processData(std::shared_ptr< InformationData > (&in)[2], std::shared_ptr<InformationData> & out,
             const ScalarOperationParameters & params )
 {
-    for(std::shared_ptr<InformationData>& info : in)
-    {
-        info->set_information();
-    }
     const double& in0 = in[0]->info().toDouble();
     const double& in1 = in[1]->info().toDouble();
 
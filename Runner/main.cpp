@@ -0,0 +1,857 @@
+//Copyright © 2025 - 2026, NECTEC, all rights reserved
+
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+
+//    http://www.apache.org/licenses/LICENSE-2.0
+
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+/**
+ * @file main.cpp
+ * @brief cvdev-run: runs a .flow file without the editor.
+ *
+ * Loads a flow through PBDataFlowGraphModel::load_from_file() with the node
+ * delegates in headless mode: no scene, view or painter is created, embedded
+ * widgets are never shown and display nodes skip their per-frame drawing.
+ * Node plugins still build their widgets in their constructors, which needs a
+ * QApplication, so the runner defaults QT_QPA_PLATFORM to "offscreen" and no
+ * display is required.
+ *
+ * @code
+ * cvdev-run camera.flow --transport zenoh_only --duration 3600 \
+ *           --stats stats.json --stats-interval 10
+ * @endcode
+ *
+ * --evaluation pull (or `[Graph] evaluation_mode=pull`) computes only the
+ * nodes an active sink depends on; see PBDataFlowGraphModel::EvaluationMode.
+ * --scheduling wave (or `[Graph] scheduling=wave`) fires every node once per
+ * frame in topological order; see PBDataFlowGraphModel::Scheduling.
+ * --buffer-reuse (or `[Graph] buffer_reuse=true`) drops each image output once
+ * its last consumer has it; the "buffer_plan" object of --stats and the lines
+ * printed on exit give the peak resident image memory without it, with it as
+ * far as the producers can release, in theory, and as measured by CVMatArena.
+ *
+ * With --codec-benchmark no flow is loaded: the runner encodes and decodes an
+ * image with every transport codec (see ImageCodecSettings) and prints the
+ * payload size and per-frame times, to choose a codec per port.
+ *
+ * @code
+ * cvdev-run --codec-benchmark frame.png --iterations 50
+ * @endcode
+ *
+ * With --chunk-loopback no flow is loaded either: frames of the given size go
+ * through the chunked frame transfer of `[FrameChunking]` (PBFrameLoopback)
+ * over an in-process link that drops chunks, and the runner prints how many
+ * arrive intact, expire or are superseded.
+ *
+ * @code
+ * cvdev-run --chunk-loopback 24883200 --drop-rate 0.01 --retransmit --iterations 300
+ * @endcode
+ *
+ * With --startup-benchmark the flow is loaded repeatedly instead of run, and
+ * the runner prints the mean flow startup time and the part of it spent
+ * building the execution plan (PBExecutionPlan).
+ *
+ * @code
+ * cvdev-run camera.flow --startup-benchmark --iterations 10
+ * @endcode
+ *
+ * With --queue-benchmark no flow is loaded: 64-bit items go from 1, 2 and 8
+ * producer threads to one consumer through a 1024-slot PBAsyncQueue,
+ * PBMpscQueue and (one producer) PBSpscQueue, one at a time and in batches of
+ * 32, and the runner prints the throughput of each. Rows with more producers
+ * than hardware threads measure time slicing rather than contention.
+ *
+ * @code
+ * cvdev-run --queue-benchmark --iterations 50
+ * @endcode
+ *
+ * With --log-benchmark no flow is loaded either: the runner times a
+ * DEBUG_LOG_INFO() statement with the DebugLogging.info category enabled (the
+ * message discarded), disabled at run time, and compiled below
+ * CVDEV_LOG_MIN_LEVEL, and prints the nanoseconds per call of each.
+ *
+ * @code
+ * cvdev-run --log-benchmark --iterations 100
+ * @endcode
+ */
+
+#include "CVDevLibrary.hpp"
+#include "CVMatArena.hpp"
+#include "CycloneDDSBridge.hpp"
+#include "DebugLogging.hpp"
+#include "NodeDataSerializer.hpp"
+#include "PBAsyncDataModel.hpp"
+#include "PBAsyncQueue.hpp"
+#include "PBDataFlowGraphModel.hpp"
+#include "PBExecutionPlan.hpp"
+#include "PBFrameTransfer.hpp"
+#include "PBLinkStats.hpp"
+#include "PBLockFreeQueue.hpp"
+#include "PBNodeDelegateModel.hpp"
+#include "PBTransportRouter.hpp"
+#include "PBWorkerExecutor.hpp"
+#include "PluginInterface.hpp"
+#include "TransportModeManager.hpp"
+#include "ZenohBridge.hpp"
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLoggingCategory>
+#include <QPluginLoader>
+#include <QSaveFile>
+#include <QSettings>
+#include <QTimer>
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+std::atomic<bool> gbStopRequested{false};
+
+void
+requestStop(int)
+{
+    gbStopRequested.store(true);
+}
+
+QJsonObject
+collectStats(PBDataFlowGraphModel *model, qint64 elapsedMs)
+{
+    QJsonArray nodes;
+    for (const auto nodeId : model->allNodeIds())
+    {
+        auto *asyncModel = model->delegateModel<PBAsyncDataModel>(nodeId);
+        if (!asyncModel)
+            continue;
+        QJsonObject node = asyncModel->backPressureStats().toJson();
+        node["id"] = asyncModel->getNodeId();
+        node["caption"] = asyncModel->caption();
+        nodes.append(node);
+    }
+
+    QJsonArray metrics;
+    for (const auto &snapshot : model->nodeMetrics())
+        metrics.append(snapshot.toJson());
+
+    const ExecutorStats executorStats = PBWorkerExecutor::instance().stats();
+    QJsonObject executor;
+    executor["executed"] = static_cast<qint64>(executorStats.executed);
+    executor["stolen"] = static_cast<qint64>(executorStats.stolen);
+    executor["parks"] = static_cast<qint64>(executorStats.parks);
+    executor["workers"] = executorStats.workers;
+    executor["numa_nodes"] = executorStats.numaNodes;
+
+    const MatArenaStats arenaStats = CVMatArena::instance().stats();
+    QJsonObject arena;
+    arena["hits"] = static_cast<qint64>(arenaStats.hits);
+    arena["misses"] = static_cast<qint64>(arenaStats.misses);
+    arena["evictions"] = static_cast<qint64>(arenaStats.evictions);
+    arena["bypassed"] = static_cast<qint64>(arenaStats.bypassed);
+    arena["bytes_in_use"] = static_cast<qint64>(arenaStats.bytesInUse);
+    arena["bytes_cached"] = static_cast<qint64>(arenaStats.bytesCached);
+    arena["peak_bytes_in_use"] = static_cast<qint64>(arenaStats.peakBytesInUse);
+
+    QJsonArray zenoh;
+    for (const auto &subscription : ZenohBridge::instance().subscriptionStats())
+    {
+        QJsonObject entry;
+        entry["key"] = subscription.key;
+        entry["received"] = static_cast<qint64>(subscription.received);
+        entry["decoded"] = static_cast<qint64>(subscription.decoded);
+        entry["dropped"] = static_cast<qint64>(subscription.dropped);
+        entry["decode"] = subscription.decode.toJson();
+        zenoh.append(entry);
+    }
+
+    QJsonArray publishers;
+    for (const auto &publisher : ZenohBridge::instance().publisherStats())
+    {
+        QJsonObject entry;
+        entry["key"] = publisher.key;
+        entry["published"] = static_cast<qint64>(publisher.published);
+        entry["coalesced"] = static_cast<qint64>(publisher.coalesced);
+        publishers.append(entry);
+    }
+
+    QJsonArray links;
+    for (const auto &link : PBLinkStats::instance().snapshot())
+        links.append(link.toJson());
+
+    QJsonArray frameTransfer;
+    for (const auto &transfer : ZenohBridge::instance().frameTransferStats())
+        frameTransfer.append(transfer.toJson());
+    for (const auto &transfer : CycloneDDSBridge::instance().frameTransferStats())
+        frameTransfer.append(transfer.toJson());
+
+    QJsonObject json;
+    json["flow"] = model->transportFlowFilename();
+    json["transport"] = TransportModeManager::settingFromTransportMode(
+        TransportModeManager::instance().getTransportMode());
+    json["timestamp"] = QDateTime::currentDateTime().toString(Qt::ISODateWithMs);
+    json["elapsed_ms"] = elapsedMs;
+    json["evaluation"] = PBDataFlowGraphModel::settingFromEvaluationMode(model->evaluationMode());
+    json["dirty_nodes"] = static_cast<qint64>(model->dirtyNodeCount());
+    json["scheduling"] = PBDataFlowGraphModel::settingFromScheduling(model->scheduling());
+    json["waves"] = static_cast<qint64>(model->waveCount());
+    json["execution_plan"] = model->executionPlan().summary();
+    json["buffer_plan"] = model->bufferReport();
+    json["nodes"] = nodes;
+    json["metrics"] = metrics;
+    json["executor"] = executor;
+    json["arena"] = arena;
+    json["zenoh_subscriptions"] = zenoh;
+    json["zenoh_publishers"] = publishers;
+    json["links"] = links;
+    json["frame_transfer"] = frameTransfer;
+    return json;
+}
+
+bool
+writeStats(const QString &filePath, PBDataFlowGraphModel *model, qint64 elapsedMs)
+{
+    // A .csv file gets the per-node metrics table only.
+    if (QFileInfo(filePath).suffix().compare("csv", Qt::CaseInsensitive) == 0)
+        return model->export_node_metrics(filePath);
+
+    const QJsonObject json = collectStats(model, elapsedMs);
+    // Readers polling the file never see a half-written document.
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+    file.write(QJsonDocument(json).toJson(QJsonDocument::Indented));
+    return file.commit();
+}
+
+/// Encodes and decodes @p imagePath with each codec and prints size and timings.
+int
+runCodecBenchmark(const QString &imagePath, int iterations)
+{
+    cv::Mat image = cv::imread(imagePath.toStdString(), cv::IMREAD_UNCHANGED);
+    if (image.empty())
+    {
+        std::fprintf(stderr, "cvdev-run: cannot read image %s\n", qPrintable(imagePath));
+        return 1;
+    }
+    auto data = std::make_shared<CVImageData>(image);
+
+    struct Case
+    {
+        const char *name;
+        NodeDataSerializer::ImageEncoding encoding;
+        int jpegQuality;
+        int pngLevel;
+    };
+    const Case cases[] = {
+        { "raw",      NodeDataSerializer::ImageEncoding::RAW,      95, 1 },
+        { "lossless", NodeDataSerializer::ImageEncoding::LOSSLESS, 95, 1 },
+        { "png-1",    NodeDataSerializer::ImageEncoding::PNG,      95, 1 },
+        { "png-6",    NodeDataSerializer::ImageEncoding::PNG,      95, 6 },
+        { "jpeg-95",  NodeDataSerializer::ImageEncoding::JPEG,     95, 1 },
+        { "jpeg-80",  NodeDataSerializer::ImageEncoding::JPEG,     80, 1 },
+    };
+
+    const double rawBytes = static_cast<double>(image.total() * image.elemSize());
+    std::printf("%dx%d, %d channel(s), %.0f bytes of pixels, %d iterations\n",
+                image.cols, image.rows, image.channels(), rawBytes, iterations);
+    std::printf("%-10s %12s %8s %11s %11s %7s\n",
+                "codec", "bytes/frame", "ratio", "encode ms", "decode ms", "exact");
+
+    for (const Case &test : cases)
+    {
+        ImageCodecSettings codec;
+        codec.encoding = test.encoding;
+        codec.jpegQuality = test.jpegQuality;
+        codec.pngLevel = test.pngLevel;
+
+        // Encoding includes flattening the payload, as every transport sends one buffer
+        std::vector<uint8_t> payload;
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < iterations; ++i)
+            payload = NodeDataSerializer::serializeSegments(data, codec).flatten();
+        const double encodeMs = timer.nsecsElapsed() / 1e6 / iterations;
+
+        std::shared_ptr<QtNodes::NodeData> decoded;
+        timer.restart();
+        for (int i = 0; i < iterations; ++i)
+            decoded = NodeDataSerializer::deserialize(payload);
+        const double decodeMs = timer.nsecsElapsed() / 1e6 / iterations;
+
+        auto decodedImage = std::dynamic_pointer_cast<CVImageData>(decoded);
+        const bool exact = decodedImage && decodedImage->data().size == image.size &&
+                           decodedImage->data().type() == image.type() &&
+                           cv::norm(decodedImage->data(), image, cv::NORM_INF) == 0;
+
+        std::printf("%-10s %12zu %7.2fx %11.3f %11.3f %7s\n",
+                    test.name, payload.size(), rawBytes / std::max<size_t>(1, payload.size()),
+                    encodeMs, decodeMs, exact ? "yes" : "no");
+    }
+    return 0;
+}
+
+/// Sends @p frames payloads of @p payloadBytes through a lossy in-process chunk link and prints the outcome.
+int
+runChunkLoopback(const FrameLoopbackConfig &config, size_t payloadBytes, int frames)
+{
+    PBFrameLoopback loopback(config);
+    const FrameLoopbackResult result = loopback.run(frames, payloadBytes);
+    const FrameTransferStats &stats = result.stats;
+
+    std::printf("%zu bytes/frame in %zu-byte chunks, %.1f MB/s link, %.3f drop rate, deadline %d ms, retransmit %s\n",
+                payloadBytes, config.chunking.chunkBytes, config.linkMBps, config.dropRate,
+                config.chunking.deadlineMs, config.chunking.retransmit ? "on" : "off");
+    std::printf("frames: %d sent, %d delivered, %d intact, %llu expired, %llu superseded\n",
+                result.framesSent, result.framesDelivered, result.framesIntact,
+                static_cast<unsigned long long>(stats.framesExpired),
+                static_cast<unsigned long long>(stats.framesSuperseded));
+    std::printf("chunks: %llu sent, %llu resent, %llu received, %llu duplicate, %llu stale; %llu NACKs\n",
+                static_cast<unsigned long long>(stats.chunksSent),
+                static_cast<unsigned long long>(stats.chunksResent),
+                static_cast<unsigned long long>(stats.chunksReceived),
+                static_cast<unsigned long long>(stats.chunksDuplicate),
+                static_cast<unsigned long long>(stats.chunksStale),
+                static_cast<unsigned long long>(stats.nacksSent));
+    std::printf("%.3f ms per frame to chunk and reassemble\n", result.wallMs / std::max(1, result.framesSent));
+    return result.framesIntact == result.framesDelivered ? 0 : 1;
+}
+
+/// Loads @p flowFile @p iterations times and prints the mean flow startup time
+/// and the time of it spent building the execution plan.
+int
+runStartupBenchmark(const std::shared_ptr<QtNodes::NodeDelegateModelRegistry> &registry,
+                    const QString &flowFile, int iterations)
+{
+    auto loadOnce = [&](double &loadMs, double &planMs, qint64 &nodes) {
+        auto *model = new PBDataFlowGraphModel(registry);
+        QElapsedTimer timer;
+        timer.start();
+        bool ok = model->load_from_file(flowFile);
+        if (ok)
+        {
+            const PBExecutionPlan &plan = model->executionPlan();
+            loadMs += timer.nsecsElapsed() / 1e6;
+            planMs += plan.prepareMs();
+            nodes = static_cast<qint64>(plan.order().size());
+        }
+        else
+        {
+            std::fprintf(stderr, "cvdev-run: could not load %s\n", qPrintable(flowFile));
+            for (const QString &error : model->loadErrors())
+                std::fprintf(stderr, "  %s\n", qPrintable(error));
+        }
+        delete model;
+        // Runs what the nodes deferred, so it is not charged to the next load
+        QCoreApplication::processEvents();
+        return ok;
+    };
+
+    // Warms the plugin libraries and the file cache
+    double warmLoadMs = 0.0;
+    double warmPlanMs = 0.0;
+    qint64 nodes = 0;
+    if (!loadOnce(warmLoadMs, warmPlanMs, nodes))
+        return 1;
+
+    double loadMs = 0.0;
+    double planMs = 0.0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        if (!loadOnce(loadMs, planMs, nodes))
+            return 1;
+    }
+    std::printf("%s: %lld nodes, %d iterations\n", qPrintable(QFileInfo(flowFile).fileName()),
+                static_cast<long long>(nodes), iterations);
+    std::printf("%12s %12s\n", "startup ms", "plan ms");
+    std::printf("%12.3f %12.3f\n", loadMs / iterations, planMs / iterations);
+    return 0;
+}
+
+/// Moves @p items values from @p producers threads to one consumer through a 1024-slot @p Queue,
+/// @p batch at a time, and returns millions of items per second; @p intact is false if any were lost.
+template<typename Queue>
+double
+queueThroughput(int producers, size_t items, size_t batch, bool &intact)
+{
+    Queue queue(1024);
+    const size_t perProducer = items / producers;
+    const size_t total = perProducer * producers;
+
+    QElapsedTimer timer;
+    timer.start();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&queue, perProducer, batch, p]() {
+            std::vector<uint64_t> values(batch);
+            uint64_t next = static_cast<uint64_t>(p) * perProducer;
+            for (size_t sent = 0; sent < perProducer;)
+            {
+                const size_t count = std::min(batch, perProducer - sent);
+                for (size_t i = 0; i < count; ++i)
+                    values[i] = next++;
+                if (batch == 1)
+                    queue.enqueue(values[0]);
+                else
+                    queue.enqueue_bulk(values.begin(), count);
+                sent += count;
+            }
+        });
+    }
+
+    // Every value 0..total-1 is sent once, so the sum shows a lost or repeated item
+    std::vector<uint64_t> received(batch);
+    uint64_t sum = 0;
+    for (size_t taken = 0; taken < total;)
+    {
+        size_t count = 0;
+        if (batch == 1)
+            count = queue.dequeue(received[0]) ? 1 : 0;
+        else
+            count = queue.dequeue_bulk(received.begin(), batch);
+        for (size_t i = 0; i < count; ++i)
+            sum += received[i];
+        taken += count;
+    }
+    const double seconds = timer.nsecsElapsed() / 1e9;
+    for (auto &thread : threads)
+        thread.join();
+
+    intact = sum == static_cast<uint64_t>(total) * (total - 1) / 2;
+    return total / seconds / 1e6;
+}
+
+/// Prints the throughput of each queue with 1, 2 and 8 producers, single items and batches of 32.
+int
+runQueueBenchmark(size_t items)
+{
+    const unsigned hardwareThreads = std::thread::hardware_concurrency();
+    std::printf("%zu items per case, 1024-slot queues of 64-bit items, %u hardware thread(s)\n",
+                items, hardwareThreads);
+    if (hardwareThreads > 0 && hardwareThreads < 9)
+        std::printf("note: fewer hardware threads than 8 producers + 1 consumer, "
+                    "rows with more than %u producer(s) are time-sliced\n", hardwareThreads - 1);
+    std::printf("%-8s %10s %6s %12s %7s\n", "queue", "producers", "batch", "M items/s", "intact");
+
+    bool allIntact = true;
+    auto report = [&](const char *name, int producers, size_t batch, double rate, bool intact) {
+        std::printf("%-8s %10d %6zu %12.2f %7s\n", name, producers, batch, rate, intact ? "yes" : "no");
+        allIntact = allIntact && intact;
+    };
+    for (const size_t batch : {size_t(1), size_t(32)})
+    {
+        for (const int producers : {1, 2, 8})
+        {
+            bool intact = false;
+            const double rate = queueThroughput<PBAsyncQueue<uint64_t>>(producers, items, batch, intact);
+            report("async", producers, batch, rate, intact);
+        }
+        for (const int producers : {1, 2, 8})
+        {
+            bool intact = false;
+            const double rate = queueThroughput<PBMpscQueue<uint64_t>>(producers, items, batch, intact);
+            report("mpsc", producers, batch, rate, intact);
+        }
+        bool intact = false;
+        const double rate = queueThroughput<PBSpscQueue<uint64_t>>(1, items, batch, intact);
+        report("spsc", 1, batch, rate, intact);
+    }
+    return allIntact ? 0 : 1;
+}
+
+/// Message handler of the enabled --log-benchmark case.
+void
+discardMessage(QtMsgType, const QMessageLogContext &, const QString &)
+{
+}
+
+/// Times @p calls DEBUG_LOG_INFO() statements with the category enabled and disabled,
+/// and the same statement below the CVDEV_LOG_MIN_LEVEL floor, and prints ns per call.
+int
+runLogBenchmark(int calls)
+{
+    auto nsPerCall = [calls](auto &&statement) {
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < calls; ++i)
+            statement(i);
+        return static_cast<double>(timer.nsecsElapsed()) / calls;
+    };
+    auto logStatement = [](int i) { DEBUG_LOG_INFO() << "frame" << i << "done"; };
+    // What DEBUG_LOG_INFO() expands to when CVDEV_LOG_MIN_LEVEL is above INFO
+    auto belowFloorStatement = [](int i) {
+        CVDEV_LOG_DISABLED() << DebugLog::Prefix{"Info", CVDEV_LOG_FILE_NAME, __LINE__} << "frame" << i << "done";
+    };
+
+    // QT_LOGGING_RULES is applied after setFilterRules() and would override it
+    QLoggingCategory::setFilterRules(QStringLiteral("DebugLogging.info=true"));
+    const bool canEnable = DebugLogging().isInfoEnabled();
+    QLoggingCategory::setFilterRules(QStringLiteral("DebugLogging.info=false"));
+    const bool canDisable = !DebugLogging().isInfoEnabled();
+    if (!canEnable || !canDisable)
+    {
+        QLoggingCategory::setFilterRules(QString());
+        std::fprintf(stderr, "cvdev-run: QT_LOGGING_RULES fixes DebugLogging.info; unset it for --log-benchmark\n");
+        return 1;
+    }
+
+    std::printf("%d calls per case, CVDEV_LOG_MIN_LEVEL %d%s\n", calls, CVDEV_LOG_MIN_LEVEL,
+                CVDEV_LOG_MIN_LEVEL > CVDEV_LOG_LEVEL_INFO ? " (DEBUG_LOG_INFO() is compiled out in this build)" : "");
+    std::printf("%-20s %10s\n", "DEBUG_LOG_INFO()", "ns/call");
+
+    QLoggingCategory::setFilterRules(QStringLiteral("DebugLogging.info=true"));
+    const QtMessageHandler previousHandler = qInstallMessageHandler(discardMessage);
+    const double enabledNs = nsPerCall(logStatement);
+    qInstallMessageHandler(previousHandler);
+    std::printf("%-20s %10.2f\n", "enabled, discarded", enabledNs);
+
+    QLoggingCategory::setFilterRules(QStringLiteral("DebugLogging.info=false"));
+    std::printf("%-20s %10.2f\n", "category disabled", nsPerCall(logStatement));
+    std::printf("%-20s %10.2f\n", "below floor", nsPerCall(belowFloorStatement));
+
+    QLoggingCategory::setFilterRules(QString());
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication app(argc, argv);
+    QCoreApplication::setOrganizationName("NECTEC");
+    QCoreApplication::setApplicationName("CVDev");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Runs a CVDev .flow file without the editor.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("flow", "Flow file to run.");
+    QCommandLineOption transportOption("transport",
+        "Transport mode: qt_only, zenoh_only, cyclonedds_only or shared_memory_only. Default: transport_mode of cvdev.ini.",
+        "mode");
+    QCommandLineOption evaluationOption("evaluation",
+        "Graph evaluation: push or pull. Default: [Graph] evaluation_mode of cvdev.ini.", "mode");
+    QCommandLineOption schedulingOption("scheduling",
+        "Input scheduling: immediate or wave. Default: [Graph] scheduling of cvdev.ini.", "mode");
+    QCommandLineOption bufferReuseOption("buffer-reuse",
+        "Release each image output once its last consumer has it, whatever cvdev.ini says.");
+    QCommandLineOption durationOption("duration",
+        "Stop after <seconds>. 0 runs until SIGINT/SIGTERM.", "seconds", "0");
+    QCommandLineOption statsOption("stats",
+        "Write node, executor and arena statistics as JSON to <file> on exit. "
+        "A .csv file receives the per-node metrics table instead.", "file");
+    QCommandLineOption statsIntervalOption("stats-interval",
+        "Also rewrite the statistics file every <seconds>.", "seconds", "0");
+    QCommandLineOption logOption("log",
+        "Write log messages to <file> from a background thread.", "file");
+    QCommandLineOption codecBenchmarkOption("codec-benchmark",
+        "Print payload size and encode/decode time of every image transport codec for <image>, then exit.",
+        "image");
+    QCommandLineOption iterationsOption("iterations",
+        "Frames encoded per codec by --codec-benchmark, frames sent by --chunk-loopback, "
+        "loads by --startup-benchmark, or hundred thousands of items or calls per case "
+        "by --queue-benchmark and --log-benchmark.", "count", "20");
+    QCommandLineOption chunkLoopbackOption("chunk-loopback",
+        "Send frames of <bytes> through an in-process lossy link with the [FrameChunking] settings, "
+        "print delivered/expired counts, then exit.",
+        "bytes");
+    QCommandLineOption dropRateOption("drop-rate",
+        "Probability that --chunk-loopback loses a chunk or a NACK.", "rate", "0.01");
+    QCommandLineOption linkRateOption("link-rate",
+        "Simulated --chunk-loopback link rate in MB/s.", "MBps", "1250");
+    QCommandLineOption retransmitOption("retransmit",
+        "Enable NACK retransmission in --chunk-loopback, whatever cvdev.ini says.");
+    QCommandLineOption startupBenchmarkOption("startup-benchmark",
+        "Load the flow --iterations times, print the mean startup time and the time spent "
+        "building its execution plan, then exit.");
+    QCommandLineOption queueBenchmarkOption("queue-benchmark",
+        "Print the throughput of PBAsyncQueue, PBMpscQueue and PBSpscQueue with 1, 2 and 8 producers, then exit.");
+    QCommandLineOption logBenchmarkOption("log-benchmark",
+        "Print the cost of DEBUG_LOG_INFO() enabled, disabled and below CVDEV_LOG_MIN_LEVEL, then exit.");
+    parser.addOptions({transportOption, evaluationOption, schedulingOption, bufferReuseOption, durationOption, statsOption, statsIntervalOption, logOption,
+                       codecBenchmarkOption, iterationsOption, chunkLoopbackOption, dropRateOption,
+                       linkRateOption, retransmitOption, startupBenchmarkOption, queueBenchmarkOption,
+                       logBenchmarkOption});
+    parser.process(app);
+
+    if (parser.isSet(codecBenchmarkOption))
+    {
+        bool ok = false;
+        const int iterations = parser.value(iterationsOption).toInt(&ok);
+        if (!ok || iterations <= 0)
+        {
+            std::fprintf(stderr, "cvdev-run: invalid --iterations\n");
+            return 2;
+        }
+        return runCodecBenchmark(parser.value(codecBenchmarkOption), iterations);
+    }
+
+    if (parser.isSet(queueBenchmarkOption))
+    {
+        bool ok = false;
+        const int iterations = parser.value(iterationsOption).toInt(&ok);
+        if (!ok || iterations <= 0 || iterations > 100000)
+        {
+            std::fprintf(stderr, "cvdev-run: invalid --iterations\n");
+            return 2;
+        }
+        return runQueueBenchmark(static_cast<size_t>(iterations) * 100000);
+    }
+
+    if (parser.isSet(logBenchmarkOption))
+    {
+        bool ok = false;
+        const int iterations = parser.value(iterationsOption).toInt(&ok);
+        if (!ok || iterations <= 0 || iterations > 20000)
+        {
+            std::fprintf(stderr, "cvdev-run: invalid --iterations\n");
+            return 2;
+        }
+        return runLogBenchmark(iterations * 100000);
+    }
+
+    if (parser.isSet(chunkLoopbackOption))
+    {
+        bool ok = false;
+        const qlonglong payloadBytes = parser.value(chunkLoopbackOption).toLongLong(&ok);
+        if (!ok || payloadBytes < 16 || payloadBytes > PBFrameReassembler::MaxFrameBytes)
+        {
+            std::fprintf(stderr, "cvdev-run: invalid --chunk-loopback size\n");
+            return 2;
+        }
+        const int frames = parser.value(iterationsOption).toInt(&ok);
+        if (!ok || frames <= 0)
+        {
+            std::fprintf(stderr, "cvdev-run: invalid --iterations\n");
+            return 2;
+        }
+
+        FrameLoopbackConfig config;
+        config.dropRate = parser.value(dropRateOption).toDouble(&ok);
+        if (!ok || config.dropRate < 0.0 || config.dropRate > 1.0)
+        {
+            std::fprintf(stderr, "cvdev-run: invalid --drop-rate\n");
+            return 2;
+        }
+        config.linkMBps = parser.value(linkRateOption).toDouble(&ok);
+        if (!ok || config.linkMBps <= 0.0)
+        {
+            std::fprintf(stderr, "cvdev-run: invalid --link-rate\n");
+            return 2;
+        }
+
+        // The same settings the bridges use; the threshold does not apply here
+        QSettings settings(CVDev::cvdevIniPath(), QSettings::IniFormat);
+        settings.beginGroup("FrameChunking");
+        config.chunking.chunkBytes = static_cast<size_t>(
+            qBound(1024LL, settings.value("chunk_bytes", 60000).toLongLong(), 16LL << 20));
+        config.chunking.deadlineMs = qBound(1, settings.value("deadline_ms", 100).toInt(), 65535);
+        config.chunking.retransmit = settings.value("retransmit", false).toBool() || parser.isSet(retransmitOption);
+        config.chunking.retransmitFrames = qMax(1, settings.value("retransmit_frames", 2).toInt());
+        settings.endGroup();
+
+        return runChunkLoopback(config, static_cast<size_t>(payloadBytes), frames);
+    }
+
+    const QStringList positional = parser.positionalArguments();
+    if (positional.size() != 1)
+    {
+        std::fprintf(stderr, "cvdev-run: exactly one flow file is required\n");
+        return 2;
+    }
+    const QString flowFile = QFileInfo(positional.first()).absoluteFilePath();
+
+    bool ok = false;
+    const double duration = parser.value(durationOption).toDouble(&ok);
+    if (!ok || duration < 0)
+    {
+        std::fprintf(stderr, "cvdev-run: invalid --duration\n");
+        return 2;
+    }
+    const double statsInterval = parser.value(statsIntervalOption).toDouble(&ok);
+    if (!ok || statsInterval < 0)
+    {
+        std::fprintf(stderr, "cvdev-run: invalid --stats-interval\n");
+        return 2;
+    }
+
+    if (parser.isSet(logOption) && !DebugLogSink::instance().start(parser.value(logOption)))
+    {
+        std::fprintf(stderr, "cvdev-run: could not open log file\n");
+        return 1;
+    }
+
+    QSettings settings(CVDev::cvdevIniPath(), QSettings::IniFormat);
+
+    QString transportSetting = settings.value("transport_mode", QString::fromLatin1(kTransportModeQtOnly)).toString();
+    if (parser.isSet(transportOption))
+    {
+        transportSetting = parser.value(transportOption);
+        if (transportSetting != QLatin1String(kTransportModeQtOnly) &&
+            transportSetting != QLatin1String(kTransportModeZenohOnly) &&
+            transportSetting != QLatin1String(kTransportModeCycloneDDSOnly) &&
+            transportSetting != QLatin1String(kTransportModeSharedMemoryOnly))
+        {
+            std::fprintf(stderr, "cvdev-run: unknown transport mode '%s'\n", qPrintable(transportSetting));
+            return 2;
+        }
+    }
+    const TransportMode requestedMode = TransportModeManager::transportModeFromSetting(transportSetting);
+
+    QString evaluationSetting = settings.value("Graph/evaluation_mode", QStringLiteral("push")).toString();
+    if (parser.isSet(evaluationOption))
+    {
+        evaluationSetting = parser.value(evaluationOption);
+        if (evaluationSetting != QLatin1String("push") && evaluationSetting != QLatin1String("pull"))
+        {
+            std::fprintf(stderr, "cvdev-run: unknown evaluation mode '%s'\n", qPrintable(evaluationSetting));
+            return 2;
+        }
+    }
+
+    QString schedulingSetting = settings.value("Graph/scheduling", QStringLiteral("immediate")).toString();
+    if (parser.isSet(schedulingOption))
+    {
+        schedulingSetting = parser.value(schedulingOption);
+        if (schedulingSetting != QLatin1String("immediate") && schedulingSetting != QLatin1String("wave"))
+        {
+            std::fprintf(stderr, "cvdev-run: unknown scheduling '%s'\n", qPrintable(schedulingSetting));
+            return 2;
+        }
+    }
+    TransportModeManager::instance().setTransportMode(requestedMode);
+
+    settings.beginGroup("Executor");
+    ExecutorConfig executorConfig;
+    executorConfig.workerCount = settings.value("worker_threads", 0).toInt();
+    executorConfig.pinThreads = settings.value("pin_threads", false).toBool();
+    executorConfig.numaAware = settings.value("numa_aware", true).toBool();
+    settings.endGroup();
+    PBWorkerExecutor::instance().configure(executorConfig);
+
+    if (PBTransportRouter::initializeBridges(settings) != requestedMode)
+    {
+        // An explicitly requested transport must not silently degrade to Qt.
+        std::fprintf(stderr, "cvdev-run: transport '%s' is not available\n", qPrintable(transportSetting));
+        PBTransportRouter::shutdownBridges();
+        return 1;
+    }
+
+    // Must be set before the registry instantiates any delegate.
+    PBNodeDelegateModel::setHeadlessMode(true);
+
+    auto registry = std::make_shared<QtNodes::NodeDelegateModelRegistry>();
+    QList<QPluginLoader *> pluginsList;
+    PluginInterfaceUtils::load_plugins(registry, pluginsList);
+
+    if (parser.isSet(startupBenchmarkOption))
+    {
+        const int iterations = parser.value(iterationsOption).toInt(&ok);
+        int exitCode = 2;
+        if (!ok || iterations <= 0)
+            std::fprintf(stderr, "cvdev-run: invalid --iterations\n");
+        else
+            exitCode = runStartupBenchmark(registry, flowFile, iterations);
+        PBTransportRouter::shutdownBridges();
+        PBWorkerExecutor::instance().shutdown();
+        return exitCode;
+    }
+
+    auto *model = new PBDataFlowGraphModel(registry);
+    model->setEvaluationMode(PBDataFlowGraphModel::evaluationModeFromSetting(evaluationSetting));
+    model->setScheduling(PBDataFlowGraphModel::schedulingFromSetting(schedulingSetting));
+    model->setBufferReuseEnabled(settings.value("Graph/buffer_reuse", false).toBool() || parser.isSet(bufferReuseOption));
+    PBTransportRouter router;
+    router.attachModel(model);
+
+    if (!model->load_from_file(flowFile))
+    {
+        std::fprintf(stderr, "cvdev-run: could not load %s\n", qPrintable(flowFile));
+        for (const QString &error : model->loadErrors())
+            std::fprintf(stderr, "  %s\n", qPrintable(error));
+        router.detachModel(model);
+        delete model;
+        PBTransportRouter::shutdownBridges();
+        PBWorkerExecutor::instance().shutdown();
+        return 1;
+    }
+
+    std::signal(SIGINT, requestStop);
+    std::signal(SIGTERM, requestStop);
+
+    QElapsedTimer elapsed;
+    elapsed.start();
+
+    // Signal handlers may only touch the flag; the event loop polls it.
+    QTimer stopPoll;
+    QObject::connect(&stopPoll, &QTimer::timeout, &app, [&app]() {
+        if (gbStopRequested.load())
+            app.quit();
+    });
+    stopPoll.start(200);
+
+    if (duration > 0)
+        QTimer::singleShot(static_cast<int>(duration * 1000), &app, &QCoreApplication::quit);
+
+    const QString statsFile = parser.value(statsOption);
+    QTimer statsTimer;
+    if (!statsFile.isEmpty() && statsInterval > 0)
+    {
+        QObject::connect(&statsTimer, &QTimer::timeout, &app, [&]() {
+            writeStats(statsFile, model, elapsed.elapsed());
+        });
+        statsTimer.start(static_cast<int>(statsInterval * 1000));
+    }
+
+    const int result = app.exec();
+
+    statsTimer.stop();
+    int exitCode = result;
+
+    const QJsonObject bufferReport = model->bufferReport();
+    std::printf("peak resident image memory: %.1f MB in %d frames without buffer reuse, %.1f MB in %d frames this run "
+                "(reuse %s, %d of %d outputs releasable), %.1f MB in %d frames in theory\n",
+                bufferReport["peak_bytes_before"].toDouble() / (1024.0 * 1024.0),
+                bufferReport["peak_frames_before"].toInt(),
+                bufferReport["peak_bytes_after"].toDouble() / (1024.0 * 1024.0),
+                bufferReport["peak_frames_after"].toInt(),
+                bufferReport["reuse"].toBool() ? "on" : "off",
+                bufferReport["releasable_outputs"].toInt(),
+                bufferReport["image_outputs"].toInt(),
+                bufferReport["peak_bytes_planned"].toDouble() / (1024.0 * 1024.0),
+                bufferReport["peak_frames_planned"].toInt());
+    std::printf("measured arena peak: %.1f MB\n",
+                bufferReport["arena_peak_bytes_in_use"].toDouble() / (1024.0 * 1024.0));
+    if (!statsFile.isEmpty() && !writeStats(statsFile, model, elapsed.elapsed()))
+    {
+        std::fprintf(stderr, "cvdev-run: could not write %s\n", qPrintable(statsFile));
+        exitCode = 1;
+    }
+
+    router.detachModel(model);
+    delete model;
+    PBTransportRouter::shutdownBridges();
+    PBWorkerExecutor::instance().shutdown();
+    DebugLogSink::instance().stop();
+    return exitCode;
+}